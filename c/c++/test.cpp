@@ -9,43 +9,7 @@
 #include <cstdint>
 #include <random>
 
-namespace simplerandom {
-
-class SHR3
-{
-private:
-    uint32_t shr3;
-public:
-    typedef uint32_t result_type;
-
-    SHR3(uint32_t seed1 = 0xFFFFFFFF)
-    {
-        seed(seed1);
-    }
-    void seed(uint32_t seed1)
-    {
-        if (seed1 == 0)
-            seed1 = 0xFFFFFFFF;
-        shr3 = seed1;
-    }
-    uint32_t operator()()
-    {
-        shr3 ^= (shr3 << 13);
-        shr3 ^= (shr3 >> 17);
-        shr3 ^= (shr3 << 5);
-        return shr3;
-    }
-    uint32_t min() const
-    {
-        return 1;
-    }
-    uint32_t max() const
-    {
-        return 0xFFFFFFFFu;
-    }
-};
-
-};
+#include "simplerandom-cpp.h"
 
 int main()
 {
@@ -74,11 +74,18 @@
 
 #include <string.h>
 
+#ifdef SIMPLERANDOM_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 
 /*****************************************************************************
  * Typedefs
  ****************************************************************************/
 
+typedef uint32_t (*BitColumnMatrix32MulUint32Fn_t)(const BitColumnMatrix32_t * p_left, uint32_t right);
+typedef void (*BitColumnMatrix32IMulFn_t)(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right);
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -193,24 +200,280 @@ void bitcolumnmatrix32_iadd(BitColumnMatrix32_t * p_left, const BitColumnMatrix3
     }
 }
 
+/*********
+ * Multiplication kernels
+ *
+ * There are several implementations of matrix-vector and matrix-matrix
+ * multiplication. The fastest one that the CPU supports is chosen once at
+ * run-time, by choose_kernels().
+ ********/
+
+/* Multiply a matrix with a vector -- portable version.
+ * Each bit of the vector selects a column via a mask, rather than a branch,
+ * so the time taken doesn't depend on the data.
+ */
+uint32_t bitcolumnmatrix32_mul_uint32_generic(const BitColumnMatrix32_t * p_left, uint32_t right)
+{
+    size_t      i;
+    uint32_t    result;
+
+    result = 0;
+    for (i = 0; i < 32u; i++)
+    {
+        result ^= p_left->matrix[i] & (0u - (right & 1u));
+        right >>= 1u;
+    }
+    return result;
+}
+
+/* Multiply two matrices -- portable version, using the "Method of Four
+ * Russians".
+ * The left matrix's columns are split into 8 groups of 4. For each group, a
+ * 16-entry table is made of the sums of all combinations of the 4 columns.
+ * Then each column of the result needs only 8 table look-ups, indexed by the
+ * 4-bit nibbles of the right matrix's column.
+ * Groups of 4 rather than 8 keep the cost of making the tables small, which
+ * matters because each table is only used for 32 look-ups.
+ */
+void bitcolumnmatrix32_imul_four_russians(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right)
+{
+    uint32_t            table[8u][16u];
+    BitColumnMatrix32_t matrix_result;
+    uint32_t            column;
+    uint32_t            value;
+    uint32_t            result;
+    size_t              i;
+    size_t              j;
+    size_t              k;
+
+    for (j = 0; j < 8u; j++)
+    {
+        table[j][0] = 0;
+        for (k = 0; k < 4u; k++)
+        {
+            column = p_left->matrix[4u * j + k];
+            for (i = 0; i < (1u << k); i++)
+            {
+                table[j][(1u << k) + i] = table[j][i] ^ column;
+            }
+        }
+    }
+
+    for (i = 0; i < 32u; i++)
+    {
+        value = p_right->matrix[i];
+        result = 0;
+        for (j = 0; j < 8u; j++)
+        {
+            result ^= table[j][value & 0xFu];
+            value >>= 4u;
+        }
+        matrix_result.matrix[i] = result;
+    }
+
+    /* Copy result to left matrix */
+    memcpy(p_left, &matrix_result, sizeof(*p_left));
+}
+
+#ifdef SIMPLERANDOM_X86_KERNELS
+
+/* Multiply a matrix with a vector -- AVX2 version.
+ * Each of the 32 columns is masked by its bit of the vector, 8 columns at a
+ * time, then the 8 lanes are summed.
+ */
+__attribute__((target("avx2")))
+uint32_t bitcolumnmatrix32_mul_uint32_avx2(const BitColumnMatrix32_t * p_left, uint32_t right)
+{
+    __m256i     vector;
+    __m256i     shift;
+    __m256i     mask;
+    __m256i     sum;
+    __m128i     sum128;
+    size_t      i;
+
+    vector = _mm256_set1_epi32((int32_t)right);
+    /* Shift bit i of the vector up to bit 31, then copy it to all bits. */
+    shift = _mm256_setr_epi32(31, 30, 29, 28, 27, 26, 25, 24);
+    sum = _mm256_setzero_si256();
+    for (i = 0; i < 32u; i += 8u)
+    {
+        mask = _mm256_srai_epi32(_mm256_sllv_epi32(vector, shift), 31);
+        sum = _mm256_xor_si256(sum, _mm256_and_si256(mask, _mm256_loadu_si256((const __m256i *)&p_left->matrix[i])));
+        shift = _mm256_sub_epi32(shift, _mm256_set1_epi32(8));
+    }
+    sum128 = _mm_xor_si128(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    sum128 = _mm_xor_si128(sum128, _mm_shuffle_epi32(sum128, 0x4E));
+    sum128 = _mm_xor_si128(sum128, _mm_shuffle_epi32(sum128, 0xB1));
+    return (uint32_t)_mm_cvtsi128_si32(sum128);
+}
+
+/* Multiply two matrices -- AVX2 version.
+ * This makes 8 result columns at a time. Bit j of each of 8 right columns
+ * selects whether column j of the left matrix is added into that result
+ * column.
+ */
+__attribute__((target("avx2")))
+void bitcolumnmatrix32_imul_avx2(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right)
+{
+    __m256i     right[4u];
+    __m256i     result[4u];
+    __m256i     left_column;
+    __m256i     mask;
+    size_t      i;
+    size_t      j;
+
+    for (i = 0; i < 4u; i++)
+    {
+        right[i] = _mm256_loadu_si256((const __m256i *)&p_right->matrix[8u * i]);
+        result[i] = _mm256_setzero_si256();
+    }
+    for (j = 0; j < 32u; j++)
+    {
+        left_column = _mm256_set1_epi32((int32_t)p_left->matrix[j]);
+        for (i = 0; i < 4u; i++)
+        {
+            /* Shift bit j up to bit 31, then copy it to all bits. */
+            mask = _mm256_srai_epi32(_mm256_sll_epi32(right[i], _mm_cvtsi32_si128(31 - (int)j)), 31);
+            result[i] = _mm256_xor_si256(result[i], _mm256_and_si256(mask, left_column));
+        }
+    }
+    for (i = 0; i < 4u; i++)
+    {
+        _mm256_storeu_si256((__m256i *)&p_left->matrix[8u * i], result[i]);
+    }
+}
+
+/* Transpose 4 vectors of 4 64-bit values each, as a 4x4 matrix. */
+#define TRANSPOSE_4X4_EPI64(V0, V1, V2, V3)                                     \
+    do {                                                                    \
+        __m256i t0, t1, t2, t3;                                             \
+        t0 = _mm256_unpacklo_epi64((V0), (V1));                             \
+        t1 = _mm256_unpackhi_epi64((V0), (V1));                             \
+        t2 = _mm256_unpacklo_epi64((V2), (V3));                             \
+        t3 = _mm256_unpackhi_epi64((V2), (V3));                             \
+        (V0) = _mm256_permute2x128_si256(t0, t2, 0x20);                     \
+        (V1) = _mm256_permute2x128_si256(t1, t3, 0x20);                     \
+        (V2) = _mm256_permute2x128_si256(t0, t2, 0x31);                     \
+        (V3) = _mm256_permute2x128_si256(t1, t3, 0x31);                     \
+    } while (0)
+
+#ifdef SIMPLERANDOM_X86_GFNI
+
+/* Multiply two matrices -- GFNI version.
+ * The 32x32 matrices are treated as 4x4 blocks of 8x8 bit matrices. The
+ * GF2P8AFFINEQB instruction multiplies 8x8 bit matrices by bytes, so that
+ * byte I of all 32 result columns is:
+ *     sum over J of: block (I, J) of left * byte J of the right columns
+ * which is 16 instructions for the whole multiplication.
+ */
+__attribute__((target("avx2,gfni")))
+void bitcolumnmatrix32_imul_gfni(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right)
+{
+    uint64_t    blocks[4u][4u];
+    __m256i     bytes[4u];
+    __m256i     result[4u];
+    __m256i     byte_transpose;
+    __m256i     dword_interleave;
+    __m256i     dword_deinterleave;
+    __m256i     reverse_select;
+    __m256i     block_bits;
+    __m256i     value;
+    size_t      i;
+    size_t      j;
+
+    /* Within each 128-bit lane, transpose 4 dwords as a 4x4 matrix of bytes. */
+    byte_transpose = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                      0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    dword_interleave = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    dword_deinterleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    /* Make the 8x8 blocks of the left matrix, in the form that
+     * GF2P8AFFINEQB needs: byte (7 - b) holds row b of the block.
+     * First gather byte I of columns 8J+7 down to 8J+0 into 64-bit value I.
+     * Then transpose those bits, by GF2P8AFFINEQB on constant bytes that
+     * select one bit each. */
+    reverse_select = _mm256_set1_epi64x((int64_t)UINT64_C(0x0102040810204080));
+    for (j = 0; j < 4u; j++)
+    {
+        value = _mm256_loadu_si256((const __m256i *)&p_left->matrix[8u * j]);
+        value = _mm256_shuffle_epi8(value,
+                                    _mm256_setr_epi8(12, 8, 4, 0, 13, 9, 5, 1, 14, 10, 6, 2, 15, 11, 7, 3,
+                                                     12, 8, 4, 0, 13, 9, 5, 1, 14, 10, 6, 2, 15, 11, 7, 3));
+        value = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(4, 0, 5, 1, 6, 2, 7, 3));
+        block_bits = _mm256_gf2p8affine_epi64_epi8(reverse_select, value, 0);
+        _mm256_storeu_si256((__m256i *)blocks[j], block_bits);
+    }
+
+    /* bytes[J] = byte J of all 32 right columns. */
+    for (j = 0; j < 4u; j++)
+    {
+        value = _mm256_loadu_si256((const __m256i *)&p_right->matrix[8u * j]);
+        value = _mm256_shuffle_epi8(value, byte_transpose);
+        bytes[j] = _mm256_permutevar8x32_epi32(value, dword_interleave);
+    }
+    TRANSPOSE_4X4_EPI64(bytes[0], bytes[1], bytes[2], bytes[3]);
+
+    /* result[I] = byte I of all 32 result columns. */
+    for (i = 0; i < 4u; i++)
+    {
+        result[i] = _mm256_setzero_si256();
+        for (j = 0; j < 4u; j++)
+        {
+            block_bits = _mm256_set1_epi64x((int64_t)blocks[j][i]);
+            result[i] = _mm256_xor_si256(result[i], _mm256_gf2p8affine_epi64_epi8(bytes[j], block_bits, 0));
+        }
+    }
+
+    /* Put the result bytes back into columns. This reverses the steps used to
+     * make bytes[] above. */
+    TRANSPOSE_4X4_EPI64(result[0], result[1], result[2], result[3]);
+    for (j = 0; j < 4u; j++)
+    {
+        value = _mm256_permutevar8x32_epi32(result[j], dword_deinterleave);
+        value = _mm256_shuffle_epi8(value, byte_transpose);
+        _mm256_storeu_si256((__m256i *)&p_left->matrix[8u * j], value);
+    }
+}
+
+#endif /* defined(SIMPLERANDOM_X86_GFNI) */
+
+#endif /* defined(SIMPLERANDOM_X86_KERNELS) */
+
+/* The kernels used by the functions below. */
+static BitColumnMatrix32MulUint32Fn_t   mul_uint32_kernel = bitcolumnmatrix32_mul_uint32_generic;
+static BitColumnMatrix32IMulFn_t        imul_kernel = bitcolumnmatrix32_imul_four_russians;
+
+#ifdef SIMPLERANDOM_X86_KERNELS
+
+CPU_FEATURES_INIT
+static void choose_kernels(void)
+{
+    cpu_features_init();
+    if (cpu_has_avx2())
+    {
+        mul_uint32_kernel = bitcolumnmatrix32_mul_uint32_avx2;
+        imul_kernel = bitcolumnmatrix32_imul_avx2;
+    }
+#ifdef SIMPLERANDOM_X86_GFNI
+    if (cpu_has_gfni())
+        imul_kernel = bitcolumnmatrix32_imul_gfni;
+#endif
+}
+
+#endif /* defined(SIMPLERANDOM_X86_KERNELS) */
+
 /* Multiply a matrix with a vector, resulting in a vector result.
  * The input and result vectors are represented by a uint32_t value.
  * That is to say, result_vector = left_matrix * right_vector.
  */
 uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right)
 {
-    size_t      i;
     uint32_t    result;
 
     result = 0;
     if (p_left != NULL)
     {
-        for (i = 0; i < 32u; i++)
-        {
-            if (right & 1u)
-                result ^= p_left->matrix[i];
-            right >>= 1u;
-        }
+        result = mul_uint32_kernel(p_left, right);
     }
     return result;
 }
@@ -220,18 +483,9 @@ uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32
  */
 void bitcolumnmatrix32_imul(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right)
 {
-    BitColumnMatrix32_t matrix_result;
-    size_t              i;
-
     if (p_left != NULL && p_right != NULL)
     {
-        for (i = 0; i < 32u; i++)
-        {
-            matrix_result.matrix[i] = bitcolumnmatrix32_mul_uint32(p_left, p_right->matrix[i]);
-        }
-
-        /* Copy result to left matrix */
-        memcpy(p_left, &matrix_result, sizeof(*p_left));
+        imul_kernel(p_left, p_right);
     }
 }
 
@@ -240,8 +494,8 @@ void bitcolumnmatrix32_imul(BitColumnMatrix32_t * p_left, const BitColumnMatrix3
  */
 void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_result, const BitColumnMatrix32_t * p_matrix, uintmax_t n)
 {
-    BitColumnMatrix32_t matrix_result;
-    BitColumnMatrix32_t matrix_exp;
+    BitColumnMatrix32_t         matrix_result;
+    BitColumnMatrix32_t         matrix_exp;
 
     if (p_result != NULL && p_matrix != NULL)
     {
@@ -252,15 +506,138 @@ void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_result, const BitColumnMatrix
         {
             if (n & 1u)
             {
-                bitcolumnmatrix32_imul(&matrix_result, &matrix_exp);
+                imul_kernel(&matrix_result, &matrix_exp);
             }
             n >>= 1;
             if (n == 0)
                 break;
-            bitcolumnmatrix32_imul(&matrix_exp, &matrix_exp);
+            imul_kernel(&matrix_exp, &matrix_exp);
+        }
+        /* Copy result to result matrix */
+        memcpy(p_result, &matrix_result, sizeof(*p_result));
+    }
+}
+
+/* Raise a matrix to the power of 'n', given a table of that matrix raised to
+ * the powers of 2: p_jump_table[k] = matrix^(2^k), for k = 0 .. table_len-1.
+ * This needs one matrix-matrix multiplication per set bit of 'n' after the
+ * first, and none if 'n' is a power of 2 within the table.
+ */
+void bitcolumnmatrix32_jump_matrix(BitColumnMatrix32_t * p_result, const BitColumnMatrix32_t * p_jump_table, size_t table_len, uintmax_t n)
+{
+    BitColumnMatrix32_t         matrix_result;
+    BitColumnMatrix32_t         matrix_exp;
+    bool                        is_unity;
+    size_t                      i;
+
+    if (p_result != NULL && p_jump_table != NULL && table_len != 0)
+    {
+        bitcolumnmatrix32_unity(&matrix_result);
+        is_unity = true;
+        for (i = 0; i < table_len && n != 0; i++)
+        {
+            if (n & 1u)
+            {
+                if (is_unity)
+                    memcpy(&matrix_result, &p_jump_table[i], sizeof(matrix_result));
+                else
+                    imul_kernel(&matrix_result, &p_jump_table[i]);
+                is_unity = false;
+            }
+            n >>= 1;
+        }
+        if (n != 0)
+        {
+            /* 'n' is beyond the range of the table, so continue with
+             * "exponentiation by squaring" from the last table entry. */
+            memcpy(&matrix_exp, &p_jump_table[table_len - 1u], sizeof(matrix_exp));
+            do
+            {
+                imul_kernel(&matrix_exp, &matrix_exp);
+                if (n & 1u)
+                {
+                    imul_kernel(&matrix_result, &matrix_exp);
+                }
+                n >>= 1;
+            } while (n != 0);
         }
         /* Copy result to result matrix */
         memcpy(p_result, &matrix_result, sizeof(*p_result));
     }
 }
 
+/* Multiply a vector by a matrix raised to the power of 'n', given a table of
+ * that matrix raised to the powers of 2: p_jump_table[k] = matrix^(2^k), for
+ * k = 0 .. table_len-1.
+ * That is to say, result_vector = pow(matrix, n) * right_vector.
+ * This needs only one matrix-vector multiplication per set bit of 'n', and no
+ * matrix-matrix multiplications, as long as 'n' < 2^table_len.
+ */
+uint32_t bitcolumnmatrix32_jump_uint32(const BitColumnMatrix32_t * p_jump_table, size_t table_len, uint32_t right, uintmax_t n)
+{
+    BitColumnMatrix32_t             matrix_exp;
+    size_t                          i;
+
+    if (p_jump_table != NULL && table_len != 0)
+    {
+        for (i = 0; i < table_len && n != 0; i++)
+        {
+            if (n & 1u)
+            {
+                right = mul_uint32_kernel(&p_jump_table[i], right);
+            }
+            n >>= 1;
+        }
+        if (n != 0)
+        {
+            /* 'n' is beyond the range of the table, so continue with
+             * "exponentiation by squaring" from the last table entry. */
+            memcpy(&matrix_exp, &p_jump_table[table_len - 1u], sizeof(matrix_exp));
+            do
+            {
+                bitcolumnmatrix32_imul(&matrix_exp, &matrix_exp);
+                if (n & 1u)
+                {
+                    right = mul_uint32_kernel(&matrix_exp, right);
+                }
+                n >>= 1;
+            } while (n != 0);
+        }
+    }
+    return right;
+}
+
+/* Rank of a matrix, 0 to 32, by Gaussian elimination on the columns.
+ * Each non-zero column is a pivot. Its lowest set bit is cleared from all the
+ * later columns, so the pivots have distinct lowest set bits, and so are
+ * linearly independent.
+ */
+uint_fast8_t bitcolumnmatrix32_rank(const BitColumnMatrix32_t * p_matrix)
+{
+    uint32_t        columns[32u];
+    uint32_t        pivot;
+    uint32_t        low_bit;
+    size_t          i;
+    size_t          j;
+    uint_fast8_t    rank;
+
+    rank = 0;
+    if (p_matrix != NULL)
+    {
+        memcpy(columns, p_matrix->matrix, sizeof(columns));
+        for (i = 0; i < 32u; i++)
+        {
+            pivot = columns[i];
+            if (pivot != 0)
+            {
+                rank++;
+                low_bit = pivot & (~pivot + 1u);
+                for (j = i + 1u; j < 32u; j++)
+                {
+                    columns[j] ^= pivot & (0u - ((columns[j] & low_bit) != 0));
+                }
+            }
+        }
+    }
+    return rank;
+}
@@ -78,6 +78,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "cpufeatures.h"
+
 
 /*****************************************************************************
  * Typedefs
@@ -105,6 +107,23 @@ void bitcolumnmatrix32_iadd(BitColumnMatrix32_t * p_left, const BitColumnMatrix3
 void bitcolumnmatrix32_imul(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right);
 uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right);
 void bitcolumnmatrix32_pow(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_matrix, uintmax_t n);
+void bitcolumnmatrix32_jump_matrix(BitColumnMatrix32_t * p_result, const BitColumnMatrix32_t * p_jump_table, size_t table_len, uintmax_t n);
+uint32_t bitcolumnmatrix32_jump_uint32(const BitColumnMatrix32_t * p_jump_table, size_t table_len, uint32_t right, uintmax_t n);
+uint_fast8_t bitcolumnmatrix32_rank(const BitColumnMatrix32_t * p_matrix);
+
+/* Multiplication kernels. The functions above choose the fastest of these
+ * that the CPU supports. They are declared here so they can be tested
+ * separately. The _avx2 and _gfni versions must only be called if
+ * cpu_has_avx2() or cpu_has_gfni() respectively is true. */
+uint32_t bitcolumnmatrix32_mul_uint32_generic(const BitColumnMatrix32_t * p_left, uint32_t right);
+void bitcolumnmatrix32_imul_four_russians(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right);
+#ifdef SIMPLERANDOM_X86_KERNELS
+uint32_t bitcolumnmatrix32_mul_uint32_avx2(const BitColumnMatrix32_t * p_left, uint32_t right);
+void bitcolumnmatrix32_imul_avx2(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right);
+#endif
+#ifdef SIMPLERANDOM_X86_GFNI
+void bitcolumnmatrix32_imul_gfni(BitColumnMatrix32_t * p_left, const BitColumnMatrix32_t * p_right);
+#endif
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,105 @@
+/*
+ * cpufeatures.h
+ *
+ * Run-time detection of optional CPU instruction set extensions. This lets
+ * the library pick a faster implementation of a function where the CPU
+ * supports it, while still building and running on any CPU.
+ *
+ * SIMPLERANDOM_X86_KERNELS is defined where the compiler can build functions
+ * for x86 instruction set extensions (via the 'target' function attribute)
+ * and detect them at run-time. Otherwise, all the cpu_has_*() functions
+ * return false.
+ *
+ * The kernels are chosen once, when the program or library is loaded, by a
+ * CPU_FEATURES_INIT function in each source file that has them. The
+ * functions then call the chosen kernels through function pointers.
+ */
+#ifndef _SIMPLERANDOM_CPUFEATURES_H
+#define _SIMPLERANDOM_CPUFEATURES_H
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <stdbool.h>
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* The 'target' attribute with the AVX2 and AVX-512 intrinsics, and
+ * __builtin_cpu_supports() of "avx2" and "avx512f", need GCC 5 or clang 4.
+ * clang also defines __GNUC__, as 4. */
+#if (defined(__clang__) ? (__clang_major__ >= 4) : (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SIMPLERANDOM_X86_KERNELS    1
+
+/* __builtin_cpu_supports() only knows "gfni" from GCC 11 and clang 16. With
+ * older compilers, the GFNI kernel isn't built, and AVX2 is used instead. */
+#if defined(__clang__) ? (__clang_major__ >= 16) : (__GNUC__ >= 11)
+#define SIMPLERANDOM_X86_GFNI       1
+#endif
+
+/* Mark a function that chooses kernels, to run once when the program or
+ * library is loaded, before main(). It must call cpu_features_init() before
+ * any cpu_has_*() function. Until it runs, the kernels are the portable
+ * versions, so a call from another constructor still gets the right result. */
+#define CPU_FEATURES_INIT           __attribute__((constructor))
+#endif
+
+
+/*****************************************************************************
+ * Inline functions
+ ****************************************************************************/
+
+#ifdef SIMPLERANDOM_X86_KERNELS
+
+/* The CPU model is read by the compiler's run-time library before main(),
+ * but a constructor may run before that, so it must read it itself. */
+static inline void cpu_features_init(void)
+{
+    __builtin_cpu_init();
+}
+
+static inline bool cpu_has_avx2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+static inline bool cpu_has_gfni(void)
+{
+#ifdef SIMPLERANDOM_X86_GFNI
+    return __builtin_cpu_supports("gfni") && __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+static inline bool cpu_has_avx512f(void)
+{
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2");
+}
+
+#else /* !defined(SIMPLERANDOM_X86_KERNELS) */
+
+static inline bool cpu_has_avx2(void)
+{
+    return false;
+}
+
+static inline bool cpu_has_gfni(void)
+{
+    return false;
+}
+
+static inline bool cpu_has_avx512f(void)
+{
+    return false;
+}
+
+#endif /* defined(SIMPLERANDOM_X86_KERNELS) */
+
+
+#endif /* !defined(_SIMPLERANDOM_CPUFEATURES_H) */
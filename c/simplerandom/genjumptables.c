@@ -0,0 +1,203 @@
+/*
+ * genjumptables.c
+ *
+ * Generate jumptables.c, the "jump" tables for the discard functions. It
+ * writes the C source to stdout.
+ *
+ * jumptables.c is committed, so that tarball and cross builds don't need to
+ * run a program at build time. After changing this file, run
+ * "make update-jumptables" to regenerate it. "make check" fails if the
+ * committed file differs from this program's output (see
+ * tests/check_jumptables).
+ *
+ * The matrix tables are calculated from the generators' parameters in
+ * matrix_specs[] in matrixspecs.c, so that adding a jump table for another
+ * xorshift or LFSR generator is a matter of adding a line there, and
+ * declaring the table in jumptables.h. See matrixspecs.h for how each
+ * generator's matrix is made.
+ *
+ * Each table holds matrix^(2^k), for k = 0 .. JUMP_TABLE_LEN-1, found by
+ * squaring.
+ *
+ * The Cong table holds its affine map composed with itself 2^k times, for
+ * k = 0 .. CONG_JUMP_TABLE_LEN-1.
+ *
+ * An LFSR component's matrix is not invertible, because the lower
+ * 'mask_bits' bits of z are never read. But on the states it can reach, it
+ * has period 2^(32 - mask_bits) - 1, so its "previous" matrix, for the prev
+ * functions, is matrix^(period - 1).
+ *
+ * The Montgomery multiplication constants for the MWC moduli are set by
+ * montgomery_uint32_init() and montgomery_uint64_init() from maths.c.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bitcolumnmatrix.h"
+#include "jumptables.h"
+#include "maths.h"
+#include "matrixspecs.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Cong 'next' operation is: cong = CONG_MULT * cong + CONG_ADD */
+#define CONG_MULT       UINT32_C(69069)
+#define CONG_ADD        UINT32_C(12345)
+
+/* MWC multipliers. Each modulus is mult * 2^16 - 1 (or mult * 2^32 - 1 for
+ * MWC64). */
+#define MWC_UPPER_MULT  UINT32_C(36969)
+#define MWC_LOWER_MULT  UINT32_C(18000)
+#define MWC64_MULT      UINT64_C(698769069)
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static void print_cong_jump_table(void)
+{
+    uint32_t    mult;
+    uint32_t    add;
+    size_t      k;
+
+    printf("/* Cong: cong = %" PRIu32 " * cong + %" PRIu32 ";\n", CONG_MULT, CONG_ADD);
+    printf(" * Entry k is the affine map for 2^k steps: cong = mult * cong + add; */\n");
+    printf("const CongJump_t cong_jump_table[CONG_JUMP_TABLE_LEN] =\n{\n");
+    mult = CONG_MULT;
+    add = CONG_ADD;
+    for (k = 0; k < CONG_JUMP_TABLE_LEN; ++k)
+    {
+        printf("    { 0x%08" PRIX32 ", 0x%08" PRIX32 " },     /* 2^%u */\n", mult, add, (unsigned)k);
+        /* mult * (mult * x + add) + add = (mult * mult) * x + (mult * add + add) */
+        add = mult * add + add;
+        mult = mult * mult;
+    }
+    printf("};\n\n");
+}
+
+/* Print the body of one matrix initialiser, at the given indent. */
+static void print_matrix(const BitColumnMatrix32_t * p_matrix, const char * p_indent)
+{
+    size_t      i;
+
+    printf("%s{\n%s    {", p_indent, p_indent);
+    for (i = 0; i < 32u; ++i)
+    {
+        if (!(i % 8))
+            printf("\n%s        ", p_indent);
+        printf("0x%08" PRIX32 ",%s", p_matrix->matrix[i], (i % 8 == 7) ? "" : " ");
+    }
+    printf("\n%s    },\n%s}", p_indent, p_indent);
+}
+
+static void print_matrix_jump_table(const MatrixSpec_t * p_spec)
+{
+    BitColumnMatrix32_t     matrix_exp;
+    BitColumnMatrix32_t     matrix;
+    uintmax_t               period;
+    size_t                  k;
+
+    make_spec_matrix(&matrix_exp, p_spec);
+    if (p_spec->kind == MATRIX_XORSHIFT)
+    {
+        printf("/* %s: xorshift (%d, %d, %d) */\n", p_spec->p_description,
+               (int)p_spec->shifts[0], (int)p_spec->shifts[1], (int)p_spec->shifts[2]);
+    }
+    else
+    {
+        printf("/* %s: LFSR (s1 = %d, s2 = %d, s3 = %d, mask = 0x%08" PRIX32 ") */\n", p_spec->p_description,
+               (int)p_spec->shifts[0], (int)p_spec->shifts[1], (int)p_spec->shifts[2],
+               (uint32_t)(UINT32_C(0xFFFFFFFF) << p_spec->mask_bits));
+    }
+    matrix = matrix_exp;
+    printf("const BitColumnMatrix32_t %s_jump_table[JUMP_TABLE_LEN] =\n{\n", p_spec->p_name);
+    for (k = 0; k < JUMP_TABLE_LEN; ++k)
+    {
+        printf("    /* 2^%u */\n", (unsigned)k);
+        print_matrix(&matrix_exp, "    ");
+        printf(",\n");
+        bitcolumnmatrix32_imul(&matrix_exp, &matrix_exp);
+    }
+    printf("};\n\n");
+
+    if (p_spec->prev_matrix)
+    {
+        period = (UINTMAX_C(1) << (32u - p_spec->mask_bits)) - 1u;
+        bitcolumnmatrix32_pow(&matrix_exp, &matrix, period - 1u);
+        printf("/* %s: previous, matrix^%" PRIuMAX " */\n", p_spec->p_description, period - 1u);
+        printf("const BitColumnMatrix32_t %s_prev_matrix =\n", p_spec->p_name);
+        print_matrix(&matrix_exp, "");
+        printf(";\n\n");
+    }
+}
+
+static void print_montgomery_uint32(const char * p_name, uint32_t mult)
+{
+    MontgomeryUint32_t  mont;
+
+    montgomery_uint32_init(&mont, mult * (UINT32_C(1) << 16u) - 1u);
+    printf("/* Montgomery constants, modulo %" PRIu32 " * 2^16 - 1 */\n", mult);
+    printf("const MontgomeryUint32_t %s =\n{\n", p_name);
+    printf("    0x%08" PRIX32 ", 0x%08" PRIX32 ", 0x%08" PRIX32 ", 0x%08" PRIX32 ",\n",
+           mont.mod, mont.mod_inverse, mont.r_mod, mont.r2_mod);
+    printf("};\n\n");
+}
+
+static void print_montgomery_uint64(const char * p_name, uint64_t mult)
+{
+    MontgomeryUint64_t  mont;
+
+    montgomery_uint64_init(&mont, mult * (UINT64_C(1) << 32u) - 1u);
+    printf("/* Montgomery constants, modulo %" PRIu64 " * 2^32 - 1 */\n", mult);
+    printf("#ifdef UINT64_C\n");
+    printf("const MontgomeryUint64_t %s =\n{\n", p_name);
+    printf("    UINT64_C(0x%016" PRIX64 "), UINT64_C(0x%016" PRIX64 "),\n", mont.mod, mont.mod_inverse);
+    printf("    UINT64_C(0x%016" PRIX64 "), UINT64_C(0x%016" PRIX64 "),\n", mont.r_mod, mont.r2_mod);
+    printf("};\n#endif\n\n");
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(void)
+{
+    size_t      i;
+
+    printf("/*\n"
+           " * jumptables.c\n"
+           " *\n"
+           " * Pre-calculated \"jump\" tables for the discard functions. See jumptables.h.\n"
+           " *\n"
+           " * This file is generated by genjumptables. Do not edit. Run\n"
+           " * \"make update-jumptables\" to regenerate it.\n"
+           " */\n\n"
+           "#include \"jumptables.h\"\n\n");
+
+    print_cong_jump_table();
+    for (i = 0; i < num_matrix_specs; ++i)
+    {
+        if (matrix_specs[i].jump_table)
+            print_matrix_jump_table(&matrix_specs[i]);
+    }
+
+    print_montgomery_uint32("mwc_upper_montgomery", MWC_UPPER_MULT);
+    print_montgomery_uint32("mwc_lower_montgomery", MWC_LOWER_MULT);
+    print_montgomery_uint64("mwc64_montgomery", MWC64_MULT);
+
+    if (fflush(stdout) != 0 || ferror(stdout))
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
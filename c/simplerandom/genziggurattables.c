@@ -0,0 +1,176 @@
+/*
+ * genziggurattables.c
+ *
+ * Generate ziggurattables.c, the tables for the ziggurat method of generating
+ * normal and exponential random values. It writes the C source to stdout.
+ *
+ * ziggurattables.c is committed, as jumptables.c is (see genjumptables.c).
+ * After changing this file, run "make update-ziggurattables" to regenerate
+ * it. "make check" fails if the committed file differs from this program's
+ * output (see tests/check_ziggurattables).
+ *
+ * The tables are calculated as in the paper by Marsaglia and Tsang, but for
+ * 256 layers. Starting from the tail start 'r', each layer edge x[i] is found
+ * from the one below it, such that each layer has area 'v':
+ *     x[i] * (f(x[i]) - f(x[i+1])) = v
+ * where 'v' is the area of the base layer, r * f(r) plus the area of the
+ * tail. The normal tables use 52-bit x values, and the exponential tables
+ * 53-bit. See ziggurattables.h.
+ *
+ * The calculation is done in long double. The committed tables were made
+ * with the x87 80-bit long double, and a different long double gives
+ * slightly different values in the last digits. So where long double isn't
+ * 80-bit, this exits with status 77, which "make check" counts as a skipped
+ * test.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ziggurattables.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Exit status for "can't reproduce the committed tables on this host". */
+#define EXIT_SKIP       77
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+static void print_ziggurat_table(const char * p_name, const uint64_t * p_k, const double * p_w, const double * p_f)
+{
+    size_t      i;
+
+    printf("const ZigguratLayer_t %s[ZIGGURAT_TABLE_LEN] =\n{\n", p_name);
+    for (i = 0; i < ZIGGURAT_TABLE_LEN; ++i)
+    {
+        printf("    { UINT64_C(0x%016"PRIX64"), %.17g, %.17g },\n", p_k[i], p_w[i], p_f[i]);
+    }
+    printf("};\n");
+}
+
+static void print_normal_table(void)
+{
+    const long double   scale = 4503599627370496.0L;        /* 2^52 */
+    const long double   r = 3.6541528853610087963519472518L;
+    const long double   v = r * expl(-0.5L * r * r) +
+                            sqrtl(acosl(0.0L)) * erfcl(r / sqrtl(2.0L));
+    uint64_t            k[ZIGGURAT_TABLE_LEN];
+    double              w[ZIGGURAT_TABLE_LEN];
+    double              f[ZIGGURAT_TABLE_LEN];
+    long double         x;
+    long double         x_prev;
+    long double         q;
+    size_t              i;
+
+    x = r;
+    q = v / expl(-0.5L * x * x);
+    k[0] = (uint64_t)((x / q) * scale);
+    k[1] = 0;
+    w[0] = q / scale;
+    w[ZIGGURAT_TABLE_LEN - 1u] = x / scale;
+    f[0] = 1.0;
+    f[ZIGGURAT_TABLE_LEN - 1u] = expl(-0.5L * x * x);
+    for (i = ZIGGURAT_TABLE_LEN - 2u; i >= 1u; --i)
+    {
+        x_prev = x;
+        x = sqrtl(-2.0L * logl(v / x + expl(-0.5L * x * x)));
+        k[i + 1u] = (uint64_t)((x / x_prev) * scale);
+        w[i] = x / scale;
+        f[i] = expl(-0.5L * x * x);
+    }
+    print_ziggurat_table("ziggurat_normal_table", k, w, f);
+}
+
+static void print_exp_table(void)
+{
+    const long double   scale = 9007199254740992.0L;        /* 2^53 */
+    const long double   r = 7.69711747013104971L;
+    const long double   v = (r + 1.0L) * expl(-r);
+    uint64_t            k[ZIGGURAT_TABLE_LEN];
+    double              w[ZIGGURAT_TABLE_LEN];
+    double              f[ZIGGURAT_TABLE_LEN];
+    long double         x;
+    long double         x_prev;
+    long double         q;
+    size_t              i;
+
+    x = r;
+    q = v / expl(-x);
+    k[0] = (uint64_t)((x / q) * scale);
+    k[1] = 0;
+    w[0] = q / scale;
+    w[ZIGGURAT_TABLE_LEN - 1u] = x / scale;
+    f[0] = 1.0;
+    f[ZIGGURAT_TABLE_LEN - 1u] = expl(-x);
+    for (i = ZIGGURAT_TABLE_LEN - 2u; i >= 1u; --i)
+    {
+        x_prev = x;
+        x = -logl(v / x + expl(-x));
+        k[i + 1u] = (uint64_t)((x / x_prev) * scale);
+        w[i] = x / scale;
+        f[i] = expl(-x);
+    }
+    print_ziggurat_table("ziggurat_exp_table", k, w, f);
+}
+
+int main(void)
+{
+    if (LDBL_MANT_DIG != 64)
+    {
+        fprintf(stderr, "genziggurattables: needs an 80-bit long double to reproduce ziggurattables.c\n");
+        return EXIT_SKIP;
+    }
+
+    printf("/*\n"
+           " * ziggurattables.c\n"
+           " *\n"
+           " * Pre-calculated tables for the ziggurat method of generating normal and\n"
+           " * exponential random values. See ziggurattables.h.\n"
+           " *\n"
+           " * This file is generated by genziggurattables. Do not edit. Run\n"
+           " * \"make update-ziggurattables\" to regenerate it.\n"
+           " */\n"
+           "\n"
+           "\n"
+           "/*****************************************************************************\n"
+           " * Includes\n"
+           " ****************************************************************************/\n"
+           "\n"
+           "#include \"ziggurattables.h\"\n"
+           "\n"
+           "\n"
+           "/*****************************************************************************\n"
+           " * Look-up tables\n"
+           " ****************************************************************************/\n"
+           "\n"
+           "#ifdef UINT64_C\n"
+           "\n"
+           "/* Each entry is { k, w, f }. The normal table is for f(x) = exp(-x^2 / 2)\n"
+           " * with 52-bit x values, and the exponential table is for f(x) = exp(-x) with\n"
+           " * 53-bit x values.\n"
+           " */\n"
+           "\n");
+    print_normal_table();
+    printf("\n");
+    print_exp_table();
+    printf("\n"
+           "#endif /* defined(UINT64_C) */\n");
+
+    if (fflush(stdout) != 0 || ferror(stdout))
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,4795 @@
+/*
+ * jumptables.c
+ *
+ * Pre-calculated "jump" tables for the discard functions. See jumptables.h.
+ *
+ * This file is generated by genjumptables. Do not edit. Run
+ * "make update-jumptables" to regenerate it.
+ */
+
+#include "jumptables.h"
+
+/* Cong: cong = 69069 * cong + 12345;
+ * Entry k is the affine map for 2^k steps: cong = mult * cong + add; */
+const CongJump_t cong_jump_table[CONG_JUMP_TABLE_LEN] =
+{
+    { 0x00010DCD, 0x00003039 },     /* 2^0 */
+    { 0x1C587629, 0x32D2B2DE },     /* 2^1 */
+    { 0x6AB9D291, 0x3953AC6C },     /* 2^2 */
+    { 0x16C43621, 0xA734ED98 },     /* 2^3 */
+    { 0x99F9F041, 0x57859E30 },     /* 2^4 */
+    { 0xF1EBF081, 0x616FC860 },     /* 2^5 */
+    { 0x50C82101, 0x96BDC0C0 },     /* 2^6 */
+    { 0x35D14201, 0x39544180 },     /* 2^7 */
+    { 0x40A68401, 0x250B8300 },     /* 2^8 */
+    { 0xF55D0801, 0x2BA30600 },     /* 2^9 */
+    { 0xBAFA1001, 0x9D760C00 },     /* 2^10 */
+    { 0xB6F42001, 0x53AC1800 },     /* 2^11 */
+    { 0x71E84001, 0x0A583000 },     /* 2^12 */
+    { 0xF3D08001, 0xA0B06000 },     /* 2^13 */
+    { 0x27A10001, 0x7160C000 },     /* 2^14 */
+    { 0x4F420001, 0xA2C18000 },     /* 2^15 */
+    { 0x9E840001, 0x45830000 },     /* 2^16 */
+    { 0x3D080001, 0x8B060000 },     /* 2^17 */
+    { 0x7A100001, 0x160C0000 },     /* 2^18 */
+    { 0xF4200001, 0x2C180000 },     /* 2^19 */
+    { 0xE8400001, 0x58300000 },     /* 2^20 */
+    { 0xD0800001, 0xB0600000 },     /* 2^21 */
+    { 0xA1000001, 0x60C00000 },     /* 2^22 */
+    { 0x42000001, 0xC1800000 },     /* 2^23 */
+    { 0x84000001, 0x83000000 },     /* 2^24 */
+    { 0x08000001, 0x06000000 },     /* 2^25 */
+    { 0x10000001, 0x0C000000 },     /* 2^26 */
+    { 0x20000001, 0x18000000 },     /* 2^27 */
+    { 0x40000001, 0x30000000 },     /* 2^28 */
+    { 0x80000001, 0x60000000 },     /* 2^29 */
+    { 0x00000001, 0xC0000000 },     /* 2^30 */
+    { 0x00000001, 0x80000000 },     /* 2^31 */
+};
+
+/* SHR3: xorshift (13, -17, 5) */
+const BitColumnMatrix32_t shr3_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00042021, 0x00084042, 0x00108084, 0x00210108, 0x00420231, 0x00840462, 0x010808C4, 0x02101188,
+            0x04202310, 0x08404620, 0x10808C40, 0x21011880, 0x42023100, 0x84046200, 0x0808C400, 0x10118800,
+            0x20231000, 0x40462021, 0x808C4042, 0x01080084, 0x02100108, 0x04200210, 0x08400420, 0x10800840,
+            0x21001080, 0x42002100, 0x84004200, 0x08008400, 0x10010800, 0x20021000, 0x40042000, 0x80084000,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x04080601, 0x08008C02, 0x10011804, 0x20023008, 0x40844453, 0x810888A6, 0x0201914C, 0x04032298,
+            0x08064511, 0x100C8A22, 0x20191444, 0x40322888, 0x80645131, 0x00C8A262, 0x019144C4, 0x03228988,
+            0x06451331, 0x0C0A0200, 0x18048400, 0x22088108, 0x44110210, 0x88220401, 0x10440802, 0x20881004,
+            0x41102008, 0x82204010, 0x04408020, 0x08918040, 0x11230080, 0x22460121, 0x448C0242, 0x89088484,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x1255994F, 0x6398B906, 0xC731720C, 0x8EE2C07A, 0x130599DA, 0x340ABABC, 0x3D2777C9, 0x7A4EEF92,
+            0x719D5183, 0xF13B2A0E, 0xF0675D35, 0xE04E9E29, 0x451D9697, 0x8A2BAD2E, 0x1447DA7D, 0x280F9098,
+            0xD58F0BF5, 0x32DF094A, 0x228D990C, 0xA9483CA8, 0x52105D32, 0x21A01080, 0x51512808, 0xB0A3D918,
+            0x6147B230, 0xC21FC002, 0x962E890C, 0x6B6E99A1, 0xD65D1720, 0x292A0485, 0x40450002, 0xD5B80294,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x19F91CB2, 0x538F61B6, 0x652DC653, 0xD3705DD7, 0xC7D046B3, 0x1010CECF, 0xF7633C19, 0xD2375EF6,
+            0x49C8595E, 0x8770C2DF, 0x1D23A458, 0x70218E61, 0x088F9D64, 0xCEA06B45, 0xFD713A54, 0xA46A8A02,
+            0xBD15E553, 0xA3911981, 0xB0CEC81D, 0x111B54D1, 0x726ECE07, 0xE63D0628, 0xC51628A0, 0x29FD906E,
+            0xADA9A745, 0x36B7CB5E, 0x3F610D90, 0xC8627EB6, 0x4B4C8D40, 0xC6795392, 0x858E03F5, 0x81D3A8C2,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0xC9C495B1, 0x8A3C6BFE, 0x924F547A, 0x99A1E1BF, 0x16044B28, 0x53349F98, 0xB6CC1DFA, 0x98051369,
+            0x04C3C68E, 0xB42D9993, 0x7D75C1BB, 0xE301B2DC, 0x54BFDE42, 0x0CD62700, 0x5B72A23C, 0xE9DE3212,
+            0x906C6081, 0xC09A246E, 0xA307B421, 0x88B47787, 0x83515E5B, 0x1A527A44, 0x8B026B64, 0x698E9C9D,
+            0x4C283091, 0xA5E451BC, 0x4E3B6116, 0xAEFCB774, 0xC5F26048, 0x8DEE79B6, 0x785ABCC7, 0xC04BE9E3,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0xCB682814, 0x97838477, 0xC2C3CAF4, 0x2B4775E5, 0x4F22D519, 0xEA3B5448, 0x1CDBCF21, 0xC9E29D4C,
+            0x9E62D754, 0xF0BB7664, 0x0CC05698, 0x7AE68F83, 0x88E150CE, 0x23CA5629, 0x37F88C37, 0x2DA3A51A,
+            0xB93F58C9, 0x0F697EE9, 0x01AA0174, 0xBA0F2EB0, 0xEEBD02D8, 0x7697AE60, 0x341DA531, 0xFAF9DEC3,
+            0x15D753D4, 0xC9BA30A2, 0x21281B70, 0x4525CF0D, 0x79DE8A52, 0x5ECCB214, 0x0E7A680A, 0x8CECA110,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x379686C7, 0x425170C2, 0x117B6D68, 0x7CBD73D3, 0x60F17F4F, 0x40F3102C, 0x122402CF, 0xDD277513,
+            0x74FFE4A2, 0x9F857006, 0x440C6E3A, 0xB312E9F2, 0xDCA256B4, 0xB0550F75, 0x5622227D, 0x7A03354A,
+            0x9E3CFC35, 0x3CB9B458, 0xC9BC20FE, 0xE33E8A56, 0x50431E52, 0x1C5647F4, 0x18A78D59, 0xE1108752,
+            0x539CACC1, 0x1AA03C75, 0xA29F511D, 0xD4CF1170, 0x8E8B2620, 0x548098C5, 0x66F61900, 0x341E7E45,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x7FCBB52D, 0x1D0936E9, 0x83E2B377, 0xD88C7E6F, 0x357CACFC, 0x80465AE3, 0x0946923B, 0x91D0FAC0,
+            0x243A2415, 0x5A96B533, 0x7EE95401, 0x3D1A8771, 0xD69B681B, 0xF9DE1A0F, 0x370B2B47, 0xA0DB100A,
+            0x01D59A81, 0x20CC5AFD, 0x22FFD71B, 0x6211E4F6, 0xD6E2562C, 0x4214CCD4, 0x0C2741D1, 0xE0468F85,
+            0xFF4DD0D0, 0x32809389, 0x87B4D668, 0x9537270C, 0xD36A4651, 0x57AFFF10, 0xD1A17042, 0x586B8A48,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x54EDA13C, 0xE9CD73EE, 0xB77136C3, 0xDEB89E2B, 0x4837DDB4, 0xAA7186BD, 0x47CCFD7D, 0x09409751,
+            0x4852E923, 0x935EB108, 0x58647569, 0x9E1D74F6, 0xE6C5E3F7, 0xB56F517A, 0xDFBAA62A, 0x6551E937,
+            0x1933008C, 0x74359566, 0xB2730C82, 0xC019BE4F, 0x7FEA9452, 0xED17FDB1, 0x926154AF, 0x200C67EB,
+            0x73FC8E9A, 0x68787DF8, 0x70E5D9CC, 0xC61D550E, 0xCB068D93, 0x3BA1B411, 0x0A6B48DA, 0x8C5A768C,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x9648C2BE, 0xE2A0ABCD, 0x650F9672, 0xFE0582AB, 0x0F8C5392, 0x78783F71, 0x5EC95971, 0x7C6A294C,
+            0x9B529F92, 0x171DC399, 0x31BBF9E1, 0xAB6D39F0, 0xCE338241, 0xFC2C712E, 0x6096FE10, 0xF7B75746,
+            0xE19595B7, 0x9337651E, 0x5FEB7F70, 0xD00878AD, 0x8120C7AA, 0x008AFD6D, 0x5FA27417, 0x27137CA6,
+            0xF5C694D0, 0x471B79D3, 0xA3D24058, 0x2352BEE0, 0x8AC39862, 0x8B535763, 0x0C6522CC, 0x44A6FEE5,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x570EC3C2, 0xA04A969B, 0xF8DC2773, 0x5EE317BE, 0x29019989, 0xBB54FD09, 0x29FEF571, 0x98B21D58,
+            0xAC047BC9, 0x745FAF6F, 0xA9D7E41D, 0x3853A8A6, 0x547B9E3C, 0x8EB305A8, 0xCAA0DEEE, 0x199BCABE,
+            0xA70F478B, 0x902E3B51, 0x0347703A, 0xE2BCC833, 0x8388A4BF, 0xEB65D4C8, 0x7D0C15CD, 0x223C2BD7,
+            0x8E3ADA36, 0x059121F8, 0xD85898D8, 0x6683842E, 0x7C04E0F4, 0x380138DA, 0x334E4B56, 0xC59BBB00,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x770AF5A8, 0x7A78BCB3, 0x5AC07F41, 0x5E1171AD, 0x3F5F6F80, 0xACEBB14C, 0x7635E9D4, 0x32046D23,
+            0x08C7EA39, 0x9A6B44E6, 0xD192D4E4, 0x3F28A7A1, 0xCB3F0132, 0x7BF7C94F, 0x32687051, 0x7331497A,
+            0xF28A95F5, 0x4E1E44CA, 0xBE55423C, 0xEE1687F2, 0xEBD3946D, 0xD0E5D03E, 0xB784F77F, 0x4DE8AB7E,
+            0x65215DD6, 0x0F946F7B, 0x437777F7, 0xCEF6E85D, 0x4C9A4596, 0x01F6D83C, 0xB1B6CA8B, 0xF7C5A413,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x9D2AB30A, 0xDE9DEC6F, 0x39AB2DF0, 0x01330B6A, 0x1D554EE9, 0xBA63B571, 0xEB3FF5FD, 0xF2D668D8,
+            0x13196EB5, 0x644645D3, 0x6E03AB06, 0x36B6B4A8, 0xD4DA6C8C, 0x9222DC10, 0x774F99B2, 0x9BBC73E5,
+            0x727F5248, 0x458FC26F, 0x17529924, 0x43FA0127, 0x8E744A77, 0x0BC42472, 0x3E5B6E23, 0xA3E30F36,
+            0xF085BDC7, 0x7C31BB02, 0x14D9767F, 0xCA40AA38, 0xFCDA26D7, 0x761B0CEA, 0xDC60024D, 0x7F174FEA,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0xD5D5E09D, 0xFA5293A5, 0x0B784C30, 0x8DDE7BA2, 0x73EBFB94, 0x30B5153E, 0xB90CE7C4, 0xC2C2851D,
+            0xE7602B6F, 0x9F7A9D18, 0x90620861, 0x6C666384, 0x295BE16B, 0xCC7EE3BE, 0x727B8496, 0xF6218816,
+            0xDFFCD50A, 0x5A415810, 0x7816EDA3, 0x9DCF6181, 0x62ACA594, 0xA2ABC1D0, 0xCC060DE7, 0x4BDE9E4A,
+            0x1A65FE12, 0x3DC778A2, 0xC69E98C4, 0xD6369CC2, 0x0451C06B, 0xE0A6EE85, 0x9E60D8D8, 0x8EDBD3AD,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x20F1E5E0, 0x60ECD21C, 0xAD7B1389, 0x55FD9B84, 0xAF66277F, 0xA93764B1, 0x934C6C70, 0x515E3FE9,
+            0x8716B7AE, 0x4C246883, 0x8E6CF602, 0x2D3153AD, 0x1E89F68C, 0x7EDC242B, 0x75632AC7, 0x6AC41EB4,
+            0x2C691481, 0x2697D9D3, 0x62EA367C, 0x29895280, 0xB8A1E758, 0xC9A24829, 0x56A4B2A5, 0x479CB0E2,
+            0xAD5F400C, 0x6754C1AF, 0xBEA220EF, 0xAF01096B, 0x1872135D, 0x0C0A3FAA, 0x8DD4CFD5, 0x2AAD691B,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x437CE0C1, 0x08CDDBE3, 0x6F62D513, 0xEF0129F8, 0x307076FE, 0xCFC32AA0, 0xD8ECA941, 0xAD1B953F,
+            0x8D1424D5, 0x00F2CD50, 0x5569B509, 0x6D5AD801, 0x389BC224, 0x41C6900A, 0x2F14DCF6, 0x31DD588E,
+            0x66057024, 0xC4B51798, 0xFE881B78, 0x3AB80B0F, 0x7E714931, 0x89E7AD0E, 0x93D2FADE, 0x4C7B74F8,
+            0xB82661A0, 0xA1DB55C6, 0x4DE9202D, 0x54DAAAAD, 0x87A5D172, 0xDBFF1832, 0xCA141F8E, 0x36751E30,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x1A19EDB3, 0x1E2D1EFC, 0x4A4B634E, 0x8598F248, 0x39266608, 0xCF006C06, 0xB6A534EE, 0x4FBC5841,
+            0x6AAFFD08, 0xAFF86F9B, 0xC276F1CF, 0xAB243D78, 0x1C18840C, 0x792C9459, 0xA842B119, 0xB8F17B40,
+            0x93BC6860, 0x00968E99, 0x7E694708, 0x03605BAE, 0x5F72FBF0, 0x9D6D2C80, 0x0A558524, 0x490E9555,
+            0x0C310B85, 0xB1D67186, 0x2CE80A2D, 0xE3F94B31, 0xBBA4F4A4, 0xDAE3CE4D, 0x21625802, 0xB348F734,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0xF1E9C892, 0xACE54CFF, 0x9A305601, 0x6FCFB0A6, 0x5465D610, 0x0C86006C, 0x36224E02, 0x164EECAE,
+            0x600CF689, 0x1324DAE3, 0xB89F6C97, 0x77638E81, 0x9DF30E6F, 0x391451E7, 0x915C961B, 0x36AE13C4,
+            0x40FC67C0, 0xFFC35EEA, 0x13FDE816, 0xA1B4F2E4, 0x34275832, 0xED8394C4, 0x7FBE13C4, 0x60D4A519,
+            0xEF2F875B, 0x00EB9DFF, 0xD6B2AA5E, 0xCEB816F8, 0x5B1D7EF8, 0x83CB9A03, 0x402FF464, 0xA816B944,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0xF23EE4A2, 0x1CE35039, 0xB20166DF, 0x9862E710, 0xC963C3C0, 0x5BBB078A, 0xFDAEFB65, 0xADB86E31,
+            0x516B8C2C, 0x6507E1F1, 0x055E588C, 0x815C1142, 0x3350AB11, 0x59EEDB2D, 0x83B458E7, 0x9AD57037,
+            0x773BB110, 0x58C37E36, 0x0B97F512, 0xC894D190, 0xC0EF872B, 0xEAA2F57C, 0xCF4A4DC2, 0xE63E1E87,
+            0xD15439DD, 0x38B3F6F9, 0x736E1777, 0xC9148B1F, 0x02FF96D0, 0xD4251357, 0xBBC4EDD7, 0x1448F736,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x5F59D38F, 0x1CCB57A9, 0x6AD26C2F, 0x1A56291D, 0xC0C70FE2, 0xAADCA113, 0xA5E1D17D, 0xF41DF789,
+            0xC5E45B6E, 0xC8A02073, 0x803CB3BD, 0x8ACCACE1, 0x7DCE70AD, 0xE58AA8F1, 0x5C8203FE, 0x5529B2B9,
+            0x52D59305, 0x42961E33, 0xD027F816, 0x545F5F5C, 0x0642461B, 0xBCAED331, 0xB924F3A1, 0xA2C87F80,
+            0x83B454BC, 0x47511E53, 0x0B193655, 0x5E8C2026, 0x87D80880, 0x273E0615, 0x90CD2212, 0x089882E4,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x81A38387, 0x3A475743, 0xDB241A2F, 0xF66AA34B, 0xA382EDF8, 0x59BF1D16, 0x033A59B8, 0x4EC046C2,
+            0xA22BA343, 0xB15D7F3A, 0x47FE6EB9, 0x90FBC686, 0x8ED24095, 0xDD1617C6, 0xF832BCD1, 0xFB58BE6F,
+            0xDF309341, 0x77B086AA, 0xCEBAFFF9, 0x040B0FBE, 0x3AE7F77D, 0x69004843, 0x84FC44DF, 0x102B01B5,
+            0x4B8C0613, 0x2BA86D2C, 0x1AD4CA26, 0x1A2EC81C, 0xF0443050, 0x29107570, 0xB327E2C3, 0xA2223FE3,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0xFE2B8FD2, 0x90A28D25, 0x5C907076, 0x1CE6E165, 0x6672F468, 0x8A21ACC6, 0x46DFD1F3, 0x758E2DD4,
+            0xE8F78D05, 0xC2F53756, 0x33AE2591, 0x63B7F721, 0x1F07EA0B, 0x5F19C734, 0xE66A598E, 0x0AA09008,
+            0x361DC3F7, 0x85E6B841, 0x5EF36B5A, 0xD1D8FC3E, 0x22F373B3, 0x1B82AE97, 0x7269B29C, 0x799EEE81,
+            0xFD7298AD, 0x0AC19402, 0x3B5833F6, 0x089E3B6A, 0x716BC035, 0xF571C32C, 0x8D571251, 0x863C1CEB,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x7AEDC5A3, 0x8A79B856, 0x545D4775, 0xBCACE81E, 0xC823FC08, 0x533F5A1B, 0x03AB7E2F, 0x52709B0F,
+            0x39FF5730, 0xEEEFD919, 0x72EF594B, 0xE300A6F4, 0x38E8F9BD, 0xB8DAE4B1, 0x2521CA55, 0x69027418,
+            0x05952610, 0x1A8B8216, 0x18692E66, 0xBFE4F723, 0x05EF14CE, 0x948EB8D7, 0x56636446, 0x079B49CA,
+            0xB8D9589A, 0x891EE235, 0x8359C77B, 0x102FF845, 0x5DD57CEA, 0x38C144B7, 0xF66E2A0D, 0x85FE7A97,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x9BCD6EF9, 0x7E20CB6F, 0xEFAF599C, 0xFA564291, 0x097D00EE, 0x27B318F4, 0x936161ED, 0x98380B6B,
+            0x96C226CD, 0x8C8A46BF, 0xEF243195, 0xA9D4BA3F, 0x4237A731, 0x342A0DF0, 0x36AE84C0, 0xDFA1D677,
+            0xC8F15278, 0xF26FD25F, 0x7C0C900D, 0x55012FAB, 0x3F312512, 0xD6EE3FD7, 0x4E94FD9D, 0x88C0FD0C,
+            0x4CECF0AD, 0x3A5B32F5, 0x6097457B, 0x73C24032, 0xC932C7E2, 0x1B3D5F06, 0x44013BDF, 0x5587CA83,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x329A7895, 0x77BBE428, 0xEDD73B9A, 0xC57A26A1, 0x3EAA1809, 0x774789C5, 0x8C11F770, 0x4B5C3C6E,
+            0x20ABCD89, 0x7A9E9132, 0xC043767D, 0xA6C5B623, 0x7AF3FF46, 0x36BDC047, 0x3653CD2C, 0x54F2665D,
+            0x3AD4A76A, 0x3F81CA27, 0xBFF41D66, 0xA11B0923, 0xAC52C661, 0x6B63C4F4, 0xF6A36F10, 0xBAC8C43C,
+            0xC04E206B, 0x2ECE34A7, 0x4303A185, 0xB2C2E418, 0x7BB13314, 0x7DCAE849, 0xDBD688A3, 0xDE9EA407,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0xD6D60DC5, 0x8FFBF65F, 0x641C8F0A, 0xABECE9FD, 0xBD937EFA, 0xF6B06C6A, 0xC8BC589B, 0x4D02BDBA,
+            0x901F4813, 0x46A97E08, 0xE9B53889, 0x97D56327, 0xCB8F67E2, 0x7432C0DF, 0x4F74B81B, 0x4500195F,
+            0x74144B29, 0xF86D4BD8, 0xAEEEC942, 0xDF0EA0F8, 0x2655209B, 0xA35EEAD3, 0xB8F786D9, 0x6A3B5C11,
+            0x9F359938, 0xD720B7CD, 0xE6F6E5D0, 0xEA4E0915, 0x03C482C0, 0xB7FB2A71, 0xC9FAAC00, 0x9CF8C5F5,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x1C01B5B2, 0x25C24CB8, 0x068341C8, 0x271D47E9, 0x59D7B651, 0x60E60D39, 0x30E2F2FA, 0x94EE8F72,
+            0x78EF50B9, 0xF9BF7073, 0xBA185A03, 0x39CDA20D, 0x984B720D, 0x42D1C703, 0x3C7F5A3B, 0x9F8E2732,
+            0x96156DCD, 0x88F819C9, 0x427D8241, 0xCFA5CCAB, 0xB4174DBD, 0xBA0359A4, 0x18D29D5F, 0x04CDA580,
+            0xEDEA63C2, 0x025DF420, 0xEDAA0959, 0xE67E8EE6, 0xB220BF09, 0x72938CD6, 0x1F8F8056, 0x14C4BF28,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x201FB55F, 0xD35C169D, 0x32561C1E, 0x2795DEEF, 0x21241809, 0xF89217F7, 0xF1613EA8, 0x5968C5FC,
+            0x3E9C888D, 0x8F75355F, 0x16637465, 0xD58AE6D2, 0xABC587E2, 0x82B59213, 0x0D3DF80B, 0x2600A8C5,
+            0x356BA4FD, 0x696DDEC9, 0x5A0BCE1E, 0x4F7C8524, 0x865F4B53, 0x39249B34, 0xF9391B4C, 0x613E7758,
+            0x00976F0E, 0x16C098D8, 0x757E3AD7, 0x8786423A, 0x10A499D0, 0xB197C205, 0x14415ED3, 0x01820CE6,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x6FF3BE16, 0x06624B95, 0x74645AF5, 0x20C0A4B8, 0xABEAF2A1, 0x019FAC3B, 0xA292FC96, 0x6B2B7516,
+            0x28233094, 0xFB458C9E, 0xC695D812, 0x5D4EC4AE, 0xD4EEE6B4, 0x76B0F851, 0x6E19F683, 0x1956EE1B,
+            0xF108BCD3, 0xA1213E7D, 0x06C3D9B2, 0x67E00E3D, 0x1E73E990, 0x474B440C, 0xDD89F5D1, 0x12376A4F,
+            0xDA7B1930, 0x1DEAA38C, 0xC17494FA, 0x9FC4ACB0, 0xFD4B1987, 0xF74B7CCC, 0x39828428, 0x7ABCB208,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x933D49A3, 0xDC1A55A5, 0x0A507608, 0x7018A23E, 0xB085DEC2, 0xF02CCA99, 0xC1755CFC, 0x1D03C556,
+            0x6916D579, 0x2BA3151F, 0x3748645E, 0xD4210C89, 0xBEE34C01, 0x4AC76334, 0xEF73EA38, 0x5F3684F8,
+            0xDFB42686, 0x10BF43BB, 0x52F94049, 0xB16583D3, 0xDEDACBE6, 0x290F03F0, 0x8866FDB0, 0xCE76FD31,
+            0x84D5B851, 0xB4BBF234, 0x55744665, 0xE2C84E2F, 0xF0E8C3BD, 0x6F1A8778, 0x0235BA73, 0xFB0D26DB,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x003AA208, 0xBAE07BAB, 0x776B9C3F, 0x2AD1D198, 0xE1C46AE6, 0xAD3D9F58, 0xDB7DE0B9, 0x452B68EF,
+            0xA5AF33BD, 0xF099F31A, 0x86B5D859, 0xB7507A1A, 0x58CB3560, 0x225C08A4, 0x94F9AB63, 0x44253F6C,
+            0x783D9CDA, 0x2A8F1556, 0x5451BB61, 0xF2595D30, 0xEF067CD5, 0xFBFA9A36, 0x695EB810, 0xDA40F121,
+            0x2600A1CF, 0x537DC10B, 0x559AC0A2, 0x3716FFEF, 0xFE9FBAF1, 0x4EF2BEF3, 0x5448BA17, 0x8DA4D21E,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x701BBBCF, 0x6553E869, 0x701F211C, 0xAD3A686A, 0x59DD5F38, 0x25465D28, 0x17361BC1, 0xA93DCF27,
+            0x1E3F86D7, 0x582B89AC, 0x4686C174, 0x43246DCD, 0xA1F9CB45, 0x15F24CFE, 0x43A2ED42, 0xE3FAAA5E,
+            0xDB523D5E, 0x8880ADA4, 0xAB86FDA7, 0x2241526C, 0x2979CF27, 0x8E8B85B2, 0x69557F52, 0x88A5F32A,
+            0xF2F5A77D, 0x9945EBD3, 0xB6F7BC0A, 0x1BC13EA3, 0x3262242C, 0x7F6F096F, 0x314481B6, 0xC2D39275,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00042021, 0x00084042, 0x00108084, 0x00210108, 0x00420231, 0x00840462, 0x010808C4, 0x02101188,
+            0x04202310, 0x08404620, 0x10808C40, 0x21011880, 0x42023100, 0x84046200, 0x0808C400, 0x10118800,
+            0x20231000, 0x40462021, 0x808C4042, 0x01080084, 0x02100108, 0x04200210, 0x08400420, 0x10800840,
+            0x21001080, 0x42002100, 0x84004200, 0x08008400, 0x10010800, 0x20021000, 0x40042000, 0x80084000,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x04080601, 0x08008C02, 0x10011804, 0x20023008, 0x40844453, 0x810888A6, 0x0201914C, 0x04032298,
+            0x08064511, 0x100C8A22, 0x20191444, 0x40322888, 0x80645131, 0x00C8A262, 0x019144C4, 0x03228988,
+            0x06451331, 0x0C0A0200, 0x18048400, 0x22088108, 0x44110210, 0x88220401, 0x10440802, 0x20881004,
+            0x41102008, 0x82204010, 0x04408020, 0x08918040, 0x11230080, 0x22460121, 0x448C0242, 0x89088484,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x1255994F, 0x6398B906, 0xC731720C, 0x8EE2C07A, 0x130599DA, 0x340ABABC, 0x3D2777C9, 0x7A4EEF92,
+            0x719D5183, 0xF13B2A0E, 0xF0675D35, 0xE04E9E29, 0x451D9697, 0x8A2BAD2E, 0x1447DA7D, 0x280F9098,
+            0xD58F0BF5, 0x32DF094A, 0x228D990C, 0xA9483CA8, 0x52105D32, 0x21A01080, 0x51512808, 0xB0A3D918,
+            0x6147B230, 0xC21FC002, 0x962E890C, 0x6B6E99A1, 0xD65D1720, 0x292A0485, 0x40450002, 0xD5B80294,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x19F91CB2, 0x538F61B6, 0x652DC653, 0xD3705DD7, 0xC7D046B3, 0x1010CECF, 0xF7633C19, 0xD2375EF6,
+            0x49C8595E, 0x8770C2DF, 0x1D23A458, 0x70218E61, 0x088F9D64, 0xCEA06B45, 0xFD713A54, 0xA46A8A02,
+            0xBD15E553, 0xA3911981, 0xB0CEC81D, 0x111B54D1, 0x726ECE07, 0xE63D0628, 0xC51628A0, 0x29FD906E,
+            0xADA9A745, 0x36B7CB5E, 0x3F610D90, 0xC8627EB6, 0x4B4C8D40, 0xC6795392, 0x858E03F5, 0x81D3A8C2,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0xC9C495B1, 0x8A3C6BFE, 0x924F547A, 0x99A1E1BF, 0x16044B28, 0x53349F98, 0xB6CC1DFA, 0x98051369,
+            0x04C3C68E, 0xB42D9993, 0x7D75C1BB, 0xE301B2DC, 0x54BFDE42, 0x0CD62700, 0x5B72A23C, 0xE9DE3212,
+            0x906C6081, 0xC09A246E, 0xA307B421, 0x88B47787, 0x83515E5B, 0x1A527A44, 0x8B026B64, 0x698E9C9D,
+            0x4C283091, 0xA5E451BC, 0x4E3B6116, 0xAEFCB774, 0xC5F26048, 0x8DEE79B6, 0x785ABCC7, 0xC04BE9E3,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0xCB682814, 0x97838477, 0xC2C3CAF4, 0x2B4775E5, 0x4F22D519, 0xEA3B5448, 0x1CDBCF21, 0xC9E29D4C,
+            0x9E62D754, 0xF0BB7664, 0x0CC05698, 0x7AE68F83, 0x88E150CE, 0x23CA5629, 0x37F88C37, 0x2DA3A51A,
+            0xB93F58C9, 0x0F697EE9, 0x01AA0174, 0xBA0F2EB0, 0xEEBD02D8, 0x7697AE60, 0x341DA531, 0xFAF9DEC3,
+            0x15D753D4, 0xC9BA30A2, 0x21281B70, 0x4525CF0D, 0x79DE8A52, 0x5ECCB214, 0x0E7A680A, 0x8CECA110,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x379686C7, 0x425170C2, 0x117B6D68, 0x7CBD73D3, 0x60F17F4F, 0x40F3102C, 0x122402CF, 0xDD277513,
+            0x74FFE4A2, 0x9F857006, 0x440C6E3A, 0xB312E9F2, 0xDCA256B4, 0xB0550F75, 0x5622227D, 0x7A03354A,
+            0x9E3CFC35, 0x3CB9B458, 0xC9BC20FE, 0xE33E8A56, 0x50431E52, 0x1C5647F4, 0x18A78D59, 0xE1108752,
+            0x539CACC1, 0x1AA03C75, 0xA29F511D, 0xD4CF1170, 0x8E8B2620, 0x548098C5, 0x66F61900, 0x341E7E45,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x7FCBB52D, 0x1D0936E9, 0x83E2B377, 0xD88C7E6F, 0x357CACFC, 0x80465AE3, 0x0946923B, 0x91D0FAC0,
+            0x243A2415, 0x5A96B533, 0x7EE95401, 0x3D1A8771, 0xD69B681B, 0xF9DE1A0F, 0x370B2B47, 0xA0DB100A,
+            0x01D59A81, 0x20CC5AFD, 0x22FFD71B, 0x6211E4F6, 0xD6E2562C, 0x4214CCD4, 0x0C2741D1, 0xE0468F85,
+            0xFF4DD0D0, 0x32809389, 0x87B4D668, 0x9537270C, 0xD36A4651, 0x57AFFF10, 0xD1A17042, 0x586B8A48,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x54EDA13C, 0xE9CD73EE, 0xB77136C3, 0xDEB89E2B, 0x4837DDB4, 0xAA7186BD, 0x47CCFD7D, 0x09409751,
+            0x4852E923, 0x935EB108, 0x58647569, 0x9E1D74F6, 0xE6C5E3F7, 0xB56F517A, 0xDFBAA62A, 0x6551E937,
+            0x1933008C, 0x74359566, 0xB2730C82, 0xC019BE4F, 0x7FEA9452, 0xED17FDB1, 0x926154AF, 0x200C67EB,
+            0x73FC8E9A, 0x68787DF8, 0x70E5D9CC, 0xC61D550E, 0xCB068D93, 0x3BA1B411, 0x0A6B48DA, 0x8C5A768C,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x9648C2BE, 0xE2A0ABCD, 0x650F9672, 0xFE0582AB, 0x0F8C5392, 0x78783F71, 0x5EC95971, 0x7C6A294C,
+            0x9B529F92, 0x171DC399, 0x31BBF9E1, 0xAB6D39F0, 0xCE338241, 0xFC2C712E, 0x6096FE10, 0xF7B75746,
+            0xE19595B7, 0x9337651E, 0x5FEB7F70, 0xD00878AD, 0x8120C7AA, 0x008AFD6D, 0x5FA27417, 0x27137CA6,
+            0xF5C694D0, 0x471B79D3, 0xA3D24058, 0x2352BEE0, 0x8AC39862, 0x8B535763, 0x0C6522CC, 0x44A6FEE5,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x570EC3C2, 0xA04A969B, 0xF8DC2773, 0x5EE317BE, 0x29019989, 0xBB54FD09, 0x29FEF571, 0x98B21D58,
+            0xAC047BC9, 0x745FAF6F, 0xA9D7E41D, 0x3853A8A6, 0x547B9E3C, 0x8EB305A8, 0xCAA0DEEE, 0x199BCABE,
+            0xA70F478B, 0x902E3B51, 0x0347703A, 0xE2BCC833, 0x8388A4BF, 0xEB65D4C8, 0x7D0C15CD, 0x223C2BD7,
+            0x8E3ADA36, 0x059121F8, 0xD85898D8, 0x6683842E, 0x7C04E0F4, 0x380138DA, 0x334E4B56, 0xC59BBB00,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x770AF5A8, 0x7A78BCB3, 0x5AC07F41, 0x5E1171AD, 0x3F5F6F80, 0xACEBB14C, 0x7635E9D4, 0x32046D23,
+            0x08C7EA39, 0x9A6B44E6, 0xD192D4E4, 0x3F28A7A1, 0xCB3F0132, 0x7BF7C94F, 0x32687051, 0x7331497A,
+            0xF28A95F5, 0x4E1E44CA, 0xBE55423C, 0xEE1687F2, 0xEBD3946D, 0xD0E5D03E, 0xB784F77F, 0x4DE8AB7E,
+            0x65215DD6, 0x0F946F7B, 0x437777F7, 0xCEF6E85D, 0x4C9A4596, 0x01F6D83C, 0xB1B6CA8B, 0xF7C5A413,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x9D2AB30A, 0xDE9DEC6F, 0x39AB2DF0, 0x01330B6A, 0x1D554EE9, 0xBA63B571, 0xEB3FF5FD, 0xF2D668D8,
+            0x13196EB5, 0x644645D3, 0x6E03AB06, 0x36B6B4A8, 0xD4DA6C8C, 0x9222DC10, 0x774F99B2, 0x9BBC73E5,
+            0x727F5248, 0x458FC26F, 0x17529924, 0x43FA0127, 0x8E744A77, 0x0BC42472, 0x3E5B6E23, 0xA3E30F36,
+            0xF085BDC7, 0x7C31BB02, 0x14D9767F, 0xCA40AA38, 0xFCDA26D7, 0x761B0CEA, 0xDC60024D, 0x7F174FEA,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0xD5D5E09D, 0xFA5293A5, 0x0B784C30, 0x8DDE7BA2, 0x73EBFB94, 0x30B5153E, 0xB90CE7C4, 0xC2C2851D,
+            0xE7602B6F, 0x9F7A9D18, 0x90620861, 0x6C666384, 0x295BE16B, 0xCC7EE3BE, 0x727B8496, 0xF6218816,
+            0xDFFCD50A, 0x5A415810, 0x7816EDA3, 0x9DCF6181, 0x62ACA594, 0xA2ABC1D0, 0xCC060DE7, 0x4BDE9E4A,
+            0x1A65FE12, 0x3DC778A2, 0xC69E98C4, 0xD6369CC2, 0x0451C06B, 0xE0A6EE85, 0x9E60D8D8, 0x8EDBD3AD,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x20F1E5E0, 0x60ECD21C, 0xAD7B1389, 0x55FD9B84, 0xAF66277F, 0xA93764B1, 0x934C6C70, 0x515E3FE9,
+            0x8716B7AE, 0x4C246883, 0x8E6CF602, 0x2D3153AD, 0x1E89F68C, 0x7EDC242B, 0x75632AC7, 0x6AC41EB4,
+            0x2C691481, 0x2697D9D3, 0x62EA367C, 0x29895280, 0xB8A1E758, 0xC9A24829, 0x56A4B2A5, 0x479CB0E2,
+            0xAD5F400C, 0x6754C1AF, 0xBEA220EF, 0xAF01096B, 0x1872135D, 0x0C0A3FAA, 0x8DD4CFD5, 0x2AAD691B,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x437CE0C1, 0x08CDDBE3, 0x6F62D513, 0xEF0129F8, 0x307076FE, 0xCFC32AA0, 0xD8ECA941, 0xAD1B953F,
+            0x8D1424D5, 0x00F2CD50, 0x5569B509, 0x6D5AD801, 0x389BC224, 0x41C6900A, 0x2F14DCF6, 0x31DD588E,
+            0x66057024, 0xC4B51798, 0xFE881B78, 0x3AB80B0F, 0x7E714931, 0x89E7AD0E, 0x93D2FADE, 0x4C7B74F8,
+            0xB82661A0, 0xA1DB55C6, 0x4DE9202D, 0x54DAAAAD, 0x87A5D172, 0xDBFF1832, 0xCA141F8E, 0x36751E30,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x1A19EDB3, 0x1E2D1EFC, 0x4A4B634E, 0x8598F248, 0x39266608, 0xCF006C06, 0xB6A534EE, 0x4FBC5841,
+            0x6AAFFD08, 0xAFF86F9B, 0xC276F1CF, 0xAB243D78, 0x1C18840C, 0x792C9459, 0xA842B119, 0xB8F17B40,
+            0x93BC6860, 0x00968E99, 0x7E694708, 0x03605BAE, 0x5F72FBF0, 0x9D6D2C80, 0x0A558524, 0x490E9555,
+            0x0C310B85, 0xB1D67186, 0x2CE80A2D, 0xE3F94B31, 0xBBA4F4A4, 0xDAE3CE4D, 0x21625802, 0xB348F734,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0xF1E9C892, 0xACE54CFF, 0x9A305601, 0x6FCFB0A6, 0x5465D610, 0x0C86006C, 0x36224E02, 0x164EECAE,
+            0x600CF689, 0x1324DAE3, 0xB89F6C97, 0x77638E81, 0x9DF30E6F, 0x391451E7, 0x915C961B, 0x36AE13C4,
+            0x40FC67C0, 0xFFC35EEA, 0x13FDE816, 0xA1B4F2E4, 0x34275832, 0xED8394C4, 0x7FBE13C4, 0x60D4A519,
+            0xEF2F875B, 0x00EB9DFF, 0xD6B2AA5E, 0xCEB816F8, 0x5B1D7EF8, 0x83CB9A03, 0x402FF464, 0xA816B944,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0xF23EE4A2, 0x1CE35039, 0xB20166DF, 0x9862E710, 0xC963C3C0, 0x5BBB078A, 0xFDAEFB65, 0xADB86E31,
+            0x516B8C2C, 0x6507E1F1, 0x055E588C, 0x815C1142, 0x3350AB11, 0x59EEDB2D, 0x83B458E7, 0x9AD57037,
+            0x773BB110, 0x58C37E36, 0x0B97F512, 0xC894D190, 0xC0EF872B, 0xEAA2F57C, 0xCF4A4DC2, 0xE63E1E87,
+            0xD15439DD, 0x38B3F6F9, 0x736E1777, 0xC9148B1F, 0x02FF96D0, 0xD4251357, 0xBBC4EDD7, 0x1448F736,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x5F59D38F, 0x1CCB57A9, 0x6AD26C2F, 0x1A56291D, 0xC0C70FE2, 0xAADCA113, 0xA5E1D17D, 0xF41DF789,
+            0xC5E45B6E, 0xC8A02073, 0x803CB3BD, 0x8ACCACE1, 0x7DCE70AD, 0xE58AA8F1, 0x5C8203FE, 0x5529B2B9,
+            0x52D59305, 0x42961E33, 0xD027F816, 0x545F5F5C, 0x0642461B, 0xBCAED331, 0xB924F3A1, 0xA2C87F80,
+            0x83B454BC, 0x47511E53, 0x0B193655, 0x5E8C2026, 0x87D80880, 0x273E0615, 0x90CD2212, 0x089882E4,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x81A38387, 0x3A475743, 0xDB241A2F, 0xF66AA34B, 0xA382EDF8, 0x59BF1D16, 0x033A59B8, 0x4EC046C2,
+            0xA22BA343, 0xB15D7F3A, 0x47FE6EB9, 0x90FBC686, 0x8ED24095, 0xDD1617C6, 0xF832BCD1, 0xFB58BE6F,
+            0xDF309341, 0x77B086AA, 0xCEBAFFF9, 0x040B0FBE, 0x3AE7F77D, 0x69004843, 0x84FC44DF, 0x102B01B5,
+            0x4B8C0613, 0x2BA86D2C, 0x1AD4CA26, 0x1A2EC81C, 0xF0443050, 0x29107570, 0xB327E2C3, 0xA2223FE3,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0xFE2B8FD2, 0x90A28D25, 0x5C907076, 0x1CE6E165, 0x6672F468, 0x8A21ACC6, 0x46DFD1F3, 0x758E2DD4,
+            0xE8F78D05, 0xC2F53756, 0x33AE2591, 0x63B7F721, 0x1F07EA0B, 0x5F19C734, 0xE66A598E, 0x0AA09008,
+            0x361DC3F7, 0x85E6B841, 0x5EF36B5A, 0xD1D8FC3E, 0x22F373B3, 0x1B82AE97, 0x7269B29C, 0x799EEE81,
+            0xFD7298AD, 0x0AC19402, 0x3B5833F6, 0x089E3B6A, 0x716BC035, 0xF571C32C, 0x8D571251, 0x863C1CEB,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x7AEDC5A3, 0x8A79B856, 0x545D4775, 0xBCACE81E, 0xC823FC08, 0x533F5A1B, 0x03AB7E2F, 0x52709B0F,
+            0x39FF5730, 0xEEEFD919, 0x72EF594B, 0xE300A6F4, 0x38E8F9BD, 0xB8DAE4B1, 0x2521CA55, 0x69027418,
+            0x05952610, 0x1A8B8216, 0x18692E66, 0xBFE4F723, 0x05EF14CE, 0x948EB8D7, 0x56636446, 0x079B49CA,
+            0xB8D9589A, 0x891EE235, 0x8359C77B, 0x102FF845, 0x5DD57CEA, 0x38C144B7, 0xF66E2A0D, 0x85FE7A97,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x9BCD6EF9, 0x7E20CB6F, 0xEFAF599C, 0xFA564291, 0x097D00EE, 0x27B318F4, 0x936161ED, 0x98380B6B,
+            0x96C226CD, 0x8C8A46BF, 0xEF243195, 0xA9D4BA3F, 0x4237A731, 0x342A0DF0, 0x36AE84C0, 0xDFA1D677,
+            0xC8F15278, 0xF26FD25F, 0x7C0C900D, 0x55012FAB, 0x3F312512, 0xD6EE3FD7, 0x4E94FD9D, 0x88C0FD0C,
+            0x4CECF0AD, 0x3A5B32F5, 0x6097457B, 0x73C24032, 0xC932C7E2, 0x1B3D5F06, 0x44013BDF, 0x5587CA83,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x329A7895, 0x77BBE428, 0xEDD73B9A, 0xC57A26A1, 0x3EAA1809, 0x774789C5, 0x8C11F770, 0x4B5C3C6E,
+            0x20ABCD89, 0x7A9E9132, 0xC043767D, 0xA6C5B623, 0x7AF3FF46, 0x36BDC047, 0x3653CD2C, 0x54F2665D,
+            0x3AD4A76A, 0x3F81CA27, 0xBFF41D66, 0xA11B0923, 0xAC52C661, 0x6B63C4F4, 0xF6A36F10, 0xBAC8C43C,
+            0xC04E206B, 0x2ECE34A7, 0x4303A185, 0xB2C2E418, 0x7BB13314, 0x7DCAE849, 0xDBD688A3, 0xDE9EA407,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0xD6D60DC5, 0x8FFBF65F, 0x641C8F0A, 0xABECE9FD, 0xBD937EFA, 0xF6B06C6A, 0xC8BC589B, 0x4D02BDBA,
+            0x901F4813, 0x46A97E08, 0xE9B53889, 0x97D56327, 0xCB8F67E2, 0x7432C0DF, 0x4F74B81B, 0x4500195F,
+            0x74144B29, 0xF86D4BD8, 0xAEEEC942, 0xDF0EA0F8, 0x2655209B, 0xA35EEAD3, 0xB8F786D9, 0x6A3B5C11,
+            0x9F359938, 0xD720B7CD, 0xE6F6E5D0, 0xEA4E0915, 0x03C482C0, 0xB7FB2A71, 0xC9FAAC00, 0x9CF8C5F5,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x1C01B5B2, 0x25C24CB8, 0x068341C8, 0x271D47E9, 0x59D7B651, 0x60E60D39, 0x30E2F2FA, 0x94EE8F72,
+            0x78EF50B9, 0xF9BF7073, 0xBA185A03, 0x39CDA20D, 0x984B720D, 0x42D1C703, 0x3C7F5A3B, 0x9F8E2732,
+            0x96156DCD, 0x88F819C9, 0x427D8241, 0xCFA5CCAB, 0xB4174DBD, 0xBA0359A4, 0x18D29D5F, 0x04CDA580,
+            0xEDEA63C2, 0x025DF420, 0xEDAA0959, 0xE67E8EE6, 0xB220BF09, 0x72938CD6, 0x1F8F8056, 0x14C4BF28,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x201FB55F, 0xD35C169D, 0x32561C1E, 0x2795DEEF, 0x21241809, 0xF89217F7, 0xF1613EA8, 0x5968C5FC,
+            0x3E9C888D, 0x8F75355F, 0x16637465, 0xD58AE6D2, 0xABC587E2, 0x82B59213, 0x0D3DF80B, 0x2600A8C5,
+            0x356BA4FD, 0x696DDEC9, 0x5A0BCE1E, 0x4F7C8524, 0x865F4B53, 0x39249B34, 0xF9391B4C, 0x613E7758,
+            0x00976F0E, 0x16C098D8, 0x757E3AD7, 0x8786423A, 0x10A499D0, 0xB197C205, 0x14415ED3, 0x01820CE6,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x6FF3BE16, 0x06624B95, 0x74645AF5, 0x20C0A4B8, 0xABEAF2A1, 0x019FAC3B, 0xA292FC96, 0x6B2B7516,
+            0x28233094, 0xFB458C9E, 0xC695D812, 0x5D4EC4AE, 0xD4EEE6B4, 0x76B0F851, 0x6E19F683, 0x1956EE1B,
+            0xF108BCD3, 0xA1213E7D, 0x06C3D9B2, 0x67E00E3D, 0x1E73E990, 0x474B440C, 0xDD89F5D1, 0x12376A4F,
+            0xDA7B1930, 0x1DEAA38C, 0xC17494FA, 0x9FC4ACB0, 0xFD4B1987, 0xF74B7CCC, 0x39828428, 0x7ABCB208,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x933D49A3, 0xDC1A55A5, 0x0A507608, 0x7018A23E, 0xB085DEC2, 0xF02CCA99, 0xC1755CFC, 0x1D03C556,
+            0x6916D579, 0x2BA3151F, 0x3748645E, 0xD4210C89, 0xBEE34C01, 0x4AC76334, 0xEF73EA38, 0x5F3684F8,
+            0xDFB42686, 0x10BF43BB, 0x52F94049, 0xB16583D3, 0xDEDACBE6, 0x290F03F0, 0x8866FDB0, 0xCE76FD31,
+            0x84D5B851, 0xB4BBF234, 0x55744665, 0xE2C84E2F, 0xF0E8C3BD, 0x6F1A8778, 0x0235BA73, 0xFB0D26DB,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x003AA208, 0xBAE07BAB, 0x776B9C3F, 0x2AD1D198, 0xE1C46AE6, 0xAD3D9F58, 0xDB7DE0B9, 0x452B68EF,
+            0xA5AF33BD, 0xF099F31A, 0x86B5D859, 0xB7507A1A, 0x58CB3560, 0x225C08A4, 0x94F9AB63, 0x44253F6C,
+            0x783D9CDA, 0x2A8F1556, 0x5451BB61, 0xF2595D30, 0xEF067CD5, 0xFBFA9A36, 0x695EB810, 0xDA40F121,
+            0x2600A1CF, 0x537DC10B, 0x559AC0A2, 0x3716FFEF, 0xFE9FBAF1, 0x4EF2BEF3, 0x5448BA17, 0x8DA4D21E,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x701BBBCF, 0x6553E869, 0x701F211C, 0xAD3A686A, 0x59DD5F38, 0x25465D28, 0x17361BC1, 0xA93DCF27,
+            0x1E3F86D7, 0x582B89AC, 0x4686C174, 0x43246DCD, 0xA1F9CB45, 0x15F24CFE, 0x43A2ED42, 0xE3FAAA5E,
+            0xDB523D5E, 0x8880ADA4, 0xAB86FDA7, 0x2241526C, 0x2979CF27, 0x8E8B85B2, 0x69557F52, 0x88A5F32A,
+            0xF2F5A77D, 0x9945EBD3, 0xB6F7BC0A, 0x1BC13EA3, 0x3262242C, 0x7F6F096F, 0x314481B6, 0xC2D39275,
+        },
+    },
+};
+
+/* LFSR113 z1: LFSR (s1 = 6, s2 = 13, s3 = 18, mask = 0xFFFFFFFE) */
+const BitColumnMatrix32_t lfsr113_1_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000001,
+            0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082, 0x00000104,
+            0x00000208, 0x00000410, 0x00000820, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400,
+            0x00020800, 0x00041000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400, 0x00020800, 0x00041000,
+            0x00082000, 0x00104000, 0x00208000, 0x00410000, 0x00820000, 0x01040000, 0x02080001, 0x04100002,
+            0x08200004, 0x10400008, 0x20800010, 0x41000020, 0x82000040, 0x04000080, 0x08000100, 0x10000200,
+            0x20000400, 0x40000800, 0x80000041, 0x00000082, 0x00000104, 0x00000208, 0x00000410, 0x00000820,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00800800, 0x01001000, 0x02002001, 0x04004002, 0x08008004, 0x10010008, 0x20020010,
+            0x40040020, 0x80080041, 0x00100082, 0x00200104, 0x00400208, 0x00800410, 0x01000820, 0x02001041,
+            0x04002082, 0x08004104, 0x10008208, 0x20010410, 0x40020820, 0x80041041, 0x00082082, 0x00104104,
+            0x00208208, 0x00410410, 0x00020020, 0x00040040, 0x00080080, 0x00100100, 0x00200200, 0x00400400,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00304000, 0x00608000, 0x00C10000, 0x01820000, 0x03040001, 0x06080003, 0x0C100006,
+            0x1820000C, 0x30400018, 0x60800030, 0xC1000061, 0x820000C2, 0x04000184, 0x08000308, 0x10000610,
+            0x20000C20, 0x40001840, 0x80003081, 0x00006102, 0x0000C204, 0x00018408, 0x00030810, 0x00061020,
+            0x000C2040, 0x00184080, 0x0000C100, 0x00018200, 0x00030400, 0x00060800, 0x000C1000, 0x00182000,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x08014504, 0x10028A08, 0x20051410, 0x400A2820, 0x80145041, 0x0028A082, 0x00514104,
+            0x00A28208, 0x01450410, 0x028A0821, 0x05141042, 0x0A282085, 0x1450410A, 0x28A08214, 0x51410428,
+            0xA2820850, 0x450410A0, 0x8A082140, 0x14104280, 0x28208500, 0x50410A00, 0xA0821401, 0x41042802,
+            0x82085004, 0x0410A008, 0x00200514, 0x00400A28, 0x00801450, 0x010028A0, 0x02005141, 0x0400A282,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x9848804D, 0x3091009A, 0x61220134, 0xC2440268, 0x848804D1, 0x091009A2, 0x12201345,
+            0x2440268A, 0x48804D14, 0x91009A29, 0x22013453, 0x440268A6, 0x8804D14D, 0x1009A29A, 0x20134534,
+            0x40268A68, 0x804D14D1, 0x009A29A2, 0x01345344, 0x0268A689, 0x04D14D12, 0x09A29A24, 0x13453449,
+            0x268A6893, 0x4D14D126, 0x02612201, 0x04C24402, 0x09848804, 0x13091009, 0x26122013, 0x4C244026,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x31440878, 0x628810F1, 0xC51021E3, 0x8A2043C6, 0x1440878C, 0x28810F18, 0x51021E30,
+            0xA2043C60, 0x440878C0, 0x8810F181, 0x1021E302, 0x2043C604, 0x40878C08, 0x810F1811, 0x021E3023,
+            0x043C6046, 0x0878C08C, 0x10F18118, 0x21E30230, 0x43C60461, 0x878C08C2, 0x0F181185, 0x1E30230B,
+            0x3C604616, 0x78C08C2C, 0xC0C51021, 0x818A2043, 0x03144087, 0x0628810F, 0x0C51021E, 0x18A2043C,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x45651EB0, 0x8ACA3D60, 0x15947AC0, 0x2B28F581, 0x5651EB03, 0xACA3D607, 0x5947AC0E,
+            0xB28F581C, 0x651EB038, 0xCA3D6070, 0x947AC0E1, 0x28F581C2, 0x51EB0384, 0xA3D60708, 0x47AC0E11,
+            0x8F581C22, 0x1EB03845, 0x3D60708A, 0x7AC0E115, 0xF581C22B, 0xEB038456, 0xD60708AC, 0xAC0E1159,
+            0x581C22B2, 0xB0384565, 0x2515947A, 0x4A2B28F5, 0x945651EB, 0x28ACA3D6, 0x515947AC, 0xA2B28F58,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x94FE32D1, 0x29FC65A2, 0x53F8CB45, 0xA7F1968A, 0x4FE32D15, 0x9FC65A2A, 0x3F8CB455,
+            0x7F1968AB, 0xFE32D156, 0xFC65A2AD, 0xF8CB455B, 0xF1968AB7, 0xE32D156E, 0xC65A2ADC, 0x8CB455B9,
+            0x1968AB72, 0x32D156E5, 0x65A2ADCA, 0xCB455B94, 0x968AB728, 0x2D156E50, 0x5A2ADCA1, 0xB455B943,
+            0x68AB7286, 0xD156E50D, 0x3653F8CB, 0x6CA7F196, 0xD94FE32D, 0xB29FC65A, 0x653F8CB4, 0xCA7F1968,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x078728D5, 0x0F0E51AB, 0x1E1CA357, 0x3C3946AE, 0x78728D5C, 0xF0E51AB9, 0xE1CA3573,
+            0xC3946AE6, 0x8728D5CC, 0x0E51AB99, 0x1CA35732, 0x3946AE64, 0x728D5CC9, 0xE51AB993, 0xCA357326,
+            0x946AE64D, 0x28D5CC9A, 0x51AB9934, 0xA3573268, 0x46AE64D1, 0x8D5CC9A3, 0x1AB99347, 0x3573268E,
+            0x6AE64D1D, 0xD5CC9A3B, 0xAC1E1CA3, 0x583C3946, 0xB078728D, 0x60F0E51A, 0xC1E1CA35, 0x83C3946A,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x87656DDC, 0x0ECADBB9, 0x1D95B772, 0x3B2B6EE5, 0x7656DDCB, 0xECADBB97, 0xD95B772F,
+            0xB2B6EE5E, 0x656DDCBC, 0xCADBB978, 0x95B772F1, 0x2B6EE5E3, 0x56DDCBC7, 0xADBB978F, 0x5B772F1F,
+            0xB6EE5E3E, 0x6DDCBC7C, 0xDBB978F8, 0xB772F1F0, 0x6EE5E3E1, 0xDDCBC7C3, 0xBB978F86, 0x772F1F0D,
+            0xEE5E3E1A, 0xDCBC7C35, 0x3E1D95B7, 0x7C3B2B6E, 0xF87656DD, 0xF0ECADBB, 0xE1D95B77, 0xC3B2B6EE,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0xCF78B8FC, 0x9EF171F8, 0x3DE2E3F0, 0x7BC5C7E1, 0xF78B8FC2, 0xEF171F84, 0xDE2E3F08,
+            0xBC5C7E11, 0x78B8FC22, 0xF171F845, 0xE2E3F08A, 0xC5C7E115, 0x8B8FC22A, 0x171F8455, 0x2E3F08AB,
+            0x5C7E1156, 0xB8FC22AD, 0x71F8455A, 0xE3F08AB4, 0xC7E11568, 0x8FC22AD0, 0x1F8455A1, 0x3F08AB43,
+            0x7E115687, 0xFC22AD0F, 0x373DE2E3, 0x6E7BC5C7, 0xDCF78B8F, 0xB9EF171F, 0x73DE2E3F, 0xE7BC5C7E,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x67B06FF9, 0xCF60DFF2, 0x9EC1BFE4, 0x3D837FC8, 0x7B06FF91, 0xF60DFF22, 0xEC1BFE45,
+            0xD837FC8B, 0xB06FF917, 0x60DFF22E, 0xC1BFE45D, 0x837FC8BA, 0x06FF9175, 0x0DFF22EA, 0x1BFE45D5,
+            0x37FC8BAB, 0x6FF91757, 0xDFF22EAE, 0xBFE45D5C, 0x7FC8BAB9, 0xFF917572, 0xFF22EAE4, 0xFE45D5C8,
+            0xFC8BAB91, 0xF9175723, 0x959EC1BF, 0x2B3D837F, 0x567B06FF, 0xACF60DFF, 0x59EC1BFE, 0xB3D837FC,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x1B6EAFA5, 0x36DD5F4B, 0x6DBABE96, 0xDB757D2C, 0xB6EAFA58, 0x6DD5F4B0, 0xDBABE960,
+            0xB757D2C0, 0x6EAFA581, 0xDD5F4B03, 0xBABE9606, 0x757D2C0C, 0xEAFA5818, 0xD5F4B031, 0xABE96062,
+            0x57D2C0C5, 0xAFA5818A, 0x5F4B0315, 0xBE96062A, 0x7D2C0C54, 0xFA5818A8, 0xF4B03151, 0xE96062A3,
+            0xD2C0C546, 0xA5818A8D, 0x506DBABE, 0xA0DB757D, 0x41B6EAFA, 0x836DD5F4, 0x06DBABE9, 0x0DB757D2,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x722AA34D, 0xE455469B, 0xC8AA8D37, 0x91551A6F, 0x22AA34DF, 0x455469BE, 0x8AA8D37C,
+            0x1551A6F8, 0x2AA34DF1, 0x55469BE2, 0xAA8D37C4, 0x551A6F88, 0xAA34DF10, 0x5469BE20, 0xA8D37C41,
+            0x51A6F882, 0xA34DF104, 0x469BE209, 0x8D37C413, 0x1A6F8827, 0x34DF104E, 0x69BE209C, 0xD37C4138,
+            0xA6F88270, 0x4DF104E0, 0xE9C8AA8D, 0xD391551A, 0xA722AA34, 0x4E455469, 0x9C8AA8D3, 0x391551A6,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x76079D7D, 0xEC0F3AFB, 0xD81E75F7, 0xB03CEBEF, 0x6079D7DE, 0xC0F3AFBD, 0x81E75F7B,
+            0x03CEBEF7, 0x079D7DEF, 0x0F3AFBDF, 0x1E75F7BF, 0x3CEBEF7E, 0x79D7DEFC, 0xF3AFBDF8, 0xE75F7BF0,
+            0xCEBEF7E0, 0x9D7DEFC1, 0x3AFBDF83, 0x75F7BF06, 0xEBEF7E0C, 0xD7DEFC18, 0xAFBDF830, 0x5F7BF061,
+            0xBEF7E0C2, 0x7DEFC184, 0x8DD81E75, 0x1BB03CEB, 0x376079D7, 0x6EC0F3AF, 0xDD81E75F, 0xBB03CEBE,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0xF0BC8FED, 0xE1791FDB, 0xC2F23FB6, 0x85E47F6D, 0x0BC8FEDB, 0x1791FDB7, 0x2F23FB6F,
+            0x5E47F6DF, 0xBC8FEDBF, 0x791FDB7E, 0xF23FB6FC, 0xE47F6DF9, 0xC8FEDBF3, 0x91FDB7E7, 0x23FB6FCF,
+            0x47F6DF9F, 0x8FEDBF3E, 0x1FDB7E7D, 0x3FB6FCFB, 0x7F6DF9F7, 0xFEDBF3EE, 0xFDB7E7DD, 0xFB6FCFBA,
+            0xF6DF9F74, 0xEDBF3EE9, 0x2BC2F23F, 0x5785E47F, 0xAF0BC8FE, 0x5E1791FD, 0xBC2F23FB, 0x785E47F6,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x353BBB68, 0x6A7776D1, 0xD4EEEDA3, 0xA9DDDB47, 0x53BBB68F, 0xA7776D1E, 0x4EEEDA3D,
+            0x9DDDB47B, 0x3BBB68F7, 0x7776D1EF, 0xEEEDA3DE, 0xDDDB47BD, 0xBBB68F7A, 0x776D1EF5, 0xEEDA3DEA,
+            0xDDB47BD5, 0xBB68F7AA, 0x76D1EF55, 0xEDA3DEAB, 0xDB47BD56, 0xB68F7AAC, 0x6D1EF558, 0xDA3DEAB0,
+            0xB47BD561, 0x68F7AAC2, 0xE4D4EEED, 0xC9A9DDDB, 0x9353BBB6, 0x26A7776D, 0x4D4EEEDA, 0x9A9DDDB4,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0xE3F2DE34, 0xC7E5BC68, 0x8FCB78D0, 0x1F96F1A1, 0x3F2DE343, 0x7E5BC687, 0xFCB78D0F,
+            0xF96F1A1F, 0xF2DE343E, 0xE5BC687D, 0xCB78D0FA, 0x96F1A1F4, 0x2DE343E8, 0x5BC687D1, 0xB78D0FA2,
+            0x6F1A1F45, 0xDE343E8A, 0xBC687D15, 0x78D0FA2A, 0xF1A1F455, 0xE343E8AA, 0xC687D154, 0x8D0FA2A9,
+            0x1A1F4553, 0x343E8AA6, 0x8B8FCB78, 0x171F96F1, 0x2E3F2DE3, 0x5C7E5BC6, 0xB8FCB78D, 0x71F96F1A,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x7DFA1698, 0xFBF42D30, 0xF7E85A60, 0xEFD0B4C0, 0xDFA16980, 0xBF42D300, 0x7E85A601,
+            0xFD0B4C03, 0xFA169806, 0xF42D300D, 0xE85A601B, 0xD0B4C037, 0xA169806F, 0x42D300DF, 0x85A601BF,
+            0x0B4C037F, 0x169806FF, 0x2D300DFE, 0x5A601BFD, 0xB4C037FB, 0x69806FF6, 0xD300DFEC, 0xA601BFD8,
+            0x4C037FB0, 0x9806FF61, 0x4DF7E85A, 0x9BEFD0B4, 0x37DFA169, 0x6FBF42D3, 0xDF7E85A6, 0xBEFD0B4C,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x418E24E4, 0x831C49C8, 0x06389391, 0x0C712722, 0x18E24E44, 0x31C49C88, 0x63893911,
+            0xC7127222, 0x8E24E444, 0x1C49C888, 0x38939110, 0x71272220, 0xE24E4440, 0xC49C8881, 0x89391103,
+            0x12722207, 0x24E4440E, 0x49C8881C, 0x93911038, 0x27222071, 0x4E4440E3, 0x9C8881C7, 0x3911038E,
+            0x7222071D, 0xE4440E3B, 0x89063893, 0x120C7127, 0x2418E24E, 0x4831C49C, 0x90638939, 0x20C71272,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x12597F5D, 0x24B2FEBA, 0x4965FD74, 0x92CBFAE8, 0x2597F5D0, 0x4B2FEBA1, 0x965FD742,
+            0x2CBFAE84, 0x597F5D08, 0xB2FEBA10, 0x65FD7420, 0xCBFAE840, 0x97F5D080, 0x2FEBA101, 0x5FD74203,
+            0xBFAE8406, 0x7F5D080D, 0xFEBA101A, 0xFD742035, 0xFAE8406A, 0xF5D080D5, 0xEBA101AA, 0xD7420354,
+            0xAE8406A8, 0x5D080D50, 0xA84965FD, 0x5092CBFA, 0xA12597F5, 0x424B2FEB, 0x84965FD7, 0x092CBFAE,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0xCAAAC9AC, 0x95559359, 0x2AAB26B3, 0x55564D66, 0xAAAC9ACC, 0x55593598, 0xAAB26B30,
+            0x5564D660, 0xAAC9ACC0, 0x55935980, 0xAB26B300, 0x564D6601, 0xAC9ACC03, 0x59359806, 0xB26B300C,
+            0x64D66018, 0xC9ACC031, 0x93598062, 0x26B300C5, 0x4D66018A, 0x9ACC0314, 0x35980628, 0x6B300C51,
+            0xD66018A2, 0xACC03145, 0x932AAB26, 0x2655564D, 0x4CAAAC9A, 0x99555935, 0x32AAB26B, 0x655564D6,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x6975F778, 0xD2EBEEF0, 0xA5D7DDE1, 0x4BAFBBC3, 0x975F7786, 0x2EBEEF0D, 0x5D7DDE1A,
+            0xBAFBBC34, 0x75F77868, 0xEBEEF0D0, 0xD7DDE1A0, 0xAFBBC340, 0x5F778681, 0xBEEF0D02, 0x7DDE1A04,
+            0xFBBC3408, 0xF7786810, 0xEEF0D020, 0xDDE1A041, 0xBBC34082, 0x77868105, 0xEF0D020A, 0xDE1A0414,
+            0xBC340829, 0x78681052, 0x99A5D7DD, 0x334BAFBB, 0x66975F77, 0xCD2EBEEF, 0x9A5D7DDE, 0x34BAFBBC,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0xAE8EDBE4, 0x5D1DB7C8, 0xBA3B6F90, 0x7476DF20, 0xE8EDBE41, 0xD1DB7C83, 0xA3B6F906,
+            0x476DF20D, 0x8EDBE41A, 0x1DB7C834, 0x3B6F9069, 0x76DF20D3, 0xEDBE41A7, 0xDB7C834E, 0xB6F9069C,
+            0x6DF20D38, 0xDBE41A70, 0xB7C834E0, 0x6F9069C1, 0xDF20D382, 0xBE41A704, 0x7C834E08, 0xF9069C11,
+            0xF20D3822, 0xE41A7045, 0x66BA3B6F, 0xCD7476DF, 0x9AE8EDBE, 0x35D1DB7C, 0x6BA3B6F9, 0xD7476DF2,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x79E6FF48, 0xF3CDFE90, 0xE79BFD20, 0xCF37FA40, 0x9E6FF480, 0x3CDFE900, 0x79BFD200,
+            0xF37FA400, 0xE6FF4800, 0xCDFE9001, 0x9BFD2002, 0x37FA4005, 0x6FF4800B, 0xDFE90016, 0xBFD2002C,
+            0x7FA40059, 0xFF4800B2, 0xFE900164, 0xFD2002C9, 0xFA400592, 0xF4800B25, 0xE900164B, 0xD2002C96,
+            0xA400592D, 0x4800B25A, 0xE9E79BFD, 0xD3CF37FA, 0xA79E6FF4, 0x4F3CDFE9, 0x9E79BFD2, 0x3CF37FA4,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x6FBED921, 0xDF7DB242, 0xBEFB6484, 0x7DF6C908, 0xFBED9210, 0xF7DB2420, 0xEFB64840,
+            0xDF6C9080, 0xBED92100, 0x7DB24200, 0xFB648400, 0xF6C90800, 0xED921001, 0xDB242002, 0xB6484004,
+            0x6C908008, 0xD9210011, 0xB2420022, 0x64840044, 0xC9080089, 0x92100112, 0x24200224, 0x48400448,
+            0x90800891, 0x21001122, 0x2DBEFB64, 0x5B7DF6C9, 0xB6FBED92, 0x6DF7DB24, 0xDBEFB648, 0xB7DF6C90,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x29A49240, 0x53492481, 0xA6924902, 0x4D249204, 0x9A492408, 0x34924810, 0x69249020,
+            0xD2492040, 0xA4924081, 0x49248102, 0x92490204, 0x24920408, 0x49240810, 0x92481020, 0x24902040,
+            0x49204080, 0x92408100, 0x24810200, 0x49020400, 0x92040800, 0x24081000, 0x48102000, 0x90204001,
+            0x20408002, 0x40810004, 0xA8A69249, 0x514D2492, 0xA29A4924, 0x45349248, 0x8A692490, 0x14D24920,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x34924800, 0x69249000, 0xD2492000, 0xA4924001, 0x49248002, 0x92490004, 0x24920008,
+            0x49240010, 0x92480020, 0x24900040, 0x49200080, 0x92400100, 0x24800200, 0x49000400, 0x92000800,
+            0x24001000, 0x48002000, 0x90004001, 0x20008002, 0x40010004, 0x80020009, 0x00040012, 0x00080024,
+            0x00100048, 0x00200090, 0x34D24920, 0x69A49240, 0xD3492480, 0xA6924900, 0x4D249200, 0x9A492400,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x49200000, 0x92400000, 0x24800000, 0x49000000, 0x92000000, 0x24000000, 0x48000000,
+            0x90000001, 0x20000002, 0x40000004, 0x80000009, 0x00000012, 0x00000024, 0x00000048, 0x00000090,
+            0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
+            0x00012000, 0x00024000, 0x49248000, 0x92490000, 0x24920000, 0x49240000, 0x92480000, 0x24900000,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000001, 0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082,
+            0x00000104, 0x00000208, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000001,
+            0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082, 0x00000104,
+            0x00000208, 0x00000410, 0x00000820, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400,
+            0x00020800, 0x00041000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400, 0x00020800, 0x00041000,
+            0x00082000, 0x00104000, 0x00208000, 0x00410000, 0x00820000, 0x01040000, 0x02080001, 0x04100002,
+            0x08200004, 0x10400008, 0x20800010, 0x41000020, 0x82000040, 0x04000080, 0x08000100, 0x10000200,
+            0x20000400, 0x40000800, 0x80000041, 0x00000082, 0x00000104, 0x00000208, 0x00000410, 0x00000820,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00800800, 0x01001000, 0x02002001, 0x04004002, 0x08008004, 0x10010008, 0x20020010,
+            0x40040020, 0x80080041, 0x00100082, 0x00200104, 0x00400208, 0x00800410, 0x01000820, 0x02001041,
+            0x04002082, 0x08004104, 0x10008208, 0x20010410, 0x40020820, 0x80041041, 0x00082082, 0x00104104,
+            0x00208208, 0x00410410, 0x00020020, 0x00040040, 0x00080080, 0x00100100, 0x00200200, 0x00400400,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00304000, 0x00608000, 0x00C10000, 0x01820000, 0x03040001, 0x06080003, 0x0C100006,
+            0x1820000C, 0x30400018, 0x60800030, 0xC1000061, 0x820000C2, 0x04000184, 0x08000308, 0x10000610,
+            0x20000C20, 0x40001840, 0x80003081, 0x00006102, 0x0000C204, 0x00018408, 0x00030810, 0x00061020,
+            0x000C2040, 0x00184080, 0x0000C100, 0x00018200, 0x00030400, 0x00060800, 0x000C1000, 0x00182000,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x08014504, 0x10028A08, 0x20051410, 0x400A2820, 0x80145041, 0x0028A082, 0x00514104,
+            0x00A28208, 0x01450410, 0x028A0821, 0x05141042, 0x0A282085, 0x1450410A, 0x28A08214, 0x51410428,
+            0xA2820850, 0x450410A0, 0x8A082140, 0x14104280, 0x28208500, 0x50410A00, 0xA0821401, 0x41042802,
+            0x82085004, 0x0410A008, 0x00200514, 0x00400A28, 0x00801450, 0x010028A0, 0x02005141, 0x0400A282,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x9848804D, 0x3091009A, 0x61220134, 0xC2440268, 0x848804D1, 0x091009A2, 0x12201345,
+            0x2440268A, 0x48804D14, 0x91009A29, 0x22013453, 0x440268A6, 0x8804D14D, 0x1009A29A, 0x20134534,
+            0x40268A68, 0x804D14D1, 0x009A29A2, 0x01345344, 0x0268A689, 0x04D14D12, 0x09A29A24, 0x13453449,
+            0x268A6893, 0x4D14D126, 0x02612201, 0x04C24402, 0x09848804, 0x13091009, 0x26122013, 0x4C244026,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x31440878, 0x628810F1, 0xC51021E3, 0x8A2043C6, 0x1440878C, 0x28810F18, 0x51021E30,
+            0xA2043C60, 0x440878C0, 0x8810F181, 0x1021E302, 0x2043C604, 0x40878C08, 0x810F1811, 0x021E3023,
+            0x043C6046, 0x0878C08C, 0x10F18118, 0x21E30230, 0x43C60461, 0x878C08C2, 0x0F181185, 0x1E30230B,
+            0x3C604616, 0x78C08C2C, 0xC0C51021, 0x818A2043, 0x03144087, 0x0628810F, 0x0C51021E, 0x18A2043C,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x45651EB0, 0x8ACA3D60, 0x15947AC0, 0x2B28F581, 0x5651EB03, 0xACA3D607, 0x5947AC0E,
+            0xB28F581C, 0x651EB038, 0xCA3D6070, 0x947AC0E1, 0x28F581C2, 0x51EB0384, 0xA3D60708, 0x47AC0E11,
+            0x8F581C22, 0x1EB03845, 0x3D60708A, 0x7AC0E115, 0xF581C22B, 0xEB038456, 0xD60708AC, 0xAC0E1159,
+            0x581C22B2, 0xB0384565, 0x2515947A, 0x4A2B28F5, 0x945651EB, 0x28ACA3D6, 0x515947AC, 0xA2B28F58,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x94FE32D1, 0x29FC65A2, 0x53F8CB45, 0xA7F1968A, 0x4FE32D15, 0x9FC65A2A, 0x3F8CB455,
+            0x7F1968AB, 0xFE32D156, 0xFC65A2AD, 0xF8CB455B, 0xF1968AB7, 0xE32D156E, 0xC65A2ADC, 0x8CB455B9,
+            0x1968AB72, 0x32D156E5, 0x65A2ADCA, 0xCB455B94, 0x968AB728, 0x2D156E50, 0x5A2ADCA1, 0xB455B943,
+            0x68AB7286, 0xD156E50D, 0x3653F8CB, 0x6CA7F196, 0xD94FE32D, 0xB29FC65A, 0x653F8CB4, 0xCA7F1968,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x078728D5, 0x0F0E51AB, 0x1E1CA357, 0x3C3946AE, 0x78728D5C, 0xF0E51AB9, 0xE1CA3573,
+            0xC3946AE6, 0x8728D5CC, 0x0E51AB99, 0x1CA35732, 0x3946AE64, 0x728D5CC9, 0xE51AB993, 0xCA357326,
+            0x946AE64D, 0x28D5CC9A, 0x51AB9934, 0xA3573268, 0x46AE64D1, 0x8D5CC9A3, 0x1AB99347, 0x3573268E,
+            0x6AE64D1D, 0xD5CC9A3B, 0xAC1E1CA3, 0x583C3946, 0xB078728D, 0x60F0E51A, 0xC1E1CA35, 0x83C3946A,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x87656DDC, 0x0ECADBB9, 0x1D95B772, 0x3B2B6EE5, 0x7656DDCB, 0xECADBB97, 0xD95B772F,
+            0xB2B6EE5E, 0x656DDCBC, 0xCADBB978, 0x95B772F1, 0x2B6EE5E3, 0x56DDCBC7, 0xADBB978F, 0x5B772F1F,
+            0xB6EE5E3E, 0x6DDCBC7C, 0xDBB978F8, 0xB772F1F0, 0x6EE5E3E1, 0xDDCBC7C3, 0xBB978F86, 0x772F1F0D,
+            0xEE5E3E1A, 0xDCBC7C35, 0x3E1D95B7, 0x7C3B2B6E, 0xF87656DD, 0xF0ECADBB, 0xE1D95B77, 0xC3B2B6EE,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0xCF78B8FC, 0x9EF171F8, 0x3DE2E3F0, 0x7BC5C7E1, 0xF78B8FC2, 0xEF171F84, 0xDE2E3F08,
+            0xBC5C7E11, 0x78B8FC22, 0xF171F845, 0xE2E3F08A, 0xC5C7E115, 0x8B8FC22A, 0x171F8455, 0x2E3F08AB,
+            0x5C7E1156, 0xB8FC22AD, 0x71F8455A, 0xE3F08AB4, 0xC7E11568, 0x8FC22AD0, 0x1F8455A1, 0x3F08AB43,
+            0x7E115687, 0xFC22AD0F, 0x373DE2E3, 0x6E7BC5C7, 0xDCF78B8F, 0xB9EF171F, 0x73DE2E3F, 0xE7BC5C7E,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x67B06FF9, 0xCF60DFF2, 0x9EC1BFE4, 0x3D837FC8, 0x7B06FF91, 0xF60DFF22, 0xEC1BFE45,
+            0xD837FC8B, 0xB06FF917, 0x60DFF22E, 0xC1BFE45D, 0x837FC8BA, 0x06FF9175, 0x0DFF22EA, 0x1BFE45D5,
+            0x37FC8BAB, 0x6FF91757, 0xDFF22EAE, 0xBFE45D5C, 0x7FC8BAB9, 0xFF917572, 0xFF22EAE4, 0xFE45D5C8,
+            0xFC8BAB91, 0xF9175723, 0x959EC1BF, 0x2B3D837F, 0x567B06FF, 0xACF60DFF, 0x59EC1BFE, 0xB3D837FC,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x1B6EAFA5, 0x36DD5F4B, 0x6DBABE96, 0xDB757D2C, 0xB6EAFA58, 0x6DD5F4B0, 0xDBABE960,
+            0xB757D2C0, 0x6EAFA581, 0xDD5F4B03, 0xBABE9606, 0x757D2C0C, 0xEAFA5818, 0xD5F4B031, 0xABE96062,
+            0x57D2C0C5, 0xAFA5818A, 0x5F4B0315, 0xBE96062A, 0x7D2C0C54, 0xFA5818A8, 0xF4B03151, 0xE96062A3,
+            0xD2C0C546, 0xA5818A8D, 0x506DBABE, 0xA0DB757D, 0x41B6EAFA, 0x836DD5F4, 0x06DBABE9, 0x0DB757D2,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x722AA34D, 0xE455469B, 0xC8AA8D37, 0x91551A6F, 0x22AA34DF, 0x455469BE, 0x8AA8D37C,
+            0x1551A6F8, 0x2AA34DF1, 0x55469BE2, 0xAA8D37C4, 0x551A6F88, 0xAA34DF10, 0x5469BE20, 0xA8D37C41,
+            0x51A6F882, 0xA34DF104, 0x469BE209, 0x8D37C413, 0x1A6F8827, 0x34DF104E, 0x69BE209C, 0xD37C4138,
+            0xA6F88270, 0x4DF104E0, 0xE9C8AA8D, 0xD391551A, 0xA722AA34, 0x4E455469, 0x9C8AA8D3, 0x391551A6,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x76079D7D, 0xEC0F3AFB, 0xD81E75F7, 0xB03CEBEF, 0x6079D7DE, 0xC0F3AFBD, 0x81E75F7B,
+            0x03CEBEF7, 0x079D7DEF, 0x0F3AFBDF, 0x1E75F7BF, 0x3CEBEF7E, 0x79D7DEFC, 0xF3AFBDF8, 0xE75F7BF0,
+            0xCEBEF7E0, 0x9D7DEFC1, 0x3AFBDF83, 0x75F7BF06, 0xEBEF7E0C, 0xD7DEFC18, 0xAFBDF830, 0x5F7BF061,
+            0xBEF7E0C2, 0x7DEFC184, 0x8DD81E75, 0x1BB03CEB, 0x376079D7, 0x6EC0F3AF, 0xDD81E75F, 0xBB03CEBE,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0xF0BC8FED, 0xE1791FDB, 0xC2F23FB6, 0x85E47F6D, 0x0BC8FEDB, 0x1791FDB7, 0x2F23FB6F,
+            0x5E47F6DF, 0xBC8FEDBF, 0x791FDB7E, 0xF23FB6FC, 0xE47F6DF9, 0xC8FEDBF3, 0x91FDB7E7, 0x23FB6FCF,
+            0x47F6DF9F, 0x8FEDBF3E, 0x1FDB7E7D, 0x3FB6FCFB, 0x7F6DF9F7, 0xFEDBF3EE, 0xFDB7E7DD, 0xFB6FCFBA,
+            0xF6DF9F74, 0xEDBF3EE9, 0x2BC2F23F, 0x5785E47F, 0xAF0BC8FE, 0x5E1791FD, 0xBC2F23FB, 0x785E47F6,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x353BBB68, 0x6A7776D1, 0xD4EEEDA3, 0xA9DDDB47, 0x53BBB68F, 0xA7776D1E, 0x4EEEDA3D,
+            0x9DDDB47B, 0x3BBB68F7, 0x7776D1EF, 0xEEEDA3DE, 0xDDDB47BD, 0xBBB68F7A, 0x776D1EF5, 0xEEDA3DEA,
+            0xDDB47BD5, 0xBB68F7AA, 0x76D1EF55, 0xEDA3DEAB, 0xDB47BD56, 0xB68F7AAC, 0x6D1EF558, 0xDA3DEAB0,
+            0xB47BD561, 0x68F7AAC2, 0xE4D4EEED, 0xC9A9DDDB, 0x9353BBB6, 0x26A7776D, 0x4D4EEEDA, 0x9A9DDDB4,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0xE3F2DE34, 0xC7E5BC68, 0x8FCB78D0, 0x1F96F1A1, 0x3F2DE343, 0x7E5BC687, 0xFCB78D0F,
+            0xF96F1A1F, 0xF2DE343E, 0xE5BC687D, 0xCB78D0FA, 0x96F1A1F4, 0x2DE343E8, 0x5BC687D1, 0xB78D0FA2,
+            0x6F1A1F45, 0xDE343E8A, 0xBC687D15, 0x78D0FA2A, 0xF1A1F455, 0xE343E8AA, 0xC687D154, 0x8D0FA2A9,
+            0x1A1F4553, 0x343E8AA6, 0x8B8FCB78, 0x171F96F1, 0x2E3F2DE3, 0x5C7E5BC6, 0xB8FCB78D, 0x71F96F1A,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x7DFA1698, 0xFBF42D30, 0xF7E85A60, 0xEFD0B4C0, 0xDFA16980, 0xBF42D300, 0x7E85A601,
+            0xFD0B4C03, 0xFA169806, 0xF42D300D, 0xE85A601B, 0xD0B4C037, 0xA169806F, 0x42D300DF, 0x85A601BF,
+            0x0B4C037F, 0x169806FF, 0x2D300DFE, 0x5A601BFD, 0xB4C037FB, 0x69806FF6, 0xD300DFEC, 0xA601BFD8,
+            0x4C037FB0, 0x9806FF61, 0x4DF7E85A, 0x9BEFD0B4, 0x37DFA169, 0x6FBF42D3, 0xDF7E85A6, 0xBEFD0B4C,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x418E24E4, 0x831C49C8, 0x06389391, 0x0C712722, 0x18E24E44, 0x31C49C88, 0x63893911,
+            0xC7127222, 0x8E24E444, 0x1C49C888, 0x38939110, 0x71272220, 0xE24E4440, 0xC49C8881, 0x89391103,
+            0x12722207, 0x24E4440E, 0x49C8881C, 0x93911038, 0x27222071, 0x4E4440E3, 0x9C8881C7, 0x3911038E,
+            0x7222071D, 0xE4440E3B, 0x89063893, 0x120C7127, 0x2418E24E, 0x4831C49C, 0x90638939, 0x20C71272,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x12597F5D, 0x24B2FEBA, 0x4965FD74, 0x92CBFAE8, 0x2597F5D0, 0x4B2FEBA1, 0x965FD742,
+            0x2CBFAE84, 0x597F5D08, 0xB2FEBA10, 0x65FD7420, 0xCBFAE840, 0x97F5D080, 0x2FEBA101, 0x5FD74203,
+            0xBFAE8406, 0x7F5D080D, 0xFEBA101A, 0xFD742035, 0xFAE8406A, 0xF5D080D5, 0xEBA101AA, 0xD7420354,
+            0xAE8406A8, 0x5D080D50, 0xA84965FD, 0x5092CBFA, 0xA12597F5, 0x424B2FEB, 0x84965FD7, 0x092CBFAE,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0xCAAAC9AC, 0x95559359, 0x2AAB26B3, 0x55564D66, 0xAAAC9ACC, 0x55593598, 0xAAB26B30,
+            0x5564D660, 0xAAC9ACC0, 0x55935980, 0xAB26B300, 0x564D6601, 0xAC9ACC03, 0x59359806, 0xB26B300C,
+            0x64D66018, 0xC9ACC031, 0x93598062, 0x26B300C5, 0x4D66018A, 0x9ACC0314, 0x35980628, 0x6B300C51,
+            0xD66018A2, 0xACC03145, 0x932AAB26, 0x2655564D, 0x4CAAAC9A, 0x99555935, 0x32AAB26B, 0x655564D6,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x6975F778, 0xD2EBEEF0, 0xA5D7DDE1, 0x4BAFBBC3, 0x975F7786, 0x2EBEEF0D, 0x5D7DDE1A,
+            0xBAFBBC34, 0x75F77868, 0xEBEEF0D0, 0xD7DDE1A0, 0xAFBBC340, 0x5F778681, 0xBEEF0D02, 0x7DDE1A04,
+            0xFBBC3408, 0xF7786810, 0xEEF0D020, 0xDDE1A041, 0xBBC34082, 0x77868105, 0xEF0D020A, 0xDE1A0414,
+            0xBC340829, 0x78681052, 0x99A5D7DD, 0x334BAFBB, 0x66975F77, 0xCD2EBEEF, 0x9A5D7DDE, 0x34BAFBBC,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0xAE8EDBE4, 0x5D1DB7C8, 0xBA3B6F90, 0x7476DF20, 0xE8EDBE41, 0xD1DB7C83, 0xA3B6F906,
+            0x476DF20D, 0x8EDBE41A, 0x1DB7C834, 0x3B6F9069, 0x76DF20D3, 0xEDBE41A7, 0xDB7C834E, 0xB6F9069C,
+            0x6DF20D38, 0xDBE41A70, 0xB7C834E0, 0x6F9069C1, 0xDF20D382, 0xBE41A704, 0x7C834E08, 0xF9069C11,
+            0xF20D3822, 0xE41A7045, 0x66BA3B6F, 0xCD7476DF, 0x9AE8EDBE, 0x35D1DB7C, 0x6BA3B6F9, 0xD7476DF2,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x79E6FF48, 0xF3CDFE90, 0xE79BFD20, 0xCF37FA40, 0x9E6FF480, 0x3CDFE900, 0x79BFD200,
+            0xF37FA400, 0xE6FF4800, 0xCDFE9001, 0x9BFD2002, 0x37FA4005, 0x6FF4800B, 0xDFE90016, 0xBFD2002C,
+            0x7FA40059, 0xFF4800B2, 0xFE900164, 0xFD2002C9, 0xFA400592, 0xF4800B25, 0xE900164B, 0xD2002C96,
+            0xA400592D, 0x4800B25A, 0xE9E79BFD, 0xD3CF37FA, 0xA79E6FF4, 0x4F3CDFE9, 0x9E79BFD2, 0x3CF37FA4,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x6FBED921, 0xDF7DB242, 0xBEFB6484, 0x7DF6C908, 0xFBED9210, 0xF7DB2420, 0xEFB64840,
+            0xDF6C9080, 0xBED92100, 0x7DB24200, 0xFB648400, 0xF6C90800, 0xED921001, 0xDB242002, 0xB6484004,
+            0x6C908008, 0xD9210011, 0xB2420022, 0x64840044, 0xC9080089, 0x92100112, 0x24200224, 0x48400448,
+            0x90800891, 0x21001122, 0x2DBEFB64, 0x5B7DF6C9, 0xB6FBED92, 0x6DF7DB24, 0xDBEFB648, 0xB7DF6C90,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x29A49240, 0x53492481, 0xA6924902, 0x4D249204, 0x9A492408, 0x34924810, 0x69249020,
+            0xD2492040, 0xA4924081, 0x49248102, 0x92490204, 0x24920408, 0x49240810, 0x92481020, 0x24902040,
+            0x49204080, 0x92408100, 0x24810200, 0x49020400, 0x92040800, 0x24081000, 0x48102000, 0x90204001,
+            0x20408002, 0x40810004, 0xA8A69249, 0x514D2492, 0xA29A4924, 0x45349248, 0x8A692490, 0x14D24920,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x34924800, 0x69249000, 0xD2492000, 0xA4924001, 0x49248002, 0x92490004, 0x24920008,
+            0x49240010, 0x92480020, 0x24900040, 0x49200080, 0x92400100, 0x24800200, 0x49000400, 0x92000800,
+            0x24001000, 0x48002000, 0x90004001, 0x20008002, 0x40010004, 0x80020009, 0x00040012, 0x00080024,
+            0x00100048, 0x00200090, 0x34D24920, 0x69A49240, 0xD3492480, 0xA6924900, 0x4D249200, 0x9A492400,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x49200000, 0x92400000, 0x24800000, 0x49000000, 0x92000000, 0x24000000, 0x48000000,
+            0x90000001, 0x20000002, 0x40000004, 0x80000009, 0x00000012, 0x00000024, 0x00000048, 0x00000090,
+            0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
+            0x00012000, 0x00024000, 0x49248000, 0x92490000, 0x24920000, 0x49240000, 0x92480000, 0x24900000,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000001, 0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082,
+            0x00000104, 0x00000208, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000001,
+            0x04000002, 0x08000004, 0x10000008, 0x20000010, 0x40000020, 0x80000041, 0x00000082, 0x00000104,
+            0x00000208, 0x00000410, 0x00000820, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400,
+            0x00020800, 0x00041000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00001040, 0x00002080, 0x00004100, 0x00008200, 0x00010400, 0x00020800, 0x00041000,
+            0x00082000, 0x00104000, 0x00208000, 0x00410000, 0x00820000, 0x01040000, 0x02080001, 0x04100002,
+            0x08200004, 0x10400008, 0x20800010, 0x41000020, 0x82000040, 0x04000080, 0x08000100, 0x10000200,
+            0x20000400, 0x40000800, 0x80000041, 0x00000082, 0x00000104, 0x00000208, 0x00000410, 0x00000820,
+        },
+    },
+};
+
+/* LFSR113 z1: previous, matrix^2147483646 */
+const BitColumnMatrix32_t lfsr113_1_prev_matrix =
+{
+    {
+        0x00000000, 0x04104000, 0x08208000, 0x10410000, 0x20820000, 0x41040000, 0x82080000, 0x04100000,
+        0x08200000, 0x10400000, 0x20800000, 0x41000000, 0x82000000, 0x04000000, 0x08000000, 0x10000000,
+        0x20000000, 0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010, 0x00000020,
+        0x00000040, 0x00000080, 0x04104100, 0x08208200, 0x10410400, 0x20820800, 0x41041000, 0x82082000,
+    },
+};
+
+/* LFSR113 z2: LFSR (s1 = 2, s2 = 27, s3 = 2, mask = 0xFFFFFFF8) */
+const BitColumnMatrix32_t lfsr113_2_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
+            0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
+            0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000008, 0x00000010,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00808000, 0x01010000, 0x02020000, 0x04040000, 0x08080001,
+            0x10100002, 0x20200005, 0x4040000A, 0x80800014, 0x01000028, 0x02000050, 0x040000A0, 0x08000141,
+            0x10000282, 0x20000505, 0x40000A0A, 0x80001414, 0x00002828, 0x00005050, 0x0000A0A0, 0x00014140,
+            0x00028280, 0x00050500, 0x000A0A00, 0x00141400, 0x00282800, 0x00505000, 0x00202000, 0x00404000,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x08014001, 0x10028002, 0x20050005, 0x400A000A, 0x80140014,
+            0x00280028, 0x00500050, 0x00A000A0, 0x01400140, 0x02800280, 0x05000500, 0x0A000A01, 0x14001402,
+            0x28002804, 0x50005008, 0xA000A011, 0x40014022, 0x80028044, 0x00050088, 0x000A0110, 0x00140220,
+            0x00280440, 0x00500880, 0x00A01100, 0x01402200, 0x02804400, 0x05008800, 0x02005000, 0x0400A000,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x23400005, 0x4680000A, 0x8D000015, 0x1A00002B, 0x34000057,
+            0x680000AE, 0xD000015C, 0xA00002B9, 0x40000572, 0x80000AE4, 0x000015C8, 0x00002B90, 0x00005720,
+            0x0000AE40, 0x00015C80, 0x0002B900, 0x00057200, 0x000AE400, 0x0015C800, 0x002B9000, 0x00572000,
+            0x00AE4000, 0x015C8000, 0x02B90000, 0x05720000, 0x0AE40001, 0x15C80002, 0x08D00001, 0x11A00002,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14115002, 0x2822A004, 0x50454008, 0xA08A8011, 0x41150022,
+            0x822A0044, 0x04540088, 0x08A80111, 0x11500222, 0x22A00445, 0x4540088A, 0x8A801115, 0x1500222A,
+            0x2A004454, 0x540088A8, 0xA8011150, 0x500222A0, 0xA0044541, 0x40088A82, 0x80111504, 0x00222A08,
+            0x00445410, 0x0088A820, 0x01115040, 0x0222A080, 0x04454100, 0x088A8201, 0x05045400, 0x0A08A801,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x27700505, 0x4EE00A0B, 0x9DC01417, 0x3B80282E, 0x7700505D,
+            0xEE00A0BA, 0xDC014175, 0xB80282EA, 0x700505D5, 0xE00A0BAB, 0xC0141756, 0x80282EAC, 0x00505D58,
+            0x00A0BAB0, 0x01417560, 0x0282EAC0, 0x0505D580, 0x0A0BAB01, 0x14175602, 0x282EAC04, 0x505D5808,
+            0xA0BAB011, 0x41756022, 0x82EAC044, 0x05D58088, 0x0BAB0111, 0x17560222, 0x09DC0141, 0x13B80282,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14436102, 0x2886C204, 0x510D8408, 0xA21B0811, 0x44361022,
+            0x886C2045, 0x10D8408A, 0x21B08115, 0x4361022A, 0x86C20454, 0x0D8408A9, 0x1B081153, 0x361022A7,
+            0x6C20454E, 0xD8408A9D, 0xB081153B, 0x61022A77, 0xC20454EE, 0x8408A9DC, 0x081153B9, 0x1022A772,
+            0x20454EE5, 0x408A9DCA, 0x81153B94, 0x022A7728, 0x0454EE50, 0x08A9DCA1, 0x0510D840, 0x0A21B081,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA7D07011, 0x4FA0E023, 0x9F41C047, 0x3E83808E, 0x7D07011C,
+            0xFA0E0238, 0xF41C0471, 0xE83808E2, 0xD07011C4, 0xA0E02389, 0x41C04712, 0x83808E24, 0x07011C48,
+            0x0E023891, 0x1C047123, 0x3808E246, 0x7011C48D, 0xE023891B, 0xC0471236, 0x808E246C, 0x011C48D8,
+            0x023891B0, 0x04712360, 0x08E246C1, 0x11C48D82, 0x23891B05, 0x4712360A, 0x29F41C04, 0x53E83808,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x56E01520, 0xADC02A40, 0x5B805481, 0xB700A903, 0x6E015206,
+            0xDC02A40D, 0xB805481A, 0x700A9035, 0xE015206B, 0xC02A40D6, 0x805481AC, 0x00A90358, 0x015206B0,
+            0x02A40D60, 0x05481AC0, 0x0A903581, 0x15206B02, 0x2A40D604, 0x5481AC08, 0xA9035810, 0x5206B020,
+            0xA40D6041, 0x481AC083, 0x90358106, 0x206B020D, 0x40D6041A, 0x81AC0834, 0x55B80548, 0xAB700A90,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55672480, 0xAACE4900, 0x559C9200, 0xAB392400, 0x56724800,
+            0xACE49000, 0x59C92001, 0xB3924003, 0x67248007, 0xCE49000F, 0x9C92001F, 0x3924003E, 0x7248007D,
+            0xE49000FB, 0xC92001F7, 0x924003EE, 0x248007DD, 0x49000FBB, 0x92001F76, 0x24003EED, 0x48007DDB,
+            0x9000FBB6, 0x2001F76D, 0x4003EEDA, 0x8007DDB4, 0x000FBB68, 0x001F76D0, 0x5559C920, 0xAAB39240,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xF5D74C41, 0xEBAE9882, 0xD75D3104, 0xAEBA6208, 0x5D74C411,
+            0xBAE98822, 0x75D31045, 0xEBA6208A, 0xD74C4114, 0xAE988228, 0x5D310451, 0xBA6208A2, 0x74C41145,
+            0xE988228A, 0xD3104514, 0xA6208A29, 0x4C411453, 0x988228A7, 0x3104514F, 0x6208A29F, 0xC411453E,
+            0x88228A7D, 0x104514FA, 0x208A29F5, 0x411453EA, 0x8228A7D4, 0x04514FA8, 0xFD75D310, 0xFAEBA620,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA35E1741, 0x46BC2E82, 0x8D785D05, 0x1AF0BA0B, 0x35E17417,
+            0x6BC2E82E, 0xD785D05C, 0xAF0BA0B8, 0x5E174171, 0xBC2E82E2, 0x785D05C4, 0xF0BA0B89, 0xE1741713,
+            0xC2E82E26, 0x85D05C4C, 0x0BA0B899, 0x17417132, 0x2E82E264, 0x5D05C4C9, 0xBA0B8992, 0x74171325,
+            0xE82E264A, 0xD05C4C94, 0xA0B89929, 0x41713252, 0x82E264A4, 0x05C4C948, 0xA8D785D0, 0x51AF0BA0,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD433F604, 0xA867EC08, 0x50CFD810, 0xA19FB021, 0x433F6042,
+            0x867EC084, 0x0CFD8109, 0x19FB0213, 0x33F60427, 0x67EC084F, 0xCFD8109F, 0x9FB0213F, 0x3F60427E,
+            0x7EC084FC, 0xFD8109F8, 0xFB0213F0, 0xF60427E1, 0xEC084FC2, 0xD8109F85, 0xB0213F0B, 0x60427E17,
+            0xC084FC2E, 0x8109F85C, 0x0213F0B8, 0x0427E170, 0x084FC2E1, 0x109F85C2, 0xF50CFD81, 0xEA19FB02,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xBFF29112, 0x7FE52224, 0xFFCA4448, 0xFF948890, 0xFF291120,
+            0xFE522240, 0xFCA44480, 0xF9488900, 0xF2911201, 0xE5222403, 0xCA444807, 0x9488900E, 0x2911201C,
+            0x52224038, 0xA4448071, 0x488900E3, 0x911201C6, 0x2224038D, 0x4448071A, 0x88900E35, 0x11201C6A,
+            0x224038D5, 0x448071AA, 0x8900E355, 0x1201C6AA, 0x24038D55, 0x48071AAB, 0x2FFCA444, 0x5FF94889,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD8202135, 0xB040426B, 0x608084D7, 0xC10109AE, 0x8202135C,
+            0x040426B8, 0x08084D71, 0x10109AE2, 0x202135C5, 0x40426B8A, 0x8084D714, 0x0109AE28, 0x02135C50,
+            0x0426B8A0, 0x084D7141, 0x109AE282, 0x2135C505, 0x426B8A0A, 0x84D71414, 0x09AE2829, 0x135C5052,
+            0x26B8A0A5, 0x4D71414B, 0x9AE28297, 0x35C5052F, 0x6B8A0A5E, 0xD71414BC, 0x7608084D, 0xEC10109A,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14C034A2, 0x29806944, 0x5300D288, 0xA601A511, 0x4C034A23,
+            0x98069447, 0x300D288F, 0x601A511F, 0xC034A23E, 0x8069447C, 0x00D288F8, 0x01A511F0, 0x034A23E0,
+            0x069447C0, 0x0D288F81, 0x1A511F03, 0x34A23E07, 0x69447C0E, 0xD288F81C, 0xA511F039, 0x4A23E073,
+            0x9447C0E6, 0x288F81CC, 0x511F0398, 0xA23E0731, 0x447C0E62, 0x88F81CC5, 0x05300D28, 0x0A601A51,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x05F31880, 0x0BE63101, 0x17CC6202, 0x2F98C404, 0x5F318809,
+            0xBE631012, 0x7CC62024, 0xF98C4048, 0xF3188091, 0xE6310123, 0xCC620247, 0x98C4048F, 0x3188091F,
+            0x6310123F, 0xC620247E, 0x8C4048FD, 0x188091FB, 0x310123F7, 0x620247EF, 0xC4048FDE, 0x88091FBD,
+            0x10123F7A, 0x20247EF5, 0x4048FDEA, 0x8091FBD4, 0x0123F7A8, 0x0247EF50, 0x017CC620, 0x02F98C40,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA07C0911, 0x40F81222, 0x81F02444, 0x03E04888, 0x07C09110,
+            0x0F812221, 0x1F024443, 0x3E048886, 0x7C09110C, 0xF8122218, 0xF0244431, 0xE0488863, 0xC09110C6,
+            0x8122218C, 0x02444318, 0x04888630, 0x09110C61, 0x122218C2, 0x24443185, 0x4888630B, 0x9110C616,
+            0x22218C2D, 0x4443185A, 0x888630B5, 0x110C616A, 0x2218C2D5, 0x443185AA, 0x281F0244, 0x503E0488,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x54086030, 0xA810C060, 0x502180C0, 0xA0430181, 0x40860302,
+            0x810C0604, 0x02180C08, 0x04301810, 0x08603021, 0x10C06042, 0x2180C085, 0x4301810A, 0x86030214,
+            0x0C060429, 0x180C0853, 0x301810A7, 0x6030214F, 0xC060429E, 0x80C0853C, 0x01810A78, 0x030214F0,
+            0x060429E0, 0x0C0853C1, 0x1810A783, 0x30214F07, 0x60429E0F, 0xC0853C1E, 0xD502180C, 0xAA043018,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x57D001E0, 0xAFA003C0, 0x5F400781, 0xBE800F02, 0x7D001E04,
+            0xFA003C08, 0xF4007811, 0xE800F022, 0xD001E044, 0xA003C089, 0x40078112, 0x800F0224, 0x001E0448,
+            0x003C0890, 0x00781120, 0x00F02240, 0x01E04480, 0x03C08900, 0x07811200, 0x0F022401, 0x1E044803,
+            0x3C089006, 0x7811200C, 0xF0224019, 0xE0448033, 0xC0890066, 0x811200CC, 0x55F40078, 0xABE800F0,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55403F80, 0xAA807F00, 0x5500FE00, 0xAA01FC00, 0x5403F800,
+            0xA807F000, 0x500FE000, 0xA01FC001, 0x403F8002, 0x807F0004, 0x00FE0008, 0x01FC0010, 0x03F80020,
+            0x07F00040, 0x0FE00081, 0x1FC00103, 0x3F800206, 0x7F00040C, 0xFE000818, 0xFC001030, 0xF8002060,
+            0xF00040C1, 0xE0008183, 0xC0010306, 0x8002060C, 0x00040C18, 0x00081830, 0x55500FE0, 0xAAA01FC0,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55FFF800, 0xABFFF000, 0x57FFE000, 0xAFFFC000, 0x5FFF8001,
+            0xBFFF0002, 0x7FFE0004, 0xFFFC0008, 0xFFF80010, 0xFFF00020, 0xFFE00040, 0xFFC00080, 0xFF800100,
+            0xFF000200, 0xFE000400, 0xFC000800, 0xF8001000, 0xF0002001, 0xE0004003, 0xC0008006, 0x8001000C,
+            0x00020018, 0x00040030, 0x00080060, 0x001000C0, 0x00200180, 0x00400300, 0x557FFE00, 0xAAFFFC00,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFF80000, 0xFFF00000, 0xFFE00000, 0xFFC00000,
+            0xFF800000, 0xFF000000, 0xFE000000, 0xFC000000, 0xF8000000, 0xF0000001, 0xE0000003, 0xC0000006,
+            0x8000000C, 0x00000018, 0x00000030, 0x00000060, 0x000000C0, 0x00000180, 0x00000300, 0x00000600,
+            0x00000C00, 0x00001800, 0x00003000, 0x00006000, 0x0000C000, 0x00018000, 0xFFFF0000, 0xFFFE0000,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100,
+            0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000004, 0x00000008,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
+            0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
+            0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000008, 0x00000010,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00808000, 0x01010000, 0x02020000, 0x04040000, 0x08080001,
+            0x10100002, 0x20200005, 0x4040000A, 0x80800014, 0x01000028, 0x02000050, 0x040000A0, 0x08000141,
+            0x10000282, 0x20000505, 0x40000A0A, 0x80001414, 0x00002828, 0x00005050, 0x0000A0A0, 0x00014140,
+            0x00028280, 0x00050500, 0x000A0A00, 0x00141400, 0x00282800, 0x00505000, 0x00202000, 0x00404000,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x08014001, 0x10028002, 0x20050005, 0x400A000A, 0x80140014,
+            0x00280028, 0x00500050, 0x00A000A0, 0x01400140, 0x02800280, 0x05000500, 0x0A000A01, 0x14001402,
+            0x28002804, 0x50005008, 0xA000A011, 0x40014022, 0x80028044, 0x00050088, 0x000A0110, 0x00140220,
+            0x00280440, 0x00500880, 0x00A01100, 0x01402200, 0x02804400, 0x05008800, 0x02005000, 0x0400A000,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x23400005, 0x4680000A, 0x8D000015, 0x1A00002B, 0x34000057,
+            0x680000AE, 0xD000015C, 0xA00002B9, 0x40000572, 0x80000AE4, 0x000015C8, 0x00002B90, 0x00005720,
+            0x0000AE40, 0x00015C80, 0x0002B900, 0x00057200, 0x000AE400, 0x0015C800, 0x002B9000, 0x00572000,
+            0x00AE4000, 0x015C8000, 0x02B90000, 0x05720000, 0x0AE40001, 0x15C80002, 0x08D00001, 0x11A00002,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14115002, 0x2822A004, 0x50454008, 0xA08A8011, 0x41150022,
+            0x822A0044, 0x04540088, 0x08A80111, 0x11500222, 0x22A00445, 0x4540088A, 0x8A801115, 0x1500222A,
+            0x2A004454, 0x540088A8, 0xA8011150, 0x500222A0, 0xA0044541, 0x40088A82, 0x80111504, 0x00222A08,
+            0x00445410, 0x0088A820, 0x01115040, 0x0222A080, 0x04454100, 0x088A8201, 0x05045400, 0x0A08A801,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x27700505, 0x4EE00A0B, 0x9DC01417, 0x3B80282E, 0x7700505D,
+            0xEE00A0BA, 0xDC014175, 0xB80282EA, 0x700505D5, 0xE00A0BAB, 0xC0141756, 0x80282EAC, 0x00505D58,
+            0x00A0BAB0, 0x01417560, 0x0282EAC0, 0x0505D580, 0x0A0BAB01, 0x14175602, 0x282EAC04, 0x505D5808,
+            0xA0BAB011, 0x41756022, 0x82EAC044, 0x05D58088, 0x0BAB0111, 0x17560222, 0x09DC0141, 0x13B80282,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14436102, 0x2886C204, 0x510D8408, 0xA21B0811, 0x44361022,
+            0x886C2045, 0x10D8408A, 0x21B08115, 0x4361022A, 0x86C20454, 0x0D8408A9, 0x1B081153, 0x361022A7,
+            0x6C20454E, 0xD8408A9D, 0xB081153B, 0x61022A77, 0xC20454EE, 0x8408A9DC, 0x081153B9, 0x1022A772,
+            0x20454EE5, 0x408A9DCA, 0x81153B94, 0x022A7728, 0x0454EE50, 0x08A9DCA1, 0x0510D840, 0x0A21B081,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA7D07011, 0x4FA0E023, 0x9F41C047, 0x3E83808E, 0x7D07011C,
+            0xFA0E0238, 0xF41C0471, 0xE83808E2, 0xD07011C4, 0xA0E02389, 0x41C04712, 0x83808E24, 0x07011C48,
+            0x0E023891, 0x1C047123, 0x3808E246, 0x7011C48D, 0xE023891B, 0xC0471236, 0x808E246C, 0x011C48D8,
+            0x023891B0, 0x04712360, 0x08E246C1, 0x11C48D82, 0x23891B05, 0x4712360A, 0x29F41C04, 0x53E83808,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x56E01520, 0xADC02A40, 0x5B805481, 0xB700A903, 0x6E015206,
+            0xDC02A40D, 0xB805481A, 0x700A9035, 0xE015206B, 0xC02A40D6, 0x805481AC, 0x00A90358, 0x015206B0,
+            0x02A40D60, 0x05481AC0, 0x0A903581, 0x15206B02, 0x2A40D604, 0x5481AC08, 0xA9035810, 0x5206B020,
+            0xA40D6041, 0x481AC083, 0x90358106, 0x206B020D, 0x40D6041A, 0x81AC0834, 0x55B80548, 0xAB700A90,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55672480, 0xAACE4900, 0x559C9200, 0xAB392400, 0x56724800,
+            0xACE49000, 0x59C92001, 0xB3924003, 0x67248007, 0xCE49000F, 0x9C92001F, 0x3924003E, 0x7248007D,
+            0xE49000FB, 0xC92001F7, 0x924003EE, 0x248007DD, 0x49000FBB, 0x92001F76, 0x24003EED, 0x48007DDB,
+            0x9000FBB6, 0x2001F76D, 0x4003EEDA, 0x8007DDB4, 0x000FBB68, 0x001F76D0, 0x5559C920, 0xAAB39240,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xF5D74C41, 0xEBAE9882, 0xD75D3104, 0xAEBA6208, 0x5D74C411,
+            0xBAE98822, 0x75D31045, 0xEBA6208A, 0xD74C4114, 0xAE988228, 0x5D310451, 0xBA6208A2, 0x74C41145,
+            0xE988228A, 0xD3104514, 0xA6208A29, 0x4C411453, 0x988228A7, 0x3104514F, 0x6208A29F, 0xC411453E,
+            0x88228A7D, 0x104514FA, 0x208A29F5, 0x411453EA, 0x8228A7D4, 0x04514FA8, 0xFD75D310, 0xFAEBA620,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA35E1741, 0x46BC2E82, 0x8D785D05, 0x1AF0BA0B, 0x35E17417,
+            0x6BC2E82E, 0xD785D05C, 0xAF0BA0B8, 0x5E174171, 0xBC2E82E2, 0x785D05C4, 0xF0BA0B89, 0xE1741713,
+            0xC2E82E26, 0x85D05C4C, 0x0BA0B899, 0x17417132, 0x2E82E264, 0x5D05C4C9, 0xBA0B8992, 0x74171325,
+            0xE82E264A, 0xD05C4C94, 0xA0B89929, 0x41713252, 0x82E264A4, 0x05C4C948, 0xA8D785D0, 0x51AF0BA0,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD433F604, 0xA867EC08, 0x50CFD810, 0xA19FB021, 0x433F6042,
+            0x867EC084, 0x0CFD8109, 0x19FB0213, 0x33F60427, 0x67EC084F, 0xCFD8109F, 0x9FB0213F, 0x3F60427E,
+            0x7EC084FC, 0xFD8109F8, 0xFB0213F0, 0xF60427E1, 0xEC084FC2, 0xD8109F85, 0xB0213F0B, 0x60427E17,
+            0xC084FC2E, 0x8109F85C, 0x0213F0B8, 0x0427E170, 0x084FC2E1, 0x109F85C2, 0xF50CFD81, 0xEA19FB02,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xBFF29112, 0x7FE52224, 0xFFCA4448, 0xFF948890, 0xFF291120,
+            0xFE522240, 0xFCA44480, 0xF9488900, 0xF2911201, 0xE5222403, 0xCA444807, 0x9488900E, 0x2911201C,
+            0x52224038, 0xA4448071, 0x488900E3, 0x911201C6, 0x2224038D, 0x4448071A, 0x88900E35, 0x11201C6A,
+            0x224038D5, 0x448071AA, 0x8900E355, 0x1201C6AA, 0x24038D55, 0x48071AAB, 0x2FFCA444, 0x5FF94889,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD8202135, 0xB040426B, 0x608084D7, 0xC10109AE, 0x8202135C,
+            0x040426B8, 0x08084D71, 0x10109AE2, 0x202135C5, 0x40426B8A, 0x8084D714, 0x0109AE28, 0x02135C50,
+            0x0426B8A0, 0x084D7141, 0x109AE282, 0x2135C505, 0x426B8A0A, 0x84D71414, 0x09AE2829, 0x135C5052,
+            0x26B8A0A5, 0x4D71414B, 0x9AE28297, 0x35C5052F, 0x6B8A0A5E, 0xD71414BC, 0x7608084D, 0xEC10109A,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14C034A2, 0x29806944, 0x5300D288, 0xA601A511, 0x4C034A23,
+            0x98069447, 0x300D288F, 0x601A511F, 0xC034A23E, 0x8069447C, 0x00D288F8, 0x01A511F0, 0x034A23E0,
+            0x069447C0, 0x0D288F81, 0x1A511F03, 0x34A23E07, 0x69447C0E, 0xD288F81C, 0xA511F039, 0x4A23E073,
+            0x9447C0E6, 0x288F81CC, 0x511F0398, 0xA23E0731, 0x447C0E62, 0x88F81CC5, 0x05300D28, 0x0A601A51,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x05F31880, 0x0BE63101, 0x17CC6202, 0x2F98C404, 0x5F318809,
+            0xBE631012, 0x7CC62024, 0xF98C4048, 0xF3188091, 0xE6310123, 0xCC620247, 0x98C4048F, 0x3188091F,
+            0x6310123F, 0xC620247E, 0x8C4048FD, 0x188091FB, 0x310123F7, 0x620247EF, 0xC4048FDE, 0x88091FBD,
+            0x10123F7A, 0x20247EF5, 0x4048FDEA, 0x8091FBD4, 0x0123F7A8, 0x0247EF50, 0x017CC620, 0x02F98C40,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA07C0911, 0x40F81222, 0x81F02444, 0x03E04888, 0x07C09110,
+            0x0F812221, 0x1F024443, 0x3E048886, 0x7C09110C, 0xF8122218, 0xF0244431, 0xE0488863, 0xC09110C6,
+            0x8122218C, 0x02444318, 0x04888630, 0x09110C61, 0x122218C2, 0x24443185, 0x4888630B, 0x9110C616,
+            0x22218C2D, 0x4443185A, 0x888630B5, 0x110C616A, 0x2218C2D5, 0x443185AA, 0x281F0244, 0x503E0488,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x54086030, 0xA810C060, 0x502180C0, 0xA0430181, 0x40860302,
+            0x810C0604, 0x02180C08, 0x04301810, 0x08603021, 0x10C06042, 0x2180C085, 0x4301810A, 0x86030214,
+            0x0C060429, 0x180C0853, 0x301810A7, 0x6030214F, 0xC060429E, 0x80C0853C, 0x01810A78, 0x030214F0,
+            0x060429E0, 0x0C0853C1, 0x1810A783, 0x30214F07, 0x60429E0F, 0xC0853C1E, 0xD502180C, 0xAA043018,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x57D001E0, 0xAFA003C0, 0x5F400781, 0xBE800F02, 0x7D001E04,
+            0xFA003C08, 0xF4007811, 0xE800F022, 0xD001E044, 0xA003C089, 0x40078112, 0x800F0224, 0x001E0448,
+            0x003C0890, 0x00781120, 0x00F02240, 0x01E04480, 0x03C08900, 0x07811200, 0x0F022401, 0x1E044803,
+            0x3C089006, 0x7811200C, 0xF0224019, 0xE0448033, 0xC0890066, 0x811200CC, 0x55F40078, 0xABE800F0,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55403F80, 0xAA807F00, 0x5500FE00, 0xAA01FC00, 0x5403F800,
+            0xA807F000, 0x500FE000, 0xA01FC001, 0x403F8002, 0x807F0004, 0x00FE0008, 0x01FC0010, 0x03F80020,
+            0x07F00040, 0x0FE00081, 0x1FC00103, 0x3F800206, 0x7F00040C, 0xFE000818, 0xFC001030, 0xF8002060,
+            0xF00040C1, 0xE0008183, 0xC0010306, 0x8002060C, 0x00040C18, 0x00081830, 0x55500FE0, 0xAAA01FC0,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55FFF800, 0xABFFF000, 0x57FFE000, 0xAFFFC000, 0x5FFF8001,
+            0xBFFF0002, 0x7FFE0004, 0xFFFC0008, 0xFFF80010, 0xFFF00020, 0xFFE00040, 0xFFC00080, 0xFF800100,
+            0xFF000200, 0xFE000400, 0xFC000800, 0xF8001000, 0xF0002001, 0xE0004003, 0xC0008006, 0x8001000C,
+            0x00020018, 0x00040030, 0x00080060, 0x001000C0, 0x00200180, 0x00400300, 0x557FFE00, 0xAAFFFC00,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFF80000, 0xFFF00000, 0xFFE00000, 0xFFC00000,
+            0xFF800000, 0xFF000000, 0xFE000000, 0xFC000000, 0xF8000000, 0xF0000001, 0xE0000003, 0xC0000006,
+            0x8000000C, 0x00000018, 0x00000030, 0x00000060, 0x000000C0, 0x00000180, 0x00000300, 0x00000600,
+            0x00000C00, 0x00001800, 0x00003000, 0x00006000, 0x0000C000, 0x00018000, 0xFFFF0000, 0xFFFE0000,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100,
+            0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000004, 0x00000008,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
+            0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
+            0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000008, 0x00000010,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+};
+
+/* LFSR113 z2: previous, matrix^536870910 */
+const BitColumnMatrix32_t lfsr113_2_prev_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x40000002, 0x80000004, 0x00000008, 0x00000010, 0x00000020,
+        0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000,
+        0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000,
+        0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x50000000, 0xA0000001,
+    },
+};
+
+/* LFSR113 z3: LFSR (s1 = 13, s2 = 21, s3 = 7, mask = 0xFFFFFFF0) */
+const BitColumnMatrix32_t lfsr113_3_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000,
+            0x00008001, 0x00010002, 0x00020004, 0x00040008, 0x00080010, 0x00100020, 0x00200040, 0x00400080,
+            0x00800100, 0x01000200, 0x02000400, 0x04000000, 0x08000000, 0x10000001, 0x20000002, 0x40000004,
+            0x80000008, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040008, 0x00080010, 0x00100020, 0x00200040,
+            0x00400080, 0x00800100, 0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002,
+            0x40008005, 0x8001000A, 0x00020014, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008001, 0x00010002, 0x00020004,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020014, 0x00040028, 0x00080050, 0x001000A0,
+            0x00200140, 0x00400280, 0x00800500, 0x01000A00, 0x02001400, 0x04002800, 0x08005000, 0x1000A000,
+            0x20014000, 0x40028001, 0x80050002, 0x00080010, 0x00100020, 0x00200040, 0x00400080, 0x00800100,
+            0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002, 0x40008005, 0x8001000A,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40008015, 0x8001002A, 0x00020054, 0x000400A8,
+            0x00080150, 0x001002A0, 0x00200540, 0x00400A80, 0x00801500, 0x01002A00, 0x02005400, 0x0400A801,
+            0x08015002, 0x1002A004, 0x20054008, 0x000A0004, 0x00140008, 0x00280010, 0x00500020, 0x00A00040,
+            0x01400080, 0x02800100, 0x05000200, 0x0A000400, 0x14000801, 0x28001002, 0x50002005, 0xA000400A,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14000811, 0x28001022, 0x50002045, 0xA000408A,
+            0x40008115, 0x8001022A, 0x00020454, 0x000408A8, 0x00081150, 0x001022A0, 0x00204540, 0x00408A81,
+            0x00811502, 0x01022A04, 0x02045408, 0x1008A000, 0x20114000, 0x40228001, 0x80450002, 0x008A0004,
+            0x01140008, 0x02280010, 0x04500020, 0x08A00040, 0x11400081, 0x22800102, 0x45000204, 0x8A000408,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01140018, 0x02280030, 0x04500060, 0x08A000C0,
+            0x11400181, 0x22800302, 0x45000604, 0x8A000C08, 0x14001811, 0x28003022, 0x50006045, 0xA000C08B,
+            0x40018117, 0x8003022E, 0x0006045C, 0x011808A0, 0x02301140, 0x04602280, 0x08C04500, 0x11808A00,
+            0x23011400, 0x46022800, 0x8C045000, 0x1808A000, 0x30114001, 0x60228003, 0xC0450006, 0x808A000C,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20230104, 0x40460208, 0x808C0410, 0x01180820,
+            0x02301040, 0x04602080, 0x08C04100, 0x11808200, 0x23010400, 0x46020800, 0x8C041000, 0x18082001,
+            0x30104003, 0x60208007, 0xC041000E, 0xA0A10118, 0x41420230, 0x82840460, 0x050808C0, 0x0A101180,
+            0x14202301, 0x28404602, 0x50808C04, 0xA1011808, 0x42023010, 0x84046020, 0x0808C041, 0x10118082,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5480B404, 0xA9016808, 0x5202D010, 0xA405A021,
+            0x480B4042, 0x90168084, 0x202D0108, 0x405A0210, 0x80B40420, 0x01680840, 0x02D01080, 0x05A02100,
+            0x0B404200, 0x16808400, 0x2D010800, 0x0E82A405, 0x1D05480B, 0x3A0A9016, 0x7415202D, 0xE82A405A,
+            0xD05480B4, 0xA0A90168, 0x415202D0, 0x82A405A0, 0x05480B40, 0x0A901680, 0x15202D01, 0x2A405A02,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D4148A3, 0x3A829146, 0x7505228D, 0xEA0A451A,
+            0xD4148A34, 0xA8291468, 0x505228D1, 0xA0A451A2, 0x4148A345, 0x8291468A, 0x05228D15, 0x0A451A2A,
+            0x148A3455, 0x291468AA, 0x5228D154, 0xB910EA0A, 0x7221D414, 0xE443A829, 0xC8875052, 0x910EA0A4,
+            0x221D4148, 0x443A8291, 0x88750522, 0x10EA0A45, 0x21D4148A, 0x43A82914, 0x87505228, 0x0EA0A451,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32553649, 0x64AA6C92, 0xC954D925, 0x92A9B24A,
+            0x25536494, 0x4AA6C929, 0x954D9252, 0x2A9B24A4, 0x55364949, 0xAA6C9293, 0x54D92527, 0xA9B24A4E,
+            0x5364949C, 0xA6C92938, 0x4D925270, 0xA97192A9, 0x52E32553, 0xA5C64AA6, 0x4B8C954D, 0x97192A9B,
+            0x2E325536, 0x5C64AA6C, 0xB8C954D9, 0x7192A9B2, 0xE3255364, 0xC64AA6C9, 0x8C954D92, 0x192A9B24,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x977770B7, 0x2EEEE16F, 0x5DDDC2DE, 0xBBBB85BC,
+            0x77770B79, 0xEEEE16F2, 0xDDDC2DE5, 0xBBB85BCB, 0x7770B796, 0xEEE16F2C, 0xDDC2DE58, 0xBB85BCB0,
+            0x770B7961, 0xEE16F2C3, 0xDC2DE586, 0x2F2CBBBB, 0x5E597777, 0xBCB2EEEE, 0x7965DDDC, 0xF2CBBBB8,
+            0xE5977770, 0xCB2EEEE1, 0x965DDDC2, 0x2CBBBB85, 0x5977770B, 0xB2EEEE16, 0x65DDDC2D, 0xCBBBB85B,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xB2E7B3E4, 0x65CF67C8, 0xCB9ECF91, 0x973D9F22,
+            0x2E7B3E44, 0x5CF67C89, 0xB9ECF912, 0x73D9F224, 0xE7B3E449, 0xCF67C893, 0x9ECF9126, 0x3D9F224D,
+            0x7B3E449B, 0xF67C8936, 0xECF9126C, 0x6B15973D, 0xD62B2E7B, 0xAC565CF6, 0x58ACB9EC, 0xB15973D9,
+            0x62B2E7B3, 0xC565CF67, 0x8ACB9ECF, 0x15973D9F, 0x2B2E7B3E, 0x565CF67C, 0xACB9ECF9, 0x5973D9F2,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9BD6A9F4, 0x37AD53E9, 0x6F5AA7D3, 0xDEB54FA7,
+            0xBD6A9F4E, 0x7AD53E9D, 0xF5AA7D3B, 0xEB54FA77, 0xD6A9F4EE, 0xAD53E9DD, 0x5AA7D3BA, 0xB54FA774,
+            0x6A9F4EE8, 0xD53E9DD0, 0xAA7D3BA0, 0xCF2CDEB5, 0x9E59BD6A, 0x3CB37AD5, 0x7966F5AA, 0xF2CDEB54,
+            0xE59BD6A9, 0xCB37AD53, 0x966F5AA7, 0x2CDEB54F, 0x59BD6A9F, 0xB37AD53E, 0x66F5AA7D, 0xCDEB54FA,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xAF23CCCD, 0x5E47999A, 0xBC8F3335, 0x791E666B,
+            0xF23CCCD6, 0xE47999AD, 0xC8F3335A, 0x91E666B5, 0x23CCCD6B, 0x47999AD7, 0x8F3335AE, 0x1E666B5D,
+            0x3CCCD6BA, 0x7999AD74, 0xF3335AE9, 0x4945791E, 0x928AF23C, 0x2515E479, 0x4A2BC8F3, 0x945791E6,
+            0x28AF23CC, 0x515E4799, 0xA2BC8F33, 0x45791E66, 0x8AF23CCC, 0x15E47999, 0x2BC8F333, 0x5791E666,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xB1D0AB0A, 0x63A15614, 0xC742AC29, 0x8E855852,
+            0x1D0AB0A4, 0x3A156149, 0x742AC292, 0xE8558525, 0xD0AB0A4B, 0xA1561496, 0x42AC292C, 0x85585258,
+            0x0AB0A4B1, 0x15614963, 0x2AC292C7, 0xE4558E85, 0xC8AB1D0A, 0x91563A15, 0x22AC742A, 0x4558E855,
+            0x8AB1D0AB, 0x1563A156, 0x2AC742AC, 0x558E8558, 0xAB1D0AB0, 0x563A1561, 0xAC742AC2, 0x58E85585,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6B65098C, 0xD6CA1319, 0xAD942632, 0x5B284C65,
+            0xB65098CA, 0x6CA13194, 0xD9426329, 0xB284C652, 0x65098CA5, 0xCA13194A, 0x94263295, 0x284C652A,
+            0x5098CA54, 0xA13194A9, 0x42632952, 0xEFA35B28, 0xDF46B650, 0xBE8D6CA1, 0x7D1AD942, 0xFA35B284,
+            0xF46B6509, 0xE8D6CA13, 0xD1AD9426, 0xA35B284C, 0x46B65098, 0x8D6CA131, 0x1AD94263, 0x35B284C6,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA6C3201C, 0x4D864038, 0x9B0C8070, 0x361900E1,
+            0x6C3201C2, 0xD8640385, 0xB0C8070B, 0x61900E16, 0xC3201C2C, 0x86403858, 0x0C8070B0, 0x1900E160,
+            0x3201C2C0, 0x64038581, 0xC8070B02, 0x36CD3619, 0x6D9A6C32, 0xDB34D864, 0xB669B0C8, 0x6CD36190,
+            0xD9A6C320, 0xB34D8640, 0x669B0C80, 0xCD361900, 0x9A6C3201, 0x34D86403, 0x69B0C807, 0xD361900E,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9E54F090, 0x3CA9E120, 0x7953C240, 0xF2A78480,
+            0xE54F0900, 0xCA9E1200, 0x953C2401, 0x2A784802, 0x54F09004, 0xA9E12008, 0x53C24011, 0xA7848023,
+            0x4F090046, 0x9E12008D, 0x3C24011B, 0xE61CF2A7, 0xCC39E54F, 0x9873CA9E, 0x30E7953C, 0x61CF2A78,
+            0xC39E54F0, 0x873CA9E1, 0x0E7953C2, 0x1CF2A784, 0x39E54F09, 0x73CA9E12, 0xE7953C24, 0xCF2A7848,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC6261FA0, 0x8C4C3F40, 0x18987E81, 0x3130FD02,
+            0x6261FA05, 0xC4C3F40B, 0x8987E817, 0x130FD02E, 0x261FA05D, 0x4C3F40BA, 0x987E8174, 0x30FD02E9,
+            0x61FA05D2, 0xC3F40BA4, 0x87E81748, 0xC9F63130, 0x93EC6261, 0x27D8C4C3, 0x4FB18987, 0x9F63130F,
+            0x3EC6261F, 0x7D8C4C3F, 0xFB18987E, 0xF63130FD, 0xEC6261FA, 0xD8C4C3F4, 0xB18987E8, 0x63130FD0,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9083D07E, 0x2107A0FD, 0x420F41FA, 0x841E83F5,
+            0x083D07EA, 0x107A0FD5, 0x20F41FAA, 0x41E83F54, 0x83D07EA8, 0x07A0FD51, 0x0F41FAA3, 0x1E83F546,
+            0x3D07EA8C, 0x7A0FD518, 0xF41FAA30, 0x78BC841E, 0xF179083D, 0xE2F2107A, 0xC5E420F4, 0x8BC841E8,
+            0x179083D0, 0x2F2107A0, 0x5E420F41, 0xBC841E83, 0x79083D07, 0xF2107A0F, 0xE420F41F, 0xC841E83F,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1C10EB70, 0x3821D6E0, 0x7043ADC0, 0xE0875B80,
+            0xC10EB701, 0x821D6E02, 0x043ADC05, 0x0875B80B, 0x10EB7017, 0x21D6E02F, 0x43ADC05F, 0x875B80BF,
+            0x0EB7017E, 0x1D6E02FD, 0x3ADC05FB, 0x69A8E087, 0xD351C10E, 0xA6A3821D, 0x4D47043A, 0x9A8E0875,
+            0x351C10EB, 0x6A3821D6, 0xD47043AD, 0xA8E0875B, 0x51C10EB7, 0xA3821D6E, 0x47043ADC, 0x8E0875B8,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04345AD8, 0x0868B5B1, 0x10D16B63, 0x21A2D6C7,
+            0x4345AD8F, 0x868B5B1E, 0x0D16B63D, 0x1A2D6C7B, 0x345AD8F6, 0x68B5B1ED, 0xD16B63DB, 0xA2D6C7B7,
+            0x45AD8F6F, 0x8B5B1EDE, 0x16B63DBD, 0x295821A2, 0x52B04345, 0xA560868B, 0x4AC10D16, 0x95821A2D,
+            0x2B04345A, 0x560868B5, 0xAC10D16B, 0x5821A2D6, 0xB04345AD, 0x60868B5B, 0xC10D16B6, 0x821A2D6C,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01A6422C, 0x034C8459, 0x069908B2, 0x0D321164,
+            0x1A6422C9, 0x34C84593, 0x69908B27, 0xD321164F, 0xA6422C9E, 0x4C84593C, 0x9908B278, 0x321164F1,
+            0x6422C9E3, 0xC84593C7, 0x908B278F, 0x20B00D32, 0x41601A64, 0x82C034C8, 0x05806990, 0x0B00D321,
+            0x1601A642, 0x2C034C84, 0x58069908, 0xB00D3211, 0x601A6422, 0xC034C845, 0x8069908B, 0x00D32116,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x69838651, 0xD3070CA3, 0xA60E1946, 0x4C1C328C,
+            0x98386519, 0x3070CA32, 0x60E19465, 0xC1C328CA, 0x83865194, 0x070CA329, 0x0E194652, 0x1C328CA4,
+            0x38651949, 0x70CA3293, 0xE1946526, 0xAAAB4C1C, 0x55569838, 0xAAAD3070, 0x555A60E1, 0xAAB4C1C3,
+            0x55698386, 0xAAD3070C, 0x55A60E19, 0xAB4C1C32, 0x56983865, 0xAD3070CA, 0x5A60E194, 0xB4C1C328,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6840A917, 0xD081522F, 0xA102A45F, 0x420548BE,
+            0x840A917D, 0x081522FA, 0x102A45F5, 0x20548BEB, 0x40A917D6, 0x81522FAC, 0x02A45F58, 0x0548BEB1,
+            0x0A917D62, 0x1522FAC4, 0x2A45F589, 0x3CCB4205, 0x7996840A, 0xF32D0815, 0xE65A102A, 0xCCB42054,
+            0x996840A9, 0x32D08152, 0x65A102A4, 0xCB420548, 0x96840A91, 0x2D081522, 0x5A102A45, 0xB420548B,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12040899, 0x24081132, 0x48102264, 0x902044C9,
+            0x20408993, 0x40811326, 0x8102264C, 0x02044C98, 0x04089931, 0x08113262, 0x102264C5, 0x2044C98B,
+            0x40899317, 0x8113262E, 0x02264C5C, 0x16489020, 0x2C912040, 0x59224081, 0xB2448102, 0x64890204,
+            0xC9120408, 0x92240811, 0x24481022, 0x48902044, 0x91204089, 0x22408113, 0x44810226, 0x8902044C,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8102040C, 0x02040818, 0x04081030, 0x08102060,
+            0x102040C1, 0x20408183, 0x40810306, 0x8102060C, 0x02040C18, 0x04081830, 0x08103060, 0x102060C1,
+            0x2040C183, 0x40818307, 0x8103060E, 0x83040810, 0x06081020, 0x0C102040, 0x18204081, 0x30408102,
+            0x60810204, 0xC1020408, 0x82040810, 0x04081020, 0x08102040, 0x10204081, 0x20408103, 0x40810206,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20008003, 0x40010006, 0x8002000C, 0x00040018,
+            0x00080030, 0x00100060, 0x002000C0, 0x00400180, 0x00800300, 0x01000600, 0x02000C00, 0x04001800,
+            0x08003000, 0x10006001, 0x2000C003, 0x60010004, 0xC0020008, 0x80040010, 0x00080020, 0x00100040,
+            0x00200080, 0x00400100, 0x00800200, 0x01000400, 0x02000800, 0x04001000, 0x08002000, 0x10004001,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000,
+            0x00008001, 0x00010002, 0x00020004, 0x00040008, 0x00080010, 0x00100020, 0x00200040, 0x00400080,
+            0x00800100, 0x01000200, 0x02000400, 0x04000000, 0x08000000, 0x10000001, 0x20000002, 0x40000004,
+            0x80000008, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040008, 0x00080010, 0x00100020, 0x00200040,
+            0x00400080, 0x00800100, 0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002,
+            0x40008005, 0x8001000A, 0x00020014, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008001, 0x00010002, 0x00020004,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020014, 0x00040028, 0x00080050, 0x001000A0,
+            0x00200140, 0x00400280, 0x00800500, 0x01000A00, 0x02001400, 0x04002800, 0x08005000, 0x1000A000,
+            0x20014000, 0x40028001, 0x80050002, 0x00080010, 0x00100020, 0x00200040, 0x00400080, 0x00800100,
+            0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002, 0x40008005, 0x8001000A,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40008015, 0x8001002A, 0x00020054, 0x000400A8,
+            0x00080150, 0x001002A0, 0x00200540, 0x00400A80, 0x00801500, 0x01002A00, 0x02005400, 0x0400A801,
+            0x08015002, 0x1002A004, 0x20054008, 0x000A0004, 0x00140008, 0x00280010, 0x00500020, 0x00A00040,
+            0x01400080, 0x02800100, 0x05000200, 0x0A000400, 0x14000801, 0x28001002, 0x50002005, 0xA000400A,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14000811, 0x28001022, 0x50002045, 0xA000408A,
+            0x40008115, 0x8001022A, 0x00020454, 0x000408A8, 0x00081150, 0x001022A0, 0x00204540, 0x00408A81,
+            0x00811502, 0x01022A04, 0x02045408, 0x1008A000, 0x20114000, 0x40228001, 0x80450002, 0x008A0004,
+            0x01140008, 0x02280010, 0x04500020, 0x08A00040, 0x11400081, 0x22800102, 0x45000204, 0x8A000408,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01140018, 0x02280030, 0x04500060, 0x08A000C0,
+            0x11400181, 0x22800302, 0x45000604, 0x8A000C08, 0x14001811, 0x28003022, 0x50006045, 0xA000C08B,
+            0x40018117, 0x8003022E, 0x0006045C, 0x011808A0, 0x02301140, 0x04602280, 0x08C04500, 0x11808A00,
+            0x23011400, 0x46022800, 0x8C045000, 0x1808A000, 0x30114001, 0x60228003, 0xC0450006, 0x808A000C,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20230104, 0x40460208, 0x808C0410, 0x01180820,
+            0x02301040, 0x04602080, 0x08C04100, 0x11808200, 0x23010400, 0x46020800, 0x8C041000, 0x18082001,
+            0x30104003, 0x60208007, 0xC041000E, 0xA0A10118, 0x41420230, 0x82840460, 0x050808C0, 0x0A101180,
+            0x14202301, 0x28404602, 0x50808C04, 0xA1011808, 0x42023010, 0x84046020, 0x0808C041, 0x10118082,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5480B404, 0xA9016808, 0x5202D010, 0xA405A021,
+            0x480B4042, 0x90168084, 0x202D0108, 0x405A0210, 0x80B40420, 0x01680840, 0x02D01080, 0x05A02100,
+            0x0B404200, 0x16808400, 0x2D010800, 0x0E82A405, 0x1D05480B, 0x3A0A9016, 0x7415202D, 0xE82A405A,
+            0xD05480B4, 0xA0A90168, 0x415202D0, 0x82A405A0, 0x05480B40, 0x0A901680, 0x15202D01, 0x2A405A02,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D4148A3, 0x3A829146, 0x7505228D, 0xEA0A451A,
+            0xD4148A34, 0xA8291468, 0x505228D1, 0xA0A451A2, 0x4148A345, 0x8291468A, 0x05228D15, 0x0A451A2A,
+            0x148A3455, 0x291468AA, 0x5228D154, 0xB910EA0A, 0x7221D414, 0xE443A829, 0xC8875052, 0x910EA0A4,
+            0x221D4148, 0x443A8291, 0x88750522, 0x10EA0A45, 0x21D4148A, 0x43A82914, 0x87505228, 0x0EA0A451,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32553649, 0x64AA6C92, 0xC954D925, 0x92A9B24A,
+            0x25536494, 0x4AA6C929, 0x954D9252, 0x2A9B24A4, 0x55364949, 0xAA6C9293, 0x54D92527, 0xA9B24A4E,
+            0x5364949C, 0xA6C92938, 0x4D925270, 0xA97192A9, 0x52E32553, 0xA5C64AA6, 0x4B8C954D, 0x97192A9B,
+            0x2E325536, 0x5C64AA6C, 0xB8C954D9, 0x7192A9B2, 0xE3255364, 0xC64AA6C9, 0x8C954D92, 0x192A9B24,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x977770B7, 0x2EEEE16F, 0x5DDDC2DE, 0xBBBB85BC,
+            0x77770B79, 0xEEEE16F2, 0xDDDC2DE5, 0xBBB85BCB, 0x7770B796, 0xEEE16F2C, 0xDDC2DE58, 0xBB85BCB0,
+            0x770B7961, 0xEE16F2C3, 0xDC2DE586, 0x2F2CBBBB, 0x5E597777, 0xBCB2EEEE, 0x7965DDDC, 0xF2CBBBB8,
+            0xE5977770, 0xCB2EEEE1, 0x965DDDC2, 0x2CBBBB85, 0x5977770B, 0xB2EEEE16, 0x65DDDC2D, 0xCBBBB85B,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xB2E7B3E4, 0x65CF67C8, 0xCB9ECF91, 0x973D9F22,
+            0x2E7B3E44, 0x5CF67C89, 0xB9ECF912, 0x73D9F224, 0xE7B3E449, 0xCF67C893, 0x9ECF9126, 0x3D9F224D,
+            0x7B3E449B, 0xF67C8936, 0xECF9126C, 0x6B15973D, 0xD62B2E7B, 0xAC565CF6, 0x58ACB9EC, 0xB15973D9,
+            0x62B2E7B3, 0xC565CF67, 0x8ACB9ECF, 0x15973D9F, 0x2B2E7B3E, 0x565CF67C, 0xACB9ECF9, 0x5973D9F2,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9BD6A9F4, 0x37AD53E9, 0x6F5AA7D3, 0xDEB54FA7,
+            0xBD6A9F4E, 0x7AD53E9D, 0xF5AA7D3B, 0xEB54FA77, 0xD6A9F4EE, 0xAD53E9DD, 0x5AA7D3BA, 0xB54FA774,
+            0x6A9F4EE8, 0xD53E9DD0, 0xAA7D3BA0, 0xCF2CDEB5, 0x9E59BD6A, 0x3CB37AD5, 0x7966F5AA, 0xF2CDEB54,
+            0xE59BD6A9, 0xCB37AD53, 0x966F5AA7, 0x2CDEB54F, 0x59BD6A9F, 0xB37AD53E, 0x66F5AA7D, 0xCDEB54FA,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xAF23CCCD, 0x5E47999A, 0xBC8F3335, 0x791E666B,
+            0xF23CCCD6, 0xE47999AD, 0xC8F3335A, 0x91E666B5, 0x23CCCD6B, 0x47999AD7, 0x8F3335AE, 0x1E666B5D,
+            0x3CCCD6BA, 0x7999AD74, 0xF3335AE9, 0x4945791E, 0x928AF23C, 0x2515E479, 0x4A2BC8F3, 0x945791E6,
+            0x28AF23CC, 0x515E4799, 0xA2BC8F33, 0x45791E66, 0x8AF23CCC, 0x15E47999, 0x2BC8F333, 0x5791E666,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xB1D0AB0A, 0x63A15614, 0xC742AC29, 0x8E855852,
+            0x1D0AB0A4, 0x3A156149, 0x742AC292, 0xE8558525, 0xD0AB0A4B, 0xA1561496, 0x42AC292C, 0x85585258,
+            0x0AB0A4B1, 0x15614963, 0x2AC292C7, 0xE4558E85, 0xC8AB1D0A, 0x91563A15, 0x22AC742A, 0x4558E855,
+            0x8AB1D0AB, 0x1563A156, 0x2AC742AC, 0x558E8558, 0xAB1D0AB0, 0x563A1561, 0xAC742AC2, 0x58E85585,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6B65098C, 0xD6CA1319, 0xAD942632, 0x5B284C65,
+            0xB65098CA, 0x6CA13194, 0xD9426329, 0xB284C652, 0x65098CA5, 0xCA13194A, 0x94263295, 0x284C652A,
+            0x5098CA54, 0xA13194A9, 0x42632952, 0xEFA35B28, 0xDF46B650, 0xBE8D6CA1, 0x7D1AD942, 0xFA35B284,
+            0xF46B6509, 0xE8D6CA13, 0xD1AD9426, 0xA35B284C, 0x46B65098, 0x8D6CA131, 0x1AD94263, 0x35B284C6,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA6C3201C, 0x4D864038, 0x9B0C8070, 0x361900E1,
+            0x6C3201C2, 0xD8640385, 0xB0C8070B, 0x61900E16, 0xC3201C2C, 0x86403858, 0x0C8070B0, 0x1900E160,
+            0x3201C2C0, 0x64038581, 0xC8070B02, 0x36CD3619, 0x6D9A6C32, 0xDB34D864, 0xB669B0C8, 0x6CD36190,
+            0xD9A6C320, 0xB34D8640, 0x669B0C80, 0xCD361900, 0x9A6C3201, 0x34D86403, 0x69B0C807, 0xD361900E,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9E54F090, 0x3CA9E120, 0x7953C240, 0xF2A78480,
+            0xE54F0900, 0xCA9E1200, 0x953C2401, 0x2A784802, 0x54F09004, 0xA9E12008, 0x53C24011, 0xA7848023,
+            0x4F090046, 0x9E12008D, 0x3C24011B, 0xE61CF2A7, 0xCC39E54F, 0x9873CA9E, 0x30E7953C, 0x61CF2A78,
+            0xC39E54F0, 0x873CA9E1, 0x0E7953C2, 0x1CF2A784, 0x39E54F09, 0x73CA9E12, 0xE7953C24, 0xCF2A7848,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC6261FA0, 0x8C4C3F40, 0x18987E81, 0x3130FD02,
+            0x6261FA05, 0xC4C3F40B, 0x8987E817, 0x130FD02E, 0x261FA05D, 0x4C3F40BA, 0x987E8174, 0x30FD02E9,
+            0x61FA05D2, 0xC3F40BA4, 0x87E81748, 0xC9F63130, 0x93EC6261, 0x27D8C4C3, 0x4FB18987, 0x9F63130F,
+            0x3EC6261F, 0x7D8C4C3F, 0xFB18987E, 0xF63130FD, 0xEC6261FA, 0xD8C4C3F4, 0xB18987E8, 0x63130FD0,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9083D07E, 0x2107A0FD, 0x420F41FA, 0x841E83F5,
+            0x083D07EA, 0x107A0FD5, 0x20F41FAA, 0x41E83F54, 0x83D07EA8, 0x07A0FD51, 0x0F41FAA3, 0x1E83F546,
+            0x3D07EA8C, 0x7A0FD518, 0xF41FAA30, 0x78BC841E, 0xF179083D, 0xE2F2107A, 0xC5E420F4, 0x8BC841E8,
+            0x179083D0, 0x2F2107A0, 0x5E420F41, 0xBC841E83, 0x79083D07, 0xF2107A0F, 0xE420F41F, 0xC841E83F,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1C10EB70, 0x3821D6E0, 0x7043ADC0, 0xE0875B80,
+            0xC10EB701, 0x821D6E02, 0x043ADC05, 0x0875B80B, 0x10EB7017, 0x21D6E02F, 0x43ADC05F, 0x875B80BF,
+            0x0EB7017E, 0x1D6E02FD, 0x3ADC05FB, 0x69A8E087, 0xD351C10E, 0xA6A3821D, 0x4D47043A, 0x9A8E0875,
+            0x351C10EB, 0x6A3821D6, 0xD47043AD, 0xA8E0875B, 0x51C10EB7, 0xA3821D6E, 0x47043ADC, 0x8E0875B8,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04345AD8, 0x0868B5B1, 0x10D16B63, 0x21A2D6C7,
+            0x4345AD8F, 0x868B5B1E, 0x0D16B63D, 0x1A2D6C7B, 0x345AD8F6, 0x68B5B1ED, 0xD16B63DB, 0xA2D6C7B7,
+            0x45AD8F6F, 0x8B5B1EDE, 0x16B63DBD, 0x295821A2, 0x52B04345, 0xA560868B, 0x4AC10D16, 0x95821A2D,
+            0x2B04345A, 0x560868B5, 0xAC10D16B, 0x5821A2D6, 0xB04345AD, 0x60868B5B, 0xC10D16B6, 0x821A2D6C,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01A6422C, 0x034C8459, 0x069908B2, 0x0D321164,
+            0x1A6422C9, 0x34C84593, 0x69908B27, 0xD321164F, 0xA6422C9E, 0x4C84593C, 0x9908B278, 0x321164F1,
+            0x6422C9E3, 0xC84593C7, 0x908B278F, 0x20B00D32, 0x41601A64, 0x82C034C8, 0x05806990, 0x0B00D321,
+            0x1601A642, 0x2C034C84, 0x58069908, 0xB00D3211, 0x601A6422, 0xC034C845, 0x8069908B, 0x00D32116,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x69838651, 0xD3070CA3, 0xA60E1946, 0x4C1C328C,
+            0x98386519, 0x3070CA32, 0x60E19465, 0xC1C328CA, 0x83865194, 0x070CA329, 0x0E194652, 0x1C328CA4,
+            0x38651949, 0x70CA3293, 0xE1946526, 0xAAAB4C1C, 0x55569838, 0xAAAD3070, 0x555A60E1, 0xAAB4C1C3,
+            0x55698386, 0xAAD3070C, 0x55A60E19, 0xAB4C1C32, 0x56983865, 0xAD3070CA, 0x5A60E194, 0xB4C1C328,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6840A917, 0xD081522F, 0xA102A45F, 0x420548BE,
+            0x840A917D, 0x081522FA, 0x102A45F5, 0x20548BEB, 0x40A917D6, 0x81522FAC, 0x02A45F58, 0x0548BEB1,
+            0x0A917D62, 0x1522FAC4, 0x2A45F589, 0x3CCB4205, 0x7996840A, 0xF32D0815, 0xE65A102A, 0xCCB42054,
+            0x996840A9, 0x32D08152, 0x65A102A4, 0xCB420548, 0x96840A91, 0x2D081522, 0x5A102A45, 0xB420548B,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12040899, 0x24081132, 0x48102264, 0x902044C9,
+            0x20408993, 0x40811326, 0x8102264C, 0x02044C98, 0x04089931, 0x08113262, 0x102264C5, 0x2044C98B,
+            0x40899317, 0x8113262E, 0x02264C5C, 0x16489020, 0x2C912040, 0x59224081, 0xB2448102, 0x64890204,
+            0xC9120408, 0x92240811, 0x24481022, 0x48902044, 0x91204089, 0x22408113, 0x44810226, 0x8902044C,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8102040C, 0x02040818, 0x04081030, 0x08102060,
+            0x102040C1, 0x20408183, 0x40810306, 0x8102060C, 0x02040C18, 0x04081830, 0x08103060, 0x102060C1,
+            0x2040C183, 0x40818307, 0x8103060E, 0x83040810, 0x06081020, 0x0C102040, 0x18204081, 0x30408102,
+            0x60810204, 0xC1020408, 0x82040810, 0x04081020, 0x08102040, 0x10204081, 0x20408103, 0x40810206,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20008003, 0x40010006, 0x8002000C, 0x00040018,
+            0x00080030, 0x00100060, 0x002000C0, 0x00400180, 0x00800300, 0x01000600, 0x02000C00, 0x04001800,
+            0x08003000, 0x10006001, 0x2000C003, 0x60010004, 0xC0020008, 0x80040010, 0x00080020, 0x00100040,
+            0x00200080, 0x00400100, 0x00800200, 0x01000400, 0x02000800, 0x04001000, 0x08002000, 0x10004001,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000,
+            0x00008001, 0x00010002, 0x00020004, 0x00040008, 0x00080010, 0x00100020, 0x00200040, 0x00400080,
+            0x00800100, 0x01000200, 0x02000400, 0x04000000, 0x08000000, 0x10000001, 0x20000002, 0x40000004,
+            0x80000008, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040008, 0x00080010, 0x00100020, 0x00200040,
+            0x00400080, 0x00800100, 0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002,
+            0x40008005, 0x8001000A, 0x00020014, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008001, 0x00010002, 0x00020004,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020014, 0x00040028, 0x00080050, 0x001000A0,
+            0x00200140, 0x00400280, 0x00800500, 0x01000A00, 0x02001400, 0x04002800, 0x08005000, 0x1000A000,
+            0x20014000, 0x40028001, 0x80050002, 0x00080010, 0x00100020, 0x00200040, 0x00400080, 0x00800100,
+            0x01000200, 0x02000400, 0x04000800, 0x08001000, 0x10002001, 0x20004002, 0x40008005, 0x8001000A,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40008015, 0x8001002A, 0x00020054, 0x000400A8,
+            0x00080150, 0x001002A0, 0x00200540, 0x00400A80, 0x00801500, 0x01002A00, 0x02005400, 0x0400A801,
+            0x08015002, 0x1002A004, 0x20054008, 0x000A0004, 0x00140008, 0x00280010, 0x00500020, 0x00A00040,
+            0x01400080, 0x02800100, 0x05000200, 0x0A000400, 0x14000801, 0x28001002, 0x50002005, 0xA000400A,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14000811, 0x28001022, 0x50002045, 0xA000408A,
+            0x40008115, 0x8001022A, 0x00020454, 0x000408A8, 0x00081150, 0x001022A0, 0x00204540, 0x00408A81,
+            0x00811502, 0x01022A04, 0x02045408, 0x1008A000, 0x20114000, 0x40228001, 0x80450002, 0x008A0004,
+            0x01140008, 0x02280010, 0x04500020, 0x08A00040, 0x11400081, 0x22800102, 0x45000204, 0x8A000408,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01140018, 0x02280030, 0x04500060, 0x08A000C0,
+            0x11400181, 0x22800302, 0x45000604, 0x8A000C08, 0x14001811, 0x28003022, 0x50006045, 0xA000C08B,
+            0x40018117, 0x8003022E, 0x0006045C, 0x011808A0, 0x02301140, 0x04602280, 0x08C04500, 0x11808A00,
+            0x23011400, 0x46022800, 0x8C045000, 0x1808A000, 0x30114001, 0x60228003, 0xC0450006, 0x808A000C,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20230104, 0x40460208, 0x808C0410, 0x01180820,
+            0x02301040, 0x04602080, 0x08C04100, 0x11808200, 0x23010400, 0x46020800, 0x8C041000, 0x18082001,
+            0x30104003, 0x60208007, 0xC041000E, 0xA0A10118, 0x41420230, 0x82840460, 0x050808C0, 0x0A101180,
+            0x14202301, 0x28404602, 0x50808C04, 0xA1011808, 0x42023010, 0x84046020, 0x0808C041, 0x10118082,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5480B404, 0xA9016808, 0x5202D010, 0xA405A021,
+            0x480B4042, 0x90168084, 0x202D0108, 0x405A0210, 0x80B40420, 0x01680840, 0x02D01080, 0x05A02100,
+            0x0B404200, 0x16808400, 0x2D010800, 0x0E82A405, 0x1D05480B, 0x3A0A9016, 0x7415202D, 0xE82A405A,
+            0xD05480B4, 0xA0A90168, 0x415202D0, 0x82A405A0, 0x05480B40, 0x0A901680, 0x15202D01, 0x2A405A02,
+        },
+    },
+};
+
+/* LFSR113 z3: previous, matrix^268435454 */
+const BitColumnMatrix32_t lfsr113_3_prev_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x04000000, 0x08000000, 0x10000001,
+        0x20000002, 0x40000004, 0x80000008, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100,
+        0x00000200, 0x00000400, 0x00000800, 0x02001000, 0x04002000, 0x08004000, 0x10008000, 0x20010000,
+        0x40020000, 0x80040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+    },
+};
+
+/* LFSR113 z4: LFSR (s1 = 3, s2 = 12, s3 = 13, mask = 0xFFFFFF80) */
+const BitColumnMatrix32_t lfsr113_4_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000,
+            0x00200000, 0x00400001, 0x00800002, 0x01000004, 0x02000009, 0x04000012, 0x08000024, 0x10000048,
+            0x20000090, 0x40000120, 0x80000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800,
+            0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00020000, 0x00040000, 0x00080000,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000900,
+            0x00001200, 0x00002400, 0x00004800, 0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000,
+            0x00120000, 0x00240000, 0x00480001, 0x00900002, 0x01200004, 0x02400008, 0x04800010, 0x09000020,
+            0x12000041, 0x24000082, 0x48000104, 0x90000208, 0x20000410, 0x40000120, 0x80000240, 0x00000480,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008200,
+            0x00010400, 0x00020800, 0x00041000, 0x00082000, 0x00104000, 0x00208000, 0x00410001, 0x00820002,
+            0x01040004, 0x02080009, 0x04100012, 0x08200024, 0x10400049, 0x20800092, 0x41000124, 0x82000249,
+            0x04000492, 0x08000924, 0x10001248, 0x20002490, 0x40004920, 0x80001040, 0x00002080, 0x00004100,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800802,
+            0x01001004, 0x02002009, 0x04004012, 0x08008024, 0x10010048, 0x20020090, 0x40040120, 0x80080240,
+            0x00100480, 0x00200900, 0x00401201, 0x00802402, 0x01004804, 0x02009009, 0x04012012, 0x08024024,
+            0x10048048, 0x20090090, 0x40120120, 0x80240240, 0x00480481, 0x00100100, 0x00200200, 0x00400401,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0002C000,
+            0x00058000, 0x000B0000, 0x00160000, 0x002C0000, 0x00580001, 0x00B00002, 0x01600005, 0x02C0000A,
+            0x05800014, 0x0B000029, 0x16000053, 0x2C0000A6, 0x5800014C, 0xB0000298, 0x60000530, 0xC0000A60,
+            0x800014C0, 0x00002980, 0x00005300, 0x0000A600, 0x00014C00, 0x00005800, 0x0000B000, 0x00016000,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08A00026,
+            0x1140004D, 0x2280009B, 0x45000136, 0x8A00026D, 0x140004DA, 0x280009B4, 0x50001368, 0xA00026D0,
+            0x40004DA0, 0x80009B40, 0x00013680, 0x00026D00, 0x0004DA00, 0x0009B400, 0x00136800, 0x0026D000,
+            0x004DA001, 0x009B4002, 0x01368004, 0x026D0008, 0x04DA0011, 0x01140004, 0x02280009, 0x04500013,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02426408,
+            0x0484C810, 0x09099020, 0x12132041, 0x24264082, 0x484C8105, 0x9099020A, 0x21320414, 0x42640828,
+            0x84C81051, 0x099020A2, 0x13204145, 0x2640828A, 0x4C810514, 0x99020A28, 0x32041451, 0x640828A2,
+            0xC8105144, 0x9020A288, 0x20414511, 0x40828A22, 0x81051444, 0x00484C81, 0x00909902, 0x01213204,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x080CB024,
+            0x10196048, 0x2032C090, 0x40658121, 0x80CB0243, 0x01960486, 0x032C090D, 0x0658121A, 0x0CB02434,
+            0x19604869, 0x32C090D2, 0x658121A4, 0xCB024349, 0x96048693, 0x2C090D26, 0x58121A4C, 0xB0243498,
+            0x60486931, 0xC090D262, 0x8121A4C4, 0x02434988, 0x04869310, 0x01019604, 0x02032C09, 0x04065812,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA2CA02DA,
+            0x459405B4, 0x8B280B69, 0x165016D2, 0x2CA02DA4, 0x59405B49, 0xB280B693, 0x65016D26, 0xCA02DA4D,
+            0x9405B49A, 0x280B6934, 0x5016D268, 0xA02DA4D0, 0x405B49A1, 0x80B69342, 0x016D2685, 0x02DA4D0A,
+            0x05B49A14, 0x0B693428, 0x16D26850, 0x2DA4D0A0, 0x5B49A140, 0x1459405B, 0x28B280B6, 0x5165016D,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xEC26DAC6,
+            0xD84DB58D, 0xB09B6B1A, 0x6136D634, 0xC26DAC68, 0x84DB58D1, 0x09B6B1A2, 0x136D6344, 0x26DAC688,
+            0x4DB58D10, 0x9B6B1A20, 0x36D63440, 0x6DAC6880, 0xDB58D100, 0xB6B1A201, 0x6D634403, 0xDAC68806,
+            0xB58D100C, 0x6B1A2019, 0xD6344033, 0xAC688067, 0x58D100CF, 0x5D84DB58, 0xBB09B6B1, 0x76136D63,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xDE72AC16,
+            0xBCE5582D, 0x79CAB05B, 0xF39560B7, 0xE72AC16F, 0xCE5582DE, 0x9CAB05BC, 0x39560B79, 0x72AC16F3,
+            0xE5582DE7, 0xCAB05BCF, 0x9560B79F, 0x2AC16F3E, 0x5582DE7C, 0xAB05BCF9, 0x560B79F3, 0xAC16F3E6,
+            0x582DE7CC, 0xB05BCF99, 0x60B79F32, 0xC16F3E65, 0x82DE7CCA, 0xDBCE5582, 0xB79CAB05, 0x6F39560B,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD37C1D24,
+            0xA6F83A48, 0x4DF07491, 0x9BE0E922, 0x37C1D244, 0x6F83A489, 0xDF074913, 0xBE0E9227, 0x7C1D244E,
+            0xF83A489C, 0xF0749139, 0xE0E92273, 0xC1D244E7, 0x83A489CF, 0x0749139E, 0x0E92273D, 0x1D244E7A,
+            0x3A489CF4, 0x749139E8, 0xE92273D0, 0xD244E7A0, 0xA489CF40, 0x9A6F83A4, 0x34DF0749, 0x69BE0E92,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x792F1DD8,
+            0xF25E3BB0, 0xE4BC7760, 0xC978EEC1, 0x92F1DD82, 0x25E3BB05, 0x4BC7760A, 0x978EEC15, 0x2F1DD82B,
+            0x5E3BB057, 0xBC7760AF, 0x78EEC15F, 0xF1DD82BF, 0xE3BB057F, 0xC7760AFE, 0x8EEC15FC, 0x1DD82BF9,
+            0x3BB057F3, 0x7760AFE6, 0xEEC15FCC, 0xDD82BF98, 0xBB057F31, 0x0F25E3BB, 0x1E4BC776, 0x3C978EEC,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x154B845F,
+            0x2A9708BF, 0x552E117E, 0xAA5C22FC, 0x54B845F8, 0xA9708BF1, 0x52E117E2, 0xA5C22FC5, 0x4B845F8B,
+            0x9708BF17, 0x2E117E2F, 0x5C22FC5E, 0xB845F8BD, 0x708BF17A, 0xE117E2F4, 0xC22FC5E9, 0x845F8BD3,
+            0x08BF17A6, 0x117E2F4D, 0x22FC5E9A, 0x45F8BD35, 0x8BF17A6A, 0x02A9708B, 0x0552E117, 0x0AA5C22F,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8319B24D,
+            0x0633649B, 0x0C66C937, 0x18CD926F, 0x319B24DE, 0x633649BD, 0xC66C937A, 0x8CD926F5, 0x19B24DEA,
+            0x33649BD4, 0x66C937A8, 0xCD926F50, 0x9B24DEA1, 0x3649BD42, 0x6C937A84, 0xD926F508, 0xB24DEA10,
+            0x649BD420, 0xC937A840, 0x926F5080, 0x24DEA101, 0x49BD4202, 0x10633649, 0x20C66C93, 0x418CD926,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC2A7036B,
+            0x854E06D7, 0x0A9C0DAF, 0x15381B5E, 0x2A7036BC, 0x54E06D79, 0xA9C0DAF3, 0x5381B5E7, 0xA7036BCF,
+            0x4E06D79F, 0x9C0DAF3E, 0x381B5E7C, 0x7036BCF8, 0xE06D79F1, 0xC0DAF3E3, 0x81B5E7C6, 0x036BCF8C,
+            0x06D79F18, 0x0DAF3E30, 0x1B5E7C60, 0x36BCF8C1, 0x6D79F183, 0x1854E06D, 0x30A9C0DA, 0x615381B5,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFA266E95,
+            0xF44CDD2B, 0xE899BA56, 0xD13374AC, 0xA266E958, 0x44CDD2B1, 0x899BA562, 0x13374AC5, 0x266E958A,
+            0x4CDD2B15, 0x99BA562A, 0x3374AC54, 0x66E958A8, 0xCDD2B151, 0x9BA562A3, 0x374AC546, 0x6E958A8D,
+            0xDD2B151A, 0xBA562A34, 0x74AC5468, 0xE958A8D1, 0xD2B151A3, 0x5F44CDD2, 0xBE899BA5, 0x7D13374A,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD74C8C36,
+            0xAE99186D, 0x5D3230DA, 0xBA6461B4, 0x74C8C369, 0xE99186D2, 0xD3230DA5, 0xA6461B4A, 0x4C8C3694,
+            0x99186D28, 0x3230DA51, 0x6461B4A3, 0xC8C36947, 0x9186D28E, 0x230DA51D, 0x461B4A3B, 0x8C369476,
+            0x186D28ED, 0x30DA51DB, 0x61B4A3B6, 0xC369476C, 0x86D28ED8, 0xDAE99186, 0xB5D3230D, 0x6BA6461B,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x793D32D8,
+            0xF27A65B0, 0xE4F4CB61, 0xC9E996C3, 0x93D32D86, 0x27A65B0D, 0x4F4CB61A, 0x9E996C35, 0x3D32D86A,
+            0x7A65B0D4, 0xF4CB61A9, 0xE996C352, 0xD32D86A5, 0xA65B0D4A, 0x4CB61A94, 0x996C3529, 0x32D86A52,
+            0x65B0D4A4, 0xCB61A948, 0x96C35290, 0x2D86A520, 0x5B0D4A41, 0xCF27A65B, 0x9E4F4CB6, 0x3C9E996C,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D43277B,
+            0x3A864EF7, 0x750C9DEE, 0xEA193BDD, 0xD43277BA, 0xA864EF75, 0x50C9DEEB, 0xA193BDD6, 0x43277BAD,
+            0x864EF75A, 0x0C9DEEB4, 0x193BDD68, 0x3277BAD0, 0x64EF75A1, 0xC9DEEB43, 0x93BDD687, 0x277BAD0E,
+            0x4EF75A1C, 0x9DEEB439, 0x3BDD6872, 0x77BAD0E5, 0xEF75A1CA, 0xC3A864EF, 0x8750C9DE, 0x0EA193BD,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01D1BA07,
+            0x03A3740F, 0x0746E81E, 0x0E8DD03D, 0x1D1BA07A, 0x3A3740F5, 0x746E81EB, 0xE8DD03D7, 0xD1BA07AE,
+            0xA3740F5C, 0x46E81EB8, 0x8DD03D71, 0x1BA07AE3, 0x3740F5C6, 0x6E81EB8D, 0xDD03D71A, 0xBA07AE35,
+            0x740F5C6A, 0xE81EB8D4, 0xD03D71A8, 0xA07AE351, 0x40F5C6A3, 0x803A3740, 0x00746E81, 0x00E8DD03,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0281510B,
+            0x0502A216, 0x0A05442D, 0x140A885A, 0x281510B4, 0x502A2168, 0xA05442D1, 0x40A885A2, 0x81510B45,
+            0x02A2168B, 0x05442D17, 0x0A885A2F, 0x1510B45E, 0x2A2168BD, 0x5442D17B, 0xA885A2F6, 0x510B45EC,
+            0xA2168BD9, 0x442D17B2, 0x885A2F65, 0x10B45ECA, 0x2168BD95, 0x40502A21, 0x80A05442, 0x0140A885,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02044209,
+            0x04088412, 0x08110824, 0x10221048, 0x20442091, 0x40884122, 0x81108244, 0x02210489, 0x04420913,
+            0x08841226, 0x1108244C, 0x22104899, 0x44209132, 0x88412265, 0x108244CA, 0x21048994, 0x42091329,
+            0x84122652, 0x08244CA4, 0x10489949, 0x20913292, 0x41226524, 0x80408841, 0x00811082, 0x01022104,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20040890,
+            0x40081120, 0x80102240, 0x00204480, 0x00408901, 0x00811202, 0x01022404, 0x02044809, 0x04089012,
+            0x08112024, 0x10224048, 0x20448091, 0x40890122, 0x81120244, 0x02240489, 0x04480913, 0x08901226,
+            0x1120244C, 0x22404898, 0x44809130, 0x89012260, 0x120244C1, 0x04008112, 0x08010224, 0x10020448,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04008012,
+            0x08010024, 0x10020048, 0x20040090, 0x40080120, 0x80100240, 0x00200480, 0x00400901, 0x00801202,
+            0x01002404, 0x02004809, 0x04009012, 0x08012024, 0x10024048, 0x20048090, 0x40090120, 0x80120240,
+            0x00240480, 0x00480901, 0x00901202, 0x01202404, 0x02404808, 0x00801002, 0x01002004, 0x02004009,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000,
+            0x00200000, 0x00400001, 0x00800002, 0x01000004, 0x02000009, 0x04000012, 0x08000024, 0x10000048,
+            0x20000090, 0x40000120, 0x80000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800,
+            0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00020000, 0x00040000, 0x00080000,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000900,
+            0x00001200, 0x00002400, 0x00004800, 0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000,
+            0x00120000, 0x00240000, 0x00480001, 0x00900002, 0x01200004, 0x02400008, 0x04800010, 0x09000020,
+            0x12000041, 0x24000082, 0x48000104, 0x90000208, 0x20000410, 0x40000120, 0x80000240, 0x00000480,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008200,
+            0x00010400, 0x00020800, 0x00041000, 0x00082000, 0x00104000, 0x00208000, 0x00410001, 0x00820002,
+            0x01040004, 0x02080009, 0x04100012, 0x08200024, 0x10400049, 0x20800092, 0x41000124, 0x82000249,
+            0x04000492, 0x08000924, 0x10001248, 0x20002490, 0x40004920, 0x80001040, 0x00002080, 0x00004100,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800802,
+            0x01001004, 0x02002009, 0x04004012, 0x08008024, 0x10010048, 0x20020090, 0x40040120, 0x80080240,
+            0x00100480, 0x00200900, 0x00401201, 0x00802402, 0x01004804, 0x02009009, 0x04012012, 0x08024024,
+            0x10048048, 0x20090090, 0x40120120, 0x80240240, 0x00480481, 0x00100100, 0x00200200, 0x00400401,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0002C000,
+            0x00058000, 0x000B0000, 0x00160000, 0x002C0000, 0x00580001, 0x00B00002, 0x01600005, 0x02C0000A,
+            0x05800014, 0x0B000029, 0x16000053, 0x2C0000A6, 0x5800014C, 0xB0000298, 0x60000530, 0xC0000A60,
+            0x800014C0, 0x00002980, 0x00005300, 0x0000A600, 0x00014C00, 0x00005800, 0x0000B000, 0x00016000,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08A00026,
+            0x1140004D, 0x2280009B, 0x45000136, 0x8A00026D, 0x140004DA, 0x280009B4, 0x50001368, 0xA00026D0,
+            0x40004DA0, 0x80009B40, 0x00013680, 0x00026D00, 0x0004DA00, 0x0009B400, 0x00136800, 0x0026D000,
+            0x004DA001, 0x009B4002, 0x01368004, 0x026D0008, 0x04DA0011, 0x01140004, 0x02280009, 0x04500013,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02426408,
+            0x0484C810, 0x09099020, 0x12132041, 0x24264082, 0x484C8105, 0x9099020A, 0x21320414, 0x42640828,
+            0x84C81051, 0x099020A2, 0x13204145, 0x2640828A, 0x4C810514, 0x99020A28, 0x32041451, 0x640828A2,
+            0xC8105144, 0x9020A288, 0x20414511, 0x40828A22, 0x81051444, 0x00484C81, 0x00909902, 0x01213204,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x080CB024,
+            0x10196048, 0x2032C090, 0x40658121, 0x80CB0243, 0x01960486, 0x032C090D, 0x0658121A, 0x0CB02434,
+            0x19604869, 0x32C090D2, 0x658121A4, 0xCB024349, 0x96048693, 0x2C090D26, 0x58121A4C, 0xB0243498,
+            0x60486931, 0xC090D262, 0x8121A4C4, 0x02434988, 0x04869310, 0x01019604, 0x02032C09, 0x04065812,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA2CA02DA,
+            0x459405B4, 0x8B280B69, 0x165016D2, 0x2CA02DA4, 0x59405B49, 0xB280B693, 0x65016D26, 0xCA02DA4D,
+            0x9405B49A, 0x280B6934, 0x5016D268, 0xA02DA4D0, 0x405B49A1, 0x80B69342, 0x016D2685, 0x02DA4D0A,
+            0x05B49A14, 0x0B693428, 0x16D26850, 0x2DA4D0A0, 0x5B49A140, 0x1459405B, 0x28B280B6, 0x5165016D,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xEC26DAC6,
+            0xD84DB58D, 0xB09B6B1A, 0x6136D634, 0xC26DAC68, 0x84DB58D1, 0x09B6B1A2, 0x136D6344, 0x26DAC688,
+            0x4DB58D10, 0x9B6B1A20, 0x36D63440, 0x6DAC6880, 0xDB58D100, 0xB6B1A201, 0x6D634403, 0xDAC68806,
+            0xB58D100C, 0x6B1A2019, 0xD6344033, 0xAC688067, 0x58D100CF, 0x5D84DB58, 0xBB09B6B1, 0x76136D63,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xDE72AC16,
+            0xBCE5582D, 0x79CAB05B, 0xF39560B7, 0xE72AC16F, 0xCE5582DE, 0x9CAB05BC, 0x39560B79, 0x72AC16F3,
+            0xE5582DE7, 0xCAB05BCF, 0x9560B79F, 0x2AC16F3E, 0x5582DE7C, 0xAB05BCF9, 0x560B79F3, 0xAC16F3E6,
+            0x582DE7CC, 0xB05BCF99, 0x60B79F32, 0xC16F3E65, 0x82DE7CCA, 0xDBCE5582, 0xB79CAB05, 0x6F39560B,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD37C1D24,
+            0xA6F83A48, 0x4DF07491, 0x9BE0E922, 0x37C1D244, 0x6F83A489, 0xDF074913, 0xBE0E9227, 0x7C1D244E,
+            0xF83A489C, 0xF0749139, 0xE0E92273, 0xC1D244E7, 0x83A489CF, 0x0749139E, 0x0E92273D, 0x1D244E7A,
+            0x3A489CF4, 0x749139E8, 0xE92273D0, 0xD244E7A0, 0xA489CF40, 0x9A6F83A4, 0x34DF0749, 0x69BE0E92,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x792F1DD8,
+            0xF25E3BB0, 0xE4BC7760, 0xC978EEC1, 0x92F1DD82, 0x25E3BB05, 0x4BC7760A, 0x978EEC15, 0x2F1DD82B,
+            0x5E3BB057, 0xBC7760AF, 0x78EEC15F, 0xF1DD82BF, 0xE3BB057F, 0xC7760AFE, 0x8EEC15FC, 0x1DD82BF9,
+            0x3BB057F3, 0x7760AFE6, 0xEEC15FCC, 0xDD82BF98, 0xBB057F31, 0x0F25E3BB, 0x1E4BC776, 0x3C978EEC,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x154B845F,
+            0x2A9708BF, 0x552E117E, 0xAA5C22FC, 0x54B845F8, 0xA9708BF1, 0x52E117E2, 0xA5C22FC5, 0x4B845F8B,
+            0x9708BF17, 0x2E117E2F, 0x5C22FC5E, 0xB845F8BD, 0x708BF17A, 0xE117E2F4, 0xC22FC5E9, 0x845F8BD3,
+            0x08BF17A6, 0x117E2F4D, 0x22FC5E9A, 0x45F8BD35, 0x8BF17A6A, 0x02A9708B, 0x0552E117, 0x0AA5C22F,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8319B24D,
+            0x0633649B, 0x0C66C937, 0x18CD926F, 0x319B24DE, 0x633649BD, 0xC66C937A, 0x8CD926F5, 0x19B24DEA,
+            0x33649BD4, 0x66C937A8, 0xCD926F50, 0x9B24DEA1, 0x3649BD42, 0x6C937A84, 0xD926F508, 0xB24DEA10,
+            0x649BD420, 0xC937A840, 0x926F5080, 0x24DEA101, 0x49BD4202, 0x10633649, 0x20C66C93, 0x418CD926,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC2A7036B,
+            0x854E06D7, 0x0A9C0DAF, 0x15381B5E, 0x2A7036BC, 0x54E06D79, 0xA9C0DAF3, 0x5381B5E7, 0xA7036BCF,
+            0x4E06D79F, 0x9C0DAF3E, 0x381B5E7C, 0x7036BCF8, 0xE06D79F1, 0xC0DAF3E3, 0x81B5E7C6, 0x036BCF8C,
+            0x06D79F18, 0x0DAF3E30, 0x1B5E7C60, 0x36BCF8C1, 0x6D79F183, 0x1854E06D, 0x30A9C0DA, 0x615381B5,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFA266E95,
+            0xF44CDD2B, 0xE899BA56, 0xD13374AC, 0xA266E958, 0x44CDD2B1, 0x899BA562, 0x13374AC5, 0x266E958A,
+            0x4CDD2B15, 0x99BA562A, 0x3374AC54, 0x66E958A8, 0xCDD2B151, 0x9BA562A3, 0x374AC546, 0x6E958A8D,
+            0xDD2B151A, 0xBA562A34, 0x74AC5468, 0xE958A8D1, 0xD2B151A3, 0x5F44CDD2, 0xBE899BA5, 0x7D13374A,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD74C8C36,
+            0xAE99186D, 0x5D3230DA, 0xBA6461B4, 0x74C8C369, 0xE99186D2, 0xD3230DA5, 0xA6461B4A, 0x4C8C3694,
+            0x99186D28, 0x3230DA51, 0x6461B4A3, 0xC8C36947, 0x9186D28E, 0x230DA51D, 0x461B4A3B, 0x8C369476,
+            0x186D28ED, 0x30DA51DB, 0x61B4A3B6, 0xC369476C, 0x86D28ED8, 0xDAE99186, 0xB5D3230D, 0x6BA6461B,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x793D32D8,
+            0xF27A65B0, 0xE4F4CB61, 0xC9E996C3, 0x93D32D86, 0x27A65B0D, 0x4F4CB61A, 0x9E996C35, 0x3D32D86A,
+            0x7A65B0D4, 0xF4CB61A9, 0xE996C352, 0xD32D86A5, 0xA65B0D4A, 0x4CB61A94, 0x996C3529, 0x32D86A52,
+            0x65B0D4A4, 0xCB61A948, 0x96C35290, 0x2D86A520, 0x5B0D4A41, 0xCF27A65B, 0x9E4F4CB6, 0x3C9E996C,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D43277B,
+            0x3A864EF7, 0x750C9DEE, 0xEA193BDD, 0xD43277BA, 0xA864EF75, 0x50C9DEEB, 0xA193BDD6, 0x43277BAD,
+            0x864EF75A, 0x0C9DEEB4, 0x193BDD68, 0x3277BAD0, 0x64EF75A1, 0xC9DEEB43, 0x93BDD687, 0x277BAD0E,
+            0x4EF75A1C, 0x9DEEB439, 0x3BDD6872, 0x77BAD0E5, 0xEF75A1CA, 0xC3A864EF, 0x8750C9DE, 0x0EA193BD,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01D1BA07,
+            0x03A3740F, 0x0746E81E, 0x0E8DD03D, 0x1D1BA07A, 0x3A3740F5, 0x746E81EB, 0xE8DD03D7, 0xD1BA07AE,
+            0xA3740F5C, 0x46E81EB8, 0x8DD03D71, 0x1BA07AE3, 0x3740F5C6, 0x6E81EB8D, 0xDD03D71A, 0xBA07AE35,
+            0x740F5C6A, 0xE81EB8D4, 0xD03D71A8, 0xA07AE351, 0x40F5C6A3, 0x803A3740, 0x00746E81, 0x00E8DD03,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0281510B,
+            0x0502A216, 0x0A05442D, 0x140A885A, 0x281510B4, 0x502A2168, 0xA05442D1, 0x40A885A2, 0x81510B45,
+            0x02A2168B, 0x05442D17, 0x0A885A2F, 0x1510B45E, 0x2A2168BD, 0x5442D17B, 0xA885A2F6, 0x510B45EC,
+            0xA2168BD9, 0x442D17B2, 0x885A2F65, 0x10B45ECA, 0x2168BD95, 0x40502A21, 0x80A05442, 0x0140A885,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02044209,
+            0x04088412, 0x08110824, 0x10221048, 0x20442091, 0x40884122, 0x81108244, 0x02210489, 0x04420913,
+            0x08841226, 0x1108244C, 0x22104899, 0x44209132, 0x88412265, 0x108244CA, 0x21048994, 0x42091329,
+            0x84122652, 0x08244CA4, 0x10489949, 0x20913292, 0x41226524, 0x80408841, 0x00811082, 0x01022104,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20040890,
+            0x40081120, 0x80102240, 0x00204480, 0x00408901, 0x00811202, 0x01022404, 0x02044809, 0x04089012,
+            0x08112024, 0x10224048, 0x20448091, 0x40890122, 0x81120244, 0x02240489, 0x04480913, 0x08901226,
+            0x1120244C, 0x22404898, 0x44809130, 0x89012260, 0x120244C1, 0x04008112, 0x08010224, 0x10020448,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04008012,
+            0x08010024, 0x10020048, 0x20040090, 0x40080120, 0x80100240, 0x00200480, 0x00400901, 0x00801202,
+            0x01002404, 0x02004809, 0x04009012, 0x08012024, 0x10024048, 0x20048090, 0x40090120, 0x80120240,
+            0x00240480, 0x00480901, 0x00901202, 0x01202404, 0x02404808, 0x00801002, 0x01002004, 0x02004009,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000,
+            0x00200000, 0x00400001, 0x00800002, 0x01000004, 0x02000009, 0x04000012, 0x08000024, 0x10000048,
+            0x20000090, 0x40000120, 0x80000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800,
+            0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00020000, 0x00040000, 0x00080000,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000900,
+            0x00001200, 0x00002400, 0x00004800, 0x00009000, 0x00012000, 0x00024000, 0x00048000, 0x00090000,
+            0x00120000, 0x00240000, 0x00480001, 0x00900002, 0x01200004, 0x02400008, 0x04800010, 0x09000020,
+            0x12000041, 0x24000082, 0x48000104, 0x90000208, 0x20000410, 0x40000120, 0x80000240, 0x00000480,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008200,
+            0x00010400, 0x00020800, 0x00041000, 0x00082000, 0x00104000, 0x00208000, 0x00410001, 0x00820002,
+            0x01040004, 0x02080009, 0x04100012, 0x08200024, 0x10400049, 0x20800092, 0x41000124, 0x82000249,
+            0x04000492, 0x08000924, 0x10001248, 0x20002490, 0x40004920, 0x80001040, 0x00002080, 0x00004100,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800802,
+            0x01001004, 0x02002009, 0x04004012, 0x08008024, 0x10010048, 0x20020090, 0x40040120, 0x80080240,
+            0x00100480, 0x00200900, 0x00401201, 0x00802402, 0x01004804, 0x02009009, 0x04012012, 0x08024024,
+            0x10048048, 0x20090090, 0x40120120, 0x80240240, 0x00480481, 0x00100100, 0x00200200, 0x00400401,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0002C000,
+            0x00058000, 0x000B0000, 0x00160000, 0x002C0000, 0x00580001, 0x00B00002, 0x01600005, 0x02C0000A,
+            0x05800014, 0x0B000029, 0x16000053, 0x2C0000A6, 0x5800014C, 0xB0000298, 0x60000530, 0xC0000A60,
+            0x800014C0, 0x00002980, 0x00005300, 0x0000A600, 0x00014C00, 0x00005800, 0x0000B000, 0x00016000,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08A00026,
+            0x1140004D, 0x2280009B, 0x45000136, 0x8A00026D, 0x140004DA, 0x280009B4, 0x50001368, 0xA00026D0,
+            0x40004DA0, 0x80009B40, 0x00013680, 0x00026D00, 0x0004DA00, 0x0009B400, 0x00136800, 0x0026D000,
+            0x004DA001, 0x009B4002, 0x01368004, 0x026D0008, 0x04DA0011, 0x01140004, 0x02280009, 0x04500013,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02426408,
+            0x0484C810, 0x09099020, 0x12132041, 0x24264082, 0x484C8105, 0x9099020A, 0x21320414, 0x42640828,
+            0x84C81051, 0x099020A2, 0x13204145, 0x2640828A, 0x4C810514, 0x99020A28, 0x32041451, 0x640828A2,
+            0xC8105144, 0x9020A288, 0x20414511, 0x40828A22, 0x81051444, 0x00484C81, 0x00909902, 0x01213204,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x080CB024,
+            0x10196048, 0x2032C090, 0x40658121, 0x80CB0243, 0x01960486, 0x032C090D, 0x0658121A, 0x0CB02434,
+            0x19604869, 0x32C090D2, 0x658121A4, 0xCB024349, 0x96048693, 0x2C090D26, 0x58121A4C, 0xB0243498,
+            0x60486931, 0xC090D262, 0x8121A4C4, 0x02434988, 0x04869310, 0x01019604, 0x02032C09, 0x04065812,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xA2CA02DA,
+            0x459405B4, 0x8B280B69, 0x165016D2, 0x2CA02DA4, 0x59405B49, 0xB280B693, 0x65016D26, 0xCA02DA4D,
+            0x9405B49A, 0x280B6934, 0x5016D268, 0xA02DA4D0, 0x405B49A1, 0x80B69342, 0x016D2685, 0x02DA4D0A,
+            0x05B49A14, 0x0B693428, 0x16D26850, 0x2DA4D0A0, 0x5B49A140, 0x1459405B, 0x28B280B6, 0x5165016D,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xEC26DAC6,
+            0xD84DB58D, 0xB09B6B1A, 0x6136D634, 0xC26DAC68, 0x84DB58D1, 0x09B6B1A2, 0x136D6344, 0x26DAC688,
+            0x4DB58D10, 0x9B6B1A20, 0x36D63440, 0x6DAC6880, 0xDB58D100, 0xB6B1A201, 0x6D634403, 0xDAC68806,
+            0xB58D100C, 0x6B1A2019, 0xD6344033, 0xAC688067, 0x58D100CF, 0x5D84DB58, 0xBB09B6B1, 0x76136D63,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xDE72AC16,
+            0xBCE5582D, 0x79CAB05B, 0xF39560B7, 0xE72AC16F, 0xCE5582DE, 0x9CAB05BC, 0x39560B79, 0x72AC16F3,
+            0xE5582DE7, 0xCAB05BCF, 0x9560B79F, 0x2AC16F3E, 0x5582DE7C, 0xAB05BCF9, 0x560B79F3, 0xAC16F3E6,
+            0x582DE7CC, 0xB05BCF99, 0x60B79F32, 0xC16F3E65, 0x82DE7CCA, 0xDBCE5582, 0xB79CAB05, 0x6F39560B,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD37C1D24,
+            0xA6F83A48, 0x4DF07491, 0x9BE0E922, 0x37C1D244, 0x6F83A489, 0xDF074913, 0xBE0E9227, 0x7C1D244E,
+            0xF83A489C, 0xF0749139, 0xE0E92273, 0xC1D244E7, 0x83A489CF, 0x0749139E, 0x0E92273D, 0x1D244E7A,
+            0x3A489CF4, 0x749139E8, 0xE92273D0, 0xD244E7A0, 0xA489CF40, 0x9A6F83A4, 0x34DF0749, 0x69BE0E92,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x792F1DD8,
+            0xF25E3BB0, 0xE4BC7760, 0xC978EEC1, 0x92F1DD82, 0x25E3BB05, 0x4BC7760A, 0x978EEC15, 0x2F1DD82B,
+            0x5E3BB057, 0xBC7760AF, 0x78EEC15F, 0xF1DD82BF, 0xE3BB057F, 0xC7760AFE, 0x8EEC15FC, 0x1DD82BF9,
+            0x3BB057F3, 0x7760AFE6, 0xEEC15FCC, 0xDD82BF98, 0xBB057F31, 0x0F25E3BB, 0x1E4BC776, 0x3C978EEC,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x154B845F,
+            0x2A9708BF, 0x552E117E, 0xAA5C22FC, 0x54B845F8, 0xA9708BF1, 0x52E117E2, 0xA5C22FC5, 0x4B845F8B,
+            0x9708BF17, 0x2E117E2F, 0x5C22FC5E, 0xB845F8BD, 0x708BF17A, 0xE117E2F4, 0xC22FC5E9, 0x845F8BD3,
+            0x08BF17A6, 0x117E2F4D, 0x22FC5E9A, 0x45F8BD35, 0x8BF17A6A, 0x02A9708B, 0x0552E117, 0x0AA5C22F,
+        },
+    },
+};
+
+/* LFSR113 z4: previous, matrix^33554430 */
+const BitColumnMatrix32_t lfsr113_4_prev_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x92480000,
+        0x24900000, 0x49200000, 0x92400000, 0x24800000, 0x49000000, 0x92000001, 0x24000002, 0x48000004,
+        0x90000008, 0x20000010, 0x40000020, 0x80000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+        0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x92490000, 0x24920000, 0x49240000,
+    },
+};
+
+/* LFSR88 z1: LFSR (s1 = 13, s2 = 19, s3 = 12, mask = 0xFFFFFFFE) */
+const BitColumnMatrix32_t lfsr88_1_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002,
+            0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040, 0x02000080, 0x04000100, 0x08000200,
+            0x10000400, 0x20000800, 0x40001000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010,
+            0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x02000080, 0x04000100, 0x08000200, 0x10000400, 0x20000800, 0x40001000, 0x80002001,
+            0x00004002, 0x00008004, 0x00010008, 0x00020010, 0x00040021, 0x00080042, 0x00100084, 0x00200108,
+            0x00400210, 0x00800420, 0x01000840, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040001, 0x00080002, 0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x80042000, 0x00084000, 0x00108000, 0x00210000, 0x00420000, 0x00840001, 0x01080002,
+            0x02100004, 0x04200008, 0x08400010, 0x10800020, 0x21000040, 0x42000080, 0x84000101, 0x08000202,
+            0x10000404, 0x20000808, 0x40001010, 0x00040021, 0x00080042, 0x00100084, 0x00200108, 0x00400210,
+            0x00800420, 0x01000840, 0x02001080, 0x04002100, 0x08004200, 0x10008400, 0x20010800, 0x40021000,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x42020090, 0x84040120, 0x08080240, 0x10100480, 0x20200900, 0x40401200, 0x80802401,
+            0x01004802, 0x02009004, 0x04012008, 0x08024010, 0x10048021, 0x20090042, 0x40120084, 0x80240108,
+            0x00480210, 0x00900420, 0x01200840, 0x40421010, 0x80842020, 0x01084040, 0x02108080, 0x04210100,
+            0x08420200, 0x10840401, 0x21080802, 0x42101004, 0x84202009, 0x08404012, 0x10808024, 0x21010048,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x9004A084, 0x20094108, 0x40128210, 0x80250420, 0x004A0840, 0x00941081, 0x01282102,
+            0x02504204, 0x04A08408, 0x09410810, 0x12821020, 0x25042041, 0x4A084082, 0x94108105, 0x2821020A,
+            0x50420414, 0xA0840828, 0x41081050, 0x12148025, 0x2429004A, 0x48520094, 0x90A40128, 0x21480250,
+            0x429004A0, 0x85200941, 0x0A401282, 0x14802504, 0x29004A08, 0x52009410, 0xA4012821, 0x48025042,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x63022898, 0xC6045130, 0x8C08A261, 0x181144C2, 0x30228984, 0x60451309, 0xC08A2613,
+            0x81144C26, 0x0228984C, 0x04513098, 0x08A26130, 0x1144C261, 0x228984C2, 0x45130984, 0x8A261308,
+            0x144C2611, 0x28984C22, 0x51309844, 0xC1631811, 0x82C63022, 0x058C6045, 0x0B18C08A, 0x16318114,
+            0x2C630228, 0x58C60451, 0xB18C08A2, 0x63181144, 0xC6302289, 0x8C604513, 0x18C08A26, 0x3181144C,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0xB625A02C, 0x6C4B4058, 0xD89680B0, 0xB12D0160, 0x625A02C0, 0xC4B40580, 0x89680B01,
+            0x12D01602, 0x25A02C04, 0x4B405808, 0x9680B011, 0x2D016022, 0x5A02C044, 0xB4058088, 0x680B0110,
+            0xD0160220, 0xA02C0440, 0x40580880, 0x3695B12D, 0x6D2B625A, 0xDA56C4B4, 0xB4AD8968, 0x695B12D0,
+            0xD2B625A0, 0xA56C4B40, 0x4AD89680, 0x95B12D01, 0x2B625A02, 0x56C4B405, 0xAD89680B, 0x5B12D016,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x67962EB9, 0xCF2C5D72, 0x9E58BAE5, 0x3CB175CA, 0x7962EB94, 0xF2C5D728, 0xE58BAE51,
+            0xCB175CA2, 0x962EB944, 0x2C5D7289, 0x58BAE512, 0xB175CA24, 0x62EB9448, 0xC5D72890, 0x8BAE5120,
+            0x175CA241, 0x2EB94482, 0x5D728904, 0xDD733CB1, 0xBAE67962, 0x75CCF2C5, 0xEB99E58B, 0xD733CB17,
+            0xAE67962E, 0x5CCF2C5D, 0xB99E58BA, 0x733CB175, 0xE67962EB, 0xCCF2C5D7, 0x99E58BAE, 0x33CB175C,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0xBE1DE33E, 0x7C3BC67C, 0xF8778CF8, 0xF0EF19F0, 0xE1DE33E0, 0xC3BC67C0, 0x8778CF81,
+            0x0EF19F02, 0x1DE33E04, 0x3BC67C09, 0x778CF813, 0xEF19F027, 0xDE33E04F, 0xBC67C09E, 0x78CF813D,
+            0xF19F027A, 0xE33E04F4, 0xC67C09E8, 0x32E5F0EF, 0x65CBE1DE, 0xCB97C3BC, 0x972F8778, 0x2E5F0EF1,
+            0x5CBE1DE3, 0xB97C3BC6, 0x72F8778C, 0xE5F0EF19, 0xCBE1DE33, 0x97C3BC67, 0x2F8778CF, 0x5F0EF19F,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x6F7CA97B, 0xDEF952F7, 0xBDF2A5EF, 0x7BE54BDF, 0xF7CA97BF, 0xEF952F7E, 0xDF2A5EFD,
+            0xBE54BDFA, 0x7CA97BF4, 0xF952F7E9, 0xF2A5EFD2, 0xE54BDFA5, 0xCA97BF4A, 0x952F7E94, 0x2A5EFD29,
+            0x54BDFA53, 0xA97BF4A7, 0x52F7E94F, 0xCA937BE5, 0x9526F7CA, 0x2A4DEF95, 0x549BDF2A, 0xA937BE54,
+            0x526F7CA9, 0xA4DEF952, 0x49BDF2A5, 0x937BE54B, 0x26F7CA97, 0x4DEF952F, 0x9BDF2A5E, 0x37BE54BD,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x94DF977A, 0x29BF2EF5, 0x537E5DEB, 0xA6FCBBD6, 0x4DF977AC, 0x9BF2EF59, 0x37E5DEB3,
+            0x6FCBBD66, 0xDF977ACC, 0xBF2EF598, 0x7E5DEB31, 0xFCBBD663, 0xF977ACC6, 0xF2EF598C, 0xE5DEB318,
+            0xCBBD6630, 0x977ACC61, 0x2EF598C3, 0xC934A6FC, 0x92694DF9, 0x24D29BF2, 0x49A537E5, 0x934A6FCB,
+            0x2694DF97, 0x4D29BF2E, 0x9A537E5D, 0x34A6FCBB, 0x694DF977, 0xD29BF2EF, 0xA537E5DE, 0x4A6FCBBD,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0xEBB073D5, 0xD760E7AB, 0xAEC1CF57, 0x5D839EAE, 0xBB073D5C, 0x760E7AB9, 0xEC1CF572,
+            0xD839EAE5, 0xB073D5CB, 0x60E7AB97, 0xC1CF572E, 0x839EAE5C, 0x073D5CB9, 0x0E7AB972, 0x1CF572E5,
+            0x39EAE5CA, 0x73D5CB95, 0xE7AB972B, 0x24E75D83, 0x49CEBB07, 0x939D760E, 0x273AEC1C, 0x4E75D839,
+            0x9CEBB073, 0x39D760E7, 0x73AEC1CF, 0xE75D839E, 0xCEBB073D, 0x9D760E7A, 0x3AEC1CF5, 0x75D839EA,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0xF667EF28, 0xECCFDE50, 0xD99FBCA0, 0xB33F7940, 0x667EF281, 0xCCFDE502, 0x99FBCA05,
+            0x33F7940B, 0x67EF2817, 0xCFDE502E, 0x9FBCA05C, 0x3F7940B8, 0x7EF28170, 0xFDE502E0, 0xFBCA05C1,
+            0xF7940B82, 0xEF281705, 0xDE502E0B, 0x4AC7B33F, 0x958F667E, 0x2B1ECCFD, 0x563D99FB, 0xAC7B33F7,
+            0x58F667EF, 0xB1ECCFDE, 0x63D99FBC, 0xC7B33F79, 0x8F667EF2, 0x1ECCFDE5, 0x3D99FBCA, 0x7B33F794,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x7DBC3CBF, 0xFB78797F, 0xF6F0F2FF, 0xEDE1E5FF, 0xDBC3CBFF, 0xB78797FE, 0x6F0F2FFD,
+            0xDE1E5FFA, 0xBC3CBFF4, 0x78797FE8, 0xF0F2FFD1, 0xE1E5FFA2, 0xC3CBFF45, 0x8797FE8A, 0x0F2FFD15,
+            0x1E5FFA2B, 0x3CBFF457, 0x797FE8AF, 0x8F43EDE1, 0x1E87DBC3, 0x3D0FB787, 0x7A1F6F0F, 0xF43EDE1E,
+            0xE87DBC3C, 0xD0FB7879, 0xA1F6F0F2, 0x43EDE1E5, 0x87DBC3CB, 0x0FB78797, 0x1F6F0F2F, 0x3EDE1E5F,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x3F536750, 0x7EA6CEA1, 0xFD4D9D42, 0xFA9B3A85, 0xF536750A, 0xEA6CEA14, 0xD4D9D429,
+            0xA9B3A853, 0x536750A7, 0xA6CEA14E, 0x4D9D429D, 0x9B3A853B, 0x36750A77, 0x6CEA14EE, 0xD9D429DC,
+            0xB3A853B9, 0x6750A772, 0xCEA14EE5, 0xA211FA9B, 0x4423F536, 0x8847EA6C, 0x108FD4D9, 0x211FA9B3,
+            0x423F5367, 0x847EA6CE, 0x08FD4D9D, 0x11FA9B3A, 0x23F53675, 0x47EA6CEA, 0x8FD4D9D4, 0x1FA9B3A8,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x2D7F3B07, 0x5AFE760F, 0xB5FCEC1E, 0x6BF9D83C, 0xD7F3B079, 0xAFE760F2, 0x5FCEC1E5,
+            0xBF9D83CA, 0x7F3B0794, 0xFE760F28, 0xFCEC1E50, 0xF9D83CA1, 0xF3B07943, 0xE760F287, 0xCEC1E50F,
+            0x9D83CA1F, 0x3B07943F, 0x760F287F, 0xC1616BF9, 0x82C2D7F3, 0x0585AFE7, 0x0B0B5FCE, 0x1616BF9D,
+            0x2C2D7F3B, 0x585AFE76, 0xB0B5FCEC, 0x616BF9D8, 0xC2D7F3B0, 0x85AFE760, 0x0B5FCEC1, 0x16BF9D83,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0xA45935F7, 0x48B26BEE, 0x9164D7DC, 0x22C9AFB8, 0x45935F70, 0x8B26BEE0, 0x164D7DC1,
+            0x2C9AFB82, 0x5935F705, 0xB26BEE0B, 0x64D7DC17, 0xC9AFB82E, 0x935F705C, 0x26BEE0B9, 0x4D7DC173,
+            0x9AFB82E7, 0x35F705CF, 0x6BEE0B9F, 0x738522C9, 0xE70A4593, 0xCE148B26, 0x9C29164D, 0x38522C9A,
+            0x70A45935, 0xE148B26B, 0xC29164D7, 0x8522C9AF, 0x0A45935F, 0x148B26BE, 0x29164D7D, 0x522C9AFB,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0xC4B09B69, 0x896136D3, 0x12C26DA6, 0x2584DB4D, 0x4B09B69A, 0x96136D35, 0x2C26DA6B,
+            0x584DB4D7, 0xB09B69AF, 0x6136D35F, 0xC26DA6BE, 0x84DB4D7D, 0x09B69AFB, 0x136D35F7, 0x26DA6BEE,
+            0x4DB4D7DD, 0x9B69AFBB, 0x36D35F76, 0xA9162584, 0x522C4B09, 0xA4589613, 0x48B12C26, 0x9162584D,
+            0x22C4B09B, 0x45896136, 0x8B12C26D, 0x162584DB, 0x2C4B09B6, 0x5896136D, 0xB12C26DA, 0x62584DB4,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x7812C708, 0xF0258E10, 0xE04B1C21, 0xC0963842, 0x812C7084, 0x0258E108, 0x04B1C210,
+            0x09638420, 0x12C70841, 0x258E1083, 0x4B1C2107, 0x9638420F, 0x2C70841E, 0x58E1083C, 0xB1C21079,
+            0x638420F3, 0xC70841E7, 0x8E1083CF, 0x6433C096, 0xC867812C, 0x90CF0258, 0x219E04B1, 0x433C0963,
+            0x867812C7, 0x0CF0258E, 0x19E04B1C, 0x33C09638, 0x67812C70, 0xCF0258E1, 0x9E04B1C2, 0x3C096384,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x3D6A0B26, 0x7AD4164D, 0xF5A82C9B, 0xEB505937, 0xD6A0B26F, 0xAD4164DF, 0x5A82C9BE,
+            0xB505937C, 0x6A0B26F8, 0xD4164DF0, 0xA82C9BE0, 0x505937C0, 0xA0B26F81, 0x4164DF03, 0x82C9BE07,
+            0x05937C0E, 0x0B26F81D, 0x164DF03B, 0x11F1EB50, 0x23E3D6A0, 0x47C7AD41, 0x8F8F5A82, 0x1F1EB505,
+            0x3E3D6A0B, 0x7C7AD416, 0xF8F5A82C, 0xF1EB5059, 0xE3D6A0B2, 0xC7AD4164, 0x8F5A82C9, 0x1EB50593,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x27FB1646, 0x4FF62C8D, 0x9FEC591A, 0x3FD8B234, 0x7FB16468, 0xFF62C8D1, 0xFEC591A2,
+            0xFD8B2345, 0xFB16468A, 0xF62C8D14, 0xEC591A29, 0xD8B23453, 0xB16468A6, 0x62C8D14C, 0xC591A299,
+            0x8B234533, 0x16468A67, 0x2C8D14CF, 0x7EE13FD8, 0xFDC27FB1, 0xFB84FF62, 0xF709FEC5, 0xEE13FD8B,
+            0xDC27FB16, 0xB84FF62C, 0x709FEC59, 0xE13FD8B2, 0xC27FB164, 0x84FF62C8, 0x09FEC591, 0x13FD8B23,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x2E37FD6D, 0x5C6FFADB, 0xB8DFF5B6, 0x71BFEB6D, 0xE37FD6DA, 0xC6FFADB4, 0x8DFF5B68,
+            0x1BFEB6D1, 0x37FD6DA3, 0x6FFADB46, 0xDFF5B68C, 0xBFEB6D19, 0x7FD6DA33, 0xFFADB466, 0xFF5B68CD,
+            0xFEB6D19A, 0xFD6DA334, 0xFADB4669, 0xDB8171BF, 0xB702E37F, 0x6E05C6FF, 0xDC0B8DFF, 0xB8171BFE,
+            0x702E37FD, 0xE05C6FFA, 0xC0B8DFF5, 0x8171BFEB, 0x02E37FD6, 0x05C6FFAD, 0x0B8DFF5B, 0x171BFEB6,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x2E5E2597, 0x5CBC4B2F, 0xB978965F, 0x72F12CBE, 0xE5E2597D, 0xCBC4B2FA, 0x978965F5,
+            0x2F12CBEA, 0x5E2597D5, 0xBC4B2FAB, 0x78965F57, 0xF12CBEAE, 0xE2597D5D, 0xC4B2FABB, 0x8965F576,
+            0x12CBEAEC, 0x2597D5D9, 0x4B2FABB3, 0xB80172F1, 0x7002E5E2, 0xE005CBC4, 0xC00B9789, 0x80172F12,
+            0x002E5E25, 0x005CBC4B, 0x00B97896, 0x0172F12C, 0x02E5E259, 0x05CBC4B2, 0x0B978965, 0x172F12CB,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x8476315C, 0x08EC62B9, 0x11D8C572, 0x23B18AE4, 0x476315C8, 0x8EC62B90, 0x1D8C5721,
+            0x3B18AE42, 0x76315C84, 0xEC62B909, 0xD8C57212, 0xB18AE425, 0x6315C84B, 0xC62B9097, 0x8C57212E,
+            0x18AE425D, 0x315C84BB, 0x62B90976, 0x410423B1, 0x82084763, 0x04108EC6, 0x08211D8C, 0x10423B18,
+            0x20847631, 0x4108EC62, 0x8211D8C5, 0x0423B18A, 0x08476315, 0x108EC62B, 0x211D8C57, 0x423B18AE,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x40321D1C, 0x80643A38, 0x00C87470, 0x0190E8E0, 0x0321D1C0, 0x0643A380, 0x0C874701,
+            0x190E8E03, 0x321D1C07, 0x643A380E, 0xC874701C, 0x90E8E039, 0x21D1C072, 0x43A380E4, 0x874701C8,
+            0x0E8E0391, 0x1D1C0723, 0x3A380E46, 0x34420190, 0x68840321, 0xD1080643, 0xA2100C87, 0x4420190E,
+            0x8840321D, 0x1080643A, 0x2100C874, 0x420190E8, 0x840321D1, 0x080643A3, 0x100C8747, 0x20190E8E,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x10080586, 0x20100B0C, 0x40201618, 0x80402C31, 0x00805862, 0x0100B0C4, 0x02016188,
+            0x0402C310, 0x08058621, 0x100B0C42, 0x20161885, 0x402C310B, 0x80586217, 0x00B0C42E, 0x0161885C,
+            0x02C310B8, 0x05862171, 0x0B0C42E3, 0x06108040, 0x0C210080, 0x18420100, 0x30840201, 0x61080402,
+            0xC2100805, 0x8420100B, 0x08402016, 0x1080402C, 0x21008058, 0x420100B0, 0x84020161, 0x080402C3,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x0100A048, 0x02014090, 0x04028120, 0x08050241, 0x100A0482, 0x20140905, 0x4028120A,
+            0x80502415, 0x00A0482A, 0x01409054, 0x028120A8, 0x05024150, 0x0A0482A1, 0x14090542, 0x28120A84,
+            0x50241509, 0xA0482A13, 0x40905426, 0x80200805, 0x0040100A, 0x00802014, 0x01004028, 0x02008050,
+            0x040100A0, 0x08020140, 0x10040281, 0x20080502, 0x40100A04, 0x80201409, 0x00402812, 0x00805024,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x020100A0, 0x04020140, 0x08040281, 0x10080502, 0x20100A04, 0x40201408, 0x80402811,
+            0x00805022, 0x0100A044, 0x02014088, 0x04028110, 0x08050221, 0x100A0442, 0x20140885, 0x4028110A,
+            0x80502215, 0x00A0442A, 0x01408854, 0x00801008, 0x01002010, 0x02004020, 0x04008040, 0x08010080,
+            0x10020100, 0x20040201, 0x40080402, 0x80100805, 0x0020100A, 0x00402014, 0x00804028, 0x01008050,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00040201, 0x00080402, 0x00100804, 0x00201008, 0x00402010, 0x00804020, 0x01008040,
+            0x02010080, 0x04020100, 0x08040201, 0x10080402, 0x20100804, 0x40201008, 0x80402011, 0x00804022,
+            0x01008044, 0x02010088, 0x04020110, 0x08000020, 0x10000040, 0x20000080, 0x40000100, 0x80000201,
+            0x00000402, 0x00000804, 0x00001008, 0x00002010, 0x00004020, 0x00008040, 0x00010080, 0x00020100,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+            0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001,
+            0x00080002, 0x00100004, 0x00200008, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000,
+            0x08000000, 0x10000000, 0x20000000, 0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000,
+            0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002, 0x00100004, 0x00200008,
+            0x00400010, 0x00800020, 0x01000040, 0x02000000, 0x04000000, 0x08000000, 0x10000000, 0x20000000,
+            0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002,
+            0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040, 0x02000080, 0x04000100, 0x08000200,
+            0x10000400, 0x20000800, 0x40001000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010,
+            0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x02000080, 0x04000100, 0x08000200, 0x10000400, 0x20000800, 0x40001000, 0x80002001,
+            0x00004002, 0x00008004, 0x00010008, 0x00020010, 0x00040021, 0x00080042, 0x00100084, 0x00200108,
+            0x00400210, 0x00800420, 0x01000840, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040001, 0x00080002, 0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x80042000, 0x00084000, 0x00108000, 0x00210000, 0x00420000, 0x00840001, 0x01080002,
+            0x02100004, 0x04200008, 0x08400010, 0x10800020, 0x21000040, 0x42000080, 0x84000101, 0x08000202,
+            0x10000404, 0x20000808, 0x40001010, 0x00040021, 0x00080042, 0x00100084, 0x00200108, 0x00400210,
+            0x00800420, 0x01000840, 0x02001080, 0x04002100, 0x08004200, 0x10008400, 0x20010800, 0x40021000,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x42020090, 0x84040120, 0x08080240, 0x10100480, 0x20200900, 0x40401200, 0x80802401,
+            0x01004802, 0x02009004, 0x04012008, 0x08024010, 0x10048021, 0x20090042, 0x40120084, 0x80240108,
+            0x00480210, 0x00900420, 0x01200840, 0x40421010, 0x80842020, 0x01084040, 0x02108080, 0x04210100,
+            0x08420200, 0x10840401, 0x21080802, 0x42101004, 0x84202009, 0x08404012, 0x10808024, 0x21010048,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x9004A084, 0x20094108, 0x40128210, 0x80250420, 0x004A0840, 0x00941081, 0x01282102,
+            0x02504204, 0x04A08408, 0x09410810, 0x12821020, 0x25042041, 0x4A084082, 0x94108105, 0x2821020A,
+            0x50420414, 0xA0840828, 0x41081050, 0x12148025, 0x2429004A, 0x48520094, 0x90A40128, 0x21480250,
+            0x429004A0, 0x85200941, 0x0A401282, 0x14802504, 0x29004A08, 0x52009410, 0xA4012821, 0x48025042,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x63022898, 0xC6045130, 0x8C08A261, 0x181144C2, 0x30228984, 0x60451309, 0xC08A2613,
+            0x81144C26, 0x0228984C, 0x04513098, 0x08A26130, 0x1144C261, 0x228984C2, 0x45130984, 0x8A261308,
+            0x144C2611, 0x28984C22, 0x51309844, 0xC1631811, 0x82C63022, 0x058C6045, 0x0B18C08A, 0x16318114,
+            0x2C630228, 0x58C60451, 0xB18C08A2, 0x63181144, 0xC6302289, 0x8C604513, 0x18C08A26, 0x3181144C,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0xB625A02C, 0x6C4B4058, 0xD89680B0, 0xB12D0160, 0x625A02C0, 0xC4B40580, 0x89680B01,
+            0x12D01602, 0x25A02C04, 0x4B405808, 0x9680B011, 0x2D016022, 0x5A02C044, 0xB4058088, 0x680B0110,
+            0xD0160220, 0xA02C0440, 0x40580880, 0x3695B12D, 0x6D2B625A, 0xDA56C4B4, 0xB4AD8968, 0x695B12D0,
+            0xD2B625A0, 0xA56C4B40, 0x4AD89680, 0x95B12D01, 0x2B625A02, 0x56C4B405, 0xAD89680B, 0x5B12D016,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x67962EB9, 0xCF2C5D72, 0x9E58BAE5, 0x3CB175CA, 0x7962EB94, 0xF2C5D728, 0xE58BAE51,
+            0xCB175CA2, 0x962EB944, 0x2C5D7289, 0x58BAE512, 0xB175CA24, 0x62EB9448, 0xC5D72890, 0x8BAE5120,
+            0x175CA241, 0x2EB94482, 0x5D728904, 0xDD733CB1, 0xBAE67962, 0x75CCF2C5, 0xEB99E58B, 0xD733CB17,
+            0xAE67962E, 0x5CCF2C5D, 0xB99E58BA, 0x733CB175, 0xE67962EB, 0xCCF2C5D7, 0x99E58BAE, 0x33CB175C,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0xBE1DE33E, 0x7C3BC67C, 0xF8778CF8, 0xF0EF19F0, 0xE1DE33E0, 0xC3BC67C0, 0x8778CF81,
+            0x0EF19F02, 0x1DE33E04, 0x3BC67C09, 0x778CF813, 0xEF19F027, 0xDE33E04F, 0xBC67C09E, 0x78CF813D,
+            0xF19F027A, 0xE33E04F4, 0xC67C09E8, 0x32E5F0EF, 0x65CBE1DE, 0xCB97C3BC, 0x972F8778, 0x2E5F0EF1,
+            0x5CBE1DE3, 0xB97C3BC6, 0x72F8778C, 0xE5F0EF19, 0xCBE1DE33, 0x97C3BC67, 0x2F8778CF, 0x5F0EF19F,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x6F7CA97B, 0xDEF952F7, 0xBDF2A5EF, 0x7BE54BDF, 0xF7CA97BF, 0xEF952F7E, 0xDF2A5EFD,
+            0xBE54BDFA, 0x7CA97BF4, 0xF952F7E9, 0xF2A5EFD2, 0xE54BDFA5, 0xCA97BF4A, 0x952F7E94, 0x2A5EFD29,
+            0x54BDFA53, 0xA97BF4A7, 0x52F7E94F, 0xCA937BE5, 0x9526F7CA, 0x2A4DEF95, 0x549BDF2A, 0xA937BE54,
+            0x526F7CA9, 0xA4DEF952, 0x49BDF2A5, 0x937BE54B, 0x26F7CA97, 0x4DEF952F, 0x9BDF2A5E, 0x37BE54BD,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x94DF977A, 0x29BF2EF5, 0x537E5DEB, 0xA6FCBBD6, 0x4DF977AC, 0x9BF2EF59, 0x37E5DEB3,
+            0x6FCBBD66, 0xDF977ACC, 0xBF2EF598, 0x7E5DEB31, 0xFCBBD663, 0xF977ACC6, 0xF2EF598C, 0xE5DEB318,
+            0xCBBD6630, 0x977ACC61, 0x2EF598C3, 0xC934A6FC, 0x92694DF9, 0x24D29BF2, 0x49A537E5, 0x934A6FCB,
+            0x2694DF97, 0x4D29BF2E, 0x9A537E5D, 0x34A6FCBB, 0x694DF977, 0xD29BF2EF, 0xA537E5DE, 0x4A6FCBBD,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0xEBB073D5, 0xD760E7AB, 0xAEC1CF57, 0x5D839EAE, 0xBB073D5C, 0x760E7AB9, 0xEC1CF572,
+            0xD839EAE5, 0xB073D5CB, 0x60E7AB97, 0xC1CF572E, 0x839EAE5C, 0x073D5CB9, 0x0E7AB972, 0x1CF572E5,
+            0x39EAE5CA, 0x73D5CB95, 0xE7AB972B, 0x24E75D83, 0x49CEBB07, 0x939D760E, 0x273AEC1C, 0x4E75D839,
+            0x9CEBB073, 0x39D760E7, 0x73AEC1CF, 0xE75D839E, 0xCEBB073D, 0x9D760E7A, 0x3AEC1CF5, 0x75D839EA,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0xF667EF28, 0xECCFDE50, 0xD99FBCA0, 0xB33F7940, 0x667EF281, 0xCCFDE502, 0x99FBCA05,
+            0x33F7940B, 0x67EF2817, 0xCFDE502E, 0x9FBCA05C, 0x3F7940B8, 0x7EF28170, 0xFDE502E0, 0xFBCA05C1,
+            0xF7940B82, 0xEF281705, 0xDE502E0B, 0x4AC7B33F, 0x958F667E, 0x2B1ECCFD, 0x563D99FB, 0xAC7B33F7,
+            0x58F667EF, 0xB1ECCFDE, 0x63D99FBC, 0xC7B33F79, 0x8F667EF2, 0x1ECCFDE5, 0x3D99FBCA, 0x7B33F794,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x7DBC3CBF, 0xFB78797F, 0xF6F0F2FF, 0xEDE1E5FF, 0xDBC3CBFF, 0xB78797FE, 0x6F0F2FFD,
+            0xDE1E5FFA, 0xBC3CBFF4, 0x78797FE8, 0xF0F2FFD1, 0xE1E5FFA2, 0xC3CBFF45, 0x8797FE8A, 0x0F2FFD15,
+            0x1E5FFA2B, 0x3CBFF457, 0x797FE8AF, 0x8F43EDE1, 0x1E87DBC3, 0x3D0FB787, 0x7A1F6F0F, 0xF43EDE1E,
+            0xE87DBC3C, 0xD0FB7879, 0xA1F6F0F2, 0x43EDE1E5, 0x87DBC3CB, 0x0FB78797, 0x1F6F0F2F, 0x3EDE1E5F,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x3F536750, 0x7EA6CEA1, 0xFD4D9D42, 0xFA9B3A85, 0xF536750A, 0xEA6CEA14, 0xD4D9D429,
+            0xA9B3A853, 0x536750A7, 0xA6CEA14E, 0x4D9D429D, 0x9B3A853B, 0x36750A77, 0x6CEA14EE, 0xD9D429DC,
+            0xB3A853B9, 0x6750A772, 0xCEA14EE5, 0xA211FA9B, 0x4423F536, 0x8847EA6C, 0x108FD4D9, 0x211FA9B3,
+            0x423F5367, 0x847EA6CE, 0x08FD4D9D, 0x11FA9B3A, 0x23F53675, 0x47EA6CEA, 0x8FD4D9D4, 0x1FA9B3A8,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x2D7F3B07, 0x5AFE760F, 0xB5FCEC1E, 0x6BF9D83C, 0xD7F3B079, 0xAFE760F2, 0x5FCEC1E5,
+            0xBF9D83CA, 0x7F3B0794, 0xFE760F28, 0xFCEC1E50, 0xF9D83CA1, 0xF3B07943, 0xE760F287, 0xCEC1E50F,
+            0x9D83CA1F, 0x3B07943F, 0x760F287F, 0xC1616BF9, 0x82C2D7F3, 0x0585AFE7, 0x0B0B5FCE, 0x1616BF9D,
+            0x2C2D7F3B, 0x585AFE76, 0xB0B5FCEC, 0x616BF9D8, 0xC2D7F3B0, 0x85AFE760, 0x0B5FCEC1, 0x16BF9D83,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0xA45935F7, 0x48B26BEE, 0x9164D7DC, 0x22C9AFB8, 0x45935F70, 0x8B26BEE0, 0x164D7DC1,
+            0x2C9AFB82, 0x5935F705, 0xB26BEE0B, 0x64D7DC17, 0xC9AFB82E, 0x935F705C, 0x26BEE0B9, 0x4D7DC173,
+            0x9AFB82E7, 0x35F705CF, 0x6BEE0B9F, 0x738522C9, 0xE70A4593, 0xCE148B26, 0x9C29164D, 0x38522C9A,
+            0x70A45935, 0xE148B26B, 0xC29164D7, 0x8522C9AF, 0x0A45935F, 0x148B26BE, 0x29164D7D, 0x522C9AFB,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0xC4B09B69, 0x896136D3, 0x12C26DA6, 0x2584DB4D, 0x4B09B69A, 0x96136D35, 0x2C26DA6B,
+            0x584DB4D7, 0xB09B69AF, 0x6136D35F, 0xC26DA6BE, 0x84DB4D7D, 0x09B69AFB, 0x136D35F7, 0x26DA6BEE,
+            0x4DB4D7DD, 0x9B69AFBB, 0x36D35F76, 0xA9162584, 0x522C4B09, 0xA4589613, 0x48B12C26, 0x9162584D,
+            0x22C4B09B, 0x45896136, 0x8B12C26D, 0x162584DB, 0x2C4B09B6, 0x5896136D, 0xB12C26DA, 0x62584DB4,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x7812C708, 0xF0258E10, 0xE04B1C21, 0xC0963842, 0x812C7084, 0x0258E108, 0x04B1C210,
+            0x09638420, 0x12C70841, 0x258E1083, 0x4B1C2107, 0x9638420F, 0x2C70841E, 0x58E1083C, 0xB1C21079,
+            0x638420F3, 0xC70841E7, 0x8E1083CF, 0x6433C096, 0xC867812C, 0x90CF0258, 0x219E04B1, 0x433C0963,
+            0x867812C7, 0x0CF0258E, 0x19E04B1C, 0x33C09638, 0x67812C70, 0xCF0258E1, 0x9E04B1C2, 0x3C096384,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x3D6A0B26, 0x7AD4164D, 0xF5A82C9B, 0xEB505937, 0xD6A0B26F, 0xAD4164DF, 0x5A82C9BE,
+            0xB505937C, 0x6A0B26F8, 0xD4164DF0, 0xA82C9BE0, 0x505937C0, 0xA0B26F81, 0x4164DF03, 0x82C9BE07,
+            0x05937C0E, 0x0B26F81D, 0x164DF03B, 0x11F1EB50, 0x23E3D6A0, 0x47C7AD41, 0x8F8F5A82, 0x1F1EB505,
+            0x3E3D6A0B, 0x7C7AD416, 0xF8F5A82C, 0xF1EB5059, 0xE3D6A0B2, 0xC7AD4164, 0x8F5A82C9, 0x1EB50593,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x27FB1646, 0x4FF62C8D, 0x9FEC591A, 0x3FD8B234, 0x7FB16468, 0xFF62C8D1, 0xFEC591A2,
+            0xFD8B2345, 0xFB16468A, 0xF62C8D14, 0xEC591A29, 0xD8B23453, 0xB16468A6, 0x62C8D14C, 0xC591A299,
+            0x8B234533, 0x16468A67, 0x2C8D14CF, 0x7EE13FD8, 0xFDC27FB1, 0xFB84FF62, 0xF709FEC5, 0xEE13FD8B,
+            0xDC27FB16, 0xB84FF62C, 0x709FEC59, 0xE13FD8B2, 0xC27FB164, 0x84FF62C8, 0x09FEC591, 0x13FD8B23,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x2E37FD6D, 0x5C6FFADB, 0xB8DFF5B6, 0x71BFEB6D, 0xE37FD6DA, 0xC6FFADB4, 0x8DFF5B68,
+            0x1BFEB6D1, 0x37FD6DA3, 0x6FFADB46, 0xDFF5B68C, 0xBFEB6D19, 0x7FD6DA33, 0xFFADB466, 0xFF5B68CD,
+            0xFEB6D19A, 0xFD6DA334, 0xFADB4669, 0xDB8171BF, 0xB702E37F, 0x6E05C6FF, 0xDC0B8DFF, 0xB8171BFE,
+            0x702E37FD, 0xE05C6FFA, 0xC0B8DFF5, 0x8171BFEB, 0x02E37FD6, 0x05C6FFAD, 0x0B8DFF5B, 0x171BFEB6,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x2E5E2597, 0x5CBC4B2F, 0xB978965F, 0x72F12CBE, 0xE5E2597D, 0xCBC4B2FA, 0x978965F5,
+            0x2F12CBEA, 0x5E2597D5, 0xBC4B2FAB, 0x78965F57, 0xF12CBEAE, 0xE2597D5D, 0xC4B2FABB, 0x8965F576,
+            0x12CBEAEC, 0x2597D5D9, 0x4B2FABB3, 0xB80172F1, 0x7002E5E2, 0xE005CBC4, 0xC00B9789, 0x80172F12,
+            0x002E5E25, 0x005CBC4B, 0x00B97896, 0x0172F12C, 0x02E5E259, 0x05CBC4B2, 0x0B978965, 0x172F12CB,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x8476315C, 0x08EC62B9, 0x11D8C572, 0x23B18AE4, 0x476315C8, 0x8EC62B90, 0x1D8C5721,
+            0x3B18AE42, 0x76315C84, 0xEC62B909, 0xD8C57212, 0xB18AE425, 0x6315C84B, 0xC62B9097, 0x8C57212E,
+            0x18AE425D, 0x315C84BB, 0x62B90976, 0x410423B1, 0x82084763, 0x04108EC6, 0x08211D8C, 0x10423B18,
+            0x20847631, 0x4108EC62, 0x8211D8C5, 0x0423B18A, 0x08476315, 0x108EC62B, 0x211D8C57, 0x423B18AE,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x40321D1C, 0x80643A38, 0x00C87470, 0x0190E8E0, 0x0321D1C0, 0x0643A380, 0x0C874701,
+            0x190E8E03, 0x321D1C07, 0x643A380E, 0xC874701C, 0x90E8E039, 0x21D1C072, 0x43A380E4, 0x874701C8,
+            0x0E8E0391, 0x1D1C0723, 0x3A380E46, 0x34420190, 0x68840321, 0xD1080643, 0xA2100C87, 0x4420190E,
+            0x8840321D, 0x1080643A, 0x2100C874, 0x420190E8, 0x840321D1, 0x080643A3, 0x100C8747, 0x20190E8E,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x10080586, 0x20100B0C, 0x40201618, 0x80402C31, 0x00805862, 0x0100B0C4, 0x02016188,
+            0x0402C310, 0x08058621, 0x100B0C42, 0x20161885, 0x402C310B, 0x80586217, 0x00B0C42E, 0x0161885C,
+            0x02C310B8, 0x05862171, 0x0B0C42E3, 0x06108040, 0x0C210080, 0x18420100, 0x30840201, 0x61080402,
+            0xC2100805, 0x8420100B, 0x08402016, 0x1080402C, 0x21008058, 0x420100B0, 0x84020161, 0x080402C3,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x0100A048, 0x02014090, 0x04028120, 0x08050241, 0x100A0482, 0x20140905, 0x4028120A,
+            0x80502415, 0x00A0482A, 0x01409054, 0x028120A8, 0x05024150, 0x0A0482A1, 0x14090542, 0x28120A84,
+            0x50241509, 0xA0482A13, 0x40905426, 0x80200805, 0x0040100A, 0x00802014, 0x01004028, 0x02008050,
+            0x040100A0, 0x08020140, 0x10040281, 0x20080502, 0x40100A04, 0x80201409, 0x00402812, 0x00805024,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x020100A0, 0x04020140, 0x08040281, 0x10080502, 0x20100A04, 0x40201408, 0x80402811,
+            0x00805022, 0x0100A044, 0x02014088, 0x04028110, 0x08050221, 0x100A0442, 0x20140885, 0x4028110A,
+            0x80502215, 0x00A0442A, 0x01408854, 0x00801008, 0x01002010, 0x02004020, 0x04008040, 0x08010080,
+            0x10020100, 0x20040201, 0x40080402, 0x80100805, 0x0020100A, 0x00402014, 0x00804028, 0x01008050,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00040201, 0x00080402, 0x00100804, 0x00201008, 0x00402010, 0x00804020, 0x01008040,
+            0x02010080, 0x04020100, 0x08040201, 0x10080402, 0x20100804, 0x40201008, 0x80402011, 0x00804022,
+            0x01008044, 0x02010088, 0x04020110, 0x08000020, 0x10000040, 0x20000080, 0x40000100, 0x80000201,
+            0x00000402, 0x00000804, 0x00001008, 0x00002010, 0x00004020, 0x00008040, 0x00010080, 0x00020100,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400,
+            0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001,
+            0x00080002, 0x00100004, 0x00200008, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000,
+            0x08000000, 0x10000000, 0x20000000, 0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000,
+            0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002, 0x00100004, 0x00200008,
+            0x00400010, 0x00800020, 0x01000040, 0x02000000, 0x04000000, 0x08000000, 0x10000000, 0x20000000,
+            0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040001, 0x00080002,
+            0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040, 0x02000080, 0x04000100, 0x08000200,
+            0x10000400, 0x20000800, 0x40001000, 0x80000001, 0x00000002, 0x00000004, 0x00000008, 0x00000010,
+            0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x00001000,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x02000080, 0x04000100, 0x08000200, 0x10000400, 0x20000800, 0x40001000, 0x80002001,
+            0x00004002, 0x00008004, 0x00010008, 0x00020010, 0x00040021, 0x00080042, 0x00100084, 0x00200108,
+            0x00400210, 0x00800420, 0x01000840, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040001, 0x00080002, 0x00100004, 0x00200008, 0x00400010, 0x00800020, 0x01000040,
+        },
+    },
+};
+
+/* LFSR88 z1: previous, matrix^2147483646 */
+const BitColumnMatrix32_t lfsr88_1_prev_matrix =
+{
+    {
+        0x00000000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000,
+        0x08000000, 0x10000000, 0x20000000, 0x40000000, 0x80000001, 0x00000002, 0x00000004, 0x00000008,
+        0x00000010, 0x00000020, 0x00000040, 0x00100080, 0x00200100, 0x00400200, 0x00800400, 0x01000800,
+        0x02001000, 0x04002000, 0x08004000, 0x10008000, 0x20010000, 0x40020000, 0x80040000, 0x00080000,
+    },
+};
+
+/* LFSR88 z2: LFSR (s1 = 2, s2 = 25, s3 = 4, mask = 0xFFFFFFF8) */
+const BitColumnMatrix32_t lfsr88_2_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00808000, 0x01010000, 0x02020000, 0x04040000, 0x08080001,
+            0x10100002, 0x20200005, 0x4040000A, 0x80800014, 0x01000028, 0x02000050, 0x040000A0, 0x08000141,
+            0x10000282, 0x20000505, 0x40000A0A, 0x80001414, 0x00002828, 0x00005050, 0x0000A0A0, 0x00014140,
+            0x00028280, 0x00050500, 0x000A0A00, 0x00141400, 0x00282800, 0x00505000, 0x00202000, 0x00404000,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x08014001, 0x10028002, 0x20050005, 0x400A000A, 0x80140014,
+            0x00280028, 0x00500050, 0x00A000A0, 0x01400140, 0x02800280, 0x05000500, 0x0A000A01, 0x14001402,
+            0x28002804, 0x50005008, 0xA000A011, 0x40014022, 0x80028044, 0x00050088, 0x000A0110, 0x00140220,
+            0x00280440, 0x00500880, 0x00A01100, 0x01402200, 0x02804400, 0x05008800, 0x02005000, 0x0400A000,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x23400005, 0x4680000A, 0x8D000015, 0x1A00002B, 0x34000057,
+            0x680000AE, 0xD000015C, 0xA00002B9, 0x40000572, 0x80000AE4, 0x000015C8, 0x00002B90, 0x00005720,
+            0x0000AE40, 0x00015C80, 0x0002B900, 0x00057200, 0x000AE400, 0x0015C800, 0x002B9000, 0x00572000,
+            0x00AE4000, 0x015C8000, 0x02B90000, 0x05720000, 0x0AE40001, 0x15C80002, 0x08D00001, 0x11A00002,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14115002, 0x2822A004, 0x50454008, 0xA08A8011, 0x41150022,
+            0x822A0044, 0x04540088, 0x08A80111, 0x11500222, 0x22A00445, 0x4540088A, 0x8A801115, 0x1500222A,
+            0x2A004454, 0x540088A8, 0xA8011150, 0x500222A0, 0xA0044541, 0x40088A82, 0x80111504, 0x00222A08,
+            0x00445410, 0x0088A820, 0x01115040, 0x0222A080, 0x04454100, 0x088A8201, 0x05045400, 0x0A08A801,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x27700505, 0x4EE00A0B, 0x9DC01417, 0x3B80282E, 0x7700505D,
+            0xEE00A0BA, 0xDC014175, 0xB80282EA, 0x700505D5, 0xE00A0BAB, 0xC0141756, 0x80282EAC, 0x00505D58,
+            0x00A0BAB0, 0x01417560, 0x0282EAC0, 0x0505D580, 0x0A0BAB01, 0x14175602, 0x282EAC04, 0x505D5808,
+            0xA0BAB011, 0x41756022, 0x82EAC044, 0x05D58088, 0x0BAB0111, 0x17560222, 0x09DC0141, 0x13B80282,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14436102, 0x2886C204, 0x510D8408, 0xA21B0811, 0x44361022,
+            0x886C2045, 0x10D8408A, 0x21B08115, 0x4361022A, 0x86C20454, 0x0D8408A9, 0x1B081153, 0x361022A7,
+            0x6C20454E, 0xD8408A9D, 0xB081153B, 0x61022A77, 0xC20454EE, 0x8408A9DC, 0x081153B9, 0x1022A772,
+            0x20454EE5, 0x408A9DCA, 0x81153B94, 0x022A7728, 0x0454EE50, 0x08A9DCA1, 0x0510D840, 0x0A21B081,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA7D07011, 0x4FA0E023, 0x9F41C047, 0x3E83808E, 0x7D07011C,
+            0xFA0E0238, 0xF41C0471, 0xE83808E2, 0xD07011C4, 0xA0E02389, 0x41C04712, 0x83808E24, 0x07011C48,
+            0x0E023891, 0x1C047123, 0x3808E246, 0x7011C48D, 0xE023891B, 0xC0471236, 0x808E246C, 0x011C48D8,
+            0x023891B0, 0x04712360, 0x08E246C1, 0x11C48D82, 0x23891B05, 0x4712360A, 0x29F41C04, 0x53E83808,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x56E01520, 0xADC02A40, 0x5B805481, 0xB700A903, 0x6E015206,
+            0xDC02A40D, 0xB805481A, 0x700A9035, 0xE015206B, 0xC02A40D6, 0x805481AC, 0x00A90358, 0x015206B0,
+            0x02A40D60, 0x05481AC0, 0x0A903581, 0x15206B02, 0x2A40D604, 0x5481AC08, 0xA9035810, 0x5206B020,
+            0xA40D6041, 0x481AC083, 0x90358106, 0x206B020D, 0x40D6041A, 0x81AC0834, 0x55B80548, 0xAB700A90,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55672480, 0xAACE4900, 0x559C9200, 0xAB392400, 0x56724800,
+            0xACE49000, 0x59C92001, 0xB3924003, 0x67248007, 0xCE49000F, 0x9C92001F, 0x3924003E, 0x7248007D,
+            0xE49000FB, 0xC92001F7, 0x924003EE, 0x248007DD, 0x49000FBB, 0x92001F76, 0x24003EED, 0x48007DDB,
+            0x9000FBB6, 0x2001F76D, 0x4003EEDA, 0x8007DDB4, 0x000FBB68, 0x001F76D0, 0x5559C920, 0xAAB39240,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xF5D74C41, 0xEBAE9882, 0xD75D3104, 0xAEBA6208, 0x5D74C411,
+            0xBAE98822, 0x75D31045, 0xEBA6208A, 0xD74C4114, 0xAE988228, 0x5D310451, 0xBA6208A2, 0x74C41145,
+            0xE988228A, 0xD3104514, 0xA6208A29, 0x4C411453, 0x988228A7, 0x3104514F, 0x6208A29F, 0xC411453E,
+            0x88228A7D, 0x104514FA, 0x208A29F5, 0x411453EA, 0x8228A7D4, 0x04514FA8, 0xFD75D310, 0xFAEBA620,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA35E1741, 0x46BC2E82, 0x8D785D05, 0x1AF0BA0B, 0x35E17417,
+            0x6BC2E82E, 0xD785D05C, 0xAF0BA0B8, 0x5E174171, 0xBC2E82E2, 0x785D05C4, 0xF0BA0B89, 0xE1741713,
+            0xC2E82E26, 0x85D05C4C, 0x0BA0B899, 0x17417132, 0x2E82E264, 0x5D05C4C9, 0xBA0B8992, 0x74171325,
+            0xE82E264A, 0xD05C4C94, 0xA0B89929, 0x41713252, 0x82E264A4, 0x05C4C948, 0xA8D785D0, 0x51AF0BA0,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD433F604, 0xA867EC08, 0x50CFD810, 0xA19FB021, 0x433F6042,
+            0x867EC084, 0x0CFD8109, 0x19FB0213, 0x33F60427, 0x67EC084F, 0xCFD8109F, 0x9FB0213F, 0x3F60427E,
+            0x7EC084FC, 0xFD8109F8, 0xFB0213F0, 0xF60427E1, 0xEC084FC2, 0xD8109F85, 0xB0213F0B, 0x60427E17,
+            0xC084FC2E, 0x8109F85C, 0x0213F0B8, 0x0427E170, 0x084FC2E1, 0x109F85C2, 0xF50CFD81, 0xEA19FB02,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xBFF29112, 0x7FE52224, 0xFFCA4448, 0xFF948890, 0xFF291120,
+            0xFE522240, 0xFCA44480, 0xF9488900, 0xF2911201, 0xE5222403, 0xCA444807, 0x9488900E, 0x2911201C,
+            0x52224038, 0xA4448071, 0x488900E3, 0x911201C6, 0x2224038D, 0x4448071A, 0x88900E35, 0x11201C6A,
+            0x224038D5, 0x448071AA, 0x8900E355, 0x1201C6AA, 0x24038D55, 0x48071AAB, 0x2FFCA444, 0x5FF94889,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD8202135, 0xB040426B, 0x608084D7, 0xC10109AE, 0x8202135C,
+            0x040426B8, 0x08084D71, 0x10109AE2, 0x202135C5, 0x40426B8A, 0x8084D714, 0x0109AE28, 0x02135C50,
+            0x0426B8A0, 0x084D7141, 0x109AE282, 0x2135C505, 0x426B8A0A, 0x84D71414, 0x09AE2829, 0x135C5052,
+            0x26B8A0A5, 0x4D71414B, 0x9AE28297, 0x35C5052F, 0x6B8A0A5E, 0xD71414BC, 0x7608084D, 0xEC10109A,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14C034A2, 0x29806944, 0x5300D288, 0xA601A511, 0x4C034A23,
+            0x98069447, 0x300D288F, 0x601A511F, 0xC034A23E, 0x8069447C, 0x00D288F8, 0x01A511F0, 0x034A23E0,
+            0x069447C0, 0x0D288F81, 0x1A511F03, 0x34A23E07, 0x69447C0E, 0xD288F81C, 0xA511F039, 0x4A23E073,
+            0x9447C0E6, 0x288F81CC, 0x511F0398, 0xA23E0731, 0x447C0E62, 0x88F81CC5, 0x05300D28, 0x0A601A51,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x05F31880, 0x0BE63101, 0x17CC6202, 0x2F98C404, 0x5F318809,
+            0xBE631012, 0x7CC62024, 0xF98C4048, 0xF3188091, 0xE6310123, 0xCC620247, 0x98C4048F, 0x3188091F,
+            0x6310123F, 0xC620247E, 0x8C4048FD, 0x188091FB, 0x310123F7, 0x620247EF, 0xC4048FDE, 0x88091FBD,
+            0x10123F7A, 0x20247EF5, 0x4048FDEA, 0x8091FBD4, 0x0123F7A8, 0x0247EF50, 0x017CC620, 0x02F98C40,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA07C0911, 0x40F81222, 0x81F02444, 0x03E04888, 0x07C09110,
+            0x0F812221, 0x1F024443, 0x3E048886, 0x7C09110C, 0xF8122218, 0xF0244431, 0xE0488863, 0xC09110C6,
+            0x8122218C, 0x02444318, 0x04888630, 0x09110C61, 0x122218C2, 0x24443185, 0x4888630B, 0x9110C616,
+            0x22218C2D, 0x4443185A, 0x888630B5, 0x110C616A, 0x2218C2D5, 0x443185AA, 0x281F0244, 0x503E0488,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x54086030, 0xA810C060, 0x502180C0, 0xA0430181, 0x40860302,
+            0x810C0604, 0x02180C08, 0x04301810, 0x08603021, 0x10C06042, 0x2180C085, 0x4301810A, 0x86030214,
+            0x0C060429, 0x180C0853, 0x301810A7, 0x6030214F, 0xC060429E, 0x80C0853C, 0x01810A78, 0x030214F0,
+            0x060429E0, 0x0C0853C1, 0x1810A783, 0x30214F07, 0x60429E0F, 0xC0853C1E, 0xD502180C, 0xAA043018,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x57D001E0, 0xAFA003C0, 0x5F400781, 0xBE800F02, 0x7D001E04,
+            0xFA003C08, 0xF4007811, 0xE800F022, 0xD001E044, 0xA003C089, 0x40078112, 0x800F0224, 0x001E0448,
+            0x003C0890, 0x00781120, 0x00F02240, 0x01E04480, 0x03C08900, 0x07811200, 0x0F022401, 0x1E044803,
+            0x3C089006, 0x7811200C, 0xF0224019, 0xE0448033, 0xC0890066, 0x811200CC, 0x55F40078, 0xABE800F0,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55403F80, 0xAA807F00, 0x5500FE00, 0xAA01FC00, 0x5403F800,
+            0xA807F000, 0x500FE000, 0xA01FC001, 0x403F8002, 0x807F0004, 0x00FE0008, 0x01FC0010, 0x03F80020,
+            0x07F00040, 0x0FE00081, 0x1FC00103, 0x3F800206, 0x7F00040C, 0xFE000818, 0xFC001030, 0xF8002060,
+            0xF00040C1, 0xE0008183, 0xC0010306, 0x8002060C, 0x00040C18, 0x00081830, 0x55500FE0, 0xAAA01FC0,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55FFF800, 0xABFFF000, 0x57FFE000, 0xAFFFC000, 0x5FFF8001,
+            0xBFFF0002, 0x7FFE0004, 0xFFFC0008, 0xFFF80010, 0xFFF00020, 0xFFE00040, 0xFFC00080, 0xFF800100,
+            0xFF000200, 0xFE000400, 0xFC000800, 0xF8001000, 0xF0002001, 0xE0004003, 0xC0008006, 0x8001000C,
+            0x00020018, 0x00040030, 0x00080060, 0x001000C0, 0x00200180, 0x00400300, 0x557FFE00, 0xAAFFFC00,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFF80000, 0xFFF00000, 0xFFE00000, 0xFFC00000,
+            0xFF800000, 0xFF000000, 0xFE000000, 0xFC000000, 0xF8000000, 0xF0000001, 0xE0000003, 0xC0000006,
+            0x8000000C, 0x00000018, 0x00000030, 0x00000060, 0x000000C0, 0x00000180, 0x00000300, 0x00000600,
+            0x00000C00, 0x00001800, 0x00003000, 0x00006000, 0x0000C000, 0x00018000, 0xFFFF0000, 0xFFFE0000,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100,
+            0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000004, 0x00000008,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
+            0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
+            0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000008, 0x00000010,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00808000, 0x01010000, 0x02020000, 0x04040000, 0x08080001,
+            0x10100002, 0x20200005, 0x4040000A, 0x80800014, 0x01000028, 0x02000050, 0x040000A0, 0x08000141,
+            0x10000282, 0x20000505, 0x40000A0A, 0x80001414, 0x00002828, 0x00005050, 0x0000A0A0, 0x00014140,
+            0x00028280, 0x00050500, 0x000A0A00, 0x00141400, 0x00282800, 0x00505000, 0x00202000, 0x00404000,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x08014001, 0x10028002, 0x20050005, 0x400A000A, 0x80140014,
+            0x00280028, 0x00500050, 0x00A000A0, 0x01400140, 0x02800280, 0x05000500, 0x0A000A01, 0x14001402,
+            0x28002804, 0x50005008, 0xA000A011, 0x40014022, 0x80028044, 0x00050088, 0x000A0110, 0x00140220,
+            0x00280440, 0x00500880, 0x00A01100, 0x01402200, 0x02804400, 0x05008800, 0x02005000, 0x0400A000,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x23400005, 0x4680000A, 0x8D000015, 0x1A00002B, 0x34000057,
+            0x680000AE, 0xD000015C, 0xA00002B9, 0x40000572, 0x80000AE4, 0x000015C8, 0x00002B90, 0x00005720,
+            0x0000AE40, 0x00015C80, 0x0002B900, 0x00057200, 0x000AE400, 0x0015C800, 0x002B9000, 0x00572000,
+            0x00AE4000, 0x015C8000, 0x02B90000, 0x05720000, 0x0AE40001, 0x15C80002, 0x08D00001, 0x11A00002,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14115002, 0x2822A004, 0x50454008, 0xA08A8011, 0x41150022,
+            0x822A0044, 0x04540088, 0x08A80111, 0x11500222, 0x22A00445, 0x4540088A, 0x8A801115, 0x1500222A,
+            0x2A004454, 0x540088A8, 0xA8011150, 0x500222A0, 0xA0044541, 0x40088A82, 0x80111504, 0x00222A08,
+            0x00445410, 0x0088A820, 0x01115040, 0x0222A080, 0x04454100, 0x088A8201, 0x05045400, 0x0A08A801,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x27700505, 0x4EE00A0B, 0x9DC01417, 0x3B80282E, 0x7700505D,
+            0xEE00A0BA, 0xDC014175, 0xB80282EA, 0x700505D5, 0xE00A0BAB, 0xC0141756, 0x80282EAC, 0x00505D58,
+            0x00A0BAB0, 0x01417560, 0x0282EAC0, 0x0505D580, 0x0A0BAB01, 0x14175602, 0x282EAC04, 0x505D5808,
+            0xA0BAB011, 0x41756022, 0x82EAC044, 0x05D58088, 0x0BAB0111, 0x17560222, 0x09DC0141, 0x13B80282,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14436102, 0x2886C204, 0x510D8408, 0xA21B0811, 0x44361022,
+            0x886C2045, 0x10D8408A, 0x21B08115, 0x4361022A, 0x86C20454, 0x0D8408A9, 0x1B081153, 0x361022A7,
+            0x6C20454E, 0xD8408A9D, 0xB081153B, 0x61022A77, 0xC20454EE, 0x8408A9DC, 0x081153B9, 0x1022A772,
+            0x20454EE5, 0x408A9DCA, 0x81153B94, 0x022A7728, 0x0454EE50, 0x08A9DCA1, 0x0510D840, 0x0A21B081,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA7D07011, 0x4FA0E023, 0x9F41C047, 0x3E83808E, 0x7D07011C,
+            0xFA0E0238, 0xF41C0471, 0xE83808E2, 0xD07011C4, 0xA0E02389, 0x41C04712, 0x83808E24, 0x07011C48,
+            0x0E023891, 0x1C047123, 0x3808E246, 0x7011C48D, 0xE023891B, 0xC0471236, 0x808E246C, 0x011C48D8,
+            0x023891B0, 0x04712360, 0x08E246C1, 0x11C48D82, 0x23891B05, 0x4712360A, 0x29F41C04, 0x53E83808,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x56E01520, 0xADC02A40, 0x5B805481, 0xB700A903, 0x6E015206,
+            0xDC02A40D, 0xB805481A, 0x700A9035, 0xE015206B, 0xC02A40D6, 0x805481AC, 0x00A90358, 0x015206B0,
+            0x02A40D60, 0x05481AC0, 0x0A903581, 0x15206B02, 0x2A40D604, 0x5481AC08, 0xA9035810, 0x5206B020,
+            0xA40D6041, 0x481AC083, 0x90358106, 0x206B020D, 0x40D6041A, 0x81AC0834, 0x55B80548, 0xAB700A90,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55672480, 0xAACE4900, 0x559C9200, 0xAB392400, 0x56724800,
+            0xACE49000, 0x59C92001, 0xB3924003, 0x67248007, 0xCE49000F, 0x9C92001F, 0x3924003E, 0x7248007D,
+            0xE49000FB, 0xC92001F7, 0x924003EE, 0x248007DD, 0x49000FBB, 0x92001F76, 0x24003EED, 0x48007DDB,
+            0x9000FBB6, 0x2001F76D, 0x4003EEDA, 0x8007DDB4, 0x000FBB68, 0x001F76D0, 0x5559C920, 0xAAB39240,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xF5D74C41, 0xEBAE9882, 0xD75D3104, 0xAEBA6208, 0x5D74C411,
+            0xBAE98822, 0x75D31045, 0xEBA6208A, 0xD74C4114, 0xAE988228, 0x5D310451, 0xBA6208A2, 0x74C41145,
+            0xE988228A, 0xD3104514, 0xA6208A29, 0x4C411453, 0x988228A7, 0x3104514F, 0x6208A29F, 0xC411453E,
+            0x88228A7D, 0x104514FA, 0x208A29F5, 0x411453EA, 0x8228A7D4, 0x04514FA8, 0xFD75D310, 0xFAEBA620,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA35E1741, 0x46BC2E82, 0x8D785D05, 0x1AF0BA0B, 0x35E17417,
+            0x6BC2E82E, 0xD785D05C, 0xAF0BA0B8, 0x5E174171, 0xBC2E82E2, 0x785D05C4, 0xF0BA0B89, 0xE1741713,
+            0xC2E82E26, 0x85D05C4C, 0x0BA0B899, 0x17417132, 0x2E82E264, 0x5D05C4C9, 0xBA0B8992, 0x74171325,
+            0xE82E264A, 0xD05C4C94, 0xA0B89929, 0x41713252, 0x82E264A4, 0x05C4C948, 0xA8D785D0, 0x51AF0BA0,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD433F604, 0xA867EC08, 0x50CFD810, 0xA19FB021, 0x433F6042,
+            0x867EC084, 0x0CFD8109, 0x19FB0213, 0x33F60427, 0x67EC084F, 0xCFD8109F, 0x9FB0213F, 0x3F60427E,
+            0x7EC084FC, 0xFD8109F8, 0xFB0213F0, 0xF60427E1, 0xEC084FC2, 0xD8109F85, 0xB0213F0B, 0x60427E17,
+            0xC084FC2E, 0x8109F85C, 0x0213F0B8, 0x0427E170, 0x084FC2E1, 0x109F85C2, 0xF50CFD81, 0xEA19FB02,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xBFF29112, 0x7FE52224, 0xFFCA4448, 0xFF948890, 0xFF291120,
+            0xFE522240, 0xFCA44480, 0xF9488900, 0xF2911201, 0xE5222403, 0xCA444807, 0x9488900E, 0x2911201C,
+            0x52224038, 0xA4448071, 0x488900E3, 0x911201C6, 0x2224038D, 0x4448071A, 0x88900E35, 0x11201C6A,
+            0x224038D5, 0x448071AA, 0x8900E355, 0x1201C6AA, 0x24038D55, 0x48071AAB, 0x2FFCA444, 0x5FF94889,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xD8202135, 0xB040426B, 0x608084D7, 0xC10109AE, 0x8202135C,
+            0x040426B8, 0x08084D71, 0x10109AE2, 0x202135C5, 0x40426B8A, 0x8084D714, 0x0109AE28, 0x02135C50,
+            0x0426B8A0, 0x084D7141, 0x109AE282, 0x2135C505, 0x426B8A0A, 0x84D71414, 0x09AE2829, 0x135C5052,
+            0x26B8A0A5, 0x4D71414B, 0x9AE28297, 0x35C5052F, 0x6B8A0A5E, 0xD71414BC, 0x7608084D, 0xEC10109A,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x14C034A2, 0x29806944, 0x5300D288, 0xA601A511, 0x4C034A23,
+            0x98069447, 0x300D288F, 0x601A511F, 0xC034A23E, 0x8069447C, 0x00D288F8, 0x01A511F0, 0x034A23E0,
+            0x069447C0, 0x0D288F81, 0x1A511F03, 0x34A23E07, 0x69447C0E, 0xD288F81C, 0xA511F039, 0x4A23E073,
+            0x9447C0E6, 0x288F81CC, 0x511F0398, 0xA23E0731, 0x447C0E62, 0x88F81CC5, 0x05300D28, 0x0A601A51,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x05F31880, 0x0BE63101, 0x17CC6202, 0x2F98C404, 0x5F318809,
+            0xBE631012, 0x7CC62024, 0xF98C4048, 0xF3188091, 0xE6310123, 0xCC620247, 0x98C4048F, 0x3188091F,
+            0x6310123F, 0xC620247E, 0x8C4048FD, 0x188091FB, 0x310123F7, 0x620247EF, 0xC4048FDE, 0x88091FBD,
+            0x10123F7A, 0x20247EF5, 0x4048FDEA, 0x8091FBD4, 0x0123F7A8, 0x0247EF50, 0x017CC620, 0x02F98C40,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xA07C0911, 0x40F81222, 0x81F02444, 0x03E04888, 0x07C09110,
+            0x0F812221, 0x1F024443, 0x3E048886, 0x7C09110C, 0xF8122218, 0xF0244431, 0xE0488863, 0xC09110C6,
+            0x8122218C, 0x02444318, 0x04888630, 0x09110C61, 0x122218C2, 0x24443185, 0x4888630B, 0x9110C616,
+            0x22218C2D, 0x4443185A, 0x888630B5, 0x110C616A, 0x2218C2D5, 0x443185AA, 0x281F0244, 0x503E0488,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x54086030, 0xA810C060, 0x502180C0, 0xA0430181, 0x40860302,
+            0x810C0604, 0x02180C08, 0x04301810, 0x08603021, 0x10C06042, 0x2180C085, 0x4301810A, 0x86030214,
+            0x0C060429, 0x180C0853, 0x301810A7, 0x6030214F, 0xC060429E, 0x80C0853C, 0x01810A78, 0x030214F0,
+            0x060429E0, 0x0C0853C1, 0x1810A783, 0x30214F07, 0x60429E0F, 0xC0853C1E, 0xD502180C, 0xAA043018,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x57D001E0, 0xAFA003C0, 0x5F400781, 0xBE800F02, 0x7D001E04,
+            0xFA003C08, 0xF4007811, 0xE800F022, 0xD001E044, 0xA003C089, 0x40078112, 0x800F0224, 0x001E0448,
+            0x003C0890, 0x00781120, 0x00F02240, 0x01E04480, 0x03C08900, 0x07811200, 0x0F022401, 0x1E044803,
+            0x3C089006, 0x7811200C, 0xF0224019, 0xE0448033, 0xC0890066, 0x811200CC, 0x55F40078, 0xABE800F0,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55403F80, 0xAA807F00, 0x5500FE00, 0xAA01FC00, 0x5403F800,
+            0xA807F000, 0x500FE000, 0xA01FC001, 0x403F8002, 0x807F0004, 0x00FE0008, 0x01FC0010, 0x03F80020,
+            0x07F00040, 0x0FE00081, 0x1FC00103, 0x3F800206, 0x7F00040C, 0xFE000818, 0xFC001030, 0xF8002060,
+            0xF00040C1, 0xE0008183, 0xC0010306, 0x8002060C, 0x00040C18, 0x00081830, 0x55500FE0, 0xAAA01FC0,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x55FFF800, 0xABFFF000, 0x57FFE000, 0xAFFFC000, 0x5FFF8001,
+            0xBFFF0002, 0x7FFE0004, 0xFFFC0008, 0xFFF80010, 0xFFF00020, 0xFFE00040, 0xFFC00080, 0xFF800100,
+            0xFF000200, 0xFE000400, 0xFC000800, 0xF8001000, 0xF0002001, 0xE0004003, 0xC0008006, 0x8001000C,
+            0x00020018, 0x00040030, 0x00080060, 0x001000C0, 0x00200180, 0x00400300, 0x557FFE00, 0xAAFFFC00,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFF80000, 0xFFF00000, 0xFFE00000, 0xFFC00000,
+            0xFF800000, 0xFF000000, 0xFE000000, 0xFC000000, 0xF8000000, 0xF0000001, 0xE0000003, 0xC0000006,
+            0x8000000C, 0x00000018, 0x00000030, 0x00000060, 0x000000C0, 0x00000180, 0x00000300, 0x00000600,
+            0x00000C00, 0x00001800, 0x00003000, 0x00006000, 0x0000C000, 0x00018000, 0xFFFF0000, 0xFFFE0000,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100,
+            0x00000200, 0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000,
+            0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000004, 0x00000008,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200,
+            0x00000400, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000,
+            0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000,
+            0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000008, 0x00000010,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+            0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+            0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x04000000, 0x08000001,
+            0x10000002, 0x20000005, 0x4000000A, 0x80000014, 0x00000028, 0x00000050, 0x00000020, 0x00000040,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00001000, 0x00002000, 0x00004000, 0x00008000,
+            0x00010000, 0x00020000, 0x00040000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000200, 0x00000400,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00100000, 0x00200000, 0x00400000, 0x00800000,
+            0x01000000, 0x02000000, 0x04000000, 0x08000001, 0x10000002, 0x20000005, 0x4000000A, 0x80000014,
+            0x00000028, 0x00000050, 0x000000A0, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x00020000, 0x00040000,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000140, 0x00000280, 0x00000500, 0x00000A00, 0x00001400,
+            0x00002800, 0x00005000, 0x0000A000, 0x00014000, 0x00028000, 0x00050000, 0x000A0000, 0x00140000,
+            0x00280000, 0x00500000, 0x00A00000, 0x01400000, 0x02800000, 0x05000000, 0x0A000001, 0x14000002,
+            0x28000004, 0x50000008, 0xA0000011, 0x40000022, 0x80000044, 0x00000088, 0x00000050, 0x000000A0,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00002200, 0x00004400, 0x00008800, 0x00011000, 0x00022000,
+            0x00044000, 0x00088000, 0x00110000, 0x00220000, 0x00440000, 0x00880000, 0x01100000, 0x02200000,
+            0x04400000, 0x08800001, 0x11000002, 0x22000005, 0x4400000A, 0x88000015, 0x1000002A, 0x20000055,
+            0x400000AA, 0x80000154, 0x000002A8, 0x00000550, 0x00000AA0, 0x00001540, 0x00000880, 0x00001100,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00808000, 0x01010000, 0x02020000, 0x04040000, 0x08080001,
+            0x10100002, 0x20200005, 0x4040000A, 0x80800014, 0x01000028, 0x02000050, 0x040000A0, 0x08000141,
+            0x10000282, 0x20000505, 0x40000A0A, 0x80001414, 0x00002828, 0x00005050, 0x0000A0A0, 0x00014140,
+            0x00028280, 0x00050500, 0x000A0A00, 0x00141400, 0x00282800, 0x00505000, 0x00202000, 0x00404000,
+        },
+    },
+};
+
+/* LFSR88 z2: previous, matrix^536870910 */
+const BitColumnMatrix32_t lfsr88_2_prev_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x50000000, 0xA0000001, 0x40000002, 0x80000004, 0x00000008,
+        0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800,
+        0x00001000, 0x00002000, 0x00004000, 0x00008000, 0x00010000, 0x00020000, 0x00040000, 0x00080000,
+        0x00100000, 0x00200000, 0x00400000, 0x00800000, 0x01000000, 0x02000000, 0x54000000, 0xA8000000,
+    },
+};
+
+/* LFSR88 z3: LFSR (s1 = 3, s2 = 11, s3 = 17, mask = 0xFFFFFFF0) */
+const BitColumnMatrix32_t lfsr88_3_jump_table[JUMP_TABLE_LEN] =
+{
+    /* 2^0 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000001, 0x04000002, 0x08000004, 0x10000009, 0x20000012, 0x40000024, 0x80000048, 0x00000090,
+            0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
+            0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00040000, 0x00080000, 0x00100000,
+        },
+    },
+    /* 2^1 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00004800, 0x00009000, 0x00012000,
+            0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00240000, 0x00480000, 0x00900000, 0x01200000,
+            0x02400001, 0x04800002, 0x09000004, 0x12000008, 0x24000010, 0x48000020, 0x90000041, 0x20000082,
+            0x40000104, 0x80000208, 0x00000410, 0x00000820, 0x00001040, 0x00000480, 0x00000900, 0x00001200,
+        },
+    },
+    /* 2^2 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x00820000, 0x01040000, 0x02080001,
+            0x04100002, 0x08200004, 0x10400009, 0x20800012, 0x41000024, 0x82000049, 0x04000092, 0x08000124,
+            0x10000249, 0x20000492, 0x40000924, 0x80001248, 0x00002490, 0x00004920, 0x00009240, 0x00012480,
+            0x00024900, 0x00049200, 0x00092400, 0x00124800, 0x00249000, 0x00082000, 0x00104000, 0x00208000,
+        },
+    },
+    /* 2^3 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10009009, 0x20012012, 0x40024024, 0x80048048,
+            0x00090090, 0x00120120, 0x00240240, 0x00480480, 0x00900900, 0x01201200, 0x02402401, 0x04804802,
+            0x09009004, 0x12012008, 0x24024010, 0x48048020, 0x90090041, 0x20120082, 0x40240104, 0x80480208,
+            0x00900410, 0x01200820, 0x02401041, 0x04802082, 0x09004104, 0x02001201, 0x04002402, 0x08004804,
+        },
+    },
+    /* 2^4 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0D100006, 0x1A20000C, 0x34400019, 0x68800032,
+            0xD1000065, 0xA20000CB, 0x44000196, 0x8800032C, 0x10000659, 0x20000CB2, 0x40001964, 0x800032C8,
+            0x00006590, 0x0000CB20, 0x00019640, 0x00032C80, 0x00065900, 0x000CB200, 0x00196400, 0x0032C800,
+            0x00659000, 0x00CB2000, 0x01964000, 0x032C8001, 0x06590003, 0x01A20000, 0x03440001, 0x06880003,
+        },
+    },
+    /* 2^5 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02D90901, 0x05B21202, 0x0B642405, 0x16C8480A,
+            0x2D909014, 0x5B212028, 0xB6424050, 0x6C8480A0, 0xD9090141, 0xB2120282, 0x64240504, 0xC8480A08,
+            0x90901411, 0x21202822, 0x42405045, 0x8480A08A, 0x09014114, 0x12028228, 0x24050450, 0x480A08A0,
+            0x90141141, 0x20282282, 0x40504504, 0x80A08A08, 0x01411410, 0x005B2120, 0x00B64240, 0x016C8480,
+        },
+    },
+    /* 2^6 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1022CB49, 0x20459692, 0x408B2D24, 0x81165A48,
+            0x022CB491, 0x04596922, 0x08B2D244, 0x1165A489, 0x22CB4913, 0x45969226, 0x8B2D244D, 0x165A489A,
+            0x2CB49134, 0x59692269, 0xB2D244D2, 0x65A489A4, 0xCB491349, 0x96922692, 0x2D244D24, 0x5A489A48,
+            0xB4913491, 0x69226922, 0xD244D244, 0xA489A488, 0x49134910, 0x82045969, 0x0408B2D2, 0x081165A4,
+        },
+    },
+    /* 2^7 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C047522, 0x9808EA45, 0x3011D48B, 0x6023A916,
+            0xC047522C, 0x808EA458, 0x011D48B0, 0x023A9161, 0x047522C2, 0x08EA4584, 0x11D48B09, 0x23A91613,
+            0x47522C27, 0x8EA4584F, 0x1D48B09F, 0x3A91613E, 0x7522C27D, 0xEA4584FB, 0xD48B09F7, 0xA91613EE,
+            0x522C27DC, 0xA4584FB8, 0x48B09F70, 0x91613EE1, 0x22C27DC3, 0x09808EA4, 0x13011D48, 0x26023A91,
+        },
+    },
+    /* 2^8 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x938110D0, 0x270221A1, 0x4E044343, 0x9C088687,
+            0x38110D0F, 0x70221A1F, 0xE044343E, 0xC088687C, 0x8110D0F8, 0x0221A1F1, 0x044343E2, 0x088687C4,
+            0x110D0F89, 0x221A1F13, 0x44343E26, 0x88687C4C, 0x10D0F899, 0x21A1F132, 0x4343E265, 0x8687C4CB,
+            0x0D0F8996, 0x1A1F132C, 0x343E2659, 0x687C4CB2, 0xD0F89965, 0x3270221A, 0x64E04434, 0xC9C08868,
+        },
+    },
+    /* 2^9 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x593F4519, 0xB27E8A32, 0x64FD1464, 0xC9FA28C8,
+            0x93F45190, 0x27E8A321, 0x4FD14643, 0x9FA28C86, 0x3F45190C, 0x7E8A3218, 0xFD146431, 0xFA28C862,
+            0xF45190C5, 0xE8A3218A, 0xD1464315, 0xA28C862B, 0x45190C56, 0x8A3218AD, 0x1464315B, 0x28C862B6,
+            0x5190C56D, 0xA3218ADB, 0x464315B7, 0x8C862B6E, 0x190C56DD, 0x6B27E8A3, 0xD64FD146, 0xAC9FA28C,
+        },
+    },
+    /* 2^10 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCA483FE9, 0x94907FD3, 0x2920FFA6, 0x5241FF4C,
+            0xA483FE98, 0x4907FD30, 0x920FFA60, 0x241FF4C0, 0x483FE980, 0x907FD301, 0x20FFA602, 0x41FF4C04,
+            0x83FE9809, 0x07FD3013, 0x0FFA6027, 0x1FF4C04E, 0x3FE9809C, 0x7FD30138, 0xFFA60270, 0xFF4C04E0,
+            0xFE9809C0, 0xFD301381, 0xFA602702, 0xF4C04E05, 0xE9809C0A, 0x194907FD, 0x32920FFA, 0x65241FF4,
+        },
+    },
+    /* 2^11 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD231C704, 0xA4638E08, 0x48C71C10, 0x918E3821,
+            0x231C7043, 0x4638E087, 0x8C71C10E, 0x18E3821D, 0x31C7043B, 0x638E0877, 0xC71C10EF, 0x8E3821DF,
+            0x1C7043BF, 0x38E0877F, 0x71C10EFF, 0xE3821DFF, 0xC7043BFF, 0x8E0877FF, 0x1C10EFFF, 0x3821DFFF,
+            0x7043BFFF, 0xE0877FFE, 0xC10EFFFC, 0x821DFFF9, 0x043BFFF2, 0xDA4638E0, 0xB48C71C1, 0x6918E382,
+        },
+    },
+    /* 2^12 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCC257D0A, 0x984AFA15, 0x3095F42B, 0x612BE856,
+            0xC257D0AD, 0x84AFA15A, 0x095F42B4, 0x12BE8568, 0x257D0AD0, 0x4AFA15A1, 0x95F42B43, 0x2BE85687,
+            0x57D0AD0E, 0xAFA15A1D, 0x5F42B43A, 0xBE856874, 0x7D0AD0E9, 0xFA15A1D2, 0xF42B43A5, 0xE856874A,
+            0xD0AD0E95, 0xA15A1D2A, 0x42B43A55, 0x856874AA, 0x0AD0E955, 0xD984AFA1, 0xB3095F42, 0x6612BE85,
+        },
+    },
+    /* 2^13 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC385349D, 0x870A693B, 0x0E14D277, 0x1C29A4EF,
+            0x385349DF, 0x70A693BF, 0xE14D277E, 0xC29A4EFD, 0x85349DFA, 0x0A693BF5, 0x14D277EB, 0x29A4EFD6,
+            0x5349DFAC, 0xA693BF59, 0x4D277EB2, 0x9A4EFD64, 0x349DFAC9, 0x693BF592, 0xD277EB24, 0xA4EFD648,
+            0x49DFAC90, 0x93BF5920, 0x277EB241, 0x4EFD6483, 0x9DFAC907, 0xF870A693, 0xF0E14D27, 0xE1C29A4E,
+        },
+    },
+    /* 2^14 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC07E448C, 0x80FC8918, 0x01F91230, 0x03F22461,
+            0x07E448C3, 0x0FC89187, 0x1F91230E, 0x3F22461C, 0x7E448C38, 0xFC891871, 0xF91230E3, 0xF22461C6,
+            0xE448C38C, 0xC8918718, 0x91230E31, 0x22461C63, 0x448C38C6, 0x8918718C, 0x1230E318, 0x2461C630,
+            0x48C38C60, 0x918718C1, 0x230E3183, 0x461C6307, 0x8C38C60E, 0xD80FC891, 0xB01F9123, 0x603F2246,
+        },
+    },
+    /* 2^15 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9101BBF1, 0x220377E3, 0x4406EFC6, 0x880DDF8C,
+            0x101BBF19, 0x20377E32, 0x406EFC64, 0x80DDF8C8, 0x01BBF190, 0x0377E321, 0x06EFC643, 0x0DDF8C86,
+            0x1BBF190C, 0x377E3218, 0x6EFC6431, 0xDDF8C863, 0xBBF190C6, 0x77E3218C, 0xEFC64319, 0xDF8C8632,
+            0xBF190C64, 0x7E3218C8, 0xFC643191, 0xF8C86323, 0xF190C647, 0x7220377E, 0xE4406EFC, 0xC880DDF8,
+        },
+    },
+    /* 2^16 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5D5D555B, 0xBABAAAB6, 0x7575556D, 0xEAEAAADB,
+            0xD5D555B7, 0xABAAAB6F, 0x575556DE, 0xAEAAADBD, 0x5D555B7B, 0xBAAAB6F6, 0x75556DED, 0xEAAADBDB,
+            0xD555B7B7, 0xAAAB6F6F, 0x5556DEDF, 0xAAADBDBF, 0x555B7B7F, 0xAAB6F6FF, 0x556DEDFF, 0xAADBDBFF,
+            0x55B7B7FF, 0xAB6F6FFF, 0x56DEDFFE, 0xADBDBFFC, 0x5B7B7FF8, 0xEBABAAAB, 0xD7575556, 0xAEAEAAAD,
+        },
+    },
+    /* 2^17 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AC88ACD, 0x1591159B, 0x2B222B37, 0x5644566E,
+            0xAC88ACDC, 0x591159B9, 0xB222B372, 0x644566E4, 0xC88ACDC8, 0x91159B91, 0x222B3723, 0x44566E46,
+            0x88ACDC8C, 0x1159B919, 0x22B37233, 0x4566E466, 0x8ACDC8CD, 0x159B919B, 0x2B372337, 0x566E466E,
+            0xACDC8CDC, 0x59B919B9, 0xB3723372, 0x66E466E5, 0xCDC8CDCA, 0x11591159, 0x22B222B3, 0x45644566,
+        },
+    },
+    /* 2^18 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x46629747, 0x8CC52E8E, 0x198A5D1D, 0x3314BA3A,
+            0x66297475, 0xCC52E8EA, 0x98A5D1D5, 0x314BA3AB, 0x62974757, 0xC52E8EAE, 0x8A5D1D5D, 0x14BA3ABB,
+            0x29747576, 0x52E8EAEC, 0xA5D1D5D8, 0x4BA3ABB1, 0x97475762, 0x2E8EAEC5, 0x5D1D5D8B, 0xBA3ABB16,
+            0x7475762D, 0xE8EAEC5A, 0xD1D5D8B5, 0xA3ABB16B, 0x475762D7, 0xC8CC52E8, 0x9198A5D1, 0x23314BA3,
+        },
+    },
+    /* 2^19 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD4A5E527, 0xA94BCA4E, 0x5297949C, 0xA52F2938,
+            0x4A5E5271, 0x94BCA4E3, 0x297949C6, 0x52F2938C, 0xA5E52718, 0x4BCA4E31, 0x97949C62, 0x2F2938C5,
+            0x5E52718A, 0xBCA4E315, 0x7949C62B, 0xF2938C56, 0xE52718AC, 0xCA4E3159, 0x949C62B3, 0x2938C566,
+            0x52718ACC, 0xA4E31598, 0x49C62B30, 0x938C5660, 0x2718ACC1, 0x9A94BCA4, 0x35297949, 0x6A52F293,
+        },
+    },
+    /* 2^20 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCCD374DA, 0x99A6E9B5, 0x334DD36A, 0x669BA6D5,
+            0xCD374DAA, 0x9A6E9B54, 0x34DD36A9, 0x69BA6D52, 0xD374DAA4, 0xA6E9B549, 0x4DD36A92, 0x9BA6D524,
+            0x374DAA48, 0x6E9B5491, 0xDD36A923, 0xBA6D5246, 0x74DAA48D, 0xE9B5491A, 0xD36A9234, 0xA6D52469,
+            0x4DAA48D2, 0x9B5491A4, 0x36A92348, 0x6D524690, 0xDAA48D20, 0x799A6E9B, 0xF334DD36, 0xE669BA6D,
+        },
+    },
+    /* 2^21 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8383DC39, 0x0707B873, 0x0E0F70E7, 0x1C1EE1CF,
+            0x383DC39F, 0x707B873F, 0xE0F70E7E, 0xC1EE1CFC, 0x83DC39F9, 0x07B873F3, 0x0F70E7E7, 0x1EE1CFCE,
+            0x3DC39F9D, 0x7B873F3A, 0xF70E7E74, 0xEE1CFCE9, 0xDC39F9D3, 0xB873F3A7, 0x70E7E74F, 0xE1CFCE9E,
+            0xC39F9D3D, 0x873F3A7B, 0x0E7E74F7, 0x1CFCE9EF, 0x39F9D3DF, 0xF0707B87, 0xE0E0F70E, 0xC1C1EE1C,
+        },
+    },
+    /* 2^22 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x153A407B, 0x2A7480F7, 0x54E901EF, 0xA9D203DE,
+            0x53A407BC, 0xA7480F79, 0x4E901EF3, 0x9D203DE7, 0x3A407BCE, 0x7480F79D, 0xE901EF3A, 0xD203DE74,
+            0xA407BCE8, 0x480F79D0, 0x901EF3A1, 0x203DE742, 0x407BCE84, 0x80F79D08, 0x01EF3A10, 0x03DE7421,
+            0x07BCE843, 0x0F79D087, 0x1EF3A10E, 0x3DE7421D, 0x7BCE843A, 0xE2A7480F, 0xC54E901E, 0x8A9D203D,
+        },
+    },
+    /* 2^23 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x48992E30, 0x91325C61, 0x2264B8C3, 0x44C97186,
+            0x8992E30C, 0x1325C618, 0x264B8C31, 0x4C971862, 0x992E30C5, 0x325C618A, 0x64B8C314, 0xC9718628,
+            0x92E30C50, 0x25C618A0, 0x4B8C3141, 0x97186282, 0x2E30C505, 0x5C618A0B, 0xB8C31417, 0x7186282F,
+            0xE30C505F, 0xC618A0BF, 0x8C31417E, 0x186282FD, 0x30C505FB, 0x291325C6, 0x52264B8C, 0xA44C9718,
+        },
+    },
+    /* 2^24 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x82070B19, 0x040E1632, 0x081C2C64, 0x103858C9,
+            0x2070B192, 0x40E16324, 0x81C2C648, 0x03858C91, 0x070B1923, 0x0E163247, 0x1C2C648F, 0x3858C91F,
+            0x70B1923F, 0xE163247E, 0xC2C648FD, 0x858C91FA, 0x0B1923F5, 0x163247EA, 0x2C648FD4, 0x58C91FA9,
+            0xB1923F53, 0x63247EA7, 0xC648FD4F, 0x8C91FA9E, 0x1923F53D, 0xB040E163, 0x6081C2C6, 0xC103858C,
+        },
+    },
+    /* 2^25 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x102050A9, 0x2040A152, 0x408142A4, 0x81028548,
+            0x02050A91, 0x040A1522, 0x08142A44, 0x10285489, 0x2050A912, 0x40A15224, 0x8142A448, 0x02854891,
+            0x050A9122, 0x0A152245, 0x142A448B, 0x28548916, 0x50A9122D, 0xA152245A, 0x42A448B5, 0x8548916A,
+            0x0A9122D5, 0x152245AB, 0x2A448B57, 0x548916AF, 0xA9122D5E, 0x42040A15, 0x8408142A, 0x08102854,
+        },
+    },
+    /* 2^26 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08102044, 0x10204089, 0x20408112, 0x40810224,
+            0x81020448, 0x02040891, 0x04081122, 0x08102244, 0x10204489, 0x20408912, 0x40811224, 0x81022448,
+            0x02044891, 0x04089122, 0x08112244, 0x10224489, 0x20448912, 0x40891224, 0x81122448, 0x02244891,
+            0x04489122, 0x08912244, 0x11224489, 0x22448913, 0x44891226, 0x81020408, 0x02040811, 0x04081022,
+        },
+    },
+    /* 2^27 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000801, 0x04001002, 0x08002004, 0x10004009,
+            0x20008012, 0x40010024, 0x80020048, 0x00040090, 0x00080120, 0x00100240, 0x00200480, 0x00400900,
+            0x00801200, 0x01002400, 0x02004801, 0x04009002, 0x08012004, 0x10024009, 0x20048012, 0x40090024,
+            0x80120048, 0x00240090, 0x00480120, 0x00900240, 0x01200480, 0x00400100, 0x00800200, 0x01000400,
+        },
+    },
+    /* 2^28 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000001, 0x04000002, 0x08000004, 0x10000009, 0x20000012, 0x40000024, 0x80000048, 0x00000090,
+            0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
+            0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00040000, 0x00080000, 0x00100000,
+        },
+    },
+    /* 2^29 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00004800, 0x00009000, 0x00012000,
+            0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00240000, 0x00480000, 0x00900000, 0x01200000,
+            0x02400001, 0x04800002, 0x09000004, 0x12000008, 0x24000010, 0x48000020, 0x90000041, 0x20000082,
+            0x40000104, 0x80000208, 0x00000410, 0x00000820, 0x00001040, 0x00000480, 0x00000900, 0x00001200,
+        },
+    },
+    /* 2^30 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x00820000, 0x01040000, 0x02080001,
+            0x04100002, 0x08200004, 0x10400009, 0x20800012, 0x41000024, 0x82000049, 0x04000092, 0x08000124,
+            0x10000249, 0x20000492, 0x40000924, 0x80001248, 0x00002490, 0x00004920, 0x00009240, 0x00012480,
+            0x00024900, 0x00049200, 0x00092400, 0x00124800, 0x00249000, 0x00082000, 0x00104000, 0x00208000,
+        },
+    },
+    /* 2^31 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10009009, 0x20012012, 0x40024024, 0x80048048,
+            0x00090090, 0x00120120, 0x00240240, 0x00480480, 0x00900900, 0x01201200, 0x02402401, 0x04804802,
+            0x09009004, 0x12012008, 0x24024010, 0x48048020, 0x90090041, 0x20120082, 0x40240104, 0x80480208,
+            0x00900410, 0x01200820, 0x02401041, 0x04802082, 0x09004104, 0x02001201, 0x04002402, 0x08004804,
+        },
+    },
+    /* 2^32 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0D100006, 0x1A20000C, 0x34400019, 0x68800032,
+            0xD1000065, 0xA20000CB, 0x44000196, 0x8800032C, 0x10000659, 0x20000CB2, 0x40001964, 0x800032C8,
+            0x00006590, 0x0000CB20, 0x00019640, 0x00032C80, 0x00065900, 0x000CB200, 0x00196400, 0x0032C800,
+            0x00659000, 0x00CB2000, 0x01964000, 0x032C8001, 0x06590003, 0x01A20000, 0x03440001, 0x06880003,
+        },
+    },
+    /* 2^33 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02D90901, 0x05B21202, 0x0B642405, 0x16C8480A,
+            0x2D909014, 0x5B212028, 0xB6424050, 0x6C8480A0, 0xD9090141, 0xB2120282, 0x64240504, 0xC8480A08,
+            0x90901411, 0x21202822, 0x42405045, 0x8480A08A, 0x09014114, 0x12028228, 0x24050450, 0x480A08A0,
+            0x90141141, 0x20282282, 0x40504504, 0x80A08A08, 0x01411410, 0x005B2120, 0x00B64240, 0x016C8480,
+        },
+    },
+    /* 2^34 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1022CB49, 0x20459692, 0x408B2D24, 0x81165A48,
+            0x022CB491, 0x04596922, 0x08B2D244, 0x1165A489, 0x22CB4913, 0x45969226, 0x8B2D244D, 0x165A489A,
+            0x2CB49134, 0x59692269, 0xB2D244D2, 0x65A489A4, 0xCB491349, 0x96922692, 0x2D244D24, 0x5A489A48,
+            0xB4913491, 0x69226922, 0xD244D244, 0xA489A488, 0x49134910, 0x82045969, 0x0408B2D2, 0x081165A4,
+        },
+    },
+    /* 2^35 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C047522, 0x9808EA45, 0x3011D48B, 0x6023A916,
+            0xC047522C, 0x808EA458, 0x011D48B0, 0x023A9161, 0x047522C2, 0x08EA4584, 0x11D48B09, 0x23A91613,
+            0x47522C27, 0x8EA4584F, 0x1D48B09F, 0x3A91613E, 0x7522C27D, 0xEA4584FB, 0xD48B09F7, 0xA91613EE,
+            0x522C27DC, 0xA4584FB8, 0x48B09F70, 0x91613EE1, 0x22C27DC3, 0x09808EA4, 0x13011D48, 0x26023A91,
+        },
+    },
+    /* 2^36 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x938110D0, 0x270221A1, 0x4E044343, 0x9C088687,
+            0x38110D0F, 0x70221A1F, 0xE044343E, 0xC088687C, 0x8110D0F8, 0x0221A1F1, 0x044343E2, 0x088687C4,
+            0x110D0F89, 0x221A1F13, 0x44343E26, 0x88687C4C, 0x10D0F899, 0x21A1F132, 0x4343E265, 0x8687C4CB,
+            0x0D0F8996, 0x1A1F132C, 0x343E2659, 0x687C4CB2, 0xD0F89965, 0x3270221A, 0x64E04434, 0xC9C08868,
+        },
+    },
+    /* 2^37 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x593F4519, 0xB27E8A32, 0x64FD1464, 0xC9FA28C8,
+            0x93F45190, 0x27E8A321, 0x4FD14643, 0x9FA28C86, 0x3F45190C, 0x7E8A3218, 0xFD146431, 0xFA28C862,
+            0xF45190C5, 0xE8A3218A, 0xD1464315, 0xA28C862B, 0x45190C56, 0x8A3218AD, 0x1464315B, 0x28C862B6,
+            0x5190C56D, 0xA3218ADB, 0x464315B7, 0x8C862B6E, 0x190C56DD, 0x6B27E8A3, 0xD64FD146, 0xAC9FA28C,
+        },
+    },
+    /* 2^38 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCA483FE9, 0x94907FD3, 0x2920FFA6, 0x5241FF4C,
+            0xA483FE98, 0x4907FD30, 0x920FFA60, 0x241FF4C0, 0x483FE980, 0x907FD301, 0x20FFA602, 0x41FF4C04,
+            0x83FE9809, 0x07FD3013, 0x0FFA6027, 0x1FF4C04E, 0x3FE9809C, 0x7FD30138, 0xFFA60270, 0xFF4C04E0,
+            0xFE9809C0, 0xFD301381, 0xFA602702, 0xF4C04E05, 0xE9809C0A, 0x194907FD, 0x32920FFA, 0x65241FF4,
+        },
+    },
+    /* 2^39 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD231C704, 0xA4638E08, 0x48C71C10, 0x918E3821,
+            0x231C7043, 0x4638E087, 0x8C71C10E, 0x18E3821D, 0x31C7043B, 0x638E0877, 0xC71C10EF, 0x8E3821DF,
+            0x1C7043BF, 0x38E0877F, 0x71C10EFF, 0xE3821DFF, 0xC7043BFF, 0x8E0877FF, 0x1C10EFFF, 0x3821DFFF,
+            0x7043BFFF, 0xE0877FFE, 0xC10EFFFC, 0x821DFFF9, 0x043BFFF2, 0xDA4638E0, 0xB48C71C1, 0x6918E382,
+        },
+    },
+    /* 2^40 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCC257D0A, 0x984AFA15, 0x3095F42B, 0x612BE856,
+            0xC257D0AD, 0x84AFA15A, 0x095F42B4, 0x12BE8568, 0x257D0AD0, 0x4AFA15A1, 0x95F42B43, 0x2BE85687,
+            0x57D0AD0E, 0xAFA15A1D, 0x5F42B43A, 0xBE856874, 0x7D0AD0E9, 0xFA15A1D2, 0xF42B43A5, 0xE856874A,
+            0xD0AD0E95, 0xA15A1D2A, 0x42B43A55, 0x856874AA, 0x0AD0E955, 0xD984AFA1, 0xB3095F42, 0x6612BE85,
+        },
+    },
+    /* 2^41 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC385349D, 0x870A693B, 0x0E14D277, 0x1C29A4EF,
+            0x385349DF, 0x70A693BF, 0xE14D277E, 0xC29A4EFD, 0x85349DFA, 0x0A693BF5, 0x14D277EB, 0x29A4EFD6,
+            0x5349DFAC, 0xA693BF59, 0x4D277EB2, 0x9A4EFD64, 0x349DFAC9, 0x693BF592, 0xD277EB24, 0xA4EFD648,
+            0x49DFAC90, 0x93BF5920, 0x277EB241, 0x4EFD6483, 0x9DFAC907, 0xF870A693, 0xF0E14D27, 0xE1C29A4E,
+        },
+    },
+    /* 2^42 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC07E448C, 0x80FC8918, 0x01F91230, 0x03F22461,
+            0x07E448C3, 0x0FC89187, 0x1F91230E, 0x3F22461C, 0x7E448C38, 0xFC891871, 0xF91230E3, 0xF22461C6,
+            0xE448C38C, 0xC8918718, 0x91230E31, 0x22461C63, 0x448C38C6, 0x8918718C, 0x1230E318, 0x2461C630,
+            0x48C38C60, 0x918718C1, 0x230E3183, 0x461C6307, 0x8C38C60E, 0xD80FC891, 0xB01F9123, 0x603F2246,
+        },
+    },
+    /* 2^43 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9101BBF1, 0x220377E3, 0x4406EFC6, 0x880DDF8C,
+            0x101BBF19, 0x20377E32, 0x406EFC64, 0x80DDF8C8, 0x01BBF190, 0x0377E321, 0x06EFC643, 0x0DDF8C86,
+            0x1BBF190C, 0x377E3218, 0x6EFC6431, 0xDDF8C863, 0xBBF190C6, 0x77E3218C, 0xEFC64319, 0xDF8C8632,
+            0xBF190C64, 0x7E3218C8, 0xFC643191, 0xF8C86323, 0xF190C647, 0x7220377E, 0xE4406EFC, 0xC880DDF8,
+        },
+    },
+    /* 2^44 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5D5D555B, 0xBABAAAB6, 0x7575556D, 0xEAEAAADB,
+            0xD5D555B7, 0xABAAAB6F, 0x575556DE, 0xAEAAADBD, 0x5D555B7B, 0xBAAAB6F6, 0x75556DED, 0xEAAADBDB,
+            0xD555B7B7, 0xAAAB6F6F, 0x5556DEDF, 0xAAADBDBF, 0x555B7B7F, 0xAAB6F6FF, 0x556DEDFF, 0xAADBDBFF,
+            0x55B7B7FF, 0xAB6F6FFF, 0x56DEDFFE, 0xADBDBFFC, 0x5B7B7FF8, 0xEBABAAAB, 0xD7575556, 0xAEAEAAAD,
+        },
+    },
+    /* 2^45 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AC88ACD, 0x1591159B, 0x2B222B37, 0x5644566E,
+            0xAC88ACDC, 0x591159B9, 0xB222B372, 0x644566E4, 0xC88ACDC8, 0x91159B91, 0x222B3723, 0x44566E46,
+            0x88ACDC8C, 0x1159B919, 0x22B37233, 0x4566E466, 0x8ACDC8CD, 0x159B919B, 0x2B372337, 0x566E466E,
+            0xACDC8CDC, 0x59B919B9, 0xB3723372, 0x66E466E5, 0xCDC8CDCA, 0x11591159, 0x22B222B3, 0x45644566,
+        },
+    },
+    /* 2^46 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x46629747, 0x8CC52E8E, 0x198A5D1D, 0x3314BA3A,
+            0x66297475, 0xCC52E8EA, 0x98A5D1D5, 0x314BA3AB, 0x62974757, 0xC52E8EAE, 0x8A5D1D5D, 0x14BA3ABB,
+            0x29747576, 0x52E8EAEC, 0xA5D1D5D8, 0x4BA3ABB1, 0x97475762, 0x2E8EAEC5, 0x5D1D5D8B, 0xBA3ABB16,
+            0x7475762D, 0xE8EAEC5A, 0xD1D5D8B5, 0xA3ABB16B, 0x475762D7, 0xC8CC52E8, 0x9198A5D1, 0x23314BA3,
+        },
+    },
+    /* 2^47 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xD4A5E527, 0xA94BCA4E, 0x5297949C, 0xA52F2938,
+            0x4A5E5271, 0x94BCA4E3, 0x297949C6, 0x52F2938C, 0xA5E52718, 0x4BCA4E31, 0x97949C62, 0x2F2938C5,
+            0x5E52718A, 0xBCA4E315, 0x7949C62B, 0xF2938C56, 0xE52718AC, 0xCA4E3159, 0x949C62B3, 0x2938C566,
+            0x52718ACC, 0xA4E31598, 0x49C62B30, 0x938C5660, 0x2718ACC1, 0x9A94BCA4, 0x35297949, 0x6A52F293,
+        },
+    },
+    /* 2^48 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xCCD374DA, 0x99A6E9B5, 0x334DD36A, 0x669BA6D5,
+            0xCD374DAA, 0x9A6E9B54, 0x34DD36A9, 0x69BA6D52, 0xD374DAA4, 0xA6E9B549, 0x4DD36A92, 0x9BA6D524,
+            0x374DAA48, 0x6E9B5491, 0xDD36A923, 0xBA6D5246, 0x74DAA48D, 0xE9B5491A, 0xD36A9234, 0xA6D52469,
+            0x4DAA48D2, 0x9B5491A4, 0x36A92348, 0x6D524690, 0xDAA48D20, 0x799A6E9B, 0xF334DD36, 0xE669BA6D,
+        },
+    },
+    /* 2^49 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8383DC39, 0x0707B873, 0x0E0F70E7, 0x1C1EE1CF,
+            0x383DC39F, 0x707B873F, 0xE0F70E7E, 0xC1EE1CFC, 0x83DC39F9, 0x07B873F3, 0x0F70E7E7, 0x1EE1CFCE,
+            0x3DC39F9D, 0x7B873F3A, 0xF70E7E74, 0xEE1CFCE9, 0xDC39F9D3, 0xB873F3A7, 0x70E7E74F, 0xE1CFCE9E,
+            0xC39F9D3D, 0x873F3A7B, 0x0E7E74F7, 0x1CFCE9EF, 0x39F9D3DF, 0xF0707B87, 0xE0E0F70E, 0xC1C1EE1C,
+        },
+    },
+    /* 2^50 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x153A407B, 0x2A7480F7, 0x54E901EF, 0xA9D203DE,
+            0x53A407BC, 0xA7480F79, 0x4E901EF3, 0x9D203DE7, 0x3A407BCE, 0x7480F79D, 0xE901EF3A, 0xD203DE74,
+            0xA407BCE8, 0x480F79D0, 0x901EF3A1, 0x203DE742, 0x407BCE84, 0x80F79D08, 0x01EF3A10, 0x03DE7421,
+            0x07BCE843, 0x0F79D087, 0x1EF3A10E, 0x3DE7421D, 0x7BCE843A, 0xE2A7480F, 0xC54E901E, 0x8A9D203D,
+        },
+    },
+    /* 2^51 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x48992E30, 0x91325C61, 0x2264B8C3, 0x44C97186,
+            0x8992E30C, 0x1325C618, 0x264B8C31, 0x4C971862, 0x992E30C5, 0x325C618A, 0x64B8C314, 0xC9718628,
+            0x92E30C50, 0x25C618A0, 0x4B8C3141, 0x97186282, 0x2E30C505, 0x5C618A0B, 0xB8C31417, 0x7186282F,
+            0xE30C505F, 0xC618A0BF, 0x8C31417E, 0x186282FD, 0x30C505FB, 0x291325C6, 0x52264B8C, 0xA44C9718,
+        },
+    },
+    /* 2^52 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x82070B19, 0x040E1632, 0x081C2C64, 0x103858C9,
+            0x2070B192, 0x40E16324, 0x81C2C648, 0x03858C91, 0x070B1923, 0x0E163247, 0x1C2C648F, 0x3858C91F,
+            0x70B1923F, 0xE163247E, 0xC2C648FD, 0x858C91FA, 0x0B1923F5, 0x163247EA, 0x2C648FD4, 0x58C91FA9,
+            0xB1923F53, 0x63247EA7, 0xC648FD4F, 0x8C91FA9E, 0x1923F53D, 0xB040E163, 0x6081C2C6, 0xC103858C,
+        },
+    },
+    /* 2^53 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x102050A9, 0x2040A152, 0x408142A4, 0x81028548,
+            0x02050A91, 0x040A1522, 0x08142A44, 0x10285489, 0x2050A912, 0x40A15224, 0x8142A448, 0x02854891,
+            0x050A9122, 0x0A152245, 0x142A448B, 0x28548916, 0x50A9122D, 0xA152245A, 0x42A448B5, 0x8548916A,
+            0x0A9122D5, 0x152245AB, 0x2A448B57, 0x548916AF, 0xA9122D5E, 0x42040A15, 0x8408142A, 0x08102854,
+        },
+    },
+    /* 2^54 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08102044, 0x10204089, 0x20408112, 0x40810224,
+            0x81020448, 0x02040891, 0x04081122, 0x08102244, 0x10204489, 0x20408912, 0x40811224, 0x81022448,
+            0x02044891, 0x04089122, 0x08112244, 0x10224489, 0x20448912, 0x40891224, 0x81122448, 0x02244891,
+            0x04489122, 0x08912244, 0x11224489, 0x22448913, 0x44891226, 0x81020408, 0x02040811, 0x04081022,
+        },
+    },
+    /* 2^55 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000801, 0x04001002, 0x08002004, 0x10004009,
+            0x20008012, 0x40010024, 0x80020048, 0x00040090, 0x00080120, 0x00100240, 0x00200480, 0x00400900,
+            0x00801200, 0x01002400, 0x02004801, 0x04009002, 0x08012004, 0x10024009, 0x20048012, 0x40090024,
+            0x80120048, 0x00240090, 0x00480120, 0x00900240, 0x01200480, 0x00400100, 0x00800200, 0x01000400,
+        },
+    },
+    /* 2^56 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00400000, 0x00800000, 0x01000000,
+            0x02000001, 0x04000002, 0x08000004, 0x10000009, 0x20000012, 0x40000024, 0x80000048, 0x00000090,
+            0x00000120, 0x00000240, 0x00000480, 0x00000900, 0x00001200, 0x00002400, 0x00004800, 0x00009000,
+            0x00012000, 0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00040000, 0x00080000, 0x00100000,
+        },
+    },
+    /* 2^57 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002400, 0x00004800, 0x00009000, 0x00012000,
+            0x00024000, 0x00048000, 0x00090000, 0x00120000, 0x00240000, 0x00480000, 0x00900000, 0x01200000,
+            0x02400001, 0x04800002, 0x09000004, 0x12000008, 0x24000010, 0x48000020, 0x90000041, 0x20000082,
+            0x40000104, 0x80000208, 0x00000410, 0x00000820, 0x00001040, 0x00000480, 0x00000900, 0x00001200,
+        },
+    },
+    /* 2^58 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x00820000, 0x01040000, 0x02080001,
+            0x04100002, 0x08200004, 0x10400009, 0x20800012, 0x41000024, 0x82000049, 0x04000092, 0x08000124,
+            0x10000249, 0x20000492, 0x40000924, 0x80001248, 0x00002490, 0x00004920, 0x00009240, 0x00012480,
+            0x00024900, 0x00049200, 0x00092400, 0x00124800, 0x00249000, 0x00082000, 0x00104000, 0x00208000,
+        },
+    },
+    /* 2^59 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10009009, 0x20012012, 0x40024024, 0x80048048,
+            0x00090090, 0x00120120, 0x00240240, 0x00480480, 0x00900900, 0x01201200, 0x02402401, 0x04804802,
+            0x09009004, 0x12012008, 0x24024010, 0x48048020, 0x90090041, 0x20120082, 0x40240104, 0x80480208,
+            0x00900410, 0x01200820, 0x02401041, 0x04802082, 0x09004104, 0x02001201, 0x04002402, 0x08004804,
+        },
+    },
+    /* 2^60 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0D100006, 0x1A20000C, 0x34400019, 0x68800032,
+            0xD1000065, 0xA20000CB, 0x44000196, 0x8800032C, 0x10000659, 0x20000CB2, 0x40001964, 0x800032C8,
+            0x00006590, 0x0000CB20, 0x00019640, 0x00032C80, 0x00065900, 0x000CB200, 0x00196400, 0x0032C800,
+            0x00659000, 0x00CB2000, 0x01964000, 0x032C8001, 0x06590003, 0x01A20000, 0x03440001, 0x06880003,
+        },
+    },
+    /* 2^61 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02D90901, 0x05B21202, 0x0B642405, 0x16C8480A,
+            0x2D909014, 0x5B212028, 0xB6424050, 0x6C8480A0, 0xD9090141, 0xB2120282, 0x64240504, 0xC8480A08,
+            0x90901411, 0x21202822, 0x42405045, 0x8480A08A, 0x09014114, 0x12028228, 0x24050450, 0x480A08A0,
+            0x90141141, 0x20282282, 0x40504504, 0x80A08A08, 0x01411410, 0x005B2120, 0x00B64240, 0x016C8480,
+        },
+    },
+    /* 2^62 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1022CB49, 0x20459692, 0x408B2D24, 0x81165A48,
+            0x022CB491, 0x04596922, 0x08B2D244, 0x1165A489, 0x22CB4913, 0x45969226, 0x8B2D244D, 0x165A489A,
+            0x2CB49134, 0x59692269, 0xB2D244D2, 0x65A489A4, 0xCB491349, 0x96922692, 0x2D244D24, 0x5A489A48,
+            0xB4913491, 0x69226922, 0xD244D244, 0xA489A488, 0x49134910, 0x82045969, 0x0408B2D2, 0x081165A4,
+        },
+    },
+    /* 2^63 */
+    {
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C047522, 0x9808EA45, 0x3011D48B, 0x6023A916,
+            0xC047522C, 0x808EA458, 0x011D48B0, 0x023A9161, 0x047522C2, 0x08EA4584, 0x11D48B09, 0x23A91613,
+            0x47522C27, 0x8EA4584F, 0x1D48B09F, 0x3A91613E, 0x7522C27D, 0xEA4584FB, 0xD48B09F7, 0xA91613EE,
+            0x522C27DC, 0xA4584FB8, 0x48B09F70, 0x91613EE1, 0x22C27DC3, 0x09808EA4, 0x13011D48, 0x26023A91,
+        },
+    },
+};
+
+/* LFSR88 z3: previous, matrix^268435454 */
+const BitColumnMatrix32_t lfsr88_3_prev_matrix =
+{
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x49248000, 0x92490000, 0x24920000, 0x49240000,
+        0x92480000, 0x24900000, 0x49200000, 0x92400000, 0x24800000, 0x49000000, 0x92000000, 0x24000000,
+        0x48000000, 0x90000001, 0x20000002, 0x40000004, 0x80000008, 0x00000010, 0x00000020, 0x00000040,
+        0x00000080, 0x00000100, 0x00000200, 0x00000400, 0x00000800, 0x49249000, 0x92492000, 0x24924000,
+    },
+};
+
+/* Montgomery constants, modulo 36969 * 2^16 - 1 */
+const MontgomeryUint32_t mwc_upper_montgomery =
+{
+    0x9068FFFF, 0x6F96FFFF, 0x6F970001, 0x04688901,
+};
+
+/* Montgomery constants, modulo 18000 * 2^16 - 1 */
+const MontgomeryUint32_t mwc_lower_montgomery =
+{
+    0x464FFFFF, 0xB9AFFFFF, 0x2D100003, 0x1C614B5F,
+};
+
+/* Montgomery constants, modulo 698769069 * 2^32 - 1 */
+#ifdef UINT64_C
+const MontgomeryUint64_t mwc64_montgomery =
+{
+    UINT64_C(0x29A65EACFFFFFFFF), UINT64_C(0xD659A152FFFFFFFF),
+    UINT64_C(0x0619C7F200000006), UINT64_C(0x129F928B60CC8FAB),
+};
+#endif
+
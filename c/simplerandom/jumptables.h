@@ -0,0 +1,100 @@
+/*
+ * jumptables.h
+ *
+ * Pre-calculated "jump" tables for the discard functions of generators whose
+ * 'next' operation is a Galois-2 matrix. Each table holds the generator's
+ * matrix M raised to the powers M^(2^k), for k = 0 .. JUMP_TABLE_LEN-1.
+ * Discarding 'n' samples is then a matrix-vector multiplication by the table
+ * entry for each set bit of 'n', with no matrix-matrix multiplications.
+ *
+ * Cong's 'next' operation is an affine map, x -> mult * x + add, mod 2^32.
+ * Its table holds that map composed with itself 2^k times, for
+ * k = 0 .. CONG_JUMP_TABLE_LEN-1. Cong has period 2^32, so 32 entries cover
+ * any 'n'.
+ *
+ * The LFSR components also have a "previous" matrix, for the prev functions.
+ * See genjumptables.c.
+ *
+ * The MWC discard functions raise the multiplier to the power 'n' modulo a
+ * fixed modulus, by Montgomery multiplication. The Montgomery constants for
+ * each modulus are pre-calculated too.
+ *
+ * The tables are defined in jumptables.c, which is generated by genjumptables
+ * from the generators' parameters, and committed, so that building the
+ * library doesn't need to run it. After a change to genjumptables.c, run
+ * "make update-jumptables" to regenerate it; tests/check_jumptables, run by
+ * "make check", fails if it is stale. A table for another xorshift or LFSR
+ * generator needs a line in genjumptables.c, and a declaration here.
+ */
+#ifndef _SIMPLERANDOM_JUMPTABLES_H
+#define _SIMPLERANDOM_JUMPTABLES_H
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "bitcolumnmatrix.h"
+#include "maths.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define JUMP_TABLE_LEN          64u
+#define CONG_JUMP_TABLE_LEN     32u
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef struct
+{
+    uint32_t    mult;
+    uint32_t    add;
+} CongJump_t;
+
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const CongJump_t cong_jump_table[CONG_JUMP_TABLE_LEN];
+
+extern const BitColumnMatrix32_t shr3_jump_table[JUMP_TABLE_LEN];
+
+extern const BitColumnMatrix32_t lfsr113_1_jump_table[JUMP_TABLE_LEN];
+extern const BitColumnMatrix32_t lfsr113_2_jump_table[JUMP_TABLE_LEN];
+extern const BitColumnMatrix32_t lfsr113_3_jump_table[JUMP_TABLE_LEN];
+extern const BitColumnMatrix32_t lfsr113_4_jump_table[JUMP_TABLE_LEN];
+
+extern const BitColumnMatrix32_t lfsr88_1_jump_table[JUMP_TABLE_LEN];
+extern const BitColumnMatrix32_t lfsr88_2_jump_table[JUMP_TABLE_LEN];
+extern const BitColumnMatrix32_t lfsr88_3_jump_table[JUMP_TABLE_LEN];
+
+extern const BitColumnMatrix32_t lfsr113_1_prev_matrix;
+extern const BitColumnMatrix32_t lfsr113_2_prev_matrix;
+extern const BitColumnMatrix32_t lfsr113_3_prev_matrix;
+extern const BitColumnMatrix32_t lfsr113_4_prev_matrix;
+
+extern const BitColumnMatrix32_t lfsr88_1_prev_matrix;
+extern const BitColumnMatrix32_t lfsr88_2_prev_matrix;
+extern const BitColumnMatrix32_t lfsr88_3_prev_matrix;
+
+extern const MontgomeryUint32_t mwc_upper_montgomery;
+extern const MontgomeryUint32_t mwc_lower_montgomery;
+#ifdef UINT64_C
+extern const MontgomeryUint64_t mwc64_montgomery;
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* !defined(_SIMPLERANDOM_JUMPTABLES_H) */
@@ -1,8 +1,26 @@
 /*
  * maths.c
  *
- * Integer functions for modulo power, multiplication and geometric series,
- * for uint32_t and uint64_t.
+ * Integer functions for modulo power, multiplication, inverse and geometric
+ * series, for uint32_t and uint64_t.
+ *
+ * Modulo power for an odd modulus (which includes the MWC moduli) uses
+ * Montgomery multiplication [1], which replaces each division of a
+ * double-width product by two multiplications. With R = 2^32 (or 2^64), a
+ * value x is represented by x * R mod 'mod', its "Montgomery form". The
+ * Montgomery product of a and b is a * b * R^-1 mod 'mod', and is calculated
+ * from the double-width product T = a * b by:
+ *     q = (T mod R) * mod^-1 mod R
+ *     result = (T - q * mod) / R
+ * which is exact, since T - q * mod is a multiple of R. Only the upper halves
+ * of T and q * mod are needed, and the result is in (-mod, mod), so it needs
+ * at most one correction by adding 'mod'. The Montgomery product of two values
+ * in Montgomery form is the product in Montgomery form, so a whole modulo
+ * power is done in Montgomery form.
+ *
+ * [1] Modular Multiplication Without Trial Division
+ *     Peter L. Montgomery
+ *     Mathematics of Computation, 44 (170), 1985
  */
 
 
@@ -18,9 +36,74 @@
 
 
 /*****************************************************************************
- * Local function prototypes
+ * Local functions
  ****************************************************************************/
 
+#ifdef UINT64_C
+
+#if defined(__SIZEOF_INT128__)
+
+/* 64-bit by 64-bit multiplication, with a 128-bit result. Return the upper 64
+ * bits, and put the lower 64 bits in *p_low. */
+static inline uint64_t mul_uint64_wide(uint64_t a, uint64_t b, uint64_t * p_low)
+{
+    unsigned __int128   product;
+
+    product = (unsigned __int128)a * b;
+    *p_low = (uint64_t)product;
+    return (uint64_t)(product >> 64u);
+}
+
+#else /* !defined(__SIZEOF_INT128__) */
+
+/* 64-bit by 64-bit multiplication, with a 128-bit result. Return the upper 64
+ * bits, and put the lower 64 bits in *p_low.
+ *
+ * This is an implementation for compilers without a 128-bit type. It
+ * multiplies 32-bit halves.
+ */
+static inline uint64_t mul_uint64_wide(uint64_t a, uint64_t b, uint64_t * p_low)
+{
+    uint64_t    a_low = a & UINT64_C(0xFFFFFFFF);
+    uint64_t    a_high = a >> 32u;
+    uint64_t    b_low = b & UINT64_C(0xFFFFFFFF);
+    uint64_t    b_high = b >> 32u;
+    uint64_t    low_low;
+    uint64_t    middle;
+    uint64_t    middle2;
+
+    low_low = a_low * b_low;
+    middle = a_high * b_low + (low_low >> 32u);
+    middle2 = a_low * b_high + (middle & UINT64_C(0xFFFFFFFF));
+    *p_low = (middle2 << 32u) | (low_low & UINT64_C(0xFFFFFFFF));
+    return a_high * b_high + (middle >> 32u) + (middle2 >> 32u);
+}
+
+#endif /* defined(__SIZEOF_INT128__) */
+
+#endif /* defined(UINT64_C) */
+
+/* Addition of values less than 'mod', modulo 'mod', without overflow. */
+static inline uint32_t add_mod_uint32(uint32_t a, uint32_t b, uint32_t mod)
+{
+    if (a >= mod - b)
+        return a - (mod - b);
+    return a + b;
+}
+
+#ifdef UINT64_C
+
+/* Addition of values less than 'mod', modulo 'mod', without overflow. */
+static inline uint64_t add_mod_uint64(uint64_t a, uint64_t b, uint64_t mod)
+{
+    if (a >= mod - b)
+        return a - (mod - b);
+    return a + b;
+}
+
+#endif /* defined(UINT64_C) */
+
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -104,6 +187,28 @@ uint32_t pow_uint32(uint32_t base, uintmax_t n)
     return result;
 }
 
+/* Multiplicative inverse of an odd 'a', modulo 2^32. That is, the value 'x'
+ * such that a * x = 1 mod 2^32.
+ *
+ * This uses Newton's method: if x is the inverse of 'a' mod 2^k, then
+ * x * (2 - a * x) is the inverse mod 2^(2k). For any odd 'a', 'a' is its own
+ * inverse mod 2^3, so 4 iterations reach 2^48, more than the 32 bits needed.
+ * This takes 8 multiplications, compared to about 62 for calculating
+ * a^(2^31 - 1) by exponentiation.
+ */
+uint32_t inverse_uint32(uint32_t a)
+{
+    uint32_t    x;
+    unsigned    i;
+
+    x = a;
+    for (i = 0; i < 4u; i++)
+    {
+        x *= 2u - a * x;
+    }
+    return x;
+}
+
 #ifdef UINT64_C
 
 /* Calculate geometric series:
@@ -125,12 +230,14 @@ uint32_t pow_uint32(uint32_t base, uintmax_t n)
  * Then multiply by the inverse mod 2^32 of the other factors.
  *
  * This is a simple implementation that uses 64-bit intermediate results.
- * Given the complexity of this calculation, it is questionable whether it is
- * faster than the alternative 32-bit-only implementation.
- * The calculation of 'other_factors_inverse' is one of the slower parts. Given
- * that this is used for the simplerandom Cong discard function, and so 'r' is
- * a fixed constant, then a faster implementation would special-case the 'r'
- * constant used for Cong.
+ * The numerator is needed mod (common_factor * 2^32), which is a power of 2
+ * no more than 2^63, so it can be calculated mod 2^64 with ordinary
+ * multiplications, then masked. 'other_factors_inverse' is calculated by
+ * Newton's method in inverse_uint32(). So the whole calculation is about
+ * 2 * log2(n) 64-bit multiplications.
+ *
+ * (The simplerandom Cong discard function doesn't use this; it uses a table
+ * of pre-calculated values, since its 'r' is a fixed constant.)
  */
 uint32_t geom_series_uint32(uint32_t r, uintmax_t n)
 {
@@ -143,6 +250,8 @@ uint32_t geom_series_uint32(uint32_t r, uintmax_t n)
         return 0;
     if (n == 1u || r == 0)
         return 1u;
+    if (r == 1u)
+        return (uint32_t)n;
     /* Split (r - 1) into common factors with the modulo 2**32 -- i.e. all
      * factors of 2; and other factors which are coprime with the modulo 2**32.
      */
@@ -154,8 +263,8 @@ uint32_t geom_series_uint32(uint32_t r, uintmax_t n)
         other_factors >>= 1u;
         common_factor <<= 1u;
     }
-    other_factors_inverse = pow_uint32(other_factors, 0xFFFFFFFFu);
-    numerator = pow_mod_uint64(r, n, common_factor * UINT64_C(0x100000000)) - 1u;
+    other_factors_inverse = inverse_uint32(other_factors);
+    numerator = (pow_uint64(r, n) & (common_factor * UINT64_C(0x100000000) - 1u)) - 1u;
     return (numerator / common_factor * other_factors_inverse);
 }
 
@@ -206,13 +315,88 @@ uint32_t geom_series_uint32(uint32_t r, uintmax_t n)
 
 #endif /* defined(UINT64_C) */
 
-/* 32-bit calculation of 'base' to the power of an unsigned integer 'n',
- * modulo a uint32_t value 'mod'. */
-uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod)
+/* Set up the constants for Montgomery multiplication modulo an odd 'mod'.
+ * R^2 mod 'mod' is found from R mod 'mod' by doubling it 32 times, which
+ * needs no double-width division. */
+void montgomery_uint32_init(MontgomeryUint32_t * p_mont, uint32_t mod)
+{
+    uint32_t    r2_mod;
+    unsigned    i;
+
+    p_mont->mod = mod;
+    p_mont->mod_inverse = inverse_uint32(mod);
+    p_mont->r_mod = (uint32_t)(0u - mod) % mod;
+    r2_mod = p_mont->r_mod;
+    for (i = 0; i < 32u; i++)
+    {
+        r2_mod = add_mod_uint32(r2_mod, r2_mod, mod);
+    }
+    p_mont->r2_mod = r2_mod;
+}
+
+/* Montgomery product a * b * R^-1 mod 'mod'. At least one of 'a' and 'b'
+ * must be less than 'mod'; the other can be any value. The result is less
+ * than 'mod'.
+ *
+ * So for 'mult' in Montgomery form, montgomery_uint32_mul(p_mont, mult, x)
+ * is the ordinary mult * x mod 'mod', for any x.
+ */
+uint32_t montgomery_uint32_mul(const MontgomeryUint32_t * p_mont, uint32_t a, uint32_t b)
+{
+    uint32_t    product_high;
+    uint32_t    product_low;
+    uint32_t    q_mod_high;
+    uint32_t    q_mod_low;
+
+    product_high = mul_uint32_wide(a, b, &product_low);
+    q_mod_high = mul_uint32_wide(product_low * p_mont->mod_inverse, p_mont->mod, &q_mod_low);
+    /* The lower halves are equal, so they cancel. */
+    if (product_high < q_mod_high)
+        return product_high - q_mod_high + p_mont->mod;
+    return product_high - q_mod_high;
+}
+
+/* 'base' to the power of an unsigned integer 'n', modulo 'mod', as a
+ * multiplier in Montgomery form. That is, montgomery_uint32_mul(p_mont, mult, x)
+ * is then base^n * x mod 'mod', for any x.
+ */
+uint32_t montgomery_uint32_pow_mult(const MontgomeryUint32_t * p_mont, uint32_t base, uintmax_t n)
 {
     uint32_t    result;
     uint32_t    temp_exp;
 
+    result = p_mont->r_mod;
+    temp_exp = montgomery_uint32_mul(p_mont, base, p_mont->r2_mod);
+    for (;;)
+    {
+        if (n & 1u)
+        {
+            result = montgomery_uint32_mul(p_mont, result, temp_exp);
+        }
+        n >>= 1u;
+        if (n == 0)
+            break;
+        temp_exp = montgomery_uint32_mul(p_mont, temp_exp, temp_exp);
+    }
+    return result;
+}
+
+/* 32-bit calculation of 'base' to the power of an unsigned integer 'n',
+ * modulo a uint32_t value 'mod'.
+ * For an odd 'mod', it is done by Montgomery multiplication. */
+uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod)
+{
+    MontgomeryUint32_t  mont;
+    uint32_t            result;
+    uint32_t            temp_exp;
+
+    if ((mod & 1u) && mod > 1u)
+    {
+        montgomery_uint32_init(&mont, mod);
+        /* Montgomery product with 1 converts out of Montgomery form. */
+        return montgomery_uint32_mul(&mont, montgomery_uint32_pow_mult(&mont, base, n), 1u);
+    }
+
     result = 1u;
     temp_exp = base;
     for (;;)
@@ -231,6 +415,23 @@ uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod)
 
 #ifdef UINT64_C
 
+#if defined(__SIZEOF_INT128__)
+
+/* Multiplication of uint64_t values, modulo some uint64_t value.
+ *
+ * This is a simple implementation that uses 128-bit intermediate results,
+ * for compilers that have a 128-bit type.
+ */
+uint64_t mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod)
+{
+    unsigned __int128   temp;
+
+    temp = (unsigned __int128)a * b;
+    return (uint64_t)(temp % mod);
+}
+
+#else /* !defined(__SIZEOF_INT128__) */
+
 /* Multiplication of uint64_t values, modulo some uint64_t value.
  *
  * A "simple" implementation would require 128-bit intermediate values
@@ -271,6 +472,8 @@ uint64_t mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod)
     return result;
 }
 
+#endif /* defined(__SIZEOF_INT128__) */
+
 /* 64-bit calculation of 'base' to the power of 'n', modulo 2^64. */
 uint64_t pow_uint64(uint64_t base, uintmax_t n)
 {
@@ -291,13 +494,92 @@ uint64_t pow_uint64(uint64_t base, uintmax_t n)
     return result;
 }
 
-/* 64-bit calculation of 'base' to the power of an unsigned integer 'n',
- * modulo a uint64_t value 'mod'. */
-uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
+/* Multiplicative inverse of an odd 'a', modulo 2^64. See inverse_uint32();
+ * 5 iterations of Newton's method reach 2^96, more than the 64 bits needed. */
+uint64_t inverse_uint64(uint64_t a)
+{
+    uint64_t    x;
+    unsigned    i;
+
+    x = a;
+    for (i = 0; i < 5u; i++)
+    {
+        x *= 2u - a * x;
+    }
+    return x;
+}
+
+/* As montgomery_uint32_init(), with R = 2^64. */
+void montgomery_uint64_init(MontgomeryUint64_t * p_mont, uint64_t mod)
+{
+    uint64_t    r2_mod;
+    unsigned    i;
+
+    p_mont->mod = mod;
+    p_mont->mod_inverse = inverse_uint64(mod);
+    p_mont->r_mod = (uint64_t)(0u - mod) % mod;
+    r2_mod = p_mont->r_mod;
+    for (i = 0; i < 64u; i++)
+    {
+        r2_mod = add_mod_uint64(r2_mod, r2_mod, mod);
+    }
+    p_mont->r2_mod = r2_mod;
+}
+
+/* As montgomery_uint32_mul(), with R = 2^64. */
+uint64_t montgomery_uint64_mul(const MontgomeryUint64_t * p_mont, uint64_t a, uint64_t b)
+{
+    uint64_t    product_high;
+    uint64_t    product_low;
+    uint64_t    q_mod_high;
+    uint64_t    q_mod_low;
+
+    product_high = mul_uint64_wide(a, b, &product_low);
+    q_mod_high = mul_uint64_wide(product_low * p_mont->mod_inverse, p_mont->mod, &q_mod_low);
+    /* The lower halves are equal, so they cancel. */
+    if (product_high < q_mod_high)
+        return product_high - q_mod_high + p_mont->mod;
+    return product_high - q_mod_high;
+}
+
+/* As montgomery_uint32_pow_mult(), with R = 2^64. */
+uint64_t montgomery_uint64_pow_mult(const MontgomeryUint64_t * p_mont, uint64_t base, uintmax_t n)
 {
     uint64_t    result;
     uint64_t    temp_exp;
 
+    result = p_mont->r_mod;
+    temp_exp = montgomery_uint64_mul(p_mont, base, p_mont->r2_mod);
+    for (;;)
+    {
+        if (n & 1u)
+        {
+            result = montgomery_uint64_mul(p_mont, result, temp_exp);
+        }
+        n >>= 1u;
+        if (n == 0)
+            break;
+        temp_exp = montgomery_uint64_mul(p_mont, temp_exp, temp_exp);
+    }
+    return result;
+}
+
+/* 64-bit calculation of 'base' to the power of an unsigned integer 'n',
+ * modulo a uint64_t value 'mod'.
+ * For an odd 'mod', it is done by Montgomery multiplication. */
+uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
+{
+    MontgomeryUint64_t  mont;
+    uint64_t            result;
+    uint64_t            temp_exp;
+
+    if ((mod & 1u) && mod > 1u)
+    {
+        montgomery_uint64_init(&mont, mod);
+        /* Montgomery product with 1 converts out of Montgomery form. */
+        return montgomery_uint64_mul(&mont, montgomery_uint64_pow_mult(&mont, base, n), 1u);
+    }
+
     result = 1u;
     temp_exp = base;
     for (;;)
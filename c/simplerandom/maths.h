@@ -1,8 +1,8 @@
 /*
  * maths.h
  *
- * Integer functions for modulo power, multiplication and geometric series,
- * for uint32_t and uint64_t.
+ * Integer functions for modulo power, multiplication, inverse and geometric
+ * series, for uint32_t and uint64_t.
  */
 #ifndef _SIMPLERANDOM_MATHS_H
 #define _SIMPLERANDOM_MATHS_H
@@ -15,6 +15,35 @@
 #include <stdint.h>
 
 
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+/* Constants for Montgomery multiplication modulo an odd 'mod', with
+ * R = 2^32. See montgomery_uint32_init(). */
+typedef struct
+{
+    uint32_t    mod;
+    uint32_t    mod_inverse;        /* mod^-1 mod R */
+    uint32_t    r_mod;              /* R mod 'mod' -- that is, 1 in Montgomery form */
+    uint32_t    r2_mod;             /* R^2 mod 'mod' */
+} MontgomeryUint32_t;
+
+#ifdef UINT64_C
+
+/* Constants for Montgomery multiplication modulo an odd 'mod', with
+ * R = 2^64. See montgomery_uint64_init(). */
+typedef struct
+{
+    uint64_t    mod;
+    uint64_t    mod_inverse;        /* mod^-1 mod R */
+    uint64_t    r_mod;              /* R mod 'mod' -- that is, 1 in Montgomery form */
+    uint64_t    r2_mod;             /* R^2 mod 'mod' */
+} MontgomeryUint64_t;
+
+#endif /* defined(UINT64_C) */
+
+
 /*****************************************************************************
  * Function prototypes
  ****************************************************************************/
@@ -25,19 +54,74 @@ extern "C" {
 
 uint32_t mul_mod_uint32(uint32_t a, uint32_t b, uint32_t mod);
 uint32_t pow_uint32(uint32_t base, uintmax_t n);
+uint32_t inverse_uint32(uint32_t a);
 uint32_t geom_series_uint32(uint32_t r, uintmax_t n);
 uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod);
 
+void montgomery_uint32_init(MontgomeryUint32_t * p_mont, uint32_t mod);
+uint32_t montgomery_uint32_mul(const MontgomeryUint32_t * p_mont, uint32_t a, uint32_t b);
+uint32_t montgomery_uint32_pow_mult(const MontgomeryUint32_t * p_mont, uint32_t base, uintmax_t n);
+
 #ifdef UINT64_C
 
 uint64_t mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod);
 uint64_t pow_uint64(uint64_t base, uintmax_t n);
+uint64_t inverse_uint64(uint64_t a);
 uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod);
 
+void montgomery_uint64_init(MontgomeryUint64_t * p_mont, uint64_t mod);
+uint64_t montgomery_uint64_mul(const MontgomeryUint64_t * p_mont, uint64_t a, uint64_t b);
+uint64_t montgomery_uint64_pow_mult(const MontgomeryUint64_t * p_mont, uint64_t base, uintmax_t n);
+
 #endif /* defined(UINT64_C) */
 
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
 
+
+/*****************************************************************************
+ * Inline functions
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+/* 32-bit by 32-bit multiplication, with a 64-bit result. Return the upper 32
+ * bits, and put the lower 32 bits in *p_low. */
+static inline uint32_t mul_uint32_wide(uint32_t a, uint32_t b, uint32_t * p_low)
+{
+    uint64_t    product;
+
+    product = (uint64_t)a * b;
+    *p_low = (uint32_t)product;
+    return (uint32_t)(product >> 32u);
+}
+
+#else /* !defined(UINT64_C) */
+
+/* 32-bit by 32-bit multiplication, with a 64-bit result. Return the upper 32
+ * bits, and put the lower 32 bits in *p_low.
+ *
+ * This is an implementation that fits all calculations within 32 bits, for
+ * platforms without 64-bit types. It multiplies 16-bit halves.
+ */
+static inline uint32_t mul_uint32_wide(uint32_t a, uint32_t b, uint32_t * p_low)
+{
+    uint32_t    a_low = a & 0xFFFFu;
+    uint32_t    a_high = a >> 16u;
+    uint32_t    b_low = b & 0xFFFFu;
+    uint32_t    b_high = b >> 16u;
+    uint32_t    low_low;
+    uint32_t    middle;
+    uint32_t    middle2;
+
+    low_low = a_low * b_low;
+    middle = a_high * b_low + (low_low >> 16u);
+    middle2 = a_low * b_high + (middle & 0xFFFFu);
+    *p_low = (middle2 << 16u) | (low_low & 0xFFFFu);
+    return a_high * b_high + (middle >> 16u) + (middle2 >> 16u);
+}
+
+#endif /* defined(UINT64_C) */
+
 #endif /* !defined(_SIMPLERANDOM_POW_H) */
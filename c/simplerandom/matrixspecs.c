@@ -0,0 +1,111 @@
+/*
+ * matrixspecs.c
+ *
+ * Parameters of the generator components whose 'next' operation is a
+ * Galois-2 matrix, and functions to make their matrices. See matrixspecs.h.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <string.h>
+
+#include "matrixspecs.h"
+
+
+/*****************************************************************************
+ * Global variables
+ ****************************************************************************/
+
+const MatrixSpec_t matrix_specs[] =
+{
+    { "shr3",       "SHR3",         MATRIX_XORSHIFT,    { 13, -17, 5 },     0,  true,   false },
+    /* The SHR3 of Marsaglia's 1999 post, which isn't full period. See
+     * README.md. Not used by the library. */
+    { "shr3_1999",  "SHR3 1999",    MATRIX_XORSHIFT,    { 17, -13, 5 },     0,  false,  false },
+
+    { "lfsr113_1",  "LFSR113 z1",   MATRIX_LFSR,        { 6, 13, 18 },      1,  true,   true },
+    { "lfsr113_2",  "LFSR113 z2",   MATRIX_LFSR,        { 2, 27, 2 },       3,  true,   true },
+    { "lfsr113_3",  "LFSR113 z3",   MATRIX_LFSR,        { 13, 21, 7 },      4,  true,   true },
+    { "lfsr113_4",  "LFSR113 z4",   MATRIX_LFSR,        { 3, 12, 13 },      7,  true,   true },
+
+    { "lfsr88_1",   "LFSR88 z1",    MATRIX_LFSR,        { 13, 19, 12 },     1,  true,   true },
+    { "lfsr88_2",   "LFSR88 z2",    MATRIX_LFSR,        { 2, 25, 4 },       3,  true,   true },
+    { "lfsr88_3",   "LFSR88 z3",    MATRIX_LFSR,        { 3, 11, 17 },      4,  true,   true },
+};
+
+const size_t num_matrix_specs = sizeof(matrix_specs) / sizeof(matrix_specs[0]);
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* matrix = unity + shift(shift_value) */
+static void make_xorshift_step(BitColumnMatrix32_t * p_matrix, int_fast8_t shift_value)
+{
+    BitColumnMatrix32_t     shift_matrix;
+
+    bitcolumnmatrix32_unity(p_matrix);
+    bitcolumnmatrix32_shift(&shift_matrix, shift_value);
+    bitcolumnmatrix32_iadd(p_matrix, &shift_matrix);
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+void make_xorshift_matrix(BitColumnMatrix32_t * p_matrix, const int_fast8_t * p_shifts)
+{
+    BitColumnMatrix32_t     step_matrix;
+    size_t                  i;
+
+    bitcolumnmatrix32_unity(p_matrix);
+    for (i = 3u; i-- > 0; )
+    {
+        make_xorshift_step(&step_matrix, p_shifts[i]);
+        bitcolumnmatrix32_imul(p_matrix, &step_matrix);
+    }
+}
+
+void make_lfsr_matrix(BitColumnMatrix32_t * p_matrix, const int_fast8_t * p_shifts, uint_fast8_t mask_bits)
+{
+    BitColumnMatrix32_t     temp_matrix;
+    BitColumnMatrix32_t     b_matrix;
+
+    /* shift(s3) * mask(mask_bits, 32) */
+    bitcolumnmatrix32_shift(p_matrix, p_shifts[2]);
+    bitcolumnmatrix32_mask(&temp_matrix, mask_bits, 32u);
+    bitcolumnmatrix32_imul(p_matrix, &temp_matrix);
+
+    /* shift(-s2) * (unity + shift(s1)) */
+    bitcolumnmatrix32_shift(&b_matrix, (int_fast8_t)-p_shifts[1]);
+    make_xorshift_step(&temp_matrix, p_shifts[0]);
+    bitcolumnmatrix32_imul(&b_matrix, &temp_matrix);
+
+    bitcolumnmatrix32_iadd(p_matrix, &b_matrix);
+}
+
+void make_spec_matrix(BitColumnMatrix32_t * p_matrix, const MatrixSpec_t * p_spec)
+{
+    if (p_spec->kind == MATRIX_XORSHIFT)
+        make_xorshift_matrix(p_matrix, p_spec->shifts);
+    else
+        make_lfsr_matrix(p_matrix, p_spec->shifts, p_spec->mask_bits);
+}
+
+/* Find a component by its short name. Returns NULL if there is none. */
+const MatrixSpec_t * find_matrix_spec(const char * p_name)
+{
+    size_t      i;
+
+    for (i = 0; i < num_matrix_specs; i++)
+    {
+        if (strcmp(p_name, matrix_specs[i].p_name) == 0)
+            return &matrix_specs[i];
+    }
+    return NULL;
+}
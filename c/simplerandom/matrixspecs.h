@@ -0,0 +1,93 @@
+/*
+ * matrixspecs.h
+ *
+ * Parameters of the generator components whose 'next' operation is a
+ * Galois-2 matrix, and functions to make their matrices. These are shared by
+ * the tools that work on the matrices: genjumptables (which makes the jump
+ * tables in jumptables.c) and support/matrix_cycles (which finds their cycle
+ * structure). So a new xorshift or LFSR generator component needs only a
+ * line in matrix_specs[] in matrixspecs.c.
+ *
+ * An xorshift generator's 'next' operation is three xorshifts:
+ *     x ^= x << a;
+ *     x ^= x >> b;     (or <<, depending on the sign of the shift)
+ *     x ^= x << c;
+ * Its Galois matrix equivalent is:
+ *     matrix = (unity + shift(c)) * (unity + shift(b)) * (unity + shift(a))
+ * where shift(s) is a left shift for positive s, right shift for negative s.
+ *
+ * An LFSR component (of LFSR113 or LFSR88) 'next' operation is:
+ *     b = ((z << s1) ^ z) >> s2;
+ *     z = ((z & mask) << s3) ^ b;
+ * where 'mask' clears the lower 'mask_bits' bits. Its Galois matrix
+ * equivalent is:
+ *     matrix = (shift(s3) * mask(mask_bits, 32)) + (shift(-s2) * (unity + shift(s1)))
+ */
+#ifndef _SIMPLERANDOM_MATRIXSPECS_H
+#define _SIMPLERANDOM_MATRIXSPECS_H
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitcolumnmatrix.h"
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef enum
+{
+    MATRIX_XORSHIFT,
+    MATRIX_LFSR,
+} MatrixKind_t;
+
+/* Parameters of one generator component.
+ * 'p_name' is the short name, e.g. "lfsr113_1". Its jump table in
+ * jumptables.c is named "<name>_jump_table", and its "previous" matrix
+ * "<name>_prev_matrix".
+ * For MATRIX_XORSHIFT, 'shifts' are the three xorshifts a, b, c, with
+ * negative values for right shifts, and 'mask_bits' is unused.
+ * For MATRIX_LFSR, 'shifts' are s1, s2, s3, which are all left shifts apart
+ * from s2, which is a right shift.
+ * 'jump_table' is false for components that aren't used by the library, and
+ * so have no jump table.
+ * 'prev_matrix' is false for components that need no "previous" matrix. SHR3
+ * needs none, because its xorshifts are simple to undo directly. */
+typedef struct
+{
+    const char *    p_name;
+    const char *    p_description;
+    MatrixKind_t    kind;
+    int_fast8_t     shifts[3];
+    uint_fast8_t    mask_bits;
+    bool            jump_table;
+    bool            prev_matrix;
+} MatrixSpec_t;
+
+
+/*****************************************************************************
+ * Global variables
+ ****************************************************************************/
+
+extern const MatrixSpec_t   matrix_specs[];
+extern const size_t         num_matrix_specs;
+
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void make_xorshift_matrix(BitColumnMatrix32_t * p_matrix, const int_fast8_t * p_shifts);
+void make_lfsr_matrix(BitColumnMatrix32_t * p_matrix, const int_fast8_t * p_shifts, uint_fast8_t mask_bits);
+void make_spec_matrix(BitColumnMatrix32_t * p_matrix, const MatrixSpec_t * p_spec);
+const MatrixSpec_t * find_matrix_spec(const char * p_name);
+
+
+#endif /* !defined(_SIMPLERANDOM_MATRIXSPECS_H) */
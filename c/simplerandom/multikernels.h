@@ -0,0 +1,104 @@
+/*
+ * multikernels.h
+ *
+ * Implementations of the multi-lane generator "fill" functions for different
+ * instruction sets. The public functions, such as
+ * simplerandom_lfsr113x8_fill(), use the fastest of these that the CPU
+ * supports, chosen once when the program or library is loaded. They are
+ * declared here so they can be tested separately.
+ *
+ * The _generic versions run on any CPU. They use SSE2 where the compile
+ * target has it (as all x86-64 targets do). MULTI_HAVE_AVX2 and
+ * MULTI_HAVE_AVX512 are defined if the _avx2 and _avx512 versions are built.
+ * They must only be called if multi_use_avx2() or multi_use_avx512()
+ * respectively is true.
+ */
+#ifndef _SIMPLERANDOM_MULTIKERNELS_H
+#define _SIMPLERANDOM_MULTIKERNELS_H
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+#include "cpufeatures.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Where the compiler can build functions for x86 instruction set extensions,
+ * and detect them at run-time, all versions are built. Otherwise, only the
+ * versions that the compile target supports are built. */
+#if defined(SIMPLERANDOM_X86_KERNELS)
+#define MULTI_HAVE_AVX2         1
+#define MULTI_HAVE_AVX512       1
+#else
+#if defined(__AVX2__)
+#define MULTI_HAVE_AVX2         1
+#endif
+#if defined(__AVX512F__)
+#define MULTI_HAVE_AVX512       1
+#endif
+#endif
+
+
+/*****************************************************************************
+ * Inline functions
+ ****************************************************************************/
+
+static inline bool multi_use_avx2(void)
+{
+#if defined(SIMPLERANDOM_X86_KERNELS)
+    return cpu_has_avx2();
+#elif defined(MULTI_HAVE_AVX2)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static inline bool multi_use_avx512(void)
+{
+#if defined(SIMPLERANDOM_X86_KERNELS)
+    return cpu_has_avx512f();
+#elif defined(MULTI_HAVE_AVX512)
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void lfsr113x8_fill_generic(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out);
+#ifdef MULTI_HAVE_AVX2
+void lfsr113x8_fill_avx2(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out);
+#endif
+
+#ifdef UINT64_C
+void kiss2x4_fill_generic(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out);
+void kiss2x8_fill_generic(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out);
+#ifdef MULTI_HAVE_AVX2
+void kiss2x4_fill_avx2(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out);
+void kiss2x8_fill_avx2(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out);
+#endif
+#ifdef MULTI_HAVE_AVX512
+void kiss2x8_fill_avx512(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out);
+#endif
+#endif /* defined(UINT64_C) */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* !defined(_SIMPLERANDOM_MULTIKERNELS_H) */
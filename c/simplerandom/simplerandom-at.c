@@ -0,0 +1,132 @@
+/*
+ * simplerandom-at.c
+ *
+ * Simple Pseudo-random Number Generators -- random access.
+ *
+ * simplerandom_zzz_at(p_rng, i) returns the random value at index 'i' after
+ * the given state, without changing the state. That is the value that the
+ * (i + 1)th call of simplerandom_zzz_next() would return, so index 0 is the
+ * next value. E.g. a simulation can find the value for particle 7341002 at
+ * step 9 from the stream's starting state, without replaying the stream.
+ *
+ * It is done by a discard of 'i' on a copy of the state. Each thread keeps a
+ * cache of its most recent look-up for each generator: the given state, and
+ * the state just after index 'i'. If the next look-up is from the same state
+ * at a later index, it starts from the cached state, so it only needs to jump
+ * the difference. A difference of up to AT_STEP_MAX is done by stepping the
+ * generator, which is cheaper than a discard. So looking up nearby indices in
+ * increasing order costs little more than generating them. A look-up at an
+ * earlier index, or from a different state, does a full discard.
+ *
+ * The cache is per thread, so no locking is needed. If the compiler has no
+ * thread-local storage, there is no cache, and every look-up does a full
+ * discard.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <string.h>
+
+#include "simplerandom.h"
+#include "threadlocal.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Maximum jump from the cached state that is done by stepping the generator,
+ * rather than by a discard. */
+#define AT_STEP_MAX             32u
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+#ifdef SIMPLERANDOM_THREAD_LOCAL
+
+/* Define simplerandom_zzz_at() for generator 'zzz', with a per-thread cache.
+ * The cached 'state' is the state just after index 'index - 1', so the next
+ * index in sequence needs no jump at all. */
+#define SIMPLERANDOM_AT_FUNCTIONS(NAME, TYPE)                                   \
+static SIMPLERANDOM_THREAD_LOCAL struct                                     \
+{                                                                           \
+    TYPE        base;                                                       \
+    TYPE        state;                                                      \
+    uintmax_t   index;                                                      \
+    bool        valid;                                                      \
+} NAME##_at_cache;                                                          \
+                                                                            \
+uint32_t simplerandom_##NAME##_at(const TYPE * p_rng, uintmax_t i)          \
+{                                                                           \
+    TYPE        rng;                                                        \
+    uintmax_t   n;                                                          \
+    uint32_t    result;                                                     \
+                                                                            \
+    if (NAME##_at_cache.valid && i >= NAME##_at_cache.index &&              \
+        memcmp(&NAME##_at_cache.base, p_rng, sizeof(*p_rng)) == 0)          \
+    {                                                                       \
+        rng = NAME##_at_cache.state;                                        \
+        n = i - NAME##_at_cache.index;                                      \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        NAME##_at_cache.base = *p_rng;                                      \
+        rng = *p_rng;                                                       \
+        n = i;                                                              \
+    }                                                                       \
+    if (n <= AT_STEP_MAX)                                                   \
+    {                                                                       \
+        for ( ; n != 0; n--)                                                \
+        {                                                                   \
+            simplerandom_##NAME##_next(&rng);                               \
+        }                                                                   \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        simplerandom_##NAME##_discard(&rng, n);                             \
+    }                                                                       \
+    result = simplerandom_##NAME##_next(&rng);                              \
+                                                                            \
+    /* If i is UINTMAX_MAX, index wraps to 0, which is still correct. */    \
+    NAME##_at_cache.state = rng;                                            \
+    NAME##_at_cache.index = i + 1u;                                         \
+    NAME##_at_cache.valid = (NAME##_at_cache.index != 0);                   \
+    return result;                                                          \
+}
+
+#else /* !defined(SIMPLERANDOM_THREAD_LOCAL) */
+
+/* Define simplerandom_zzz_at() for generator 'zzz', without a cache. */
+#define SIMPLERANDOM_AT_FUNCTIONS(NAME, TYPE)                                   \
+uint32_t simplerandom_##NAME##_at(const TYPE * p_rng, uintmax_t i)          \
+{                                                                           \
+    TYPE        rng;                                                        \
+                                                                            \
+    rng = *p_rng;                                                           \
+    simplerandom_##NAME##_discard(&rng, i);                                 \
+    return simplerandom_##NAME##_next(&rng);                                \
+}
+
+#endif /* defined(SIMPLERANDOM_THREAD_LOCAL) */
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SIMPLERANDOM_AT_FUNCTIONS(cong, SimpleRandomCong_t)
+SIMPLERANDOM_AT_FUNCTIONS(shr3, SimpleRandomSHR3_t)
+SIMPLERANDOM_AT_FUNCTIONS(mwc1, SimpleRandomMWC1_t)
+SIMPLERANDOM_AT_FUNCTIONS(mwc2, SimpleRandomMWC2_t)
+SIMPLERANDOM_AT_FUNCTIONS(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+SIMPLERANDOM_AT_FUNCTIONS(mwc64, SimpleRandomMWC64_t)
+SIMPLERANDOM_AT_FUNCTIONS(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+SIMPLERANDOM_AT_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t)
+SIMPLERANDOM_AT_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t)
@@ -16,6 +16,70 @@
  *         Seed the generator with a number of unsigned 32-bit seed values.
  *         The number of seed values depends on the generator, and is given
  *         by simplerandom_zzz_num_seeds().
+ *     simplerandom_zzz_next()
+ *         Generate the next unsigned 32-bit random value. If SIMPLERANDOM_INLINE
+ *         is defined before simplerandom.h is included, this and
+ *         simplerandom_zzz_sanitize() are 'static inline' so they can be
+ *         inlined into the caller's loops. See simplerandom-inline.h.
+ *     simplerandom_zzz_prev()
+ *         Step the generator back by one. It returns the value that the last
+ *         simplerandom_zzz_next() returned, and sets an equivalent state to
+ *         the one before that call, which gives the same sequence, so that a
+ *         following simplerandom_zzz_next() returns it again. For most
+ *         generators it is exactly the state before that call. For LFSR113
+ *         and LFSR88, the lower bits of each component that 'next' never
+ *         reads may differ, e.g. when stepping back to a freshly seeded state.
+ *     simplerandom_zzz_fill(out, num_out)
+ *         Fill an array with the next 'num_out' random values. This gives
+ *         exactly the same sequence as 'num_out' calls of
+ *         simplerandom_zzz_next(), but is faster for bulk generation because
+ *         the generator state is kept in local variables for the whole loop.
+ *     simplerandom_zzz_fill_float(out, num_out, bits)
+ *     simplerandom_zzz_fill_double(out, num_out, bits)
+ *         Fill an array with 'num_out' uniform random values in the range
+ *         [0, 1). 'bits' is the number of random bits per value: 24, 32 or
+ *         (for double only) 53. 53-bit values use two 32-bit random values
+ *         each. See simplerandom-float.c for details.
+ *     simplerandom_zzz_uniform_u32(bound)
+ *         Generate an unbiased random integer in the range [0, bound), without
+ *         division in most cases. A 'bound' of 0 means 2^32. Use this rather
+ *         than "next() % bound", which is biased and slower. See
+ *         simplerandom-uniform.c for details.
+ *     simplerandom_zzz_fill_uniform_u32(out, num_out, bound)
+ *         Fill an array with the same values as 'num_out' calls of
+ *         simplerandom_zzz_uniform_u32(), but faster.
+ *     simplerandom_zzz_normal()
+ *     simplerandom_zzz_exponential()
+ *         Generate a standard normal (mean 0, variance 1) or standard
+ *         exponential (mean 1) random double, by the ziggurat method. Each
+ *         value uses two 32-bit random values, or occasionally more. Only
+ *         available with 64-bit integer support. See simplerandom-ziggurat.c
+ *         for details.
+ *     simplerandom_zzz_fill_normal(out, num_out)
+ *     simplerandom_zzz_fill_exponential(out, num_out)
+ *         Fill an array with the same values as 'num_out' calls of
+ *         simplerandom_zzz_normal() or simplerandom_zzz_exponential(), but
+ *         faster.
+ *     simplerandom_zzz_discard(n)
+ *         Discard the next 'n' random values, that is, jump ahead in the
+ *         sequence. This takes time O(log n), not O(n).
+ *     simplerandom_zzz_split(out, n_streams, stride)
+ *         Fill an array of 'n_streams' generator states, spaced 'stride'
+ *         samples apart in the sequence, starting with a copy of the given
+ *         state. Each state is the same as from a discard of 'i * stride',
+ *         but the jump is only calculated once, so it is much faster for
+ *         many streams.
+ *     simplerandom_zzz_parallel_fill(out, num_out, num_threads)
+ *         Fill an array with exactly the same values as
+ *         simplerandom_zzz_fill(), using up to 'num_threads' threads (0 for
+ *         one per online processor). Each thread fills one part of the
+ *         array, from a copy of the state jumped ahead to that part. See
+ *         simplerandom-parallel.c for details.
+ *     simplerandom_zzz_at(i)
+ *         Return the random value at index 'i' after the given state (index 0
+ *         is the next value), without changing the state. Each thread caches
+ *         its most recent look-up, so later indices near it, from the same
+ *         state, are cheap. See simplerandom-at.c for details.
  *
  * Most of these are from two newsgroup posts by George Marsaglia.
  *
@@ -103,6 +167,21 @@
 #include <stddef.h>
 
 
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Define SIMPLERANDOM_INLINE before including simplerandom.h to get
+ * 'static inline' definitions of simplerandom_zzz_sanitize() and
+ * simplerandom_zzz_next(), rather than calls to the library's functions.
+ * See simplerandom-inline.h. */
+#ifdef SIMPLERANDOM_INLINE
+#define SIMPLERANDOM_INLINE_API         static inline
+#else
+#define SIMPLERANDOM_INLINE_API
+#endif
+
+
 /*****************************************************************************
  * Typedefs
  ****************************************************************************/
@@ -166,6 +245,43 @@ typedef struct
     uint32_t        z3;
 } SimpleRandomLFSR88_t;
 
+/* Multi-lane generators run several independent streams side by side. The
+ * state is stored as structure-of-arrays, so that one component of all lanes
+ * can be updated at once in a SIMD register.
+ */
+#define SIMPLERANDOM_LFSR113X8_LANES    8u
+
+typedef struct
+{
+    uint32_t        z1[SIMPLERANDOM_LFSR113X8_LANES];
+    uint32_t        z2[SIMPLERANDOM_LFSR113X8_LANES];
+    uint32_t        z3[SIMPLERANDOM_LFSR113X8_LANES];
+    uint32_t        z4[SIMPLERANDOM_LFSR113X8_LANES];
+} SimpleRandomLFSR113x8_t;
+
+#ifdef UINT64_C
+
+#define SIMPLERANDOM_KISS2X4_LANES      4u
+#define SIMPLERANDOM_KISS2X8_LANES      8u
+
+typedef struct
+{
+    uint32_t        mwc_upper[SIMPLERANDOM_KISS2X4_LANES];
+    uint32_t        mwc_lower[SIMPLERANDOM_KISS2X4_LANES];
+    uint32_t        cong[SIMPLERANDOM_KISS2X4_LANES];
+    uint32_t        shr3[SIMPLERANDOM_KISS2X4_LANES];
+} SimpleRandomKISS2x4_t;
+
+typedef struct
+{
+    uint32_t        mwc_upper[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t        mwc_lower[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t        cong[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t        shr3[SIMPLERANDOM_KISS2X8_LANES];
+} SimpleRandomKISS2x8_t;
+
+#endif /* defined(UINT64_C) */
+
 
 /*****************************************************************************
  * Function prototypes
@@ -194,10 +310,19 @@ extern "C" {
 size_t simplerandom_cong_num_seeds(const SimpleRandomCong_t * p_cong);
 size_t simplerandom_cong_seed_array(SimpleRandomCong_t * p_cong, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_cong_seed(SimpleRandomCong_t * p_cong, uint32_t seed);
-void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong);
+SIMPLERANDOM_INLINE_API void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong);
 void simplerandom_cong_mix(SimpleRandomCong_t * p_cong, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong);
+uint32_t simplerandom_cong_prev(SimpleRandomCong_t * p_cong);
+void simplerandom_cong_fill(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out);
+void simplerandom_cong_fill_float(SimpleRandomCong_t * p_cong, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_cong_fill_double(SimpleRandomCong_t * p_cong, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_cong_uniform_u32(SimpleRandomCong_t * p_cong, uint32_t bound);
+void simplerandom_cong_fill_uniform_u32(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_cong_discard(SimpleRandomCong_t * p_cong, uintmax_t n);
+void simplerandom_cong_split(const SimpleRandomCong_t * p_cong, SimpleRandomCong_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_cong_parallel_fill(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_cong_at(const SimpleRandomCong_t * p_cong, uintmax_t i);
 
 /* SHR3 -- 3-shift-register random number generator
  *
@@ -225,10 +350,19 @@ void simplerandom_cong_discard(SimpleRandomCong_t * p_cong, uintmax_t n);
 size_t simplerandom_shr3_num_seeds(const SimpleRandomSHR3_t * p_shr3);
 size_t simplerandom_shr3_seed_array(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_shr3_seed(SimpleRandomSHR3_t * p_shr3, uint32_t seed);
-void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3);
+SIMPLERANDOM_INLINE_API void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3);
 void simplerandom_shr3_mix(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3);
+uint32_t simplerandom_shr3_prev(SimpleRandomSHR3_t * p_shr3);
+void simplerandom_shr3_fill(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out);
+void simplerandom_shr3_fill_float(SimpleRandomSHR3_t * p_shr3, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_shr3_fill_double(SimpleRandomSHR3_t * p_shr3, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_shr3_uniform_u32(SimpleRandomSHR3_t * p_shr3, uint32_t bound);
+void simplerandom_shr3_fill_uniform_u32(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_shr3_discard(SimpleRandomSHR3_t * p_shr3, uintmax_t n);
+void simplerandom_shr3_split(const SimpleRandomSHR3_t * p_shr3, SimpleRandomSHR3_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_shr3_parallel_fill(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_shr3_at(const SimpleRandomSHR3_t * p_shr3, uintmax_t i);
 
 /* MWC1 -- "Multiply-with-carry" random number generator
  *
@@ -256,10 +390,19 @@ void simplerandom_shr3_discard(SimpleRandomSHR3_t * p_shr3, uintmax_t n);
 size_t simplerandom_mwc1_num_seeds(const SimpleRandomMWC1_t * p_mwc);
 size_t simplerandom_mwc1_seed_array(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc1_seed(SimpleRandomMWC1_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
-void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc);
+SIMPLERANDOM_INLINE_API void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc);
 void simplerandom_mwc1_mix(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc);
+uint32_t simplerandom_mwc1_prev(SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_fill(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc1_fill_float(SimpleRandomMWC1_t * p_mwc, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_mwc1_fill_double(SimpleRandomMWC1_t * p_mwc, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_mwc1_uniform_u32(SimpleRandomMWC1_t * p_mwc, uint32_t bound);
+void simplerandom_mwc1_fill_uniform_u32(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_mwc1_discard(SimpleRandomMWC1_t * p_mwc, uintmax_t n);
+void simplerandom_mwc1_split(const SimpleRandomMWC1_t * p_mwc, SimpleRandomMWC1_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_mwc1_parallel_fill(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_mwc1_at(const SimpleRandomMWC1_t * p_mwc, uintmax_t i);
 
 static inline uint32_t mwc1_current(SimpleRandomMWC1_t * p_mwc)
 {
@@ -280,10 +423,19 @@ static inline uint32_t mwc1_current(SimpleRandomMWC1_t * p_mwc)
 size_t simplerandom_mwc2_num_seeds(const SimpleRandomMWC2_t * p_mwc);
 size_t simplerandom_mwc2_seed_array(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc2_seed(SimpleRandomMWC2_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
-void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc);
+SIMPLERANDOM_INLINE_API void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc);
 void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc);
+uint32_t simplerandom_mwc2_prev(SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_fill(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc2_fill_float(SimpleRandomMWC2_t * p_mwc, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_mwc2_fill_double(SimpleRandomMWC2_t * p_mwc, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_mwc2_uniform_u32(SimpleRandomMWC2_t * p_mwc, uint32_t bound);
+void simplerandom_mwc2_fill_uniform_u32(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_mwc2_discard(SimpleRandomMWC2_t * p_mwc, uintmax_t n);
+void simplerandom_mwc2_split(const SimpleRandomMWC2_t * p_mwc, SimpleRandomMWC2_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_mwc2_parallel_fill(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_mwc2_at(const SimpleRandomMWC2_t * p_mwc, uintmax_t i);
 
 static inline uint32_t mwc2_current(SimpleRandomMWC2_t * p_mwc)
 {
@@ -307,10 +459,19 @@ static inline uint32_t mwc2_current(SimpleRandomMWC2_t * p_mwc)
 size_t simplerandom_kiss_num_seeds(const SimpleRandomKISS_t * );
 size_t simplerandom_kiss_seed_array(SimpleRandomKISS_t * p_kiss, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_kiss_seed(SimpleRandomKISS_t * p_kiss, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
-void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss);
+SIMPLERANDOM_INLINE_API void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss);
 void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss);
+uint32_t simplerandom_kiss_prev(SimpleRandomKISS_t * p_kiss);
+void simplerandom_kiss_fill(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out);
+void simplerandom_kiss_fill_float(SimpleRandomKISS_t * p_kiss, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_kiss_fill_double(SimpleRandomKISS_t * p_kiss, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_kiss_uniform_u32(SimpleRandomKISS_t * p_kiss, uint32_t bound);
+void simplerandom_kiss_fill_uniform_u32(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_kiss_discard(SimpleRandomKISS_t * p_kiss, uintmax_t n);
+void simplerandom_kiss_split(const SimpleRandomKISS_t * p_kiss, SimpleRandomKISS_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_kiss_parallel_fill(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_kiss_at(const SimpleRandomKISS_t * p_kiss, uintmax_t i);
 
 static inline uint32_t kiss_current(SimpleRandomKISS_t * p_kiss)
 {
@@ -339,10 +500,24 @@ static inline uint32_t kiss_current(SimpleRandomKISS_t * p_kiss)
 size_t simplerandom_mwc64_num_seeds(const SimpleRandomMWC64_t * p_mwc);
 size_t simplerandom_mwc64_seed_array(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_mwc64_seed(SimpleRandomMWC64_t * p_mwc, uint32_t seed_upper, uint32_t seed_lower);
-void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc);
+SIMPLERANDOM_INLINE_API void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc);
 void simplerandom_mwc64_mix(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc);
+uint32_t simplerandom_mwc64_prev(SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_fill(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out);
+void simplerandom_mwc64_fill_float(SimpleRandomMWC64_t * p_mwc, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_mwc64_fill_double(SimpleRandomMWC64_t * p_mwc, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_mwc64_uniform_u32(SimpleRandomMWC64_t * p_mwc, uint32_t bound);
+void simplerandom_mwc64_fill_uniform_u32(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_mwc64_discard(SimpleRandomMWC64_t * p_mwc, uintmax_t n);
+void simplerandom_mwc64_split(const SimpleRandomMWC64_t * p_mwc, SimpleRandomMWC64_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_mwc64_parallel_fill(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_mwc64_at(const SimpleRandomMWC64_t * p_mwc, uintmax_t i);
+
+static inline uint32_t mwc64_current(SimpleRandomMWC64_t * p_mwc)
+{
+    return p_mwc->mwc_lower;
+}
 
 /* KISS2 -- "Keep It Simple Stupid" random number generator
  *
@@ -358,10 +533,19 @@ void simplerandom_mwc64_discard(SimpleRandomMWC64_t * p_mwc, uintmax_t n);
 size_t simplerandom_kiss2_num_seeds(const SimpleRandomKISS2_t * p_kiss2);
 size_t simplerandom_kiss2_seed_array(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_kiss2_seed(SimpleRandomKISS2_t * p_kiss2, uint32_t seed_mwc_upper, uint32_t seed_mwc_lower, uint32_t seed_cong, uint32_t seed_shr3);
-void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2);
+SIMPLERANDOM_INLINE_API void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2);
 void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2);
+uint32_t simplerandom_kiss2_prev(SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2_fill(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out);
+void simplerandom_kiss2_fill_float(SimpleRandomKISS2_t * p_kiss2, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_kiss2_fill_double(SimpleRandomKISS2_t * p_kiss2, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_kiss2_uniform_u32(SimpleRandomKISS2_t * p_kiss2, uint32_t bound);
+void simplerandom_kiss2_fill_uniform_u32(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_kiss2_discard(SimpleRandomKISS2_t * p_kiss2, uintmax_t n);
+void simplerandom_kiss2_split(const SimpleRandomKISS2_t * p_kiss2, SimpleRandomKISS2_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_kiss2_parallel_fill(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_kiss2_at(const SimpleRandomKISS2_t * p_kiss2, uintmax_t i);
 
 static inline uint32_t kiss2_current(SimpleRandomKISS2_t * p_kiss2)
 {
@@ -386,10 +570,24 @@ static inline uint32_t kiss2_current(SimpleRandomKISS2_t * p_kiss2)
 size_t simplerandom_lfsr113_num_seeds(const SimpleRandomLFSR113_t * p_lfsr113);
 size_t simplerandom_lfsr113_seed_array(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_z1, uint32_t seed_z2, uint32_t seed_z3, uint32_t seed_z4);
-void simplerandom_lfsr113_sanitize(SimpleRandomLFSR113_t * p_lfsr113);
+SIMPLERANDOM_INLINE_API void simplerandom_lfsr113_sanitize(SimpleRandomLFSR113_t * p_lfsr113);
 void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113);
+uint32_t simplerandom_lfsr113_prev(SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113_fill(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out);
+void simplerandom_lfsr113_fill_float(SimpleRandomLFSR113_t * p_lfsr113, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_lfsr113_fill_double(SimpleRandomLFSR113_t * p_lfsr113, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_lfsr113_uniform_u32(SimpleRandomLFSR113_t * p_lfsr113, uint32_t bound);
+void simplerandom_lfsr113_fill_uniform_u32(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_lfsr113_discard(SimpleRandomLFSR113_t * p_lfsr113, uintmax_t n);
+void simplerandom_lfsr113_split(const SimpleRandomLFSR113_t * p_lfsr113, SimpleRandomLFSR113_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_lfsr113_parallel_fill(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_lfsr113_at(const SimpleRandomLFSR113_t * p_lfsr113, uintmax_t i);
+
+static inline uint32_t lfsr113_current(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    return (p_lfsr113->z1 ^ p_lfsr113->z2 ^ p_lfsr113->z3 ^ p_lfsr113->z4);
+}
 
 /* LFSR88 -- Combined LFSR random number generator by L'Ecuyer
  *
@@ -405,10 +603,154 @@ void simplerandom_lfsr113_discard(SimpleRandomLFSR113_t * p_lfsr113, uintmax_t n
 size_t simplerandom_lfsr88_num_seeds(const SimpleRandomLFSR88_t * p_lfsr88);
 size_t simplerandom_lfsr88_seed_array(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_seeds, size_t num_seeds, bool mix_extras);
 void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1, uint32_t seed_z2, uint32_t seed_z3);
-void simplerandom_lfsr88_sanitize(SimpleRandomLFSR88_t * p_lfsr88);
+SIMPLERANDOM_INLINE_API void simplerandom_lfsr88_sanitize(SimpleRandomLFSR88_t * p_lfsr88);
 void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_data, size_t num_data);
-uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88);
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88);
+uint32_t simplerandom_lfsr88_prev(SimpleRandomLFSR88_t * p_lfsr88);
+void simplerandom_lfsr88_fill(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out);
+void simplerandom_lfsr88_fill_float(SimpleRandomLFSR88_t * p_lfsr88, float * p_out, size_t num_out, unsigned bits);
+void simplerandom_lfsr88_fill_double(SimpleRandomLFSR88_t * p_lfsr88, double * p_out, size_t num_out, unsigned bits);
+uint32_t simplerandom_lfsr88_uniform_u32(SimpleRandomLFSR88_t * p_lfsr88, uint32_t bound);
+void simplerandom_lfsr88_fill_uniform_u32(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out, uint32_t bound);
 void simplerandom_lfsr88_discard(SimpleRandomLFSR88_t * p_lfsr88, uintmax_t n);
+void simplerandom_lfsr88_split(const SimpleRandomLFSR88_t * p_lfsr88, SimpleRandomLFSR88_t * p_out, size_t n_streams, uintmax_t stride);
+void simplerandom_lfsr88_parallel_fill(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out, unsigned num_threads);
+uint32_t simplerandom_lfsr88_at(const SimpleRandomLFSR88_t * p_lfsr88, uintmax_t i);
+
+static inline uint32_t lfsr88_current(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    return (p_lfsr88->z1 ^ p_lfsr88->z2 ^ p_lfsr88->z3);
+}
+
+
+/* Normal and exponential distributions, for each generator
+ *
+ * These use the ziggurat method, with 64-bit integer arithmetic. See
+ * simplerandom-ziggurat.c.
+ */
+#ifdef UINT64_C
+double simplerandom_cong_normal(SimpleRandomCong_t * p_cong);
+void simplerandom_cong_fill_normal(SimpleRandomCong_t * p_cong, double * p_out, size_t num_out);
+double simplerandom_cong_exponential(SimpleRandomCong_t * p_cong);
+void simplerandom_cong_fill_exponential(SimpleRandomCong_t * p_cong, double * p_out, size_t num_out);
+double simplerandom_shr3_normal(SimpleRandomSHR3_t * p_shr3);
+void simplerandom_shr3_fill_normal(SimpleRandomSHR3_t * p_shr3, double * p_out, size_t num_out);
+double simplerandom_shr3_exponential(SimpleRandomSHR3_t * p_shr3);
+void simplerandom_shr3_fill_exponential(SimpleRandomSHR3_t * p_shr3, double * p_out, size_t num_out);
+double simplerandom_mwc1_normal(SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_fill_normal(SimpleRandomMWC1_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_mwc1_exponential(SimpleRandomMWC1_t * p_mwc);
+void simplerandom_mwc1_fill_exponential(SimpleRandomMWC1_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_mwc2_normal(SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_fill_normal(SimpleRandomMWC2_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_mwc2_exponential(SimpleRandomMWC2_t * p_mwc);
+void simplerandom_mwc2_fill_exponential(SimpleRandomMWC2_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_kiss_normal(SimpleRandomKISS_t * p_kiss);
+void simplerandom_kiss_fill_normal(SimpleRandomKISS_t * p_kiss, double * p_out, size_t num_out);
+double simplerandom_kiss_exponential(SimpleRandomKISS_t * p_kiss);
+void simplerandom_kiss_fill_exponential(SimpleRandomKISS_t * p_kiss, double * p_out, size_t num_out);
+double simplerandom_mwc64_normal(SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_fill_normal(SimpleRandomMWC64_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_mwc64_exponential(SimpleRandomMWC64_t * p_mwc);
+void simplerandom_mwc64_fill_exponential(SimpleRandomMWC64_t * p_mwc, double * p_out, size_t num_out);
+double simplerandom_kiss2_normal(SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2_fill_normal(SimpleRandomKISS2_t * p_kiss2, double * p_out, size_t num_out);
+double simplerandom_kiss2_exponential(SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2_fill_exponential(SimpleRandomKISS2_t * p_kiss2, double * p_out, size_t num_out);
+double simplerandom_lfsr113_normal(SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113_fill_normal(SimpleRandomLFSR113_t * p_lfsr113, double * p_out, size_t num_out);
+double simplerandom_lfsr113_exponential(SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113_fill_exponential(SimpleRandomLFSR113_t * p_lfsr113, double * p_out, size_t num_out);
+double simplerandom_lfsr88_normal(SimpleRandomLFSR88_t * p_lfsr88);
+void simplerandom_lfsr88_fill_normal(SimpleRandomLFSR88_t * p_lfsr88, double * p_out, size_t num_out);
+double simplerandom_lfsr88_exponential(SimpleRandomLFSR88_t * p_lfsr88);
+void simplerandom_lfsr88_fill_exponential(SimpleRandomLFSR88_t * p_lfsr88, double * p_out, size_t num_out);
+#endif /* defined(UINT64_C) */
+
+
+/* LFSR113x8 -- 8 independent LFSR113 streams, run side by side
+ *
+ * Each lane is a complete LFSR113 generator, and produces exactly the same
+ * sequence as simplerandom_lfsr113_next() would for that lane's state. All
+ * 8 lanes are stepped together, which suits SIMD instructions: when compiled
+ * for AVX2, each LFSR component of all 8 lanes is held in one 256-bit
+ * register.
+ *
+ * simplerandom_lfsr113x8_seed_streams() sets lane 0 to the given state, and
+ * each following lane to the previous lane discarded by 'stride' samples.
+ * So a stride of 2^k places the lanes 2^k apart in the LFSR113 sequence.
+ *
+ * Output of simplerandom_lfsr113x8_next() and simplerandom_lfsr113x8_fill()
+ * is interleaved: one value from each lane in turn, lane 0 first. If
+ * 'num_out' for simplerandom_lfsr113x8_fill() is not a multiple of 8, all
+ * lanes are still stepped for the final partial set of values, and the values
+ * from the remaining lanes are discarded.
+ */
+void simplerandom_lfsr113x8_seed_streams(SimpleRandomLFSR113x8_t * p_lfsr113x8, const SimpleRandomLFSR113_t * p_lfsr113, uintmax_t stride);
+void simplerandom_lfsr113x8_set_lane(SimpleRandomLFSR113x8_t * p_lfsr113x8, size_t lane, const SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113x8_get_lane(const SimpleRandomLFSR113x8_t * p_lfsr113x8, size_t lane, SimpleRandomLFSR113_t * p_lfsr113);
+void simplerandom_lfsr113x8_next(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out);
+void simplerandom_lfsr113x8_fill(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out);
+
+
+/* KISS2x4, KISS2x8 -- 4 or 8 independent KISS2 streams, run side by side
+ *
+ * Each lane is a complete KISS2 generator, and produces exactly the same
+ * sequence as simplerandom_kiss2_next() would for that lane's state. The
+ * 64-bit MWC of each lane is held in a 64-bit SIMD element, so the
+ * 32-bit x 32-bit -> 64-bit multiplication is one instruction for all lanes
+ * (VPMULUDQ), while Cong and SHR3 use 32-bit elements. KISS2x4 uses AVX2
+ * instructions where available. KISS2x8 uses AVX-512 where available, or
+ * otherwise two sets of AVX2 registers.
+ *
+ * The functions work in the same way as the LFSR113x8 functions: output is
+ * interleaved, one value from each lane in turn, lane 0 first, and a final
+ * partial set of values steps all lanes.
+ */
+#ifdef UINT64_C
+void simplerandom_kiss2x4_seed_streams(SimpleRandomKISS2x4_t * p_kiss2x4, const SimpleRandomKISS2_t * p_kiss2, uintmax_t stride);
+void simplerandom_kiss2x4_set_lane(SimpleRandomKISS2x4_t * p_kiss2x4, size_t lane, const SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2x4_get_lane(const SimpleRandomKISS2x4_t * p_kiss2x4, size_t lane, SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2x4_next(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out);
+void simplerandom_kiss2x4_fill(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out);
+
+void simplerandom_kiss2x8_seed_streams(SimpleRandomKISS2x8_t * p_kiss2x8, const SimpleRandomKISS2_t * p_kiss2, uintmax_t stride);
+void simplerandom_kiss2x8_set_lane(SimpleRandomKISS2x8_t * p_kiss2x8, size_t lane, const SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2x8_get_lane(const SimpleRandomKISS2x8_t * p_kiss2x8, size_t lane, SimpleRandomKISS2_t * p_kiss2);
+void simplerandom_kiss2x8_next(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out);
+void simplerandom_kiss2x8_fill(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out);
+#endif /* defined(UINT64_C) */
+
+
+/* Thread-local default generator
+ *
+ * A KISS2 generator for each thread, for code that just wants random values
+ * without managing a generator state. No locks are needed. Each thread's
+ * generator is seeded on its first call, as a separate stream of a KISS2
+ * sequence, SIMPLERANDOM_TLS_STREAM_STRIDE values apart from the others. See
+ * simplerandom-tls.c for details.
+ *
+ *     simplerandom_tls_next()
+ *     simplerandom_tls_fill(out, num_out)
+ *         As simplerandom_kiss2_next() and simplerandom_kiss2_fill(), on the
+ *         calling thread's generator.
+ *     simplerandom_tls_kiss2()
+ *         Return the calling thread's generator, to use with the other
+ *         simplerandom_kiss2_zzz() functions. It must only be used by the
+ *         calling thread.
+ */
+#ifdef UINT64_C
+#define SIMPLERANDOM_TLS_STREAM_STRIDE  (UINTMAX_C(1) << 44u)
+
+uint32_t simplerandom_tls_next(void);
+void simplerandom_tls_fill(uint32_t * p_out, size_t num_out);
+SimpleRandomKISS2_t * simplerandom_tls_kiss2(void);
+#endif /* defined(UINT64_C) */
+
+
+#ifdef SIMPLERANDOM_INLINE
+#include "simplerandom-inline.h"
+#endif
 
 
 #ifdef __cplusplus
@@ -81,14 +81,1014 @@
 
 
 /*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom-c.h"
+
+#include <type_traits>
+
+
+/*****************************************************************************
+ * Defines
+ *
+ * With C++14 or later, the engines' constructors, seed(), set_state(),
+ * discard() and operator()() are constexpr, so they can be used to generate
+ * values at compile time. They use the inline functions in
+ * simplerandom::detail, which give identical results to the C library.
+ *
+ * discard() uses the C library functions when not evaluated at compile time,
+ * where the compiler can tell (C++20, or GCC/Clang built-ins), since those
+ * use pre-calculated jump tables and are much faster.
+ ****************************************************************************/
+
+#if __cplusplus >= 201402L
+#define SIMPLERANDOM_CONSTEXPR              constexpr
+#if defined(__cpp_lib_is_constant_evaluated)
+#define SIMPLERANDOM_IS_CONSTANT_EVALUATED()    std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SIMPLERANDOM_IS_CONSTANT_EVALUATED()    __builtin_is_constant_evaluated()
+#endif
+#endif
+#ifndef SIMPLERANDOM_IS_CONSTANT_EVALUATED
+#define SIMPLERANDOM_IS_CONSTANT_EVALUATED()    true
+#endif
+#else
+#define SIMPLERANDOM_CONSTEXPR              inline
+#define SIMPLERANDOM_IS_CONSTANT_EVALUATED()    false
+#endif
+
+
+/*****************************************************************************
+ * Inline functions
  *
+ * These are ports of the C library's seed, sanitize and discard calculations.
+ * Discard for SHR3 and the LFSR generators raises the one-step matrix to the
+ * power 'n' by repeated squaring, rather than using the C library's tables of
+ * pre-calculated powers.
  ****************************************************************************/
 
 namespace simplerandom
 {
+namespace detail
+{
+
+/* 32x32 bit matrix over GF(2), as columns. See bitcolumnmatrix.h. */
+struct BitColumnMatrix32
+{
+    uint32_t    matrix[32];
+};
+
+SIMPLERANDOM_CONSTEXPR uint32_t bitcolumnmatrix32_mul_uint32(const BitColumnMatrix32 & m, uint32_t v)
+{
+    uint32_t    result = 0;
+
+    for (unsigned i = 0; v != 0; i++, v >>= 1u)
+    {
+        if (v & 1u)
+            result ^= m.matrix[i];
+    }
+    return result;
+}
+
+/* Apply 'n' steps of a linear (over GF(2)) generator 'step' to 'x'. */
+SIMPLERANDOM_CONSTEXPR uint32_t bitcolumnmatrix32_jump_uint32(uint32_t (*step)(uint32_t), uint32_t x, uintmax_t n)
+{
+    BitColumnMatrix32   m = {};
+    BitColumnMatrix32   squared = {};
+
+    for (unsigned i = 0; i < 32u; i++)
+    {
+        m.matrix[i] = step(UINT32_C(1) << i);
+    }
+    for (;;)
+    {
+        if (n & 1u)
+            x = bitcolumnmatrix32_mul_uint32(m, x);
+        n >>= 1u;
+        if (n == 0)
+            break;
+        for (unsigned i = 0; i < 32u; i++)
+        {
+            squared.matrix[i] = bitcolumnmatrix32_mul_uint32(m, m.matrix[i]);
+        }
+        m = squared;
+    }
+    return x;
+}
+
+#ifdef UINT64_C
+
+SIMPLERANDOM_CONSTEXPR uint32_t mul_mod_uint32(uint32_t a, uint32_t b, uint32_t mod)
+{
+    return (uint32_t)(((uint64_t)a * b) % mod);
+}
+
+#else /* !defined(UINT64_C) */
+
+/* Multiplication modulo 'mod', within 32 bits, as mul_mod_uint32() in the C
+ * library. */
+SIMPLERANDOM_CONSTEXPR uint32_t mul_mod_uint32(uint32_t a, uint32_t b, uint32_t mod)
+{
+    uint32_t    result = 0;
+    uint32_t    temp_b = 0;
+
+    if (b >= mod)
+    {
+        if (mod > UINT32_C(0xFFFFFFFF) / 2u)
+            b -= mod;
+        else
+            b %= mod;
+    }
+    while (a != 0)
+    {
+        if (a & 1u)
+        {
+            if (b >= mod - result)
+                result -= mod;
+            result += b;
+        }
+        a >>= 1u;
+
+        temp_b = b;
+        if (b >= mod - temp_b)
+            temp_b -= mod;
+        b += temp_b;
+    }
+    return result;
+}
+
+#endif /* defined(UINT64_C) */
+
+SIMPLERANDOM_CONSTEXPR uint32_t pow_mod_uint32(uint32_t base, uintmax_t n, uint32_t mod)
+{
+    uint32_t    result = 1u;
+
+    for (;;)
+    {
+        if (n & 1u)
+            result = mul_mod_uint32(result, base, mod);
+        n >>= 1u;
+        if (n == 0)
+            break;
+        base = mul_mod_uint32(base, base, mod);
+    }
+    return result;
+}
+
+/* The C library's _simplerandom_mwc2_sanitize_upper() and
+ * _simplerandom_mwc2_sanitize_lower(). */
+SIMPLERANDOM_CONSTEXPR uint32_t mwc_sanitize(uint32_t state, uint32_t mod)
+{
+    uint32_t    temp = state % mod;
+
+    if (temp == 0)
+        temp = (state ^ UINT32_C(0xFFFFFFFF)) % mod;
+    return temp;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t mwc_upper_next(uint32_t mwc_upper)
+{
+    return 36969u * (mwc_upper & 0xFFFFu) + (mwc_upper >> 16u);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t mwc_lower_next(uint32_t mwc_lower)
+{
+    return 18000u * (mwc_lower & 0xFFFFu) + (mwc_lower >> 16u);
+}
+
+/* MWC1 and MWC2 discard, on the combined state of the upper or lower part. */
+SIMPLERANDOM_CONSTEXPR uint32_t mwc_discard(uint32_t state, uintmax_t n, uint32_t mult)
+{
+    uint32_t    mod = mult * (UINT32_C(1) << 16u) - 1u;
+
+    return mul_mod_uint32(pow_mod_uint32(mult, n, mod), state, mod);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t cong_next(uint32_t cong)
+{
+    return UINT32_C(69069) * cong + 12345u;
+}
+
+/* Cong discard, by composing the affine maps for 2^k steps. Cong has period
+ * 2^32, so only the lower 32 bits of 'n' matter. */
+SIMPLERANDOM_CONSTEXPR uint32_t cong_discard(uint32_t cong, uintmax_t n)
+{
+    uint32_t    mult = UINT32_C(69069);
+    uint32_t    add = 12345u;
+
+    for (unsigned i = 0; i < 32u && n != 0; i++, n >>= 1u)
+    {
+        if (n & 1u)
+            cong = mult * cong + add;
+        add = mult * add + add;
+        mult *= mult;
+    }
+    return cong;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t shr3_sanitize(uint32_t shr3)
+{
+    return (shr3 == 0) ? UINT32_C(0xFFFFFFFF) : shr3;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t shr3_next(uint32_t shr3)
+{
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 5);
+    return shr3;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t shr3_discard(uint32_t shr3, uintmax_t n)
+{
+    return bitcolumnmatrix32_jump_uint32(shr3_next, shr3, n);
+}
+
+#ifdef UINT64_C
+
+constexpr uint64_t mwc64_mult = UINT64_C(698769069);
+constexpr uint64_t mwc64_modulo = UINT64_C(0x29A65EACFFFFFFFF);    /* 698769069 * 2^32 - 1 */
+
+/* Multiplication modulo 'mod', within 64 bits, as mul_mod_uint64() in the C
+ * library. */
+SIMPLERANDOM_CONSTEXPR uint64_t mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod)
+{
+    uint64_t    result = 0;
+    uint64_t    temp_b = 0;
+
+    if (b >= mod)
+    {
+        if (mod > UINT64_C(0xFFFFFFFFFFFFFFFF) / 2u)
+            b -= mod;
+        else
+            b %= mod;
+    }
+    while (a != 0)
+    {
+        if (a & 1u)
+        {
+            if (b >= mod - result)
+                result -= mod;
+            result += b;
+        }
+        a >>= 1u;
+
+        temp_b = b;
+        if (b >= mod - temp_b)
+            temp_b -= mod;
+        b += temp_b;
+    }
+    return result;
+}
+
+SIMPLERANDOM_CONSTEXPR uint64_t pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
+{
+    uint64_t    result = 1u;
+
+    for (;;)
+    {
+        if (n & 1u)
+            result = mul_mod_uint64(result, base, mod);
+        n >>= 1u;
+        if (n == 0)
+            break;
+        base = mul_mod_uint64(base, base, mod);
+    }
+    return result;
+}
+
+/* The C library's simplerandom_mwc64_sanitize(), on the combined state. */
+SIMPLERANDOM_CONSTEXPR uint64_t mwc64_sanitize(uint64_t state)
+{
+    uint64_t    temp = state % mwc64_modulo;
+
+    if (temp == 0)
+        temp = (state ^ UINT64_C(0xFFFFFFFFFFFFFFFF)) % mwc64_modulo;
+    return temp;
+}
+
+SIMPLERANDOM_CONSTEXPR uint64_t mwc64_next(uint64_t state)
+{
+    return mwc64_mult * (uint32_t)state + (state >> 32u);
+}
+
+SIMPLERANDOM_CONSTEXPR uint64_t mwc64_discard(uint64_t state, uintmax_t n)
+{
+    return mul_mod_uint64(pow_mod_uint64(mwc64_mult, n, mwc64_modulo), state, mwc64_modulo);
+}
+
+#endif /* defined(UINT64_C) */
+
+/* The C library's LFSR seeding, for one component with minimum value
+ * 'min_value'. */
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr_seed_z(uint32_t seed, uint32_t min_value)
+{
+    uint32_t    working_seed = seed ^ (seed << 16u);
+
+    if (working_seed < min_value)
+    {
+        working_seed = seed << 24u;
+        if (working_seed < min_value)
+            working_seed = ~working_seed;
+    }
+    return working_seed;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr_sanitize_z(uint32_t z, uint32_t min_value)
+{
+    return (z < min_value) ? ~z : z;
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr113_z1_next(uint32_t z1)
+{
+    return ((z1 & UINT32_C(0xFFFFFFFE)) << 18) ^ (((z1 << 6) ^ z1) >> 13);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr113_z2_next(uint32_t z2)
+{
+    return ((z2 & UINT32_C(0xFFFFFFF8)) << 2) ^ (((z2 << 2) ^ z2) >> 27);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr113_z3_next(uint32_t z3)
+{
+    return ((z3 & UINT32_C(0xFFFFFFF0)) << 7) ^ (((z3 << 13) ^ z3) >> 21);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr113_z4_next(uint32_t z4)
+{
+    return ((z4 & UINT32_C(0xFFFFFF80)) << 13) ^ (((z4 << 3) ^ z4) >> 12);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr88_z1_next(uint32_t z1)
+{
+    return ((z1 & UINT32_C(0xFFFFFFFE)) << 12) ^ (((z1 << 13) ^ z1) >> 19);
+}
 
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr88_z2_next(uint32_t z2)
+{
+    return ((z2 & UINT32_C(0xFFFFFFF8)) << 4) ^ (((z2 << 2) ^ z2) >> 25);
+}
+
+SIMPLERANDOM_CONSTEXPR uint32_t lfsr88_z3_next(uint32_t z3)
+{
+    return ((z3 & UINT32_C(0xFFFFFFF0)) << 17) ^ (((z3 << 3) ^ z3) >> 11);
 }
 
+} /* namespace detail */
+} /* namespace simplerandom */
+
+
+/*****************************************************************************
+ * Classes
+ *
+ * Each generator is a class that meets the C++11 UniformRandomBitGenerator
+ * requirements, so it can be used with the standard <random> distributions
+ * such as std::uniform_real_distribution.
+ *
+ * The classes have no virtual functions. The "next" calculation is defined
+ * inline in operator()(), so it can be fully inlined into the caller's loop.
+ * seed(), set_state() and discard() are inline too, so they can be constexpr
+ * (see above). The other less time-critical functions (seed_array, mix, fill)
+ * call the C library functions. All give identical results to the C library.
+ * The state is the same structure as used by the C API, available via
+ * state().
+ ****************************************************************************/
+
+namespace simplerandom
+{
+
+class Cong
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR Cong(uint32_t seed1 = 0)
+        : rng()
+    {
+        seed(seed1);
+    }
+    Cong(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 1u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed1 = 0)
+    {
+        rng.cong = seed1;
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_cong_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_cong_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_cong_discard(&rng, n);
+            return;
+        }
+        rng.cong = detail::cong_discard(rng.cong, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_cong_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.cong = detail::cong_next(rng.cong);
+        return rng.cong;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomCong_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomCong_t & new_state)
+    {
+        rng = new_state;
+    }
+
+private:
+    SimpleRandomCong_t rng;
+};
+
+/* SHR3 never outputs 0, so its min() is 1. */
+class SHR3
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR SHR3(uint32_t seed1 = 0)
+        : rng()
+    {
+        seed(seed1);
+    }
+    SHR3(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 1u; }
+    static constexpr result_type min() { return 1; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed1 = 0)
+    {
+        rng.shr3 = detail::shr3_sanitize(seed1);
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_shr3_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_shr3_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_shr3_discard(&rng, n);
+            return;
+        }
+        rng.shr3 = detail::shr3_discard(rng.shr3, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_shr3_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.shr3 = detail::shr3_next(rng.shr3);
+        return rng.shr3;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomSHR3_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomSHR3_t & new_state)
+    {
+        rng = new_state;
+        rng.shr3 = detail::shr3_sanitize(rng.shr3);
+    }
+
+private:
+    SimpleRandomSHR3_t rng;
+};
+
+class MWC1
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR MWC1(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+        : rng()
+    {
+        seed(seed_upper, seed_lower);
+    }
+    MWC1(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 2u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+    {
+        rng.mwc_upper = detail::mwc_sanitize(seed_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(seed_lower, UINT32_C(0x464FFFFF));
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_mwc1_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_mwc1_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_mwc1_discard(&rng, n);
+            return;
+        }
+        rng.mwc_upper = detail::mwc_discard(rng.mwc_upper, n, 36969u);
+        rng.mwc_lower = detail::mwc_discard(rng.mwc_lower, n, 18000u);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_mwc1_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.mwc_upper = detail::mwc_upper_next(rng.mwc_upper);
+        rng.mwc_lower = detail::mwc_lower_next(rng.mwc_lower);
+        return (rng.mwc_upper << 16u) + rng.mwc_lower;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomMWC1_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomMWC1_t & new_state)
+    {
+        rng = new_state;
+        rng.mwc_upper = detail::mwc_sanitize(rng.mwc_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(rng.mwc_lower, UINT32_C(0x464FFFFF));
+    }
+
+private:
+    SimpleRandomMWC1_t rng;
+};
+
+class MWC2
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR MWC2(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+        : rng()
+    {
+        seed(seed_upper, seed_lower);
+    }
+    MWC2(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 2u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+    {
+        rng.mwc_upper = detail::mwc_sanitize(seed_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(seed_lower, UINT32_C(0x464FFFFF));
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_mwc2_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_mwc2_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_mwc2_discard(&rng, n);
+            return;
+        }
+        rng.mwc_upper = detail::mwc_discard(rng.mwc_upper, n, 36969u);
+        rng.mwc_lower = detail::mwc_discard(rng.mwc_lower, n, 18000u);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_mwc2_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.mwc_upper = detail::mwc_upper_next(rng.mwc_upper);
+        rng.mwc_lower = detail::mwc_lower_next(rng.mwc_lower);
+        return (rng.mwc_upper << 16u) + (rng.mwc_upper >> 16u) + rng.mwc_lower;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomMWC2_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomMWC2_t & new_state)
+    {
+        rng = new_state;
+        rng.mwc_upper = detail::mwc_sanitize(rng.mwc_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(rng.mwc_lower, UINT32_C(0x464FFFFF));
+    }
+
+private:
+    SimpleRandomMWC2_t rng;
+};
+
+class KISS
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR KISS(uint32_t seed_mwc_upper = 0, uint32_t seed_mwc_lower = 0, uint32_t seed_cong = 0, uint32_t seed_shr3 = 0)
+        : rng()
+    {
+        seed(seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+    }
+    KISS(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 4u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_mwc_upper = 0, uint32_t seed_mwc_lower = 0, uint32_t seed_cong = 0, uint32_t seed_shr3 = 0)
+    {
+        rng.mwc_upper = detail::mwc_sanitize(seed_mwc_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(seed_mwc_lower, UINT32_C(0x464FFFFF));
+        rng.cong = seed_cong;
+        rng.shr3 = detail::shr3_sanitize(seed_shr3);
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_kiss_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_kiss_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_kiss_discard(&rng, n);
+            return;
+        }
+        rng.mwc_upper = detail::mwc_discard(rng.mwc_upper, n, 36969u);
+        rng.mwc_lower = detail::mwc_discard(rng.mwc_lower, n, 18000u);
+        rng.cong = detail::cong_discard(rng.cong, n);
+        rng.shr3 = detail::shr3_discard(rng.shr3, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_kiss_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.mwc_upper = detail::mwc_upper_next(rng.mwc_upper);
+        rng.mwc_lower = detail::mwc_lower_next(rng.mwc_lower);
+        rng.cong = detail::cong_next(rng.cong);
+        rng.shr3 = detail::shr3_next(rng.shr3);
+        return (((rng.mwc_upper << 16u) + (rng.mwc_upper >> 16u) + rng.mwc_lower) ^ rng.cong) + rng.shr3;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomKISS_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomKISS_t & new_state)
+    {
+        rng = new_state;
+        rng.mwc_upper = detail::mwc_sanitize(rng.mwc_upper, UINT32_C(0x9068FFFF));
+        rng.mwc_lower = detail::mwc_sanitize(rng.mwc_lower, UINT32_C(0x464FFFFF));
+        rng.shr3 = detail::shr3_sanitize(rng.shr3);
+    }
+
+private:
+    SimpleRandomKISS_t rng;
+};
+
+#ifdef UINT64_C
+
+class MWC64
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR MWC64(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+        : rng()
+    {
+        seed(seed_upper, seed_lower);
+    }
+    MWC64(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 2u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_upper = 0, uint32_t seed_lower = 0)
+    {
+        set_mwc64(detail::mwc64_sanitize(((uint64_t)seed_upper << 32u) + seed_lower));
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_mwc64_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_mwc64_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_mwc64_discard(&rng, n);
+            return;
+        }
+        set_mwc64(detail::mwc64_discard(get_mwc64(), n));
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_mwc64_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        set_mwc64(detail::mwc64_next(get_mwc64()));
+        return rng.mwc_lower;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomMWC64_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomMWC64_t & new_state)
+    {
+        rng = new_state;
+        set_mwc64(detail::mwc64_sanitize(get_mwc64()));
+    }
+
+private:
+    SIMPLERANDOM_CONSTEXPR uint64_t get_mwc64() const
+    {
+        return ((uint64_t)rng.mwc_upper << 32u) + rng.mwc_lower;
+    }
+    SIMPLERANDOM_CONSTEXPR void set_mwc64(uint64_t mwc64)
+    {
+        rng.mwc_upper = (uint32_t)(mwc64 >> 32u);
+        rng.mwc_lower = (uint32_t)mwc64;
+    }
+
+    SimpleRandomMWC64_t rng;
+};
+
+class KISS2
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR KISS2(uint32_t seed_mwc_upper = 0, uint32_t seed_mwc_lower = 0, uint32_t seed_cong = 0, uint32_t seed_shr3 = 0)
+        : rng()
+    {
+        seed(seed_mwc_upper, seed_mwc_lower, seed_cong, seed_shr3);
+    }
+    KISS2(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 4u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_mwc_upper = 0, uint32_t seed_mwc_lower = 0, uint32_t seed_cong = 0, uint32_t seed_shr3 = 0)
+    {
+        set_mwc64(detail::mwc64_sanitize(((uint64_t)seed_mwc_upper << 32u) + seed_mwc_lower));
+        rng.cong = seed_cong;
+        rng.shr3 = detail::shr3_sanitize(seed_shr3);
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_kiss2_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_kiss2_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_kiss2_discard(&rng, n);
+            return;
+        }
+        set_mwc64(detail::mwc64_discard(get_mwc64(), n));
+        rng.cong = detail::cong_discard(rng.cong, n);
+        rng.shr3 = detail::shr3_discard(rng.shr3, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_kiss2_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        set_mwc64(detail::mwc64_next(get_mwc64()));
+        rng.cong = detail::cong_next(rng.cong);
+        rng.shr3 = detail::shr3_next(rng.shr3);
+        return rng.mwc_lower + rng.cong + rng.shr3;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomKISS2_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomKISS2_t & new_state)
+    {
+        rng = new_state;
+        set_mwc64(detail::mwc64_sanitize(get_mwc64()));
+        rng.shr3 = detail::shr3_sanitize(rng.shr3);
+    }
+
+private:
+    SIMPLERANDOM_CONSTEXPR uint64_t get_mwc64() const
+    {
+        return ((uint64_t)rng.mwc_upper << 32u) + rng.mwc_lower;
+    }
+    SIMPLERANDOM_CONSTEXPR void set_mwc64(uint64_t mwc64)
+    {
+        rng.mwc_upper = (uint32_t)(mwc64 >> 32u);
+        rng.mwc_lower = (uint32_t)mwc64;
+    }
+
+    SimpleRandomKISS2_t rng;
+};
+
+#endif /* defined(UINT64_C) */
+
+class LFSR113
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR LFSR113(uint32_t seed_z1 = 0, uint32_t seed_z2 = 0, uint32_t seed_z3 = 0, uint32_t seed_z4 = 0)
+        : rng()
+    {
+        seed(seed_z1, seed_z2, seed_z3, seed_z4);
+    }
+    LFSR113(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 4u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_z1 = 0, uint32_t seed_z2 = 0, uint32_t seed_z3 = 0, uint32_t seed_z4 = 0)
+    {
+        rng.z1 = detail::lfsr_seed_z(seed_z1, 2u);
+        rng.z2 = detail::lfsr_seed_z(seed_z2, 8u);
+        rng.z3 = detail::lfsr_seed_z(seed_z3, 16u);
+        rng.z4 = detail::lfsr_seed_z(seed_z4, 128u);
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_lfsr113_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_lfsr113_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_lfsr113_discard(&rng, n);
+            return;
+        }
+        rng.z1 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr113_z1_next, rng.z1, n);
+        rng.z2 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr113_z2_next, rng.z2, n);
+        rng.z3 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr113_z3_next, rng.z3, n);
+        rng.z4 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr113_z4_next, rng.z4, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_lfsr113_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.z1 = detail::lfsr113_z1_next(rng.z1);
+        rng.z2 = detail::lfsr113_z2_next(rng.z2);
+        rng.z3 = detail::lfsr113_z3_next(rng.z3);
+        rng.z4 = detail::lfsr113_z4_next(rng.z4);
+        return rng.z1 ^ rng.z2 ^ rng.z3 ^ rng.z4;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomLFSR113_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomLFSR113_t & new_state)
+    {
+        rng = new_state;
+        rng.z1 = detail::lfsr_sanitize_z(rng.z1, 2u);
+        rng.z2 = detail::lfsr_sanitize_z(rng.z2, 8u);
+        rng.z3 = detail::lfsr_sanitize_z(rng.z3, 16u);
+        rng.z4 = detail::lfsr_sanitize_z(rng.z4, 128u);
+    }
+
+private:
+    SimpleRandomLFSR113_t rng;
+};
+
+class LFSR88
+{
+public:
+    typedef uint32_t result_type;
+
+    explicit SIMPLERANDOM_CONSTEXPR LFSR88(uint32_t seed_z1 = 0, uint32_t seed_z2 = 0, uint32_t seed_z3 = 0)
+        : rng()
+    {
+        seed(seed_z1, seed_z2, seed_z3);
+    }
+    LFSR88(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        seed_array(p_seeds, num_seeds, mix_extras);
+    }
+
+    static constexpr size_t num_seeds() { return 3u; }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_C(0xFFFFFFFF); }
+
+    SIMPLERANDOM_CONSTEXPR void seed(uint32_t seed_z1 = 0, uint32_t seed_z2 = 0, uint32_t seed_z3 = 0)
+    {
+        rng.z1 = detail::lfsr_seed_z(seed_z1, 2u);
+        rng.z2 = detail::lfsr_seed_z(seed_z2, 8u);
+        rng.z3 = detail::lfsr_seed_z(seed_z3, 16u);
+    }
+    size_t seed_array(const uint32_t * p_seeds, size_t num_seeds, bool mix_extras = false)
+    {
+        return simplerandom_lfsr88_seed_array(&rng, p_seeds, num_seeds, mix_extras);
+    }
+    void mix(const uint32_t * p_data, size_t num_data)
+    {
+        simplerandom_lfsr88_mix(&rng, p_data, num_data);
+    }
+    SIMPLERANDOM_CONSTEXPR void discard(uintmax_t n)
+    {
+        if (!SIMPLERANDOM_IS_CONSTANT_EVALUATED())
+        {
+            simplerandom_lfsr88_discard(&rng, n);
+            return;
+        }
+        rng.z1 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr88_z1_next, rng.z1, n);
+        rng.z2 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr88_z2_next, rng.z2, n);
+        rng.z3 = detail::bitcolumnmatrix32_jump_uint32(detail::lfsr88_z3_next, rng.z3, n);
+    }
+    void fill(uint32_t * p_out, size_t num_out)
+    {
+        simplerandom_lfsr88_fill(&rng, p_out, num_out);
+    }
+
+    SIMPLERANDOM_CONSTEXPR result_type operator()()
+    {
+        rng.z1 = detail::lfsr88_z1_next(rng.z1);
+        rng.z2 = detail::lfsr88_z2_next(rng.z2);
+        rng.z3 = detail::lfsr88_z3_next(rng.z3);
+        return rng.z1 ^ rng.z2 ^ rng.z3;
+    }
+
+    SIMPLERANDOM_CONSTEXPR const SimpleRandomLFSR88_t & state() const { return rng; }
+    SIMPLERANDOM_CONSTEXPR void set_state(const SimpleRandomLFSR88_t & new_state)
+    {
+        rng = new_state;
+        rng.z1 = detail::lfsr_sanitize_z(rng.z1, 2u);
+        rng.z2 = detail::lfsr_sanitize_z(rng.z2, 8u);
+        rng.z3 = detail::lfsr_sanitize_z(rng.z3, 16u);
+    }
+
+private:
+    SimpleRandomLFSR88_t rng;
+};
+
+} /* namespace simplerandom */
+
 
 #endif /* !defined(_SIMPLERANDOM_CPP_H) */
 
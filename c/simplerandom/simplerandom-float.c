@@ -0,0 +1,250 @@
+/*
+ * simplerandom-float.c
+ *
+ * Simple Pseudo-random Number Generators -- floating point output.
+ *
+ * Fill arrays of float or double with uniform random values in the range
+ * [0, 1), using a selectable number of random bits per value:
+ *
+ *     bits    draws   float               double
+ *     24      1       x >> 8, / 2^24      x >> 8, / 2^24
+ *     32      1       x / 2^32 (*)        x / 2^32
+ *     53      2       -                   (x2 >> 5, x1 >> 6), / 2^53
+ *
+ * where x, x1, x2 are successive 32-bit values from the generator.
+ * Other 'bits' values are rounded up to the next of these, and then limited
+ * to 32 for float, and 53 for double.
+ *
+ * (*) A float has only 24 bits of precision, so values very close to 1 round
+ * up to 1.0f. These are replaced by the largest float below 1.
+ *
+ * For 32 and 53 bits, doubles are the same values that the Python
+ * simplerandom.random classes give for bpf = 32 and bpf = 53 respectively
+ * (apart from rounding of the last bit for 53): the second draw gives the
+ * more significant bits.
+ *
+ * The random values are generated in chunks by simplerandom_zzz_fill(), then
+ * converted. The conversions are done with SSE2 instructions where available.
+ * They only use conversions from signed integers, which SIMD instruction sets
+ * generally have.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of float values converted per chunk. */
+#define FLOAT_CHUNK_LEN         256u
+
+#define SCALE_24                (1.0 / 16777216.0)              /* 2^-24 */
+#define SCALE_32                (1.0 / 4294967296.0)            /* 2^-32 */
+#define SCALE_53                (1.0 / 9007199254740992.0)      /* 2^-53 */
+#define FLOAT_BELOW_ONE         (1.0f - 1.0f / 16777216.0f)     /* 1 - 2^-24 */
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Number of 32-bit random values needed per float value. */
+static unsigned float_draws(unsigned bits)
+{
+    return (bits > 32u) ? 2u : 1u;
+}
+
+/* Convert a uint32_t to double exactly, via a signed conversion (which SIMD
+ * instruction sets generally have, while unsigned conversion often isn't
+ * available). */
+static inline double uint32_to_double(uint32_t value)
+{
+    return (double)(int32_t)(value ^ UINT32_C(0x80000000)) + 2147483648.0;
+}
+
+/* Each conversion function converts 4 values at a time with SSE2 where it is
+ * available, then does any remaining values one at a time.
+ */
+static void convert_float(float * p_out, const uint32_t * p_in, size_t num_out, unsigned bits)
+{
+    float       value;
+    size_t      i;
+#if defined(__SSE2__)
+    __m128i     in;
+    __m128      high;
+    __m128      low;
+#endif
+
+    i = 0;
+    if (bits <= 24u)
+    {
+#if defined(__SSE2__)
+        for ( ; i + 4u <= num_out; i += 4u)
+        {
+            in = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)&p_in[i]), 8);
+            _mm_storeu_ps(&p_out[i], _mm_mul_ps(_mm_cvtepi32_ps(in), _mm_set1_ps((float)SCALE_24)));
+        }
+#endif
+        for ( ; i < num_out; i++)
+        {
+            p_out[i] = (float)(int32_t)(p_in[i] >> 8u) * (float)SCALE_24;
+        }
+    }
+    else
+    {
+#if defined(__SSE2__)
+        /* The upper and lower 16 bits convert to float exactly, so their sum
+         * is correctly rounded. */
+        for ( ; i + 4u <= num_out; i += 4u)
+        {
+            in = _mm_loadu_si128((const __m128i *)&p_in[i]);
+            high = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(in, 16)), _mm_set1_ps(65536.0f));
+            low = _mm_cvtepi32_ps(_mm_and_si128(in, _mm_set1_epi32(0xFFFF)));
+            high = _mm_mul_ps(_mm_add_ps(high, low), _mm_set1_ps((float)SCALE_32));
+            _mm_storeu_ps(&p_out[i], _mm_min_ps(high, _mm_set1_ps(FLOAT_BELOW_ONE)));
+        }
+#endif
+        for ( ; i < num_out; i++)
+        {
+            value = (float)(uint32_to_double(p_in[i]) * SCALE_32);
+            p_out[i] = (value < FLOAT_BELOW_ONE) ? value : FLOAT_BELOW_ONE;
+        }
+    }
+}
+
+static void convert_double(double * p_out, const uint32_t * p_in, size_t num_out, unsigned bits)
+{
+    size_t      i;
+#if defined(__SSE2__)
+    __m128i     in;
+    __m128i     in_high;
+    __m128d     high;
+    __m128d     low;
+#endif
+
+    i = 0;
+    if (bits <= 24u)
+    {
+#if defined(__SSE2__)
+        for ( ; i + 4u <= num_out; i += 4u)
+        {
+            in = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)&p_in[i]), 8);
+            _mm_storeu_pd(&p_out[i], _mm_mul_pd(_mm_cvtepi32_pd(in), _mm_set1_pd(SCALE_24)));
+            _mm_storeu_pd(&p_out[i + 2u], _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(in, in)), _mm_set1_pd(SCALE_24)));
+        }
+#endif
+        for ( ; i < num_out; i++)
+        {
+            p_out[i] = (double)(int32_t)(p_in[i] >> 8u) * SCALE_24;
+        }
+    }
+    else if (bits <= 32u)
+    {
+#if defined(__SSE2__)
+        for ( ; i + 4u <= num_out; i += 4u)
+        {
+            in = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p_in[i]), _mm_set1_epi32((int32_t)UINT32_C(0x80000000)));
+            low = _mm_add_pd(_mm_cvtepi32_pd(in), _mm_set1_pd(2147483648.0));
+            high = _mm_add_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(in, in)), _mm_set1_pd(2147483648.0));
+            _mm_storeu_pd(&p_out[i], _mm_mul_pd(low, _mm_set1_pd(SCALE_32)));
+            _mm_storeu_pd(&p_out[i + 2u], _mm_mul_pd(high, _mm_set1_pd(SCALE_32)));
+        }
+#endif
+        for ( ; i < num_out; i++)
+        {
+            p_out[i] = uint32_to_double(p_in[i]) * SCALE_32;
+        }
+    }
+    else
+    {
+#if defined(__SSE2__)
+        /* Two values per 4 input values: pairs of (low, high). */
+        for ( ; i + 2u <= num_out; i += 2u)
+        {
+            in = _mm_loadu_si128((const __m128i *)&p_in[2u * i]);
+            in_high = _mm_shuffle_epi32(_mm_srli_epi32(in, 5), _MM_SHUFFLE(3, 1, 3, 1));
+            in = _mm_shuffle_epi32(_mm_srli_epi32(in, 6), _MM_SHUFFLE(2, 0, 2, 0));
+            high = _mm_mul_pd(_mm_cvtepi32_pd(in_high), _mm_set1_pd(67108864.0));
+            low = _mm_cvtepi32_pd(in);
+            _mm_storeu_pd(&p_out[i], _mm_mul_pd(_mm_add_pd(high, low), _mm_set1_pd(SCALE_53)));
+        }
+#endif
+        for ( ; i < num_out; i++)
+        {
+            p_out[i] = ((double)(int32_t)(p_in[2u * i + 1u] >> 5u) * 67108864.0 +
+                        (double)(int32_t)(p_in[2u * i] >> 6u)) * SCALE_53;
+        }
+    }
+}
+
+/* Define simplerandom_zzz_fill_float() and simplerandom_zzz_fill_double() for
+ * generator 'zzz', in terms of simplerandom_zzz_fill(). */
+#define SIMPLERANDOM_FLOAT_FUNCTIONS(NAME, TYPE)                                \
+void simplerandom_##NAME##_fill_float(TYPE * p_rng, float * p_out, size_t num_out, unsigned bits) \
+{                                                                           \
+    uint32_t    buffer[2u * FLOAT_CHUNK_LEN];                               \
+    unsigned    draws;                                                      \
+    size_t      num_chunk;                                                  \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        if (bits > 32u)                                                     \
+            bits = 32u;                                                     \
+        draws = float_draws(bits);                                          \
+        while (num_out)                                                     \
+        {                                                                   \
+            num_chunk = (num_out < FLOAT_CHUNK_LEN) ? num_out : FLOAT_CHUNK_LEN; \
+            simplerandom_##NAME##_fill(p_rng, buffer, num_chunk * draws);   \
+            convert_float(p_out, buffer, num_chunk, bits);                  \
+            p_out += num_chunk;                                             \
+            num_out -= num_chunk;                                           \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_fill_double(TYPE * p_rng, double * p_out, size_t num_out, unsigned bits) \
+{                                                                           \
+    uint32_t    buffer[2u * FLOAT_CHUNK_LEN];                               \
+    unsigned    draws;                                                      \
+    size_t      num_chunk;                                                  \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        draws = float_draws(bits);                                          \
+        while (num_out)                                                     \
+        {                                                                   \
+            num_chunk = (num_out < FLOAT_CHUNK_LEN) ? num_out : FLOAT_CHUNK_LEN; \
+            simplerandom_##NAME##_fill(p_rng, buffer, num_chunk * draws);   \
+            convert_double(p_out, buffer, num_chunk, bits);                 \
+            p_out += num_chunk;                                             \
+            num_out -= num_chunk;                                           \
+        }                                                                   \
+    }                                                                       \
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SIMPLERANDOM_FLOAT_FUNCTIONS(cong, SimpleRandomCong_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(shr3, SimpleRandomSHR3_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(mwc1, SimpleRandomMWC1_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(mwc2, SimpleRandomMWC2_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+SIMPLERANDOM_FLOAT_FUNCTIONS(mwc64, SimpleRandomMWC64_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+SIMPLERANDOM_FLOAT_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t)
+SIMPLERANDOM_FLOAT_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t)
@@ -0,0 +1,641 @@
+/*
+ * simplerandom-inline.h
+ *
+ * Simple Pseudo-random Number Generators -- sanitize and next functions.
+ *
+ * These are the definitions of simplerandom_zzz_sanitize() and
+ * simplerandom_zzz_next() for all generators. Don't include this file
+ * directly; it is included in one of two ways:
+ *
+ *   - By simplerandom.c, to define the library's out-of-line functions.
+ *   - By simplerandom-c.h, if SIMPLERANDOM_INLINE is defined before
+ *     simplerandom.h is included. Then the functions are 'static inline', so
+ *     the compiler can inline them into the caller, and keep the generator
+ *     state in registers over a loop. The library's other functions still
+ *     call the out-of-line functions, which give the same results.
+ *
+ * SIMPLERANDOM_INLINE_API is 'static inline' or empty accordingly. See
+ * simplerandom-c.h.
+ *
+ * Since this can be included in the user's source files, the helper
+ * functions and macros here are all prefixed, so they can't clash with the
+ * user's names.
+ */
+#ifndef _SIMPLERANDOM_INLINE_H
+#define _SIMPLERANDOM_INLINE_H
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Minimum good values of the LFSR113 and LFSR88 state components. */
+#define SIMPLERANDOM_LFSR_Z1_MIN_VALUE  2u
+#define SIMPLERANDOM_LFSR_Z2_MIN_VALUE  8u
+#define SIMPLERANDOM_LFSR_Z3_MIN_VALUE  16u
+#define SIMPLERANDOM_LFSR_Z4_MIN_VALUE  128u
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*********
+ * Cong
+ ********/
+
+SIMPLERANDOM_INLINE_API void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong)
+{
+    /* All state values are valid for Cong. No sanitizing needed. */
+    (void)p_cong;
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong)
+{
+    uint32_t    cong;
+
+    cong = UINT32_C(69069) * p_cong->cong + 12345u;
+    p_cong->cong = cong;
+
+    return cong;
+}
+
+
+/*********
+ * SHR3
+ ********/
+
+SIMPLERANDOM_INLINE_API void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3)
+{
+    /* Zero is a bad state value for SHR3. */
+    if (p_shr3->shr3 == 0)
+    {
+        p_shr3->shr3 = UINT32_C(0xFFFFFFFF);
+    }
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3)
+{
+    uint32_t    shr3;
+
+
+    shr3 = p_shr3->shr3;
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 5);
+    p_shr3->shr3 = shr3;
+
+    return shr3;
+}
+
+
+/*********
+ * MWC2
+ ********/
+
+/* The good state values are all modulo 0x9068FFFF. Values above that would
+ * jump to a corresponding good state value on the first "next" operation.
+ * Any integer multiple of 0x9068FFFF, including 0, is a bad state.
+ */
+static inline void _simplerandom_mwc2_sanitize_upper(SimpleRandomMWC2_t * p_mwc)
+{
+    uint32_t    state_orig;
+    uint32_t    temp;
+
+    state_orig = p_mwc->mwc_upper;
+    temp = state_orig;
+    /* The following is equivalent to % 0x9068FFFF, without using modulo
+     * operation which may be expensive on embedded targets. For
+     * uint32_t and this divisor, we only need 'if' rather than 'while'. */
+    if (temp >= UINT32_C(0x9068FFFF))
+        temp -= UINT32_C(0x9068FFFF);
+    if (temp == 0)
+    {
+        /* Any integer multiple of 0x9068FFFF, including 0, is a bad state.
+         * Use an alternate state value by inverting the original value. */
+        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
+        if (temp >= UINT32_C(0x9068FFFF))
+            temp -= UINT32_C(0x9068FFFF);
+    }
+    p_mwc->mwc_upper = temp;
+}
+
+/* The good state values are all modulo 0x9068FFFF. Values above that would
+ * jump to a corresponding good state value on the first "next" operation.
+ * Any integer multiple of 0x464FFFFF, including 0, is a bad state.
+ */
+static inline void _simplerandom_mwc2_sanitize_lower(SimpleRandomMWC2_t * p_mwc)
+{
+    uint32_t    state_orig;
+    uint32_t    temp;
+
+    state_orig = p_mwc->mwc_lower;
+    temp = state_orig;
+    /* The following is equivalent to % 0x464FFFFF, without using modulo
+     * operation which may be expensive on embedded targets. For
+     * uint32_t and this divisor, it may loop up to 3 times. */
+    while (temp >= UINT32_C(0x464FFFFF))
+        temp -= UINT32_C(0x464FFFFF);
+    if (temp == 0)
+    {
+        /* Any integer multiple of 0x464FFFFF, including 0, is a bad state.
+         * Use an alternate state value by inverting the original value. */
+        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
+        while (temp >= UINT32_C(0x464FFFFF))
+            temp -= UINT32_C(0x464FFFFF);
+    }
+
+    p_mwc->mwc_lower = temp;
+}
+
+SIMPLERANDOM_INLINE_API void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc)
+{
+    _simplerandom_mwc2_sanitize_upper(p_mwc);
+    _simplerandom_mwc2_sanitize_lower(p_mwc);
+}
+
+static inline void _simplerandom_mwc2_next_upper(SimpleRandomMWC2_t * p_mwc)
+{
+    p_mwc->mwc_upper = 36969u * (p_mwc->mwc_upper & 0xFFFFu) + (p_mwc->mwc_upper >> 16u);
+}
+
+static inline void _simplerandom_mwc2_next_lower(SimpleRandomMWC2_t * p_mwc)
+{
+    p_mwc->mwc_lower = 18000u * (p_mwc->mwc_lower & 0xFFFFu) + (p_mwc->mwc_lower >> 16u);
+}
+
+/*
+ * This is almost identical to simplerandom_mwc1_next(), except that when
+ * combining the upper and lower values in the last step, the upper 16 bits of
+ * mwc_upper are added in too, instead of just being discarded.
+ */
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc)
+{
+    _simplerandom_mwc2_next_upper(p_mwc);
+    _simplerandom_mwc2_next_lower(p_mwc);
+    return mwc2_current(p_mwc);
+}
+
+
+/*********
+ * MWC1
+ ********/
+
+SIMPLERANDOM_INLINE_API void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc)
+{
+    simplerandom_mwc2_sanitize(p_mwc);
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc)
+{
+    _simplerandom_mwc2_next_upper(p_mwc);
+    _simplerandom_mwc2_next_lower(p_mwc);
+    return mwc1_current(p_mwc);
+}
+
+
+/*********
+ * KISS
+ ********/
+
+/* The good state values are all modulo 0x9068FFFF. Values above that would
+ * jump to a corresponding good state value on the first "next" operation.
+ * Any integer multiple of 0x9068FFFF, including 0, is a bad state.
+ */
+static inline void _simplerandom_kiss_sanitize_mwc_upper(SimpleRandomKISS_t * p_kiss)
+{
+    uint32_t    state_orig;
+    uint32_t    temp;
+
+    state_orig = p_kiss->mwc_upper;
+    temp = state_orig;
+    /* The following is equivalent to % 0x9068FFFF, without using modulo
+     * operation which may be expensive on embedded targets. For
+     * uint32_t and this divisor, we only need 'if' rather than 'while'. */
+    if (temp >= UINT32_C(0x9068FFFF))
+        temp -= UINT32_C(0x9068FFFF);
+    if (temp == 0)
+    {
+        /* Any integer multiple of 0x9068FFFF, including 0, is a bad state.
+         * Use an alternate state value by inverting the original value. */
+        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
+        if (temp >= UINT32_C(0x9068FFFF))
+            temp -= UINT32_C(0x9068FFFF);
+    }
+    p_kiss->mwc_upper = temp;
+}
+
+/* The good state values are all modulo 0x9068FFFF. Values above that would
+ * jump to a corresponding good state value on the first "next" operation.
+ * Any integer multiple of 0x464FFFFF, including 0, is a bad state.
+ */
+static inline void _simplerandom_kiss_sanitize_mwc_lower(SimpleRandomKISS_t * p_kiss)
+{
+    uint32_t    state_orig;
+    uint32_t    temp;
+
+    state_orig = p_kiss->mwc_lower;
+    temp = state_orig;
+    /* The following is equivalent to % 0x464FFFFF, without using modulo
+     * operation which may be expensive on embedded targets. For
+     * uint32_t and this divisor, it may loop up to 3 times. */
+    while (temp >= UINT32_C(0x464FFFFF))
+        temp -= UINT32_C(0x464FFFFF);
+    if (temp == 0)
+    {
+        /* Any integer multiple of 0x464FFFFF, including 0, is a bad state.
+         * Use an alternate state value by inverting the original value. */
+        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
+        while (temp >= UINT32_C(0x464FFFFF))
+            temp -= UINT32_C(0x464FFFFF);
+    }
+
+    p_kiss->mwc_lower = temp;
+}
+
+static inline void _simplerandom_kiss_sanitize_shr3(SimpleRandomKISS_t * p_kiss)
+{
+    /* Zero is a bad state value for SHR3. */
+    if (p_kiss->shr3 == 0)
+    {
+        p_kiss->shr3 = UINT32_C(0xFFFFFFFF);
+    }
+}
+
+SIMPLERANDOM_INLINE_API void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss)
+{
+    _simplerandom_kiss_sanitize_mwc_upper(p_kiss);
+    _simplerandom_kiss_sanitize_mwc_lower(p_kiss);
+    /* No sanitize needed for Cong, because all state values are valid. */
+    _simplerandom_kiss_sanitize_shr3(p_kiss);
+}
+
+static inline void _simplerandom_kiss_next_mwc_upper(SimpleRandomKISS_t * p_kiss)
+{
+    p_kiss->mwc_upper = 36969u * (p_kiss->mwc_upper & 0xFFFFu) + (p_kiss->mwc_upper >> 16u);
+}
+
+static inline void _simplerandom_kiss_next_mwc_lower(SimpleRandomKISS_t * p_kiss)
+{
+    p_kiss->mwc_lower = 18000u * (p_kiss->mwc_lower & 0xFFFFu) + (p_kiss->mwc_lower >> 16u);
+}
+
+static inline void _simplerandom_kiss_next_cong(SimpleRandomKISS_t * p_kiss)
+{
+    p_kiss->cong = UINT32_C(69069) * p_kiss->cong + 12345u;
+}
+
+static inline void _simplerandom_kiss_next_shr3(SimpleRandomKISS_t * p_kiss)
+{
+    uint32_t    shr3;
+
+    shr3 = p_kiss->shr3;
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 5);
+    p_kiss->shr3 = shr3;
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss)
+{
+    _simplerandom_kiss_next_mwc_upper(p_kiss);
+    _simplerandom_kiss_next_mwc_lower(p_kiss);
+    _simplerandom_kiss_next_cong(p_kiss);
+    _simplerandom_kiss_next_shr3(p_kiss);
+    return kiss_current(p_kiss);
+}
+
+
+#ifdef UINT64_C
+
+/*********
+ * MWC64
+ ********/
+
+SIMPLERANDOM_INLINE_API void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc)
+{
+    uint64_t    state64_orig;
+    uint64_t    temp64;
+    bool        was_changed = false;
+
+    state64_orig = ((uint64_t)p_mwc->mwc_upper << 32u) + p_mwc->mwc_lower;
+    temp64 = state64_orig;
+    if (temp64 >= UINT64_C(0x29A65EACFFFFFFFF))
+    {
+        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
+        was_changed = true;
+    }
+    if (temp64 == 0)
+    {
+        /* Invert both upper and lower to get a good seed. */
+        temp64 = state64_orig;
+        temp64 ^= UINT64_C(0xFFFFFFFFFFFFFFFF);
+        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
+        was_changed = true;
+    }
+    if (was_changed)
+    {
+        p_mwc->mwc_upper = (uint32_t)(temp64 >> 32u);
+        p_mwc->mwc_lower = (uint32_t)temp64;
+    }
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc)
+{
+    uint64_t    mwc64;
+
+
+    mwc64 = UINT64_C(698769069) * p_mwc->mwc_lower + p_mwc->mwc_upper;
+    p_mwc->mwc_upper = (mwc64 >> 32u);
+    p_mwc->mwc_lower = (uint32_t)mwc64;
+
+    return (uint32_t)mwc64;
+}
+
+
+/*********
+ * KISS2
+ ********/
+
+static inline void _simplerandom_kiss2_sanitize_mwc64(SimpleRandomKISS2_t * p_kiss2)
+{
+    uint64_t    state64_orig;
+    uint64_t    temp64;
+    bool        was_changed = false;
+
+    state64_orig = ((uint64_t)p_kiss2->mwc_upper << 32u) + p_kiss2->mwc_lower;
+    temp64 = state64_orig;
+    if (temp64 >= UINT64_C(0x29A65EACFFFFFFFF))
+    {
+        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
+        was_changed = true;
+    }
+    if (temp64 == 0)
+    {
+        /* Invert both upper and lower to get a good seed. */
+        temp64 = state64_orig;
+        temp64 ^= UINT64_C(0xFFFFFFFFFFFFFFFF);
+        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
+        was_changed = true;
+    }
+    if (was_changed)
+    {
+        p_kiss2->mwc_upper = (uint32_t)(temp64 >> 32u);
+        p_kiss2->mwc_lower = (uint32_t)temp64;
+    }
+}
+
+static inline void _simplerandom_kiss2_sanitize_shr3(SimpleRandomKISS2_t * p_kiss2)
+{
+    /* Zero is a bad state value for SHR3. */
+    if (p_kiss2->shr3 == 0)
+    {
+        p_kiss2->shr3 = UINT32_C(0xFFFFFFFF);
+    }
+}
+
+SIMPLERANDOM_INLINE_API void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2)
+{
+    _simplerandom_kiss2_sanitize_mwc64(p_kiss2);
+    /* No sanitize needed for Cong, because all state values are valid. */
+    _simplerandom_kiss2_sanitize_shr3(p_kiss2);
+}
+
+static inline void _simplerandom_kiss2_next_mwc64(SimpleRandomKISS2_t * p_kiss2)
+{
+    uint64_t    mwc64;
+
+    mwc64 = UINT64_C(698769069) * p_kiss2->mwc_lower + p_kiss2->mwc_upper;
+    p_kiss2->mwc_upper = (mwc64 >> 32u);
+    p_kiss2->mwc_lower = (uint32_t)mwc64;
+}
+
+static inline void _simplerandom_kiss2_next_cong(SimpleRandomKISS2_t * p_kiss2)
+{
+    p_kiss2->cong = UINT32_C(69069) * p_kiss2->cong + 12345u;
+}
+
+static inline void _simplerandom_kiss2_next_shr3(SimpleRandomKISS2_t * p_kiss2)
+{
+    uint32_t    shr3;
+
+    shr3 = p_kiss2->shr3;
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 5);
+    p_kiss2->shr3 = shr3;
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2)
+{
+    _simplerandom_kiss2_next_mwc64(p_kiss2);
+    _simplerandom_kiss2_next_cong(p_kiss2);
+    _simplerandom_kiss2_next_shr3(p_kiss2);
+    return kiss2_current(p_kiss2);
+}
+
+
+#endif /* defined(UINT64_C) */
+
+
+/*********
+ * LFSR113
+ ********/
+
+/* For most simplerandom generators, sanitise functions are used for both
+ * seeding and for sanitising the mix function results. But for LFSR generators
+ * with a more complex seeding function, the sanitise functions are specified
+ * separately, and are relatively simple compared to the seeding function.
+ */
+static inline void _simplerandom_lfsr113_sanitize_z1(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr113->z1;
+    if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
+    {
+        p_lfsr113->z1 = ~working_seed;
+    }
+}
+
+static inline void _simplerandom_lfsr113_sanitize_z2(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr113->z2;
+    if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
+    {
+        p_lfsr113->z2 = ~working_seed;
+    }
+}
+
+static inline void _simplerandom_lfsr113_sanitize_z3(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr113->z3;
+    if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
+    {
+        p_lfsr113->z3 = ~working_seed;
+    }
+}
+
+static inline void _simplerandom_lfsr113_sanitize_z4(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr113->z4;
+    if (working_seed < SIMPLERANDOM_LFSR_Z4_MIN_VALUE)
+    {
+        p_lfsr113->z4 = ~working_seed;
+    }
+}
+
+SIMPLERANDOM_INLINE_API void simplerandom_lfsr113_sanitize(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    _simplerandom_lfsr113_sanitize_z1(p_lfsr113);
+    _simplerandom_lfsr113_sanitize_z2(p_lfsr113);
+    _simplerandom_lfsr113_sanitize_z3(p_lfsr113);
+    _simplerandom_lfsr113_sanitize_z4(p_lfsr113);
+}
+
+static inline void _simplerandom_lfsr113_next_z1(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    b;
+    uint32_t    z1;
+
+    z1 = p_lfsr113->z1;
+    b  = ((z1 << 6) ^ z1) >> 13;
+    z1 = ((z1 & UINT32_C(0xFFFFFFFE)) << 18) ^ b;
+    p_lfsr113->z1 = z1;
+}
+
+static inline void _simplerandom_lfsr113_next_z2(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    b;
+    uint32_t    z2;
+
+    z2 = p_lfsr113->z2;
+    b  = ((z2 << 2) ^ z2) >> 27;
+    z2 = ((z2 & UINT32_C(0xFFFFFFF8)) << 2) ^ b;
+    p_lfsr113->z2 = z2;
+}
+
+static inline void _simplerandom_lfsr113_next_z3(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    b;
+    uint32_t    z3;
+
+    z3 = p_lfsr113->z3;
+    b  = ((z3 << 13) ^ z3) >> 21;
+    z3 = ((z3 & UINT32_C(0xFFFFFFF0)) << 7) ^ b;
+    p_lfsr113->z3 = z3;
+}
+
+static inline void _simplerandom_lfsr113_next_z4(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    uint32_t    b;
+    uint32_t    z4;
+
+    z4 = p_lfsr113->z4;
+    b  = ((z4 << 3) ^ z4) >> 12;
+    z4 = ((z4 & UINT32_C(0xFFFFFF80)) << 13) ^ b;
+    p_lfsr113->z4 = z4;
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
+{
+    _simplerandom_lfsr113_next_z1(p_lfsr113);
+    _simplerandom_lfsr113_next_z2(p_lfsr113);
+    _simplerandom_lfsr113_next_z3(p_lfsr113);
+    _simplerandom_lfsr113_next_z4(p_lfsr113);
+    return lfsr113_current(p_lfsr113);
+}
+
+
+/*********
+ * LFSR88
+ ********/
+
+static inline void _simplerandom_lfsr88_sanitize_z1(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr88->z1;
+    if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
+    {
+        p_lfsr88->z1 = ~working_seed;
+    }
+}
+
+static inline void _simplerandom_lfsr88_sanitize_z2(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr88->z2;
+    if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
+    {
+        p_lfsr88->z2 = ~working_seed;
+    }
+}
+
+static inline void _simplerandom_lfsr88_sanitize_z3(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    working_seed;
+
+    working_seed = p_lfsr88->z3;
+    if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
+    {
+        p_lfsr88->z3 = ~working_seed;
+    }
+}
+
+SIMPLERANDOM_INLINE_API void simplerandom_lfsr88_sanitize(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    _simplerandom_lfsr88_sanitize_z1(p_lfsr88);
+    _simplerandom_lfsr88_sanitize_z2(p_lfsr88);
+    _simplerandom_lfsr88_sanitize_z3(p_lfsr88);
+}
+
+static inline void _simplerandom_lfsr88_next_z1(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    b;
+    uint32_t    z1;
+
+    z1 = p_lfsr88->z1;
+    b  = ((z1 << 13) ^ z1) >> 19;
+    z1 = ((z1 & UINT32_C(0xFFFFFFFE)) << 12) ^ b;
+    p_lfsr88->z1 = z1;
+}
+
+static inline void _simplerandom_lfsr88_next_z2(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    b;
+    uint32_t    z2;
+
+    z2 = p_lfsr88->z2;
+    b  = ((z2 << 2) ^ z2) >> 25;
+    z2 = ((z2 & UINT32_C(0xFFFFFFF8)) << 4) ^ b;
+    p_lfsr88->z2 = z2;
+}
+
+static inline void _simplerandom_lfsr88_next_z3(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    uint32_t    b;
+    uint32_t    z3;
+
+    z3 = p_lfsr88->z3;
+    b  = ((z3 << 3) ^ z3) >> 11;
+    z3 = ((z3 & UINT32_C(0xFFFFFFF0)) << 17) ^ b;
+    p_lfsr88->z3 = z3;
+}
+
+SIMPLERANDOM_INLINE_API uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
+{
+    _simplerandom_lfsr88_next_z1(p_lfsr88);
+    _simplerandom_lfsr88_next_z2(p_lfsr88);
+    _simplerandom_lfsr88_next_z3(p_lfsr88);
+    return lfsr88_current(p_lfsr88);
+}
+
+#endif /* !defined(_SIMPLERANDOM_INLINE_H) */
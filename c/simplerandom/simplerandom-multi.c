@@ -0,0 +1,730 @@
+/*
+ * simplerandom-multi.c
+ *
+ * Simple Pseudo-random Number Generators -- multi-lane generators.
+ *
+ * These run several independent streams of a generator side by side. The
+ * state is stored as structure-of-arrays, so that the same step of all lanes
+ * can be done at once with SIMD instructions. Each lane gives exactly the same
+ * sequence as the equivalent single-stream generator.
+ *
+ * The "fill" functions have versions for several instruction sets: generic
+ * (SSE2 on x86-64), AVX2 and AVX-512. The AVX2 and AVX-512 versions are built
+ * with 'target' function attributes, so the library doesn't need to be
+ * compiled with -march or -mavx2, and the fastest version that the CPU
+ * supports is chosen once, when the program or library is loaded. See
+ * multikernels.h.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+#include "multikernels.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(MULTI_HAVE_AVX2) || defined(MULTI_HAVE_AVX512)
+#include <immintrin.h>
+#endif
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define KISS2_MWC64_MULT        698769069
+
+#if defined(SIMPLERANDOM_X86_KERNELS)
+#define TARGET_AVX2             __attribute__((target("avx2")))
+#define TARGET_AVX512           __attribute__((target("avx512f,avx2")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef void (*LFSR113x8FillFn_t)(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out);
+#ifdef UINT64_C
+typedef void (*KISS2x4FillFn_t)(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out);
+typedef void (*KISS2x8FillFn_t)(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out);
+#endif
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*********
+ * LFSR113x8
+ ********/
+
+void simplerandom_lfsr113x8_seed_streams(SimpleRandomLFSR113x8_t * p_lfsr113x8, const SimpleRandomLFSR113_t * p_lfsr113, uintmax_t stride)
+{
+    SimpleRandomLFSR113_t   lfsr113[SIMPLERANDOM_LFSR113X8_LANES];
+    size_t                  lane;
+
+    simplerandom_lfsr113_split(p_lfsr113, lfsr113, SIMPLERANDOM_LFSR113X8_LANES, stride);
+    for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; ++lane)
+    {
+        simplerandom_lfsr113x8_set_lane(p_lfsr113x8, lane, &lfsr113[lane]);
+    }
+}
+
+void simplerandom_lfsr113x8_set_lane(SimpleRandomLFSR113x8_t * p_lfsr113x8, size_t lane, const SimpleRandomLFSR113_t * p_lfsr113)
+{
+    if (lane < SIMPLERANDOM_LFSR113X8_LANES)
+    {
+        p_lfsr113x8->z1[lane] = p_lfsr113->z1;
+        p_lfsr113x8->z2[lane] = p_lfsr113->z2;
+        p_lfsr113x8->z3[lane] = p_lfsr113->z3;
+        p_lfsr113x8->z4[lane] = p_lfsr113->z4;
+    }
+}
+
+void simplerandom_lfsr113x8_get_lane(const SimpleRandomLFSR113x8_t * p_lfsr113x8, size_t lane, SimpleRandomLFSR113_t * p_lfsr113)
+{
+    if (lane < SIMPLERANDOM_LFSR113X8_LANES)
+    {
+        p_lfsr113->z1 = p_lfsr113x8->z1[lane];
+        p_lfsr113->z2 = p_lfsr113x8->z2[lane];
+        p_lfsr113->z3 = p_lfsr113x8->z3[lane];
+        p_lfsr113->z4 = p_lfsr113x8->z4[lane];
+    }
+}
+
+/* Generic implementation. The lane loops have no dependencies between lanes,
+ * so the compiler can vectorise them for the baseline instruction set.
+ */
+void lfsr113x8_fill_generic(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR113x8_t lfsr113x8;
+    uint32_t                current[SIMPLERANDOM_LFSR113X8_LANES];
+    uint32_t                b;
+    uint32_t                z;
+    size_t                  lane;
+    size_t                  num_copy;
+
+    lfsr113x8 = *p_lfsr113x8;
+    while (num_out)
+    {
+        for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; ++lane)
+        {
+            z = lfsr113x8.z1[lane];
+            b = ((z << 6) ^ z) >> 13;
+            lfsr113x8.z1[lane] = ((z & UINT32_C(0xFFFFFFFE)) << 18) ^ b;
+
+            z = lfsr113x8.z2[lane];
+            b = ((z << 2) ^ z) >> 27;
+            lfsr113x8.z2[lane] = ((z & UINT32_C(0xFFFFFFF8)) << 2) ^ b;
+
+            z = lfsr113x8.z3[lane];
+            b = ((z << 13) ^ z) >> 21;
+            lfsr113x8.z3[lane] = ((z & UINT32_C(0xFFFFFFF0)) << 7) ^ b;
+
+            z = lfsr113x8.z4[lane];
+            b = ((z << 3) ^ z) >> 12;
+            lfsr113x8.z4[lane] = ((z & UINT32_C(0xFFFFFF80)) << 13) ^ b;
+
+            current[lane] = lfsr113x8.z1[lane] ^ lfsr113x8.z2[lane] ^ lfsr113x8.z3[lane] ^ lfsr113x8.z4[lane];
+        }
+
+        num_copy = (num_out < SIMPLERANDOM_LFSR113X8_LANES) ? num_out : SIMPLERANDOM_LFSR113X8_LANES;
+        for (lane = 0; lane < num_copy; ++lane)
+        {
+            *p_out++ = current[lane];
+        }
+        num_out -= num_copy;
+    }
+    *p_lfsr113x8 = lfsr113x8;
+}
+
+#ifdef MULTI_HAVE_AVX2
+
+/* One LFSR113 component step for all 8 lanes. This is the same calculation as
+ * _simplerandom_lfsr113_next_z1() etc in simplerandom-inline.h:
+ *     b = ((z << shift_a) ^ z) >> shift_b;
+ *     z = ((z & mask) << shift_c) ^ b;
+ */
+#define LFSR113X8_STEP(Z, SHIFT_A, SHIFT_B, MASK, SHIFT_C)                     \
+    do {                                                                    \
+        __m256i b;                                                          \
+        b = _mm256_srli_epi32(_mm256_xor_si256(_mm256_slli_epi32((Z), (SHIFT_A)), (Z)), (SHIFT_B)); \
+        (Z) = _mm256_xor_si256(_mm256_slli_epi32(_mm256_and_si256((Z), (MASK)), (SHIFT_C)), b); \
+    } while (0)
+
+TARGET_AVX2
+void lfsr113x8_fill_avx2(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out)
+{
+    __m256i     z1, z2, z3, z4;
+    __m256i     mask1, mask2, mask3, mask4;
+    __m256i     current;
+    uint32_t    last[SIMPLERANDOM_LFSR113X8_LANES];
+    size_t      i;
+
+    mask1 = _mm256_set1_epi32((int32_t)UINT32_C(0xFFFFFFFE));
+    mask2 = _mm256_set1_epi32((int32_t)UINT32_C(0xFFFFFFF8));
+    mask3 = _mm256_set1_epi32((int32_t)UINT32_C(0xFFFFFFF0));
+    mask4 = _mm256_set1_epi32((int32_t)UINT32_C(0xFFFFFF80));
+
+    z1 = _mm256_loadu_si256((const __m256i *)p_lfsr113x8->z1);
+    z2 = _mm256_loadu_si256((const __m256i *)p_lfsr113x8->z2);
+    z3 = _mm256_loadu_si256((const __m256i *)p_lfsr113x8->z3);
+    z4 = _mm256_loadu_si256((const __m256i *)p_lfsr113x8->z4);
+
+    while (num_out)
+    {
+        LFSR113X8_STEP(z1, 6, 13, mask1, 18);
+        LFSR113X8_STEP(z2, 2, 27, mask2, 2);
+        LFSR113X8_STEP(z3, 13, 21, mask3, 7);
+        LFSR113X8_STEP(z4, 3, 12, mask4, 13);
+        current = _mm256_xor_si256(_mm256_xor_si256(z1, z2), _mm256_xor_si256(z3, z4));
+
+        if (num_out >= SIMPLERANDOM_LFSR113X8_LANES)
+        {
+            _mm256_storeu_si256((__m256i *)p_out, current);
+            p_out += SIMPLERANDOM_LFSR113X8_LANES;
+            num_out -= SIMPLERANDOM_LFSR113X8_LANES;
+        }
+        else
+        {
+            /* Final partial set of values. */
+            _mm256_storeu_si256((__m256i *)last, current);
+            for (i = 0; i < num_out; ++i)
+            {
+                p_out[i] = last[i];
+            }
+            num_out = 0;
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)p_lfsr113x8->z1, z1);
+    _mm256_storeu_si256((__m256i *)p_lfsr113x8->z2, z2);
+    _mm256_storeu_si256((__m256i *)p_lfsr113x8->z3, z3);
+    _mm256_storeu_si256((__m256i *)p_lfsr113x8->z4, z4);
+}
+
+#endif /* defined(MULTI_HAVE_AVX2) */
+
+/* The kernel used by simplerandom_lfsr113x8_fill(). See
+ * multi_choose_kernels(). */
+#if defined(MULTI_HAVE_AVX2) && !defined(SIMPLERANDOM_X86_KERNELS)
+static LFSR113x8FillFn_t    lfsr113x8_fill_kernel = lfsr113x8_fill_avx2;
+#else
+static LFSR113x8FillFn_t    lfsr113x8_fill_kernel = lfsr113x8_fill_generic;
+#endif
+
+void simplerandom_lfsr113x8_fill(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out, size_t num_out)
+{
+    if (p_out != NULL)
+    {
+        lfsr113x8_fill_kernel(p_lfsr113x8, p_out, num_out);
+    }
+}
+
+void simplerandom_lfsr113x8_next(SimpleRandomLFSR113x8_t * p_lfsr113x8, uint32_t * p_out)
+{
+    simplerandom_lfsr113x8_fill(p_lfsr113x8, p_out, SIMPLERANDOM_LFSR113X8_LANES);
+}
+
+
+
+#ifdef UINT64_C
+
+/*********
+ * KISS2x4, KISS2x8
+ ********/
+
+/* Define the functions of a multi-lane KISS2 generator that don't depend on
+ * the instruction set: simplerandom_kiss2xN_seed_streams(),
+ * simplerandom_kiss2xN_set_lane(), simplerandom_kiss2xN_get_lane() and
+ * simplerandom_kiss2xN_next(). */
+#define SIMPLERANDOM_KISS2XN_FUNCTIONS(NAME, TYPE, LANES)                       \
+void simplerandom_##NAME##_seed_streams(TYPE * p_rng, const SimpleRandomKISS2_t * p_kiss2, uintmax_t stride) \
+{                                                                           \
+    SimpleRandomKISS2_t     kiss2[LANES];                                   \
+    size_t                  lane;                                           \
+                                                                            \
+    simplerandom_kiss2_split(p_kiss2, kiss2, LANES, stride);                \
+    for (lane = 0; lane < LANES; ++lane)                                    \
+    {                                                                       \
+        simplerandom_##NAME##_set_lane(p_rng, lane, &kiss2[lane]);          \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_set_lane(TYPE * p_rng, size_t lane, const SimpleRandomKISS2_t * p_kiss2) \
+{                                                                           \
+    if (lane < LANES)                                                       \
+    {                                                                       \
+        p_rng->mwc_upper[lane] = p_kiss2->mwc_upper;                        \
+        p_rng->mwc_lower[lane] = p_kiss2->mwc_lower;                        \
+        p_rng->cong[lane] = p_kiss2->cong;                                  \
+        p_rng->shr3[lane] = p_kiss2->shr3;                                  \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_get_lane(const TYPE * p_rng, size_t lane, SimpleRandomKISS2_t * p_kiss2) \
+{                                                                           \
+    if (lane < LANES)                                                       \
+    {                                                                       \
+        p_kiss2->mwc_upper = p_rng->mwc_upper[lane];                        \
+        p_kiss2->mwc_lower = p_rng->mwc_lower[lane];                        \
+        p_kiss2->cong = p_rng->cong[lane];                                  \
+        p_kiss2->shr3 = p_rng->shr3[lane];                                  \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_next(TYPE * p_rng, uint32_t * p_out)             \
+{                                                                           \
+    simplerandom_##NAME##_fill(p_rng, p_out, LANES);                        \
+}
+
+SIMPLERANDOM_KISS2XN_FUNCTIONS(kiss2x4, SimpleRandomKISS2x4_t, SIMPLERANDOM_KISS2X4_LANES)
+SIMPLERANDOM_KISS2XN_FUNCTIONS(kiss2x8, SimpleRandomKISS2x8_t, SIMPLERANDOM_KISS2X8_LANES)
+
+#if defined(__SSE2__)
+
+/* KISS2 step for 4 lanes with SSE2. The MWC of lanes 0-1 and lanes 2-3 are in
+ * two registers, as 64-bit elements with mwc_lower in the low half. SSE2 has
+ * no 32-bit multiplication with a 32-bit result, so Cong multiplies the even
+ * and odd lanes separately with PMULUDQ, and takes the low halves.
+ */
+static inline __m128i kiss2x4_step_sse2(__m128i * p_mwc64_0, __m128i * p_mwc64_2, __m128i * p_cong, __m128i * p_shr3)
+{
+    __m128i     mwc_mult = _mm_set1_epi32(KISS2_MWC64_MULT);
+    __m128i     cong_mult = _mm_set1_epi32(69069);
+    __m128i     even;
+    __m128i     odd;
+    __m128i     cong;
+    __m128i     shr3;
+    __m128i     low_0;
+    __m128i     low_2;
+
+    *p_mwc64_0 = _mm_add_epi64(_mm_mul_epu32(*p_mwc64_0, mwc_mult), _mm_srli_epi64(*p_mwc64_0, 32));
+    *p_mwc64_2 = _mm_add_epi64(_mm_mul_epu32(*p_mwc64_2, mwc_mult), _mm_srli_epi64(*p_mwc64_2, 32));
+
+    even = _mm_shuffle_epi32(_mm_mul_epu32(*p_cong, cong_mult), _MM_SHUFFLE(0, 0, 2, 0));
+    odd = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(*p_cong, 32), cong_mult), _MM_SHUFFLE(0, 0, 2, 0));
+    cong = _mm_add_epi32(_mm_unpacklo_epi32(even, odd), _mm_set1_epi32(12345));
+    *p_cong = cong;
+
+    shr3 = *p_shr3;
+    shr3 = _mm_xor_si128(shr3, _mm_slli_epi32(shr3, 13));
+    shr3 = _mm_xor_si128(shr3, _mm_srli_epi32(shr3, 17));
+    shr3 = _mm_xor_si128(shr3, _mm_slli_epi32(shr3, 5));
+    *p_shr3 = shr3;
+
+    low_0 = _mm_shuffle_epi32(*p_mwc64_0, _MM_SHUFFLE(3, 1, 2, 0));
+    low_2 = _mm_shuffle_epi32(*p_mwc64_2, _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi64(low_0, low_2), cong), shr3);
+}
+
+/* SSE2 implementation of the generic fill functions, for 'lanes' lanes, a
+ * multiple of 4 up to SIMPLERANDOM_KISS2X8_LANES. */
+static inline void kiss2xn_fill_sse2(uint32_t * p_mwc_upper, uint32_t * p_mwc_lower, uint32_t * p_cong, uint32_t * p_shr3,
+                                     size_t lanes, uint32_t * p_out, size_t num_out)
+{
+    __m128i     mwc64[SIMPLERANDOM_KISS2X8_LANES / 2u];
+    __m128i     cong[SIMPLERANDOM_KISS2X8_LANES / 4u];
+    __m128i     shr3[SIMPLERANDOM_KISS2X8_LANES / 4u];
+    __m128i     upper;
+    __m128i     lower;
+    uint32_t    current[SIMPLERANDOM_KISS2X8_LANES];
+    size_t      group;
+    size_t      i;
+
+    for (group = 0; group < lanes / 4u; ++group)
+    {
+        upper = _mm_loadu_si128((const __m128i *)&p_mwc_upper[4u * group]);
+        lower = _mm_loadu_si128((const __m128i *)&p_mwc_lower[4u * group]);
+        mwc64[2u * group] = _mm_unpacklo_epi32(lower, upper);
+        mwc64[2u * group + 1u] = _mm_unpackhi_epi32(lower, upper);
+        cong[group] = _mm_loadu_si128((const __m128i *)&p_cong[4u * group]);
+        shr3[group] = _mm_loadu_si128((const __m128i *)&p_shr3[4u * group]);
+    }
+
+    while (num_out)
+    {
+        if (num_out >= lanes)
+        {
+            for (group = 0; group < lanes / 4u; ++group)
+            {
+                _mm_storeu_si128((__m128i *)&p_out[4u * group],
+                                 kiss2x4_step_sse2(&mwc64[2u * group], &mwc64[2u * group + 1u], &cong[group], &shr3[group]));
+            }
+            p_out += lanes;
+            num_out -= lanes;
+        }
+        else
+        {
+            /* Final partial set of values. */
+            for (group = 0; group < lanes / 4u; ++group)
+            {
+                _mm_storeu_si128((__m128i *)&current[4u * group],
+                                 kiss2x4_step_sse2(&mwc64[2u * group], &mwc64[2u * group + 1u], &cong[group], &shr3[group]));
+            }
+            for (i = 0; i < num_out; ++i)
+            {
+                p_out[i] = current[i];
+            }
+            num_out = 0;
+        }
+    }
+
+    for (group = 0; group < lanes / 4u; ++group)
+    {
+        lower = _mm_shuffle_epi32(mwc64[2u * group], _MM_SHUFFLE(3, 1, 2, 0));
+        upper = _mm_shuffle_epi32(mwc64[2u * group + 1u], _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)&p_mwc_upper[4u * group], _mm_unpackhi_epi64(lower, upper));
+        _mm_storeu_si128((__m128i *)&p_mwc_lower[4u * group], _mm_unpacklo_epi64(lower, upper));
+        _mm_storeu_si128((__m128i *)&p_cong[4u * group], cong[group]);
+        _mm_storeu_si128((__m128i *)&p_shr3[4u * group], shr3[group]);
+    }
+}
+
+#else /* !defined(__SSE2__) */
+
+/* Portable implementation of the generic fill functions, for 'lanes' lanes.
+ */
+static void kiss2xn_fill_portable(uint32_t * p_mwc_upper, uint32_t * p_mwc_lower, uint32_t * p_cong, uint32_t * p_shr3,
+                                  size_t lanes, uint32_t * p_out, size_t num_out)
+{
+    uint64_t    mwc64[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t    cong[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t    shr3[SIMPLERANDOM_KISS2X8_LANES];
+    uint32_t    current[SIMPLERANDOM_KISS2X8_LANES];
+    size_t      lane;
+    size_t      num_copy;
+
+    for (lane = 0; lane < lanes; ++lane)
+    {
+        mwc64[lane] = ((uint64_t)p_mwc_upper[lane] << 32u) | p_mwc_lower[lane];
+        cong[lane] = p_cong[lane];
+        shr3[lane] = p_shr3[lane];
+    }
+    while (num_out)
+    {
+        for (lane = 0; lane < lanes; ++lane)
+        {
+            mwc64[lane] = (uint64_t)KISS2_MWC64_MULT * (uint32_t)mwc64[lane] + (mwc64[lane] >> 32u);
+            cong[lane] = UINT32_C(69069) * cong[lane] + 12345u;
+            shr3[lane] ^= (shr3[lane] << 13);
+            shr3[lane] ^= (shr3[lane] >> 17);
+            shr3[lane] ^= (shr3[lane] << 5);
+            current[lane] = (uint32_t)mwc64[lane] + cong[lane] + shr3[lane];
+        }
+
+        num_copy = (num_out < lanes) ? num_out : lanes;
+        for (lane = 0; lane < num_copy; ++lane)
+        {
+            *p_out++ = current[lane];
+        }
+        num_out -= num_copy;
+    }
+    for (lane = 0; lane < lanes; ++lane)
+    {
+        p_mwc_upper[lane] = (uint32_t)(mwc64[lane] >> 32u);
+        p_mwc_lower[lane] = (uint32_t)mwc64[lane];
+        p_cong[lane] = cong[lane];
+        p_shr3[lane] = shr3[lane];
+    }
+}
+
+#endif /* defined(__SSE2__) */
+
+void kiss2x4_fill_generic(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out)
+{
+#if defined(__SSE2__)
+    kiss2xn_fill_sse2(p_kiss2x4->mwc_upper, p_kiss2x4->mwc_lower, p_kiss2x4->cong, p_kiss2x4->shr3,
+                      SIMPLERANDOM_KISS2X4_LANES, p_out, num_out);
+#else
+    kiss2xn_fill_portable(p_kiss2x4->mwc_upper, p_kiss2x4->mwc_lower, p_kiss2x4->cong, p_kiss2x4->shr3,
+                          SIMPLERANDOM_KISS2X4_LANES, p_out, num_out);
+#endif
+}
+
+void kiss2x8_fill_generic(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out)
+{
+#if defined(__SSE2__)
+    kiss2xn_fill_sse2(p_kiss2x8->mwc_upper, p_kiss2x8->mwc_lower, p_kiss2x8->cong, p_kiss2x8->shr3,
+                      SIMPLERANDOM_KISS2X8_LANES, p_out, num_out);
+#else
+    kiss2xn_fill_portable(p_kiss2x8->mwc_upper, p_kiss2x8->mwc_lower, p_kiss2x8->cong, p_kiss2x8->shr3,
+                          SIMPLERANDOM_KISS2X8_LANES, p_out, num_out);
+#endif
+}
+
+#ifdef MULTI_HAVE_AVX2
+
+/* KISS2 steps for 4 lanes. The 64-bit MWC of each lane is in a 64-bit
+ * element, with mwc_lower in the low half, so the step
+ *     mwc64 = 698769069 * mwc_lower + mwc_upper;
+ * is a VPMULUDQ of the low halves, plus the high halves shifted down.
+ */
+TARGET_AVX2
+static inline __m256i kiss2x4_next_mwc64(__m256i mwc64)
+{
+    return _mm256_add_epi64(_mm256_mul_epu32(mwc64, _mm256_set1_epi64x(KISS2_MWC64_MULT)),
+                            _mm256_srli_epi64(mwc64, 32));
+}
+
+TARGET_AVX2
+static inline __m256i kiss2x8_next_cong(__m256i cong)
+{
+    return _mm256_add_epi32(_mm256_mullo_epi32(cong, _mm256_set1_epi32(69069)), _mm256_set1_epi32(12345));
+}
+
+TARGET_AVX2
+static inline __m256i kiss2x8_next_shr3(__m256i shr3)
+{
+    shr3 = _mm256_xor_si256(shr3, _mm256_slli_epi32(shr3, 13));
+    shr3 = _mm256_xor_si256(shr3, _mm256_srli_epi32(shr3, 17));
+    return _mm256_xor_si256(shr3, _mm256_slli_epi32(shr3, 5));
+}
+
+/* Load/store 4 lanes of MWC state, to/from 64-bit elements. */
+TARGET_AVX2
+static inline __m256i kiss2x4_load_mwc64(const uint32_t * p_mwc_upper, const uint32_t * p_mwc_lower)
+{
+    __m256i     upper;
+    __m256i     lower;
+
+    upper = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)p_mwc_upper));
+    lower = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)p_mwc_lower));
+    return _mm256_or_si256(_mm256_slli_epi64(upper, 32), lower);
+}
+
+/* The low halves of the 64-bit elements, packed into the lower 128 bits. */
+TARGET_AVX2
+static inline __m128i kiss2x4_low_halves(__m256i mwc64)
+{
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(mwc64, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+}
+
+TARGET_AVX2
+static inline void kiss2x4_store_mwc64(__m256i mwc64, uint32_t * p_mwc_upper, uint32_t * p_mwc_lower)
+{
+    _mm_storeu_si128((__m128i *)p_mwc_upper, kiss2x4_low_halves(_mm256_srli_epi64(mwc64, 32)));
+    _mm_storeu_si128((__m128i *)p_mwc_lower, kiss2x4_low_halves(mwc64));
+}
+
+TARGET_AVX2
+void kiss2x4_fill_avx2(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out)
+{
+    __m256i     mwc64;
+    __m128i     cong;
+    __m128i     shr3;
+    __m128i     current;
+    uint32_t    last[SIMPLERANDOM_KISS2X4_LANES];
+    size_t      i;
+
+    mwc64 = kiss2x4_load_mwc64(p_kiss2x4->mwc_upper, p_kiss2x4->mwc_lower);
+    cong = _mm_loadu_si128((const __m128i *)p_kiss2x4->cong);
+    shr3 = _mm_loadu_si128((const __m128i *)p_kiss2x4->shr3);
+
+    while (num_out)
+    {
+        /* Cong and SHR3 for 4 lanes, in the lower half of 8-lane
+         * calculations. */
+        mwc64 = kiss2x4_next_mwc64(mwc64);
+        cong = _mm256_castsi256_si128(kiss2x8_next_cong(_mm256_castsi128_si256(cong)));
+        shr3 = _mm256_castsi256_si128(kiss2x8_next_shr3(_mm256_castsi128_si256(shr3)));
+        current = _mm_add_epi32(_mm_add_epi32(kiss2x4_low_halves(mwc64), cong), shr3);
+
+        if (num_out >= SIMPLERANDOM_KISS2X4_LANES)
+        {
+            _mm_storeu_si128((__m128i *)p_out, current);
+            p_out += SIMPLERANDOM_KISS2X4_LANES;
+            num_out -= SIMPLERANDOM_KISS2X4_LANES;
+        }
+        else
+        {
+            /* Final partial set of values. */
+            _mm_storeu_si128((__m128i *)last, current);
+            for (i = 0; i < num_out; ++i)
+            {
+                p_out[i] = last[i];
+            }
+            num_out = 0;
+        }
+    }
+
+    kiss2x4_store_mwc64(mwc64, p_kiss2x4->mwc_upper, p_kiss2x4->mwc_lower);
+    _mm_storeu_si128((__m128i *)p_kiss2x4->cong, cong);
+    _mm_storeu_si128((__m128i *)p_kiss2x4->shr3, shr3);
+}
+
+/* With AVX2, the MWC of lanes 0-3 and lanes 4-7 are in separate registers.
+ * Their two multiplications are independent, so they overlap in the
+ * pipeline. */
+TARGET_AVX2
+void kiss2x8_fill_avx2(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out)
+{
+    __m256i     mwc64_0;
+    __m256i     mwc64_4;
+    __m256i     cong;
+    __m256i     shr3;
+    __m256i     current;
+    uint32_t    last[SIMPLERANDOM_KISS2X8_LANES];
+    size_t      i;
+
+    mwc64_0 = kiss2x4_load_mwc64(&p_kiss2x8->mwc_upper[0], &p_kiss2x8->mwc_lower[0]);
+    mwc64_4 = kiss2x4_load_mwc64(&p_kiss2x8->mwc_upper[4], &p_kiss2x8->mwc_lower[4]);
+    cong = _mm256_loadu_si256((const __m256i *)p_kiss2x8->cong);
+    shr3 = _mm256_loadu_si256((const __m256i *)p_kiss2x8->shr3);
+
+    while (num_out)
+    {
+        mwc64_0 = kiss2x4_next_mwc64(mwc64_0);
+        mwc64_4 = kiss2x4_next_mwc64(mwc64_4);
+        cong = kiss2x8_next_cong(cong);
+        shr3 = kiss2x8_next_shr3(shr3);
+        current = _mm256_inserti128_si256(_mm256_castsi128_si256(kiss2x4_low_halves(mwc64_0)),
+                                          kiss2x4_low_halves(mwc64_4), 1);
+        current = _mm256_add_epi32(_mm256_add_epi32(current, cong), shr3);
+
+        if (num_out >= SIMPLERANDOM_KISS2X8_LANES)
+        {
+            _mm256_storeu_si256((__m256i *)p_out, current);
+            p_out += SIMPLERANDOM_KISS2X8_LANES;
+            num_out -= SIMPLERANDOM_KISS2X8_LANES;
+        }
+        else
+        {
+            /* Final partial set of values. */
+            _mm256_storeu_si256((__m256i *)last, current);
+            for (i = 0; i < num_out; ++i)
+            {
+                p_out[i] = last[i];
+            }
+            num_out = 0;
+        }
+    }
+
+    kiss2x4_store_mwc64(mwc64_0, &p_kiss2x8->mwc_upper[0], &p_kiss2x8->mwc_lower[0]);
+    kiss2x4_store_mwc64(mwc64_4, &p_kiss2x8->mwc_upper[4], &p_kiss2x8->mwc_lower[4]);
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->cong, cong);
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->shr3, shr3);
+}
+
+#endif /* defined(MULTI_HAVE_AVX2) */
+
+#ifdef MULTI_HAVE_AVX512
+
+/* With AVX-512, the MWC of all 8 lanes fits in one 512-bit register, and
+ * VPMOVQD packs the low halves of the 64-bit elements. */
+TARGET_AVX512
+void kiss2x8_fill_avx512(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out)
+{
+    __m512i     mwc64;
+    __m256i     cong;
+    __m256i     shr3;
+    __m256i     current;
+    uint32_t    last[SIMPLERANDOM_KISS2X8_LANES];
+    size_t      i;
+
+    mwc64 = _mm512_or_si512(
+                _mm512_slli_epi64(_mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)p_kiss2x8->mwc_upper)), 32),
+                _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)p_kiss2x8->mwc_lower)));
+    cong = _mm256_loadu_si256((const __m256i *)p_kiss2x8->cong);
+    shr3 = _mm256_loadu_si256((const __m256i *)p_kiss2x8->shr3);
+
+    while (num_out)
+    {
+        mwc64 = _mm512_add_epi64(_mm512_mul_epu32(mwc64, _mm512_set1_epi64(KISS2_MWC64_MULT)),
+                                 _mm512_srli_epi64(mwc64, 32));
+        cong = kiss2x8_next_cong(cong);
+        shr3 = kiss2x8_next_shr3(shr3);
+        current = _mm256_add_epi32(_mm256_add_epi32(_mm512_cvtepi64_epi32(mwc64), cong), shr3);
+
+        if (num_out >= SIMPLERANDOM_KISS2X8_LANES)
+        {
+            _mm256_storeu_si256((__m256i *)p_out, current);
+            p_out += SIMPLERANDOM_KISS2X8_LANES;
+            num_out -= SIMPLERANDOM_KISS2X8_LANES;
+        }
+        else
+        {
+            /* Final partial set of values. */
+            _mm256_storeu_si256((__m256i *)last, current);
+            for (i = 0; i < num_out; ++i)
+            {
+                p_out[i] = last[i];
+            }
+            num_out = 0;
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->mwc_upper, _mm512_cvtepi64_epi32(_mm512_srli_epi64(mwc64, 32)));
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->mwc_lower, _mm512_cvtepi64_epi32(mwc64));
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->cong, cong);
+    _mm256_storeu_si256((__m256i *)p_kiss2x8->shr3, shr3);
+}
+
+#endif /* defined(MULTI_HAVE_AVX512) */
+
+/* The kernels used by simplerandom_kiss2x4_fill() and
+ * simplerandom_kiss2x8_fill(). See multi_choose_kernels(). */
+#if defined(MULTI_HAVE_AVX2) && !defined(SIMPLERANDOM_X86_KERNELS)
+static KISS2x4FillFn_t      kiss2x4_fill_kernel = kiss2x4_fill_avx2;
+#else
+static KISS2x4FillFn_t      kiss2x4_fill_kernel = kiss2x4_fill_generic;
+#endif
+#if defined(MULTI_HAVE_AVX512) && !defined(SIMPLERANDOM_X86_KERNELS)
+static KISS2x8FillFn_t      kiss2x8_fill_kernel = kiss2x8_fill_avx512;
+#elif defined(MULTI_HAVE_AVX2) && !defined(SIMPLERANDOM_X86_KERNELS)
+static KISS2x8FillFn_t      kiss2x8_fill_kernel = kiss2x8_fill_avx2;
+#else
+static KISS2x8FillFn_t      kiss2x8_fill_kernel = kiss2x8_fill_generic;
+#endif
+
+void simplerandom_kiss2x4_fill(SimpleRandomKISS2x4_t * p_kiss2x4, uint32_t * p_out, size_t num_out)
+{
+    if (p_out != NULL)
+    {
+        kiss2x4_fill_kernel(p_kiss2x4, p_out, num_out);
+    }
+}
+
+void simplerandom_kiss2x8_fill(SimpleRandomKISS2x8_t * p_kiss2x8, uint32_t * p_out, size_t num_out)
+{
+    if (p_out != NULL)
+    {
+        kiss2x8_fill_kernel(p_kiss2x8, p_out, num_out);
+    }
+}
+
+#endif /* defined(UINT64_C) */
+
+
+#ifdef SIMPLERANDOM_X86_KERNELS
+
+/* Choose the fastest kernels that the CPU supports, once, when the program or
+ * library is loaded. Without run-time CPU checks, the kernels above are the
+ * fastest that the compile target supports. */
+CPU_FEATURES_INIT
+static void multi_choose_kernels(void)
+{
+    cpu_features_init();
+    if (multi_use_avx2())
+    {
+        lfsr113x8_fill_kernel = lfsr113x8_fill_avx2;
+#ifdef UINT64_C
+        kiss2x4_fill_kernel = kiss2x4_fill_avx2;
+        kiss2x8_fill_kernel = kiss2x8_fill_avx2;
+#endif
+    }
+#ifdef UINT64_C
+    if (multi_use_avx512())
+        kiss2x8_fill_kernel = kiss2x8_fill_avx512;
+#endif
+}
+
+#endif /* defined(SIMPLERANDOM_X86_KERNELS) */
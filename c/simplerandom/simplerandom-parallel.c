@@ -0,0 +1,186 @@
+/*
+ * simplerandom-parallel.c
+ *
+ * Simple Pseudo-random Number Generators -- parallel bulk fill.
+ *
+ * simplerandom_zzz_parallel_fill() splits the output array into one part per
+ * thread. Each thread gets a copy of the generator state, jumped ahead to the
+ * start of its part by simplerandom_zzz_split() (which is the same as
+ * simplerandom_zzz_discard(), but calculates the jump once for all threads),
+ * and fills its part with simplerandom_zzz_fill(). So the output is exactly
+ * the same as from one simplerandom_zzz_fill() call. The last part ends at
+ * 'num_out', so the state of the last thread is the caller's new state.
+ *
+ * The calling thread fills the first part itself. Arrays smaller than
+ * PARALLEL_MIN_PER_THREAD values per thread use fewer threads, since the cost
+ * of starting a thread is more than the time to fill a small array. If a
+ * thread can't be started, the calling thread fills its part instead.
+ *
+ * Threads use POSIX threads, if "configure" found them. Otherwise, the fill
+ * is done by the calling thread alone.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "simplerandom.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Maximum number of threads for one fill. */
+#define PARALLEL_MAX_THREADS        64u
+
+/* Minimum number of values for each thread to fill. */
+#define PARALLEL_MIN_PER_THREAD     (UINT32_C(1) << 18u)
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+/* One thread's part of the fill. */
+typedef struct
+{
+    void      (*p_fill)(void * p_rng, uint32_t * p_out, size_t num_out);
+    void *      p_rng;
+    uint32_t *  p_out;
+    size_t      num_out;
+} ParallelPart_t;
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Number of threads to use to fill 'num_out' values, for a requested
+ * 'num_threads'. */
+static unsigned parallel_num_threads(size_t num_out, unsigned num_threads)
+{
+    size_t      max_threads;
+
+#ifdef HAVE_PTHREAD
+    long        num_cpus;
+
+    if (num_threads == 0)
+    {
+        num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (num_cpus > 0) ? (unsigned)num_cpus : 1u;
+    }
+#else
+    num_threads = 1u;
+#endif
+    if (num_threads > PARALLEL_MAX_THREADS)
+        num_threads = PARALLEL_MAX_THREADS;
+    max_threads = num_out / PARALLEL_MIN_PER_THREAD;
+    if (num_threads > max_threads)
+        num_threads = (max_threads != 0) ? (unsigned)max_threads : 1u;
+    return num_threads;
+}
+
+#ifdef HAVE_PTHREAD
+static void * parallel_thread(void * p_arg)
+{
+    ParallelPart_t    * p_part = (ParallelPart_t *)p_arg;
+
+    p_part->p_fill(p_part->p_rng, p_part->p_out, p_part->num_out);
+    return NULL;
+}
+#endif
+
+/* Fill all the parts, one per thread. Part 0 is filled by the calling
+ * thread. */
+static void parallel_run(ParallelPart_t * p_parts, unsigned num_threads)
+{
+#ifdef HAVE_PTHREAD
+    pthread_t   threads[PARALLEL_MAX_THREADS];
+    bool        started[PARALLEL_MAX_THREADS];
+    unsigned    i;
+
+    for (i = 1; i < num_threads; ++i)
+    {
+        started[i] = (pthread_create(&threads[i], NULL, parallel_thread, &p_parts[i]) == 0);
+    }
+    p_parts[0].p_fill(p_parts[0].p_rng, p_parts[0].p_out, p_parts[0].num_out);
+    for (i = 1; i < num_threads; ++i)
+    {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+        else
+            p_parts[i].p_fill(p_parts[i].p_rng, p_parts[i].p_out, p_parts[i].num_out);
+    }
+#else
+    unsigned    i;
+
+    for (i = 0; i < num_threads; ++i)
+    {
+        p_parts[i].p_fill(p_parts[i].p_rng, p_parts[i].p_out, p_parts[i].num_out);
+    }
+#endif
+}
+
+/* Define simplerandom_zzz_parallel_fill() for generator 'zzz'. */
+#define SIMPLERANDOM_PARALLEL_FUNCTIONS(NAME, TYPE)                             \
+static void NAME##_parallel_part_fill(void * p_rng, uint32_t * p_out, size_t num_out) \
+{                                                                           \
+    simplerandom_##NAME##_fill((TYPE *)p_rng, p_out, num_out);              \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_parallel_fill(TYPE * p_rng, uint32_t * p_out, size_t num_out, unsigned num_threads) \
+{                                                                           \
+    TYPE            states[PARALLEL_MAX_THREADS];                           \
+    ParallelPart_t  parts[PARALLEL_MAX_THREADS];                            \
+    size_t          part_len;                                               \
+    unsigned        i;                                                      \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        num_threads = parallel_num_threads(num_out, num_threads);           \
+        if (num_threads <= 1u)                                              \
+        {                                                                   \
+            simplerandom_##NAME##_fill(p_rng, p_out, num_out);              \
+            return;                                                         \
+        }                                                                   \
+        part_len = (num_out + num_threads - 1u) / num_threads;              \
+        simplerandom_##NAME##_split(p_rng, states, num_threads, part_len);  \
+        for (i = 0; i < num_threads; ++i)                                   \
+        {                                                                   \
+            parts[i].p_fill = NAME##_parallel_part_fill;                    \
+            parts[i].p_rng = &states[i];                                    \
+            parts[i].p_out = p_out + i * part_len;                          \
+            parts[i].num_out = (i + 1u < num_threads) ? part_len : num_out - i * part_len; \
+        }                                                                   \
+        parallel_run(parts, num_threads);                                   \
+        *p_rng = states[num_threads - 1u];                                  \
+    }                                                                       \
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SIMPLERANDOM_PARALLEL_FUNCTIONS(cong, SimpleRandomCong_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(shr3, SimpleRandomSHR3_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(mwc1, SimpleRandomMWC1_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(mwc2, SimpleRandomMWC2_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+SIMPLERANDOM_PARALLEL_FUNCTIONS(mwc64, SimpleRandomMWC64_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+SIMPLERANDOM_PARALLEL_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t)
+SIMPLERANDOM_PARALLEL_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t)
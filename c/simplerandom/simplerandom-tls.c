@@ -0,0 +1,123 @@
+/*
+ * simplerandom-tls.c
+ *
+ * Simple Pseudo-random Number Generators -- thread-local default generator.
+ *
+ * Each thread has its own KISS2 generator, so simplerandom_tls_next() and
+ * simplerandom_tls_fill() need no lock, and threads never contend for a
+ * shared state (not even a shared cache line, apart from the first call).
+ *
+ * A thread's generator is seeded on its first call. It takes the next stream
+ * number from a global atomic counter, and starts at that stream's place in
+ * the sequence of a KISS2 generator with fixed seeds:
+ *
+ *     start = stream * SIMPLERANDOM_TLS_STREAM_STRIDE
+ *
+ * by simplerandom_kiss2_discard(). So the threads' sequences don't overlap
+ * unless a thread uses more than SIMPLERANDOM_TLS_STREAM_STRIDE values (2^44),
+ * or more than 2^20 threads are started, after which 'start' wraps. The
+ * first thread to use the generator gets stream 0. Streams are given out in
+ * the order that threads first use the generator, so which thread gets which
+ * stream is only repeatable if that order is.
+ *
+ * These functions need 64-bit integer support, thread-local storage, and
+ * atomic operations (C11, or GCC-compatible built-ins).
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+#include "threadlocal.h"
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define TLS_HAVE_STDATOMIC      1
+#endif
+
+
+#ifdef UINT64_C
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#ifndef SIMPLERANDOM_THREAD_LOCAL
+#error "Thread-local storage is not supported by this compiler"
+#endif
+
+/* Seeds of the KISS2 generator that the streams are taken from. These are
+ * Marsaglia's seeds for KISS2. */
+#define TLS_SEED_MWC_UPPER      UINT32_C(7654321)
+#define TLS_SEED_MWC_LOWER      UINT32_C(521288629)
+#define TLS_SEED_CONG           UINT32_C(123456789)
+#define TLS_SEED_SHR3           UINT32_C(362436000)
+
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+#if defined(TLS_HAVE_STDATOMIC)
+static atomic_uintmax_t tls_next_stream = 0;
+#else
+static uintmax_t tls_next_stream = 0;
+#endif
+
+static SIMPLERANDOM_THREAD_LOCAL SimpleRandomKISS2_t tls_kiss2;
+static SIMPLERANDOM_THREAD_LOCAL bool tls_seeded = false;
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static uintmax_t tls_take_stream(void)
+{
+#if defined(TLS_HAVE_STDATOMIC)
+    /* Only the counter's own value matters, so no ordering is needed. */
+    return atomic_fetch_add_explicit(&tls_next_stream, 1u, memory_order_relaxed);
+#elif defined(__GNUC__)
+    return __atomic_fetch_add(&tls_next_stream, 1u, __ATOMIC_RELAXED);
+#else
+#error "Atomic operations are not supported by this compiler"
+#endif
+}
+
+/* Seed this thread's generator, on its first call. */
+static void tls_seed(void)
+{
+    simplerandom_kiss2_seed(&tls_kiss2, TLS_SEED_MWC_UPPER, TLS_SEED_MWC_LOWER, TLS_SEED_CONG, TLS_SEED_SHR3);
+    simplerandom_kiss2_discard(&tls_kiss2, tls_take_stream() * SIMPLERANDOM_TLS_STREAM_STRIDE);
+    tls_seeded = true;
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SimpleRandomKISS2_t * simplerandom_tls_kiss2(void)
+{
+    if (!tls_seeded)
+        tls_seed();
+    return &tls_kiss2;
+}
+
+uint32_t simplerandom_tls_next(void)
+{
+    if (!tls_seeded)
+        tls_seed();
+    return simplerandom_kiss2_next(&tls_kiss2);
+}
+
+void simplerandom_tls_fill(uint32_t * p_out, size_t num_out)
+{
+    if (!tls_seeded)
+        tls_seed();
+    simplerandom_kiss2_fill(&tls_kiss2, p_out, num_out);
+}
+
+#endif /* defined(UINT64_C) */
@@ -0,0 +1,141 @@
+/*
+ * simplerandom-uniform.c
+ *
+ * Simple Pseudo-random Number Generators -- bounded integer output.
+ *
+ * Generate unbiased random integers in the range [0, bound), by Lemire's
+ * "multiply-and-reject" method [1]:
+ *
+ *     m = x * bound        (64-bit product of 32-bit random value x)
+ *     result = m >> 32
+ *
+ * The result is the upper 32 bits of the product, which is in [0, bound).
+ * To be unbiased, products whose lower 32 bits are less than
+ * (2^32 - bound) mod bound must be rejected, and a new random value drawn.
+ * That threshold needs a division, but it is only needed when the lower 32
+ * bits are less than 'bound', which is rare for small bounds. So usually no
+ * division is done at all. This is unlike the common "next() % bound", which
+ * always needs a division, and is biased.
+ *
+ * The "fill" functions calculate the threshold once for the whole array, and
+ * check for rejections without branches. Both give exactly the same sequence
+ * as repeated calls of simplerandom_zzz_uniform_u32().
+ *
+ * A 'bound' of 0 is taken to mean 2^32, so the result is simply the next
+ * 32-bit random value.
+ *
+ * [1] Fast Random Integer Generation in an Interval
+ *     Daniel Lemire
+ *     ACM Transactions on Modeling and Computer Simulation, 29 (1), 2019
+ *     https://arxiv.org/abs/1805.10941
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "simplerandom.h"
+#include "maths.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of random values drawn per chunk in the "fill" functions. */
+#define UNIFORM_CHUNK_LEN       256u
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Convert an array of 32-bit random values to values in [0, bound), leaving
+ * out any that must be rejected. 'threshold' is (2^32 - bound) mod bound.
+ * Return the number of values that were accepted.
+ * Each result is written even if it is rejected, but is then overwritten by
+ * the next one, which avoids a hard-to-predict branch.
+ */
+static size_t uniform_u32_convert(uint32_t * p_out, const uint32_t * p_in, size_t num_in, uint32_t bound, uint32_t threshold)
+{
+    uint32_t    low;
+    size_t      num_out;
+    size_t      i;
+
+    num_out = 0;
+    for (i = 0; i < num_in; i++)
+    {
+        p_out[num_out] = mul_uint32_wide(p_in[i], bound, &low);
+        num_out += (low >= threshold);
+    }
+    return num_out;
+}
+
+/* Define simplerandom_zzz_uniform_u32() and simplerandom_zzz_fill_uniform_u32()
+ * for generator 'zzz'. */
+#define SIMPLERANDOM_UNIFORM_FUNCTIONS(NAME, TYPE)                              \
+uint32_t simplerandom_##NAME##_uniform_u32(TYPE * p_rng, uint32_t bound)    \
+{                                                                           \
+    uint32_t    result;                                                     \
+    uint32_t    low;                                                        \
+    uint32_t    threshold;                                                  \
+                                                                            \
+    if (bound == 0)                                                         \
+        return simplerandom_##NAME##_next(p_rng);                           \
+    result = mul_uint32_wide(simplerandom_##NAME##_next(p_rng), bound, &low); \
+    if (low < bound)                                                        \
+    {                                                                       \
+        threshold = (0u - bound) % bound;                                   \
+        while (low < threshold)                                             \
+        {                                                                   \
+            result = mul_uint32_wide(simplerandom_##NAME##_next(p_rng), bound, &low); \
+        }                                                                   \
+    }                                                                       \
+    return result;                                                          \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_fill_uniform_u32(TYPE * p_rng, uint32_t * p_out, size_t num_out, uint32_t bound) \
+{                                                                           \
+    uint32_t    buffer[UNIFORM_CHUNK_LEN];                                  \
+    uint32_t    threshold;                                                  \
+    size_t      num_chunk;                                                  \
+    size_t      num_accepted;                                               \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        if (bound == 0)                                                     \
+        {                                                                   \
+            simplerandom_##NAME##_fill(p_rng, p_out, num_out);              \
+            return;                                                         \
+        }                                                                   \
+        threshold = (0u - bound) % bound;                                   \
+        while (num_out)                                                     \
+        {                                                                   \
+            /* Draw only as many as are still needed, so that the sequence */ \
+            /* matches repeated simplerandom_zzz_uniform_u32() calls. */    \
+            num_chunk = (num_out < UNIFORM_CHUNK_LEN) ? num_out : UNIFORM_CHUNK_LEN; \
+            simplerandom_##NAME##_fill(p_rng, buffer, num_chunk);           \
+            num_accepted = uniform_u32_convert(p_out, buffer, num_chunk, bound, threshold); \
+            p_out += num_accepted;                                          \
+            num_out -= num_accepted;                                        \
+        }                                                                   \
+    }                                                                       \
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SIMPLERANDOM_UNIFORM_FUNCTIONS(cong, SimpleRandomCong_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(shr3, SimpleRandomSHR3_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(mwc1, SimpleRandomMWC1_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(mwc2, SimpleRandomMWC2_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+SIMPLERANDOM_UNIFORM_FUNCTIONS(mwc64, SimpleRandomMWC64_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+SIMPLERANDOM_UNIFORM_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t)
+SIMPLERANDOM_UNIFORM_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t)
@@ -0,0 +1,295 @@
+/*
+ * simplerandom-ziggurat.c
+ *
+ * Simple Pseudo-random Number Generators -- normal and exponential output.
+ *
+ * Generate standard normal (mean 0, variance 1) and standard exponential
+ * (mean 1) random values, by the ziggurat method of Marsaglia and Tsang [1].
+ *
+ * The area under the density function is split into 256 layers of equal
+ * area, which are rectangles apart from the base layer (which includes the
+ * tail). A random layer is chosen, and a random x within its width. Usually,
+ * x is inside the next layer up too, so it is certainly under the density
+ * function, and is returned straight away. That is ~99% of the time, and needs
+ * just one table look-up and one multiplication, with no log, sqrt or trig
+ * (unlike the Box-Muller method). Otherwise, x is checked against the density
+ * function itself, or a value is generated from the tail.
+ *
+ * Each value uses a 64-bit random value made of two 32-bit values from the
+ * generator, with the second draw giving the upper 32 bits. The bits are used
+ * as follows, so the layer and x value are independent, unlike in the
+ * original 32-bit version of [1], which was criticised for that [2]:
+ *
+ *     normal:         bits 0-7 layer, bit 8 sign, bits 9-60 x (52 bits)
+ *     exponential:    bits 3-10 layer, bits 11-63 x (53 bits)
+ *
+ * This is the same arrangement as NumPy's ziggurat. The occasional rejections
+ * and tail values draw more random values, as 53-bit doubles in [0, 1).
+ *
+ * The "fill" functions give exactly the same sequence as repeated calls of
+ * the single-value functions. They draw random values in chunks with
+ * simplerandom_zzz_fill(), but never more than are certain to be needed, so
+ * the generator state is left the same as after the single-value calls.
+ *
+ * These functions need 64-bit integer support.
+ *
+ * [1] The Ziggurat Method for Generating Random Variables
+ *     George Marsaglia, Wai Wan Tsang
+ *     Journal of Statistical Software, 5 (8), 2000
+ *
+ * [2] An Improved Ziggurat Method to Generate Normal Random Samples
+ *     Jurgen A. Doornik
+ *     University of Oxford, 2005
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "simplerandom.h"
+#include "ziggurattables.h"
+
+
+#ifdef UINT64_C
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Maximum number of 32-bit random values drawn per chunk in the "fill"
+ * functions. */
+#define ZIGGURAT_CHUNK_LEN      512u
+
+#define SCALE_53                (1.0 / 9007199254740992.0)      /* 2^-53 */
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+/* Source of 32-bit random values for the ziggurat functions. */
+typedef uint32_t (*ZigguratNextFn_t)(void * p_context);
+
+/* Buffered source of random values, for the "fill" functions. 'num_needed' is
+ * the minimum number of random values that are still certain to be used, so
+ * the buffer is never filled with more than that.
+ * The buffer itself is separate, so that the compiler can keep this structure
+ * in registers. */
+typedef struct
+{
+    void      (*p_fill)(void * p_rng, uint32_t * p_out, size_t num_out);
+    void *      p_rng;
+    uint32_t *  p_buffer;
+    size_t      num_needed;
+    size_t      pos;
+    size_t      len;
+} ZigguratSource_t;
+
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static inline void ziggurat_source_init(ZigguratSource_t * p_source, void (*p_fill)(void *, uint32_t *, size_t), void * p_rng, uint32_t * p_buffer)
+{
+    p_source->p_fill = p_fill;
+    p_source->p_rng = p_rng;
+    p_source->p_buffer = p_buffer;
+    p_source->num_needed = 0;
+    p_source->pos = 0;
+    p_source->len = 0;
+}
+
+static inline uint32_t ziggurat_source_next(void * p_context)
+{
+    ZigguratSource_t  * p_source = (ZigguratSource_t *)p_context;
+    size_t              len;
+
+    if (p_source->pos >= p_source->len)
+    {
+        len = p_source->num_needed;
+        if (len == 0)
+            len = 1u;
+        else if (len > ZIGGURAT_CHUNK_LEN)
+            len = ZIGGURAT_CHUNK_LEN;
+        p_source->p_fill(p_source->p_rng, p_source->p_buffer, len);
+        p_source->pos = 0;
+        p_source->len = len;
+    }
+    if (p_source->num_needed)
+        p_source->num_needed--;
+    return p_source->p_buffer[p_source->pos++];
+}
+
+static inline uint64_t ziggurat_next_uint64(ZigguratNextFn_t p_next, void * p_context)
+{
+    uint32_t    low;
+
+    low = p_next(p_context);
+    return ((uint64_t)p_next(p_context) << 32u) | low;
+}
+
+/* Uniform double in [0, 1), as simplerandom_zzz_fill_double() with 53 bits. */
+static inline double ziggurat_next_double(ZigguratNextFn_t p_next, void * p_context)
+{
+    uint32_t    low;
+
+    low = p_next(p_context);
+    return ((double)(p_next(p_context) >> 5u) * 67108864.0 + (double)(low >> 6u)) * SCALE_53;
+}
+
+/* Return x, which is positive, negated if 'sign' is non-zero, without a
+ * branch. */
+static inline double copysign_bit(double x, uint64_t sign)
+{
+    uint64_t    bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+    bits |= (uint64_t)(sign != 0) << 63u;
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+/* These are inline so that each generator's functions get their own copy,
+ * with the call of p_next() inlined too. */
+static inline double ziggurat_normal(ZigguratNextFn_t p_next, void * p_context)
+{
+    const ZigguratLayer_t * p_layer;
+    uint64_t                r;
+    uint64_t                u;
+    double                  x;
+    double                  y;
+
+    for (;;)
+    {
+        r = ziggurat_next_uint64(p_next, p_context);
+        p_layer = &ziggurat_normal_table[r & 0xFFu];
+        u = (r >> 9u) & UINT64_C(0x000FFFFFFFFFFFFF);
+        /* The sign is random, so a branch for it would be mispredicted half
+         * the time. */
+        x = (double)(int64_t)u * p_layer->w;
+        x = copysign_bit(x, r & 0x100u);
+        if (u < p_layer->k)
+            return x;
+
+        if (p_layer == &ziggurat_normal_table[0])
+        {
+            /* Tail, by Marsaglia's method. 1 - uniform is in (0, 1]. */
+            do
+            {
+                x = -log1p(-ziggurat_next_double(p_next, p_context)) * (1.0 / ZIGGURAT_NORMAL_R);
+                y = -log1p(-ziggurat_next_double(p_next, p_context));
+            } while (y + y <= x * x);
+            return copysign_bit(x + ZIGGURAT_NORMAL_R, r & 0x100u);
+        }
+        if ((p_layer[-1].f - p_layer->f) * ziggurat_next_double(p_next, p_context) + p_layer->f < exp(-0.5 * x * x))
+            return x;
+    }
+}
+
+static inline double ziggurat_exponential(ZigguratNextFn_t p_next, void * p_context)
+{
+    const ZigguratLayer_t * p_layer;
+    uint64_t                r;
+    uint64_t                u;
+    double                  x;
+
+    for (;;)
+    {
+        r = ziggurat_next_uint64(p_next, p_context);
+        p_layer = &ziggurat_exp_table[(r >> 3u) & 0xFFu];
+        u = r >> 11u;
+        x = (double)(int64_t)u * p_layer->w;
+        if (u < p_layer->k)
+            return x;
+
+        if (p_layer == &ziggurat_exp_table[0])
+        {
+            /* Tail. The exponential distribution is memoryless, so the tail
+             * is just another exponential, offset by r. */
+            return ZIGGURAT_EXP_R - log1p(-ziggurat_next_double(p_next, p_context));
+        }
+        if ((p_layer[-1].f - p_layer->f) * ziggurat_next_double(p_next, p_context) + p_layer->f < exp(-x))
+            return x;
+    }
+}
+
+/* Define simplerandom_zzz_normal(), simplerandom_zzz_fill_normal(),
+ * simplerandom_zzz_exponential() and simplerandom_zzz_fill_exponential() for
+ * generator 'zzz'. Each value uses at least two random values, which sets
+ * 'num_needed' for the rest of the array. */
+#define SIMPLERANDOM_ZIGGURAT_FUNCTIONS(NAME, TYPE)                             \
+static uint32_t NAME##_ziggurat_next(void * p_rng)                          \
+{                                                                           \
+    return simplerandom_##NAME##_next((TYPE *)p_rng);                       \
+}                                                                           \
+                                                                            \
+static void NAME##_ziggurat_fill(void * p_rng, uint32_t * p_out, size_t num_out) \
+{                                                                           \
+    simplerandom_##NAME##_fill((TYPE *)p_rng, p_out, num_out);              \
+}                                                                           \
+                                                                            \
+double simplerandom_##NAME##_normal(TYPE * p_rng)                           \
+{                                                                           \
+    return ziggurat_normal(NAME##_ziggurat_next, p_rng);                    \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_fill_normal(TYPE * p_rng, double * p_out, size_t num_out) \
+{                                                                           \
+    ZigguratSource_t    source;                                             \
+    uint32_t            buffer[ZIGGURAT_CHUNK_LEN];                         \
+    size_t              i;                                                  \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        ziggurat_source_init(&source, NAME##_ziggurat_fill, p_rng, buffer); \
+        for (i = 0; i < num_out; i++)                                       \
+        {                                                                   \
+            source.num_needed = 2u * (num_out - i);                         \
+            p_out[i] = ziggurat_normal(ziggurat_source_next, &source);      \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+double simplerandom_##NAME##_exponential(TYPE * p_rng)                      \
+{                                                                           \
+    return ziggurat_exponential(NAME##_ziggurat_next, p_rng);               \
+}                                                                           \
+                                                                            \
+void simplerandom_##NAME##_fill_exponential(TYPE * p_rng, double * p_out, size_t num_out) \
+{                                                                           \
+    ZigguratSource_t    source;                                             \
+    uint32_t            buffer[ZIGGURAT_CHUNK_LEN];                         \
+    size_t              i;                                                  \
+                                                                            \
+    if (p_out != NULL)                                                      \
+    {                                                                       \
+        ziggurat_source_init(&source, NAME##_ziggurat_fill, p_rng, buffer); \
+        for (i = 0; i < num_out; i++)                                       \
+        {                                                                   \
+            source.num_needed = 2u * (num_out - i);                         \
+            p_out[i] = ziggurat_exponential(ziggurat_source_next, &source); \
+        }                                                                   \
+    }                                                                       \
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(cong, SimpleRandomCong_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(shr3, SimpleRandomSHR3_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(mwc1, SimpleRandomMWC1_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(mwc2, SimpleRandomMWC2_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(kiss, SimpleRandomKISS_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(mwc64, SimpleRandomMWC64_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(kiss2, SimpleRandomKISS2_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(lfsr113, SimpleRandomLFSR113_t)
+SIMPLERANDOM_ZIGGURAT_FUNCTIONS(lfsr88, SimpleRandomLFSR88_t)
+
+#endif /* defined(UINT64_C) */
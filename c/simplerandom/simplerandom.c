@@ -9,7 +9,12 @@
  * Includes
  ****************************************************************************/
 
+/* The library always defines the out-of-line functions. */
+#undef SIMPLERANDOM_INLINE
+
 #include "simplerandom.h"
+#include "simplerandom-inline.h"
+#include "jumptables.h"
 
 
 /*****************************************************************************
@@ -53,18 +58,13 @@ void simplerandom_cong_seed(SimpleRandomCong_t * p_cong, uint32_t seed)
     /* No sanitize is needed because for Cong, all state values are valid. */
 }
 
-void simplerandom_cong_sanitize(SimpleRandomCong_t * p_cong)
-{
-    /* All state values are valid for Cong. No sanitizing needed. */
-    (const void *) p_cong;
-}
-
-uint32_t simplerandom_cong_next(SimpleRandomCong_t * p_cong)
+uint32_t simplerandom_cong_prev(SimpleRandomCong_t * p_cong)
 {
     uint32_t    cong;
 
-    cong = UINT32_C(69069) * p_cong->cong + 12345u;
-    p_cong->cong = cong;
+    cong = p_cong->cong;
+    /* 0xA5E2A705 is the inverse of 69069, modulo 2^32. */
+    p_cong->cong = UINT32_C(0xA5E2A705) * (cong - 12345u);
 
     return cong;
 }
@@ -83,6 +83,24 @@ void simplerandom_cong_mix(SimpleRandomCong_t * p_cong, const uint32_t * p_data,
     }
 }
 
+void simplerandom_cong_fill(SimpleRandomCong_t * p_cong, uint32_t * p_out, size_t num_out)
+{
+    uint32_t    cong;
+
+    if (p_out != NULL)
+    {
+        /* Keep the state in a local variable for the duration of the loop. */
+        cong = p_cong->cong;
+        while (num_out)
+        {
+            --num_out;
+            cong = UINT32_C(69069) * cong + 12345u;
+            *p_out++ = cong;
+        }
+        p_cong->cong = cong;
+    }
+}
+
 /*********
  * SHR3
  ********/
@@ -120,27 +138,24 @@ void simplerandom_shr3_seed(SimpleRandomSHR3_t * p_shr3, uint32_t seed)
     simplerandom_shr3_sanitize(p_shr3);
 }
 
-void simplerandom_shr3_sanitize(SimpleRandomSHR3_t * p_shr3)
-{
-    /* Zero is a bad state value for SHR3. */
-    if (p_shr3->shr3 == 0)
-    {
-        p_shr3->shr3 = UINT32_C(0xFFFFFFFF);
-    }
-}
-
-uint32_t simplerandom_shr3_next(SimpleRandomSHR3_t * p_shr3)
+/* Each xorshift is undone by repeating it until the shifted-in bits run out.
+ * They are undone in the reverse order of simplerandom_shr3_next(). */
+uint32_t simplerandom_shr3_prev(SimpleRandomSHR3_t * p_shr3)
 {
     uint32_t    shr3;
+    uint32_t    result;
 
-
-    shr3 = p_shr3->shr3;
-    shr3 ^= (shr3 << 13);
-    shr3 ^= (shr3 >> 17);
+    result = p_shr3->shr3;
+    shr3 = result;
     shr3 ^= (shr3 << 5);
+    shr3 ^= (shr3 << 10);
+    shr3 ^= (shr3 << 20);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 << 26);
     p_shr3->shr3 = shr3;
 
-    return shr3;
+    return result;
 }
 
 void simplerandom_shr3_mix(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data, size_t num_data)
@@ -157,6 +172,25 @@ void simplerandom_shr3_mix(SimpleRandomSHR3_t * p_shr3, const uint32_t * p_data,
     }
 }
 
+void simplerandom_shr3_fill(SimpleRandomSHR3_t * p_shr3, uint32_t * p_out, size_t num_out)
+{
+    uint32_t    shr3;
+
+    if (p_out != NULL)
+    {
+        shr3 = p_shr3->shr3;
+        while (num_out)
+        {
+            --num_out;
+            shr3 ^= (shr3 << 13);
+            shr3 ^= (shr3 >> 17);
+            shr3 ^= (shr3 << 5);
+            *p_out++ = shr3;
+        }
+        p_shr3->shr3 = shr3;
+    }
+}
+
 /*********
  * MWC2
  *
@@ -215,87 +249,31 @@ void simplerandom_mwc2_seed(SimpleRandomMWC2_t * p_mwc, uint32_t seed_upper, uin
     simplerandom_mwc2_sanitize(p_mwc);
 }
 
-/* The good state values are all modulo 0x9068FFFF. Values above that would
- * jump to a corresponding good state value on the first "next" operation.
- * Any integer multiple of 0x9068FFFF, including 0, is a bad state.
- */
-static inline void mwc2_sanitize_upper(SimpleRandomMWC2_t * p_mwc)
-{
-    uint32_t    state_orig;
-    uint32_t    temp;
-
-    state_orig = p_mwc->mwc_upper;
-    temp = state_orig;
-    /* The following is equivalent to % 0x9068FFFF, without using modulo
-     * operation which may be expensive on embedded targets. For
-     * uint32_t and this divisor, we only need 'if' rather than 'while'. */
-    if (temp >= UINT32_C(0x9068FFFF))
-        temp -= UINT32_C(0x9068FFFF);
-    if (temp == 0)
-    {
-        /* Any integer multiple of 0x9068FFFF, including 0, is a bad state.
-         * Use an alternate state value by inverting the original value. */
-        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
-        if (temp >= UINT32_C(0x9068FFFF))
-            temp -= UINT32_C(0x9068FFFF);
-    }
-    p_mwc->mwc_upper = temp;
-}
-
-/* The good state values are all modulo 0x9068FFFF. Values above that would
- * jump to a corresponding good state value on the first "next" operation.
- * Any integer multiple of 0x464FFFFF, including 0, is a bad state.
+/* The inverse of _simplerandom_mwc2_next_upper(). The state is x = 36969 * lo + hi, where
+ * lo and hi were the lower and upper 16 bits of the previous state, and hi is
+ * less than 36969. So both are recovered by a division.
+ * This is the same as multiplying by the inverse of 36969 modulo 0x9068FFFF,
+ * which is 2^16.
  */
-static inline void mwc2_sanitize_lower(SimpleRandomMWC2_t * p_mwc)
+static inline void mwc2_prev_upper(SimpleRandomMWC2_t * p_mwc)
 {
-    uint32_t    state_orig;
-    uint32_t    temp;
-
-    state_orig = p_mwc->mwc_lower;
-    temp = state_orig;
-    /* The following is equivalent to % 0x464FFFFF, without using modulo
-     * operation which may be expensive on embedded targets. For
-     * uint32_t and this divisor, it may loop up to 3 times. */
-    while (temp >= UINT32_C(0x464FFFFF))
-        temp -= UINT32_C(0x464FFFFF);
-    if (temp == 0)
-    {
-        /* Any integer multiple of 0x464FFFFF, including 0, is a bad state.
-         * Use an alternate state value by inverting the original value. */
-        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
-        while (temp >= UINT32_C(0x464FFFFF))
-            temp -= UINT32_C(0x464FFFFF);
-    }
-
-    p_mwc->mwc_lower = temp;
+    p_mwc->mwc_upper = ((p_mwc->mwc_upper % 36969u) << 16u) | (p_mwc->mwc_upper / 36969u);
 }
 
-void simplerandom_mwc2_sanitize(SimpleRandomMWC2_t * p_mwc)
+/* The inverse of _simplerandom_mwc2_next_lower(). See mwc2_prev_upper(). */
+static inline void mwc2_prev_lower(SimpleRandomMWC2_t * p_mwc)
 {
-    mwc2_sanitize_upper(p_mwc);
-    mwc2_sanitize_lower(p_mwc);
+    p_mwc->mwc_lower = ((p_mwc->mwc_lower % 18000u) << 16u) | (p_mwc->mwc_lower / 18000u);
 }
 
-static inline void mwc2_next_upper(SimpleRandomMWC2_t * p_mwc)
+uint32_t simplerandom_mwc2_prev(SimpleRandomMWC2_t * p_mwc)
 {
-    p_mwc->mwc_upper = 36969u * (p_mwc->mwc_upper & 0xFFFFu) + (p_mwc->mwc_upper >> 16u);
-}
+    uint32_t    result;
 
-static inline void mwc2_next_lower(SimpleRandomMWC2_t * p_mwc)
-{
-    p_mwc->mwc_lower = 18000u * (p_mwc->mwc_lower & 0xFFFFu) + (p_mwc->mwc_lower >> 16u);
-}
-
-/*
- * This is almost identical to simplerandom_mwc1_next(), except that when
- * combining the upper and lower values in the last step, the upper 16 bits of
- * mwc_upper are added in too, instead of just being discarded.
- */
-uint32_t simplerandom_mwc2_next(SimpleRandomMWC2_t * p_mwc)
-{
-    mwc2_next_upper(p_mwc);
-    mwc2_next_lower(p_mwc);
-    return mwc2_current(p_mwc);
+    result = mwc2_current(p_mwc);
+    mwc2_prev_upper(p_mwc);
+    mwc2_prev_lower(p_mwc);
+    return result;
 }
 
 void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data, size_t num_data)
@@ -312,13 +290,13 @@ void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data,
             {
                 case 0:
                     p_mwc->mwc_upper ^= *p_data;
-                    mwc2_sanitize_upper(p_mwc);
-                    mwc2_next_upper(p_mwc);
+                    _simplerandom_mwc2_sanitize_upper(p_mwc);
+                    _simplerandom_mwc2_next_upper(p_mwc);
                     break;
                 case 1:
                     p_mwc->mwc_lower ^= *p_data;
-                    mwc2_sanitize_lower(p_mwc);
-                    mwc2_next_lower(p_mwc);
+                    _simplerandom_mwc2_sanitize_lower(p_mwc);
+                    _simplerandom_mwc2_next_lower(p_mwc);
                     break;
             }
             ++p_data;
@@ -326,6 +304,24 @@ void simplerandom_mwc2_mix(SimpleRandomMWC2_t * p_mwc, const uint32_t * p_data,
     }
 }
 
+void simplerandom_mwc2_fill(SimpleRandomMWC2_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC2_t  mwc;
+
+    if (p_out != NULL)
+    {
+        mwc = *p_mwc;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_mwc2_next_upper(&mwc);
+            _simplerandom_mwc2_next_lower(&mwc);
+            *p_out++ = mwc2_current(&mwc);
+        }
+        *p_mwc = mwc;
+    }
+}
+
 /*********
  * MWC1
  *
@@ -376,16 +372,14 @@ void simplerandom_mwc1_seed(SimpleRandomMWC1_t * p_mwc, uint32_t seed_upper, uin
     simplerandom_mwc2_seed(p_mwc, seed_upper, seed_lower);
 }
 
-void simplerandom_mwc1_sanitize(SimpleRandomMWC1_t * p_mwc)
+uint32_t simplerandom_mwc1_prev(SimpleRandomMWC1_t * p_mwc)
 {
-    simplerandom_mwc2_sanitize(p_mwc);
-}
+    uint32_t    result;
 
-uint32_t simplerandom_mwc1_next(SimpleRandomMWC1_t * p_mwc)
-{
-    mwc2_next_upper(p_mwc);
-    mwc2_next_lower(p_mwc);
-    return mwc1_current(p_mwc);
+    result = mwc1_current(p_mwc);
+    mwc2_prev_upper(p_mwc);
+    mwc2_prev_lower(p_mwc);
+    return result;
 }
 
 /* This is nearly identical to the MWC2 mix function, except for the call to
@@ -405,13 +399,13 @@ void simplerandom_mwc1_mix(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_data,
             {
                 case 0:
                     p_mwc->mwc_upper ^= *p_data;
-                    mwc2_sanitize_upper(p_mwc);
-                    mwc2_next_upper(p_mwc);
+                    _simplerandom_mwc2_sanitize_upper(p_mwc);
+                    _simplerandom_mwc2_next_upper(p_mwc);
                     break;
                 case 1:
                     p_mwc->mwc_lower ^= *p_data;
-                    mwc2_sanitize_lower(p_mwc);
-                    mwc2_next_lower(p_mwc);
+                    _simplerandom_mwc2_sanitize_lower(p_mwc);
+                    _simplerandom_mwc2_next_lower(p_mwc);
                     break;
             }
             ++p_data;
@@ -419,6 +413,24 @@ void simplerandom_mwc1_mix(SimpleRandomMWC1_t * p_mwc, const uint32_t * p_data,
     }
 }
 
+void simplerandom_mwc1_fill(SimpleRandomMWC1_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomMWC1_t  mwc;
+
+    if (p_out != NULL)
+    {
+        mwc = *p_mwc;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_mwc2_next_upper(&mwc);
+            _simplerandom_mwc2_next_lower(&mwc);
+            *p_out++ = mwc1_current(&mwc);
+        }
+        *p_mwc = mwc;
+    }
+}
+
 /*********
  * KISS
  ********/
@@ -468,111 +480,49 @@ void simplerandom_kiss_seed(SimpleRandomKISS_t * p_kiss, uint32_t seed_mwc_upper
     simplerandom_kiss_sanitize(p_kiss);
 }
 
-/* The good state values are all modulo 0x9068FFFF. Values above that would
- * jump to a corresponding good state value on the first "next" operation.
- * Any integer multiple of 0x9068FFFF, including 0, is a bad state.
- */
-static inline void kiss_sanitize_mwc_upper(SimpleRandomKISS_t * p_kiss)
+/* The inverse of _simplerandom_kiss_next_mwc_upper(). See mwc2_prev_upper(). */
+static inline void kiss_prev_mwc_upper(SimpleRandomKISS_t * p_kiss)
 {
-    uint32_t    state_orig;
-    uint32_t    temp;
-
-    state_orig = p_kiss->mwc_upper;
-    temp = state_orig;
-    /* The following is equivalent to % 0x9068FFFF, without using modulo
-     * operation which may be expensive on embedded targets. For
-     * uint32_t and this divisor, we only need 'if' rather than 'while'. */
-    if (temp >= UINT32_C(0x9068FFFF))
-        temp -= UINT32_C(0x9068FFFF);
-    if (temp == 0)
-    {
-        /* Any integer multiple of 0x9068FFFF, including 0, is a bad state.
-         * Use an alternate state value by inverting the original value. */
-        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
-        if (temp >= UINT32_C(0x9068FFFF))
-            temp -= UINT32_C(0x9068FFFF);
-    }
-    p_kiss->mwc_upper = temp;
+    p_kiss->mwc_upper = ((p_kiss->mwc_upper % 36969u) << 16u) | (p_kiss->mwc_upper / 36969u);
 }
 
-/* The good state values are all modulo 0x9068FFFF. Values above that would
- * jump to a corresponding good state value on the first "next" operation.
- * Any integer multiple of 0x464FFFFF, including 0, is a bad state.
- */
-static inline void kiss_sanitize_mwc_lower(SimpleRandomKISS_t * p_kiss)
+/* The inverse of _simplerandom_kiss_next_mwc_lower(). See mwc2_prev_upper(). */
+static inline void kiss_prev_mwc_lower(SimpleRandomKISS_t * p_kiss)
 {
-    uint32_t    state_orig;
-    uint32_t    temp;
-
-    state_orig = p_kiss->mwc_lower;
-    temp = state_orig;
-    /* The following is equivalent to % 0x464FFFFF, without using modulo
-     * operation which may be expensive on embedded targets. For
-     * uint32_t and this divisor, it may loop up to 3 times. */
-    while (temp >= UINT32_C(0x464FFFFF))
-        temp -= UINT32_C(0x464FFFFF);
-    if (temp == 0)
-    {
-        /* Any integer multiple of 0x464FFFFF, including 0, is a bad state.
-         * Use an alternate state value by inverting the original value. */
-        temp = state_orig ^ UINT32_C(0xFFFFFFFF);
-        while (temp >= UINT32_C(0x464FFFFF))
-            temp -= UINT32_C(0x464FFFFF);
-    }
-
-    p_kiss->mwc_lower = temp;
+    p_kiss->mwc_lower = ((p_kiss->mwc_lower % 18000u) << 16u) | (p_kiss->mwc_lower / 18000u);
 }
 
-static inline void kiss_sanitize_shr3(SimpleRandomKISS_t * p_kiss)
+/* The inverse of _simplerandom_kiss_next_cong(). See simplerandom_cong_prev(). */
+static inline void kiss_prev_cong(SimpleRandomKISS_t * p_kiss)
 {
-    /* Zero is a bad state value for SHR3. */
-    if (p_kiss->shr3 == 0)
-    {
-        p_kiss->shr3 = UINT32_C(0xFFFFFFFF);
-    }
-}
-
-void simplerandom_kiss_sanitize(SimpleRandomKISS_t * p_kiss)
-{
-    kiss_sanitize_mwc_upper(p_kiss);
-    kiss_sanitize_mwc_lower(p_kiss);
-    /* No sanitize needed for Cong, because all state values are valid. */
-    kiss_sanitize_shr3(p_kiss);
+    p_kiss->cong = UINT32_C(0xA5E2A705) * (p_kiss->cong - 12345u);
 }
 
-static inline void kiss_next_mwc_upper(SimpleRandomKISS_t * p_kiss)
-{
-    p_kiss->mwc_upper = 36969u * (p_kiss->mwc_upper & 0xFFFFu) + (p_kiss->mwc_upper >> 16u);
-}
-
-static inline void kiss_next_mwc_lower(SimpleRandomKISS_t * p_kiss)
-{
-    p_kiss->mwc_lower = 18000u * (p_kiss->mwc_lower & 0xFFFFu) + (p_kiss->mwc_lower >> 16u);
-}
-
-static inline void kiss_next_cong(SimpleRandomKISS_t * p_kiss)
-{
-    p_kiss->cong = UINT32_C(69069) * p_kiss->cong + 12345u;
-}
-
-static inline void kiss_next_shr3(SimpleRandomKISS_t * p_kiss)
+/* The inverse of _simplerandom_kiss_next_shr3(). See simplerandom_shr3_prev(). */
+static inline void kiss_prev_shr3(SimpleRandomKISS_t * p_kiss)
 {
     uint32_t    shr3;
 
     shr3 = p_kiss->shr3;
-    shr3 ^= (shr3 << 13);
-    shr3 ^= (shr3 >> 17);
     shr3 ^= (shr3 << 5);
+    shr3 ^= (shr3 << 10);
+    shr3 ^= (shr3 << 20);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 << 26);
     p_kiss->shr3 = shr3;
 }
 
-uint32_t simplerandom_kiss_next(SimpleRandomKISS_t * p_kiss)
+uint32_t simplerandom_kiss_prev(SimpleRandomKISS_t * p_kiss)
 {
-    kiss_next_mwc_upper(p_kiss);
-    kiss_next_mwc_lower(p_kiss);
-    kiss_next_cong(p_kiss);
-    kiss_next_shr3(p_kiss);
-    return kiss_current(p_kiss);
+    uint32_t    result;
+
+    result = kiss_current(p_kiss);
+    kiss_prev_mwc_upper(p_kiss);
+    kiss_prev_mwc_lower(p_kiss);
+    kiss_prev_cong(p_kiss);
+    kiss_prev_shr3(p_kiss);
+    return result;
 }
 
 void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data, size_t num_data)
@@ -589,23 +539,23 @@ void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data,
             {
                 case 0:
                     p_kiss->mwc_upper ^= *p_data;
-                    kiss_sanitize_mwc_upper(p_kiss);
-                    kiss_next_mwc_upper(p_kiss);
+                    _simplerandom_kiss_sanitize_mwc_upper(p_kiss);
+                    _simplerandom_kiss_next_mwc_upper(p_kiss);
                     break;
                 case 1:
                     p_kiss->mwc_lower ^= *p_data;
-                    kiss_sanitize_mwc_lower(p_kiss);
-                    kiss_next_mwc_lower(p_kiss);
+                    _simplerandom_kiss_sanitize_mwc_lower(p_kiss);
+                    _simplerandom_kiss_next_mwc_lower(p_kiss);
                     break;
                 case 2:
                     p_kiss->cong ^= *p_data;
                     /* Cong doesn't need sanitise; all states are valid. */
-                    kiss_next_cong(p_kiss);
+                    _simplerandom_kiss_next_cong(p_kiss);
                     break;
                 case 3:
                     p_kiss->shr3 ^= *p_data;
-                    kiss_sanitize_shr3(p_kiss);
-                    kiss_next_shr3(p_kiss);
+                    _simplerandom_kiss_sanitize_shr3(p_kiss);
+                    _simplerandom_kiss_next_shr3(p_kiss);
                     break;
             }
             ++p_data;
@@ -613,6 +563,26 @@ void simplerandom_kiss_mix(SimpleRandomKISS_t * p_kiss, const uint32_t * p_data,
     }
 }
 
+void simplerandom_kiss_fill(SimpleRandomKISS_t * p_kiss, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS_t  kiss;
+
+    if (p_out != NULL)
+    {
+        kiss = *p_kiss;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_kiss_next_mwc_upper(&kiss);
+            _simplerandom_kiss_next_mwc_lower(&kiss);
+            _simplerandom_kiss_next_cong(&kiss);
+            _simplerandom_kiss_next_shr3(&kiss);
+            *p_out++ = kiss_current(&kiss);
+        }
+        *p_kiss = kiss;
+    }
+}
+
 #ifdef UINT64_C
 
 /*********
@@ -665,49 +635,22 @@ void simplerandom_mwc64_seed(SimpleRandomMWC64_t * p_mwc, uint32_t seed_upper, u
     simplerandom_mwc64_sanitize(p_mwc);
 }
 
-void simplerandom_mwc64_sanitize(SimpleRandomMWC64_t * p_mwc)
-{
-    uint64_t    state64_orig;
-    uint64_t    temp64;
-    bool        was_changed = false;
-
-    state64_orig = ((uint64_t)p_mwc->mwc_upper << 32u) + p_mwc->mwc_lower;
-    temp64 = state64_orig;
-    if (temp64 >= UINT64_C(0x29A65EACFFFFFFFF))
-    {
-        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
-        was_changed = true;
-    }
-    if (temp64 == 0)
-    {
-        /* Invert both upper and lower to get a good seed. */
-        temp64 = state64_orig;
-        temp64 ^= UINT64_C(0xFFFFFFFFFFFFFFFF);
-        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
-        was_changed = true;
-    }
-    if (was_changed)
-    {
-        p_mwc->mwc_upper = (uint32_t)(temp64 >> 32u);
-        p_mwc->mwc_lower = (uint32_t)temp64;
-    }
-}
-
-static inline uint32_t mwc64_current(SimpleRandomMWC64_t * p_mwc)
-{
-    return p_mwc->mwc_lower;
-}
-
-uint32_t simplerandom_mwc64_next(SimpleRandomMWC64_t * p_mwc)
+/* The state is x = 698769069 * lower + upper, where lower and upper were the
+ * previous state, and upper is less than 698769069. So both are recovered by
+ * a division. This is the same as multiplying by the inverse of 698769069
+ * modulo 0x29A65EACFFFFFFFF, which is 2^32.
+ */
+uint32_t simplerandom_mwc64_prev(SimpleRandomMWC64_t * p_mwc)
 {
     uint64_t    mwc64;
+    uint32_t    result;
 
+    result = mwc64_current(p_mwc);
+    mwc64 = ((uint64_t)p_mwc->mwc_upper << 32u) | p_mwc->mwc_lower;
+    p_mwc->mwc_upper = (uint32_t)(mwc64 % UINT64_C(698769069));
+    p_mwc->mwc_lower = (uint32_t)(mwc64 / UINT64_C(698769069));
 
-    mwc64 = UINT64_C(698769069) * p_mwc->mwc_lower + p_mwc->mwc_upper;
-    p_mwc->mwc_upper = (mwc64 >> 32u);
-    p_mwc->mwc_lower = (uint32_t)mwc64;
-
-    return (uint32_t)mwc64;
+    return result;
 }
 
 void simplerandom_mwc64_mix(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data, size_t num_data)
@@ -736,6 +679,24 @@ void simplerandom_mwc64_mix(SimpleRandomMWC64_t * p_mwc, const uint32_t * p_data
     }
 }
 
+void simplerandom_mwc64_fill(SimpleRandomMWC64_t * p_mwc, uint32_t * p_out, size_t num_out)
+{
+    uint64_t    mwc64;
+
+    if (p_out != NULL)
+    {
+        mwc64 = ((uint64_t)p_mwc->mwc_upper << 32u) + p_mwc->mwc_lower;
+        while (num_out)
+        {
+            --num_out;
+            mwc64 = UINT64_C(698769069) * (uint32_t)mwc64 + (mwc64 >> 32u);
+            *p_out++ = (uint32_t)mwc64;
+        }
+        p_mwc->mwc_upper = (uint32_t)(mwc64 >> 32u);
+        p_mwc->mwc_lower = (uint32_t)mwc64;
+    }
+}
+
 /*********
  * KISS2
  ********/
@@ -785,81 +746,46 @@ void simplerandom_kiss2_seed(SimpleRandomKISS2_t * p_kiss2, uint32_t seed_mwc_up
     simplerandom_kiss2_sanitize(p_kiss2);
 }
 
-static inline void kiss2_sanitize_mwc64(SimpleRandomKISS2_t * p_kiss2)
-{
-    uint64_t    state64_orig;
-    uint64_t    temp64;
-    bool        was_changed = false;
-
-    state64_orig = ((uint64_t)p_kiss2->mwc_upper << 32u) + p_kiss2->mwc_lower;
-    temp64 = state64_orig;
-    if (temp64 >= UINT64_C(0x29A65EACFFFFFFFF))
-    {
-        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
-        was_changed = true;
-    }
-    if (temp64 == 0)
-    {
-        /* Invert both upper and lower to get a good seed. */
-        temp64 = state64_orig;
-        temp64 ^= UINT64_C(0xFFFFFFFFFFFFFFFF);
-        temp64 %= UINT64_C(0x29A65EACFFFFFFFF);
-        was_changed = true;
-    }
-    if (was_changed)
-    {
-        p_kiss2->mwc_upper = (uint32_t)(temp64 >> 32u);
-        p_kiss2->mwc_lower = (uint32_t)temp64;
-    }
-}
-
-static inline void kiss2_sanitize_shr3(SimpleRandomKISS2_t * p_kiss2)
-{
-    /* Zero is a bad state value for SHR3. */
-    if (p_kiss2->shr3 == 0)
-    {
-        p_kiss2->shr3 = UINT32_C(0xFFFFFFFF);
-    }
-}
-
-void simplerandom_kiss2_sanitize(SimpleRandomKISS2_t * p_kiss2)
-{
-    kiss2_sanitize_mwc64(p_kiss2);
-    /* No sanitize needed for Cong, because all state values are valid. */
-    kiss2_sanitize_shr3(p_kiss2);
-}
-
-static inline void kiss2_next_mwc64(SimpleRandomKISS2_t * p_kiss2)
+/* The inverse of _simplerandom_kiss2_next_mwc64(). See simplerandom_mwc64_prev(). */
+static inline void kiss2_prev_mwc64(SimpleRandomKISS2_t * p_kiss2)
 {
     uint64_t    mwc64;
 
-    mwc64 = UINT64_C(698769069) * p_kiss2->mwc_lower + p_kiss2->mwc_upper;
-    p_kiss2->mwc_upper = (mwc64 >> 32u);
-    p_kiss2->mwc_lower = (uint32_t)mwc64;
+    mwc64 = ((uint64_t)p_kiss2->mwc_upper << 32u) | p_kiss2->mwc_lower;
+    p_kiss2->mwc_upper = (uint32_t)(mwc64 % UINT64_C(698769069));
+    p_kiss2->mwc_lower = (uint32_t)(mwc64 / UINT64_C(698769069));
 }
 
-static inline void kiss2_next_cong(SimpleRandomKISS2_t * p_kiss2)
+/* The inverse of _simplerandom_kiss2_next_cong(). See simplerandom_cong_prev(). */
+static inline void kiss2_prev_cong(SimpleRandomKISS2_t * p_kiss2)
 {
-    p_kiss2->cong = UINT32_C(69069) * p_kiss2->cong + 12345u;
+    p_kiss2->cong = UINT32_C(0xA5E2A705) * (p_kiss2->cong - 12345u);
 }
 
-static inline void kiss2_next_shr3(SimpleRandomKISS2_t * p_kiss2)
+/* The inverse of _simplerandom_kiss2_next_shr3(). See simplerandom_shr3_prev(). */
+static inline void kiss2_prev_shr3(SimpleRandomKISS2_t * p_kiss2)
 {
     uint32_t    shr3;
 
     shr3 = p_kiss2->shr3;
-    shr3 ^= (shr3 << 13);
-    shr3 ^= (shr3 >> 17);
     shr3 ^= (shr3 << 5);
+    shr3 ^= (shr3 << 10);
+    shr3 ^= (shr3 << 20);
+    shr3 ^= (shr3 >> 17);
+    shr3 ^= (shr3 << 13);
+    shr3 ^= (shr3 << 26);
     p_kiss2->shr3 = shr3;
 }
 
-uint32_t simplerandom_kiss2_next(SimpleRandomKISS2_t * p_kiss2)
+uint32_t simplerandom_kiss2_prev(SimpleRandomKISS2_t * p_kiss2)
 {
-    kiss2_next_mwc64(p_kiss2);
-    kiss2_next_cong(p_kiss2);
-    kiss2_next_shr3(p_kiss2);
-    return kiss2_current(p_kiss2);
+    uint32_t    result;
+
+    result = kiss2_current(p_kiss2);
+    kiss2_prev_mwc64(p_kiss2);
+    kiss2_prev_cong(p_kiss2);
+    kiss2_prev_shr3(p_kiss2);
+    return result;
 }
 
 void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_data, size_t num_data)
@@ -876,23 +802,23 @@ void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_da
             {
                 case 0:
                     p_kiss2->mwc_upper ^= *p_data;
-                    kiss2_sanitize_mwc64(p_kiss2);
-                    kiss2_next_mwc64(p_kiss2);
+                    _simplerandom_kiss2_sanitize_mwc64(p_kiss2);
+                    _simplerandom_kiss2_next_mwc64(p_kiss2);
                     break;
                 case 1:
                     p_kiss2->mwc_lower ^= *p_data;
-                    kiss2_sanitize_mwc64(p_kiss2);
-                    kiss2_next_mwc64(p_kiss2);
+                    _simplerandom_kiss2_sanitize_mwc64(p_kiss2);
+                    _simplerandom_kiss2_next_mwc64(p_kiss2);
                     break;
                 case 2:
                     p_kiss2->cong ^= *p_data;
                     /* Cong doesn't need sanitise; all states are valid. */
-                    kiss2_next_cong(p_kiss2);
+                    _simplerandom_kiss2_next_cong(p_kiss2);
                     break;
                 case 3:
                     p_kiss2->shr3 ^= *p_data;
-                    kiss2_sanitize_shr3(p_kiss2);
-                    kiss2_next_shr3(p_kiss2);
+                    _simplerandom_kiss2_sanitize_shr3(p_kiss2);
+                    _simplerandom_kiss2_next_shr3(p_kiss2);
                     break;
             }
             ++p_data;
@@ -900,6 +826,25 @@ void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_da
     }
 }
 
+void simplerandom_kiss2_fill(SimpleRandomKISS2_t * p_kiss2, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomKISS2_t kiss2;
+
+    if (p_out != NULL)
+    {
+        kiss2 = *p_kiss2;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_kiss2_next_mwc64(&kiss2);
+            _simplerandom_kiss2_next_cong(&kiss2);
+            _simplerandom_kiss2_next_shr3(&kiss2);
+            *p_out++ = kiss2_current(&kiss2);
+        }
+        *p_kiss2 = kiss2;
+    }
+}
+
 #endif /* defined(UINT64_C) */
 
 
@@ -912,11 +857,6 @@ void simplerandom_kiss2_mix(SimpleRandomKISS2_t * p_kiss2, const uint32_t * p_da
 #define LFSR_SEED(X)            ((X) ^ ((X) << LFSR_SEED_SHIFT))
 #define LFSR_ALT_SEED(X)        ((X) << LFSR_ALT_SEED_SHIFT)
 
-#define LFSR_SEED_Z1_MIN_VALUE  2u
-#define LFSR_SEED_Z2_MIN_VALUE  8u
-#define LFSR_SEED_Z3_MIN_VALUE  16u
-#define LFSR_SEED_Z4_MIN_VALUE  128u
-
 size_t simplerandom_lfsr113_num_seeds(const SimpleRandomLFSR113_t * p_lfsr113)
 {
     (const void *)p_lfsr113;    /* We only use this parameter for type checking. */
@@ -966,10 +906,10 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
 
     /* Seed z1 */
     working_seed = LFSR_SEED(seed_z1);
-    if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z1);
-        if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -978,10 +918,10 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
 
     /* Seed z2 */
     working_seed = LFSR_SEED(seed_z2);
-    if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z2);
-        if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -990,10 +930,10 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
 
     /* Seed z3 */
     working_seed = LFSR_SEED(seed_z3);
-    if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z3);
-        if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -1002,10 +942,10 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
 
     /* Seed z4 */
     working_seed = LFSR_SEED(seed_z4);
-    if (working_seed < LFSR_SEED_Z4_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z4_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z4);
-        if (working_seed < LFSR_SEED_Z4_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z4_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -1013,119 +953,21 @@ void simplerandom_lfsr113_seed(SimpleRandomLFSR113_t * p_lfsr113, uint32_t seed_
     p_lfsr113->z4 = working_seed;
 }
 
-/* For most simplerandom generators, sanitise functions are used for both
- * seeding and for sanitising the mix function results. But for LFSR generators
- * with a more complex seeding function, the sanitise functions are specified
- * separately, and are relatively simple compared to the seeding function.
- */
-static inline void lfsr113_sanitize_z1(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr113->z1;
-    if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
-    {
-        p_lfsr113->z1 = ~working_seed;
-    }
-}
-
-static inline void lfsr113_sanitize_z2(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr113->z2;
-    if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
-    {
-        p_lfsr113->z2 = ~working_seed;
-    }
-}
-
-static inline void lfsr113_sanitize_z3(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr113->z3;
-    if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
-    {
-        p_lfsr113->z3 = ~working_seed;
-    }
-}
-
-static inline void lfsr113_sanitize_z4(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr113->z4;
-    if (working_seed < LFSR_SEED_Z4_MIN_VALUE)
-    {
-        p_lfsr113->z4 = ~working_seed;
-    }
-}
-
-void simplerandom_lfsr113_sanitize(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    lfsr113_sanitize_z1(p_lfsr113);
-    lfsr113_sanitize_z2(p_lfsr113);
-    lfsr113_sanitize_z3(p_lfsr113);
-    lfsr113_sanitize_z4(p_lfsr113);
-}
-
-static inline void lfsr113_next_z1(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    b;
-    uint32_t    z1;
-
-    z1 = p_lfsr113->z1;
-    b  = ((z1 << 6) ^ z1) >> 13;
-    z1 = ((z1 & UINT32_C(0xFFFFFFFE)) << 18) ^ b;
-    p_lfsr113->z1 = z1;
-}
-
-static inline void lfsr113_next_z2(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    b;
-    uint32_t    z2;
-
-    z2 = p_lfsr113->z2;
-    b  = ((z2 << 2) ^ z2) >> 27;
-    z2 = ((z2 & UINT32_C(0xFFFFFFF8)) << 2) ^ b;
-    p_lfsr113->z2 = z2;
-}
-
-static inline void lfsr113_next_z3(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    uint32_t    b;
-    uint32_t    z3;
-
-    z3 = p_lfsr113->z3;
-    b  = ((z3 << 13) ^ z3) >> 21;
-    z3 = ((z3 & UINT32_C(0xFFFFFFF0)) << 7) ^ b;
-    p_lfsr113->z3 = z3;
-}
-
-static inline void lfsr113_next_z4(SimpleRandomLFSR113_t * p_lfsr113)
+/* Each component steps back by its "previous" matrix from jumptables.h.
+ * This gives an equivalent state, not always the same one: stepping back to
+ * a freshly seeded state may give a state that differs from the seed in the
+ * lower bits that the 'next' operation never reads. It gives the same
+ * sequence. */
+uint32_t simplerandom_lfsr113_prev(SimpleRandomLFSR113_t * p_lfsr113)
 {
-    uint32_t    b;
-    uint32_t    z4;
+    uint32_t    result;
 
-    z4 = p_lfsr113->z4;
-    b  = ((z4 << 3) ^ z4) >> 12;
-    z4 = ((z4 & UINT32_C(0xFFFFFF80)) << 13) ^ b;
-    p_lfsr113->z4 = z4;
-}
-
-static inline uint32_t lfsr113_current(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    return (p_lfsr113->z1 ^ p_lfsr113->z2 ^ p_lfsr113->z3 ^ p_lfsr113->z4);
-}
-
-uint32_t simplerandom_lfsr113_next(SimpleRandomLFSR113_t * p_lfsr113)
-{
-    lfsr113_next_z1(p_lfsr113);
-    lfsr113_next_z2(p_lfsr113);
-    lfsr113_next_z3(p_lfsr113);
-    lfsr113_next_z4(p_lfsr113);
-    return lfsr113_current(p_lfsr113);
+    result = lfsr113_current(p_lfsr113);
+    p_lfsr113->z1 = bitcolumnmatrix32_mul_uint32(&lfsr113_1_prev_matrix, p_lfsr113->z1);
+    p_lfsr113->z2 = bitcolumnmatrix32_mul_uint32(&lfsr113_2_prev_matrix, p_lfsr113->z2);
+    p_lfsr113->z3 = bitcolumnmatrix32_mul_uint32(&lfsr113_3_prev_matrix, p_lfsr113->z3);
+    p_lfsr113->z4 = bitcolumnmatrix32_mul_uint32(&lfsr113_4_prev_matrix, p_lfsr113->z4);
+    return result;
 }
 
 void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t * p_data, size_t num_data)
@@ -1142,23 +984,23 @@ void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t
             {
                 case 0:
                     p_lfsr113->z1 ^= *p_data;
-                    lfsr113_sanitize_z1(p_lfsr113);
-                    lfsr113_next_z1(p_lfsr113);
+                    _simplerandom_lfsr113_sanitize_z1(p_lfsr113);
+                    _simplerandom_lfsr113_next_z1(p_lfsr113);
                     break;
                 case 1:
                     p_lfsr113->z2 ^= *p_data;
-                    lfsr113_sanitize_z2(p_lfsr113);
-                    lfsr113_next_z2(p_lfsr113);
+                    _simplerandom_lfsr113_sanitize_z2(p_lfsr113);
+                    _simplerandom_lfsr113_next_z2(p_lfsr113);
                     break;
                 case 2:
                     p_lfsr113->z3 ^= *p_data;
-                    lfsr113_sanitize_z3(p_lfsr113);
-                    lfsr113_next_z3(p_lfsr113);
+                    _simplerandom_lfsr113_sanitize_z3(p_lfsr113);
+                    _simplerandom_lfsr113_next_z3(p_lfsr113);
                     break;
                 case 3:
                     p_lfsr113->z4 ^= *p_data;
-                    lfsr113_sanitize_z4(p_lfsr113);
-                    lfsr113_next_z4(p_lfsr113);
+                    _simplerandom_lfsr113_sanitize_z4(p_lfsr113);
+                    _simplerandom_lfsr113_next_z4(p_lfsr113);
                     break;
             }
             ++p_data;
@@ -1166,6 +1008,26 @@ void simplerandom_lfsr113_mix(SimpleRandomLFSR113_t * p_lfsr113, const uint32_t
     }
 }
 
+void simplerandom_lfsr113_fill(SimpleRandomLFSR113_t * p_lfsr113, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR113_t   lfsr113;
+
+    if (p_out != NULL)
+    {
+        lfsr113 = *p_lfsr113;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_lfsr113_next_z1(&lfsr113);
+            _simplerandom_lfsr113_next_z2(&lfsr113);
+            _simplerandom_lfsr113_next_z3(&lfsr113);
+            _simplerandom_lfsr113_next_z4(&lfsr113);
+            *p_out++ = lfsr113_current(&lfsr113);
+        }
+        *p_lfsr113 = lfsr113;
+    }
+}
+
 /*********
  * LFSR88
  ********/
@@ -1210,10 +1072,10 @@ void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1,
 
     /* Seed z1 */
     working_seed = LFSR_SEED(seed_z1);
-    if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z1);
-        if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z1_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -1222,10 +1084,10 @@ void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1,
 
     /* Seed z2 */
     working_seed = LFSR_SEED(seed_z2);
-    if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z2);
-        if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z2_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -1234,10 +1096,10 @@ void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1,
 
     /* Seed z3 */
     working_seed = LFSR_SEED(seed_z3);
-    if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
+    if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
     {
         working_seed = LFSR_ALT_SEED(seed_z3);
-        if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
+        if (working_seed < SIMPLERANDOM_LFSR_Z3_MIN_VALUE)
         {
             working_seed = ~working_seed;
         }
@@ -1245,90 +1107,16 @@ void simplerandom_lfsr88_seed(SimpleRandomLFSR88_t * p_lfsr88, uint32_t seed_z1,
     p_lfsr88->z3 = working_seed;
 }
 
-static inline void lfsr88_sanitize_z1(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr88->z1;
-    if (working_seed < LFSR_SEED_Z1_MIN_VALUE)
-    {
-        p_lfsr88->z1 = ~working_seed;
-    }
-}
-
-static inline void lfsr88_sanitize_z2(SimpleRandomLFSR88_t * p_lfsr88)
+/* See simplerandom_lfsr113_prev(). */
+uint32_t simplerandom_lfsr88_prev(SimpleRandomLFSR88_t * p_lfsr88)
 {
-    uint32_t    working_seed;
+    uint32_t    result;
 
-    working_seed = p_lfsr88->z2;
-    if (working_seed < LFSR_SEED_Z2_MIN_VALUE)
-    {
-        p_lfsr88->z2 = ~working_seed;
-    }
-}
-
-static inline void lfsr88_sanitize_z3(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    uint32_t    working_seed;
-
-    working_seed = p_lfsr88->z3;
-    if (working_seed < LFSR_SEED_Z3_MIN_VALUE)
-    {
-        p_lfsr88->z3 = ~working_seed;
-    }
-}
-
-void simplerandom_lfsr88_sanitize(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    lfsr88_sanitize_z1(p_lfsr88);
-    lfsr88_sanitize_z2(p_lfsr88);
-    lfsr88_sanitize_z3(p_lfsr88);
-}
-
-static inline void lfsr88_next_z1(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    uint32_t    b;
-    uint32_t    z1;
-
-    z1 = p_lfsr88->z1;
-    b  = ((z1 << 13) ^ z1) >> 19;
-    z1 = ((z1 & UINT32_C(0xFFFFFFFE)) << 12) ^ b;
-    p_lfsr88->z1 = z1;
-}
-
-static inline void lfsr88_next_z2(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    uint32_t    b;
-    uint32_t    z2;
-
-    z2 = p_lfsr88->z2;
-    b  = ((z2 << 2) ^ z2) >> 25;
-    z2 = ((z2 & UINT32_C(0xFFFFFFF8)) << 4) ^ b;
-    p_lfsr88->z2 = z2;
-}
-
-static inline void lfsr88_next_z3(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    uint32_t    b;
-    uint32_t    z3;
-
-    z3 = p_lfsr88->z3;
-    b  = ((z3 << 3) ^ z3) >> 11;
-    z3 = ((z3 & UINT32_C(0xFFFFFFF0)) << 17) ^ b;
-    p_lfsr88->z3 = z3;
-}
-
-static inline uint32_t lfsr88_current(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    return (p_lfsr88->z1 ^ p_lfsr88->z2 ^ p_lfsr88->z3);
-}
-
-uint32_t simplerandom_lfsr88_next(SimpleRandomLFSR88_t * p_lfsr88)
-{
-    lfsr88_next_z1(p_lfsr88);
-    lfsr88_next_z2(p_lfsr88);
-    lfsr88_next_z3(p_lfsr88);
-    return lfsr88_current(p_lfsr88);
+    result = lfsr88_current(p_lfsr88);
+    p_lfsr88->z1 = bitcolumnmatrix32_mul_uint32(&lfsr88_1_prev_matrix, p_lfsr88->z1);
+    p_lfsr88->z2 = bitcolumnmatrix32_mul_uint32(&lfsr88_2_prev_matrix, p_lfsr88->z2);
+    p_lfsr88->z3 = bitcolumnmatrix32_mul_uint32(&lfsr88_3_prev_matrix, p_lfsr88->z3);
+    return result;
 }
 
 void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p_data, size_t num_data)
@@ -1349,23 +1137,42 @@ void simplerandom_lfsr88_mix(SimpleRandomLFSR88_t * p_lfsr88, const uint32_t * p
             if (current < UINT32_C(1431655765))         /* constant is 2^32 / 3 */
             {
                 p_lfsr88->z1 ^= *p_data;
-                lfsr88_sanitize_z1(p_lfsr88);
-                lfsr88_next_z1(p_lfsr88);
+                _simplerandom_lfsr88_sanitize_z1(p_lfsr88);
+                _simplerandom_lfsr88_next_z1(p_lfsr88);
             }
             else if (current < UINT32_C(2863311531))    /* constant is 2^32 * 2 / 3 */
             {
                 p_lfsr88->z2 ^= *p_data;
-                lfsr88_sanitize_z2(p_lfsr88);
-                lfsr88_next_z2(p_lfsr88);
+                _simplerandom_lfsr88_sanitize_z2(p_lfsr88);
+                _simplerandom_lfsr88_next_z2(p_lfsr88);
             }
             else
             {
                 p_lfsr88->z3 ^= *p_data;
-                lfsr88_sanitize_z3(p_lfsr88);
-                lfsr88_next_z3(p_lfsr88);
+                _simplerandom_lfsr88_sanitize_z3(p_lfsr88);
+                _simplerandom_lfsr88_next_z3(p_lfsr88);
             }
             ++p_data;
         }
     }
 }
 
+void simplerandom_lfsr88_fill(SimpleRandomLFSR88_t * p_lfsr88, uint32_t * p_out, size_t num_out)
+{
+    SimpleRandomLFSR88_t    lfsr88;
+
+    if (p_out != NULL)
+    {
+        lfsr88 = *p_lfsr88;
+        while (num_out)
+        {
+            --num_out;
+            _simplerandom_lfsr88_next_z1(&lfsr88);
+            _simplerandom_lfsr88_next_z2(&lfsr88);
+            _simplerandom_lfsr88_next_z3(&lfsr88);
+            *p_out++ = lfsr88_current(&lfsr88);
+        }
+        *p_lfsr88 = lfsr88;
+    }
+}
+
@@ -0,0 +1,381 @@
+/*
+ * bench.c
+ *
+ * Micro-benchmarks for each generator:
+ *     next        ns per simplerandom_zzz_next() call
+ *     fill        GB/s of output from simplerandom_zzz_fill()
+ *     fill_normal, fill_exponential
+ *                 ns per value from simplerandom_zzz_fill_normal() and
+ *                 simplerandom_zzz_fill_exponential()
+ *     discard     ns per simplerandom_zzz_discard() call, for a range of 'n'
+ *     seed_array  ns per simplerandom_zzz_seed_array() call
+ *     mix         ns per 32-bit word for simplerandom_zzz_mix()
+ *
+ * Each measurement is done after a warm-up run, and is repeated; the fastest
+ * repeat is reported, as the one least disturbed by other activity. On Linux,
+ * the process is pinned to one CPU, so timings don't include migrations.
+ *
+ * Usage:
+ *     bench [--csv | --json] [--cpu N] [--repeats N] [--quick] [generator...]
+ *
+ * Output is CSV by default, with columns:
+ *     generator,benchmark,n,value,unit
+ * or with --json, an array of objects with those fields.
+ * If generator names are given, only those generators are measured.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define FILL_BUFFER_LEN         (64u * 1024u)
+#define MIX_BUFFER_LEN          4096u
+#define DOUBLE_BUFFER_LEN       4096u
+#define DISCARD_REPEATS         1000u
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef enum
+{
+    OUTPUT_CSV,
+    OUTPUT_JSON,
+} OutputFormat_t;
+
+typedef struct
+{
+    OutputFormat_t  format;
+    unsigned        repeats;
+    unsigned long   scale;
+    size_t          num_records;
+} BenchOptions_t;
+
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static BenchOptions_t   options;
+
+/* Results are accumulated here, so the compiler can't remove the calls. */
+static volatile uint32_t sink;
+
+static uint32_t         fill_buffer[FILL_BUFFER_LEN];
+static uint32_t         mix_buffer[MIX_BUFFER_LEN];
+static double           double_buffer[DOUBLE_BUFFER_LEN];
+
+static const uintmax_t  discard_n_values[] =
+{
+    UINTMAX_C(1),
+    UINTMAX_C(1000),
+    UINTMAX_C(1000000),
+    UINTMAX_C(1000000000),
+    UINTMAX_C(1000000000000),
+    UINTMAX_C(1000000000000000),
+    UINTMAX_C(0xFFFFFFFFFFFFFFFF),
+};
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+static double time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void pin_cpu(int cpu)
+{
+#ifdef __linux__
+    cpu_set_t   cpu_set;
+
+    if (cpu < 0)
+        cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+        if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+            fprintf(stderr, "bench: couldn't pin to CPU %d\n", cpu);
+    }
+#else
+    (void)cpu;
+#endif
+}
+
+static void print_header(void)
+{
+    if (options.format == OUTPUT_JSON)
+        printf("[");
+    else
+        printf("generator,benchmark,n,value,unit\n");
+}
+
+static void print_footer(void)
+{
+    if (options.format == OUTPUT_JSON)
+        printf("\n]\n");
+}
+
+static void print_record(const char * p_generator, const char * p_benchmark, uintmax_t n, double value, const char * p_unit)
+{
+    if (options.format == OUTPUT_JSON)
+    {
+        printf("%s\n  {\"generator\": \"%s\", \"benchmark\": \"%s\", \"n\": %"PRIuMAX", \"value\": %.4f, \"unit\": \"%s\"}",
+               options.num_records ? "," : "", p_generator, p_benchmark, n, value, p_unit);
+    }
+    else
+    {
+        printf("%s,%s,%"PRIuMAX",%.4f,%s\n", p_generator, p_benchmark, n, value, p_unit);
+    }
+    options.num_records++;
+    fflush(stdout);
+}
+
+/* Time 'BODY' (options.repeats + 1) times, and put the fastest time in
+ * 'BEST', in ns. The first run is a warm-up, and is not counted. */
+#define TIME_BEST(BEST, BODY)                                                   \
+    do {                                                                    \
+        unsigned    rep_;                                                   \
+        double      start_;                                                 \
+        double      elapsed_;                                               \
+                                                                            \
+        for (rep_ = 0; rep_ <= options.repeats; rep_++)                     \
+        {                                                                   \
+            start_ = time_ns();                                             \
+            BODY;                                                           \
+            elapsed_ = time_ns() - start_;                                  \
+            if (rep_ == 1u || (rep_ > 1u && elapsed_ < (BEST)))             \
+                (BEST) = elapsed_;                                          \
+        }                                                                   \
+    } while (0)
+
+/* Benchmarks of the normal and exponential distributions, which are only
+ * available with 64-bit integer support. For use in BENCH_GENERATOR(). */
+#ifdef UINT64_C
+#define BENCH_ZIGGURAT(NAME)                                                    \
+    count = 1000ul / options.scale + 1u;                                    \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+            simplerandom_##NAME##_fill_normal(&rng, double_buffer, DOUBLE_BUFFER_LEN)); \
+    acc ^= (uint32_t)(int32_t)double_buffer[DOUBLE_BUFFER_LEN - 1u];        \
+    print_record(#NAME, "fill_normal", DOUBLE_BUFFER_LEN,                   \
+                 best / ((double)count * DOUBLE_BUFFER_LEN), "ns/value");   \
+                                                                            \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+            simplerandom_##NAME##_fill_exponential(&rng, double_buffer, DOUBLE_BUFFER_LEN)); \
+    acc ^= (uint32_t)(int32_t)double_buffer[DOUBLE_BUFFER_LEN - 1u];        \
+    print_record(#NAME, "fill_exponential", DOUBLE_BUFFER_LEN,              \
+                 best / ((double)count * DOUBLE_BUFFER_LEN), "ns/value");
+#else
+#define BENCH_ZIGGURAT(NAME)
+#endif
+
+/* Define a function bench_zzz() that runs all the benchmarks for generator
+ * 'zzz'. This is a macro rather than a function taking function pointers, so
+ * that the calls being timed are direct calls, the same as in a program using
+ * the library. */
+#define BENCH_GENERATOR(NAME, TYPE)                                             \
+static void bench_##NAME(void)                                              \
+{                                                                           \
+    TYPE            rng;                                                    \
+    uint32_t        seeds[16];                                              \
+    uint32_t        acc;                                                    \
+    unsigned long   count;                                                  \
+    unsigned long   i;                                                      \
+    size_t          k;                                                      \
+    size_t          num_seeds;                                              \
+    double          best;                                                   \
+                                                                            \
+    for (k = 0; k < sizeof(seeds) / sizeof(seeds[0]); k++)                 \
+        seeds[k] = (uint32_t)(k * UINT32_C(2654435761) + 1u);               \
+    memset(&rng, 0, sizeof(rng));                                           \
+    num_seeds = simplerandom_##NAME##_num_seeds(&rng);                      \
+    simplerandom_##NAME##_seed_array(&rng, seeds, num_seeds, false);        \
+    acc = 0;                                                                \
+    best = 0;                                                               \
+                                                                            \
+    count = 10000000ul / options.scale;                                     \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+            acc ^= simplerandom_##NAME##_next(&rng));                       \
+    print_record(#NAME, "next", count, best / count, "ns/call");            \
+                                                                            \
+    count = 256ul / options.scale + 1u;                                     \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+            simplerandom_##NAME##_fill(&rng, fill_buffer, FILL_BUFFER_LEN)); \
+    acc ^= fill_buffer[FILL_BUFFER_LEN - 1u];                               \
+    print_record(#NAME, "fill", FILL_BUFFER_LEN,                            \
+                 (double)count * FILL_BUFFER_LEN * sizeof(uint32_t) / best, "GB/s"); \
+                                                                            \
+    BENCH_ZIGGURAT(NAME)                                                    \
+                                                                            \
+    /* Each discard depends on the previous state, so this measures */      \
+    /* latency, not throughput. 'n' is varied slightly between calls. */    \
+    count = DISCARD_REPEATS / options.scale + 1u;                           \
+    for (k = 0; k < sizeof(discard_n_values) / sizeof(discard_n_values[0]); k++) \
+    {                                                                       \
+        TIME_BEST(best,                                                     \
+            for (i = 0; i < count; i++)                                     \
+                simplerandom_##NAME##_discard(&rng, discard_n_values[k] - (i & 1u))); \
+        acc ^= simplerandom_##NAME##_next(&rng);                            \
+        print_record(#NAME, "discard", discard_n_values[k], best / count, "ns/call"); \
+    }                                                                       \
+                                                                            \
+    count = 1000000ul / options.scale;                                      \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+        {                                                                   \
+            seeds[0] = (uint32_t)i;                                         \
+            simplerandom_##NAME##_seed_array(&rng, seeds, num_seeds, false); \
+            acc ^= rng.NAME##_BENCH_STATE_FIELD;                            \
+        });                                                                 \
+    print_record(#NAME, "seed_array", num_seeds, best / count, "ns/call");  \
+                                                                            \
+    for (k = 0; k < MIX_BUFFER_LEN; k++)                                    \
+        mix_buffer[k] = (uint32_t)(k * UINT32_C(2246822519));               \
+    count = 1000ul / options.scale + 1u;                                    \
+    TIME_BEST(best,                                                         \
+        for (i = 0; i < count; i++)                                         \
+            simplerandom_##NAME##_mix(&rng, mix_buffer, MIX_BUFFER_LEN));   \
+    acc ^= simplerandom_##NAME##_next(&rng);                                \
+    print_record(#NAME, "mix", MIX_BUFFER_LEN, best / ((double)count * MIX_BUFFER_LEN), "ns/word"); \
+                                                                            \
+    sink ^= acc;                                                            \
+}
+
+/* A state field of each generator, read after seeding so that the seed call
+ * can't be optimised away. */
+#define cong_BENCH_STATE_FIELD      cong
+#define shr3_BENCH_STATE_FIELD      shr3
+#define mwc1_BENCH_STATE_FIELD      mwc_upper
+#define mwc2_BENCH_STATE_FIELD      mwc_upper
+#define kiss_BENCH_STATE_FIELD      mwc_upper
+#define mwc64_BENCH_STATE_FIELD     mwc_upper
+#define kiss2_BENCH_STATE_FIELD     mwc_upper
+#define lfsr113_BENCH_STATE_FIELD   z1
+#define lfsr88_BENCH_STATE_FIELD    z1
+
+BENCH_GENERATOR(cong, SimpleRandomCong_t)
+BENCH_GENERATOR(shr3, SimpleRandomSHR3_t)
+BENCH_GENERATOR(mwc1, SimpleRandomMWC1_t)
+BENCH_GENERATOR(mwc2, SimpleRandomMWC2_t)
+BENCH_GENERATOR(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+BENCH_GENERATOR(mwc64, SimpleRandomMWC64_t)
+BENCH_GENERATOR(kiss2, SimpleRandomKISS2_t)
+#endif
+BENCH_GENERATOR(lfsr113, SimpleRandomLFSR113_t)
+BENCH_GENERATOR(lfsr88, SimpleRandomLFSR88_t)
+
+static const struct
+{
+    const char *    p_name;
+    void            (*p_bench)(void);
+} generators[] =
+{
+    { "cong",       bench_cong },
+    { "shr3",       bench_shr3 },
+    { "mwc1",       bench_mwc1 },
+    { "mwc2",       bench_mwc2 },
+    { "kiss",       bench_kiss },
+#ifdef UINT64_C
+    { "mwc64",      bench_mwc64 },
+    { "kiss2",      bench_kiss2 },
+#endif
+    { "lfsr113",    bench_lfsr113 },
+    { "lfsr88",     bench_lfsr88 },
+};
+
+#define NUM_GENERATORS      (sizeof(generators) / sizeof(generators[0]))
+
+static void usage(void)
+{
+    size_t  i;
+
+    fprintf(stderr, "Usage: bench [--csv | --json] [--cpu N] [--repeats N] [--quick] [generator...]\n");
+    fprintf(stderr, "Generators:");
+    for (i = 0; i < NUM_GENERATORS; i++)
+        fprintf(stderr, " %s", generators[i].p_name);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char ** argv)
+{
+    bool    selected[NUM_GENERATORS];
+    bool    any_selected;
+    int     cpu;
+    int     arg;
+    size_t  i;
+
+    options.format = OUTPUT_CSV;
+    options.repeats = 5u;
+    options.scale = 1u;
+    options.num_records = 0;
+    cpu = -1;
+    any_selected = false;
+    memset(selected, 0, sizeof(selected));
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--csv") == 0)
+            options.format = OUTPUT_CSV;
+        else if (strcmp(argv[arg], "--json") == 0)
+            options.format = OUTPUT_JSON;
+        else if (strcmp(argv[arg], "--quick") == 0)
+            options.scale = 100u;
+        else if (strcmp(argv[arg], "--cpu") == 0 && arg + 1 < argc)
+            cpu = atoi(argv[++arg]);
+        else if (strcmp(argv[arg], "--repeats") == 0 && arg + 1 < argc)
+            options.repeats = (unsigned)atoi(argv[++arg]);
+        else
+        {
+            for (i = 0; i < NUM_GENERATORS; i++)
+            {
+                if (strcmp(argv[arg], generators[i].p_name) == 0)
+                    break;
+            }
+            if (i == NUM_GENERATORS)
+            {
+                usage();
+                return 2;
+            }
+            selected[i] = true;
+            any_selected = true;
+        }
+    }
+    if (options.repeats == 0)
+        options.repeats = 1u;
+
+    pin_cpu(cpu);
+    print_header();
+    for (i = 0; i < NUM_GENERATORS; i++)
+    {
+        if (!any_selected || selected[i])
+            generators[i].p_bench();
+    }
+    print_footer();
+    return 0;
+}
@@ -1 +1,2 @@
-gcc test_testu01.c ../simplerandom.c -I".." -o test_testu01 -ltestu01 -lprobdist -lmylib -lwsock32
\ No newline at end of file
+gcc -O2 test_testu01.c ../simplerandom.c ../simplerandom-discard.c ../bitcolumnmatrix.c ../maths.c ../jumptables.c -I".." -o test_testu01 -ltestu01 -lprobdist -lmylib -lwsock32
+gcc -O2 stream.c ../simplerandom.c ../simplerandom-discard.c ../bitcolumnmatrix.c ../maths.c ../jumptables.c -I".." -o stream
\ No newline at end of file
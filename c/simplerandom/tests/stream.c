@@ -0,0 +1,120 @@
+/*
+ * stream.c
+ *
+ * Write the raw output of a generator to stdout, for external test suites
+ * that read random data from a pipe. E.g. for PractRand [1]:
+ *
+ *     stream kiss2 | RNG_test stdin32
+ *
+ * Output is 32-bit values in native byte order, generated by
+ * simplerandom_zzz_fill() into a large buffer, so the test suite rather than
+ * the generator is the limit on speed.
+ *
+ * Usage:
+ *     stream [--count N] [--seed S]... generator
+ *
+ * Without --count, output continues until the reader closes the pipe.
+ * Without --seed, the generator has the same default seed as test_testu01.
+ * Each --seed gives one 32-bit value for simplerandom_zzz_seed_array().
+ *
+ * References:
+ *
+ * [1]: http://pracrand.sourceforge.net/
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include "test_generators.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define STREAM_BUFFER_LEN       (64u * 1024u)
+#define MAX_SEEDS               16u
+
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static uint32_t         stream_buffer[STREAM_BUFFER_LEN];
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+static void usage(void)
+{
+    size_t      i;
+
+    fprintf(stderr, "Usage: stream [--count N] [--seed S]... generator\n");
+    fprintf(stderr, "Generators:");
+    for (i = 0; i < NUM_TEST_GENERATORS; i++)
+        fprintf(stderr, " %s", test_generators[i].p_name);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char ** argv)
+{
+    const TestGenerator_t * p_gen = NULL;
+    uint32_t                seeds[MAX_SEEDS];
+    size_t                  num_seeds = 0;
+    unsigned long long      count = 0;
+    int                     have_count = 0;
+    size_t                  len;
+    int                     arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--count") == 0 && arg + 1 < argc)
+        {
+            count = strtoull(argv[++arg], NULL, 0);
+            have_count = 1;
+        }
+        else if (strcmp(argv[arg], "--seed") == 0 && arg + 1 < argc && num_seeds < MAX_SEEDS)
+        {
+            seeds[num_seeds++] = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        }
+        else if (p_gen == NULL && test_generator_find(argv[arg]) != NULL)
+        {
+            p_gen = test_generator_find(argv[arg]);
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+    if (p_gen == NULL)
+    {
+        usage();
+        return 2;
+    }
+
+#ifdef _WIN32
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    p_gen->p_seed(seeds, num_seeds);
+    while (!have_count || count != 0)
+    {
+        len = STREAM_BUFFER_LEN;
+        if (have_count && count < len)
+            len = (size_t)count;
+        p_gen->p_fill(stream_buffer, len);
+        /* A short write means the reader has finished. */
+        if (fwrite(stream_buffer, sizeof(stream_buffer[0]), len, stdout) != len)
+            return 0;
+        count -= len;
+    }
+    fflush(stdout);
+    return 0;
+}
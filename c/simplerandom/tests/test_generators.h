@@ -0,0 +1,126 @@
+/*
+ * test_generators.h
+ *
+ * A table of all the generators, for the statistical test programs
+ * (test_testu01.c and stream.c), so they can pick a generator by name at
+ * run-time.
+ *
+ * Each generator has one static state. Its default seed is the one used for
+ * the results in tests/results/, so those results can be reproduced. Output
+ * is generated by simplerandom_zzz_fill(), which gives the same sequence as
+ * repeated simplerandom_zzz_next() calls, but faster.
+ *
+ * This defines static variables and functions, so include it in only one
+ * source file of a program.
+ */
+
+#ifndef _TEST_GENERATORS_H
+#define _TEST_GENERATORS_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "simplerandom.h"
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef struct
+{
+    /* Name as used on the command line, and in result file names. */
+    const char *    p_name;
+    /* Heading used in the results summary. */
+    const char *    p_title;
+    /* Seed the generator. With no seeds, use the default seed. */
+    void            (*p_seed)(const uint32_t * p_seeds, size_t num_seeds);
+    /* Generate the next 'num_out' values. */
+    void            (*p_fill)(uint32_t * p_out, size_t num_out);
+} TestGenerator_t;
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* Define the state and the seed and fill functions of generator 'zzz'.
+ * DEFAULT_SEED seeds 'zzz_state' with the default seed. */
+#define TEST_GENERATOR(NAME, TYPE, DEFAULT_SEED)                                \
+static TYPE NAME##_state;                                                   \
+                                                                            \
+static void NAME##_seed(const uint32_t * p_seeds, size_t num_seeds)         \
+{                                                                           \
+    if (num_seeds == 0)                                                     \
+    {                                                                       \
+        DEFAULT_SEED;                                                       \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        simplerandom_##NAME##_seed_array(&NAME##_state, p_seeds, num_seeds, true); \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static void NAME##_fill(uint32_t * p_out, size_t num_out)                   \
+{                                                                           \
+    simplerandom_##NAME##_fill(&NAME##_state, p_out, num_out);              \
+}
+
+TEST_GENERATOR(cong, SimpleRandomCong_t,
+    simplerandom_cong_seed(&cong_state, UINT32_C(2051391225)))
+TEST_GENERATOR(shr3, SimpleRandomSHR3_t,
+    simplerandom_shr3_seed(&shr3_state, UINT32_C(3360276411)))
+TEST_GENERATOR(mwc1, SimpleRandomMWC1_t,
+    simplerandom_mwc1_seed(&mwc1_state, UINT32_C(12345), UINT32_C(65437)))
+TEST_GENERATOR(mwc2, SimpleRandomMWC2_t,
+    simplerandom_mwc2_seed(&mwc2_state, UINT32_C(12345), UINT32_C(65437)))
+TEST_GENERATOR(kiss, SimpleRandomKISS_t,
+    simplerandom_kiss_seed(&kiss_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837)))
+#ifdef UINT64_C
+TEST_GENERATOR(mwc64, SimpleRandomMWC64_t,
+    simplerandom_mwc64_seed(&mwc64_state, UINT32_C(7654321), UINT32_C(521288629)))
+TEST_GENERATOR(kiss2, SimpleRandomKISS2_t,
+    simplerandom_kiss2_seed(&kiss2_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837)))
+#endif /* defined(UINT64_C) */
+TEST_GENERATOR(lfsr113, SimpleRandomLFSR113_t,
+    simplerandom_lfsr113_seed(&lfsr113_state, 0, 0, 0, 0))
+TEST_GENERATOR(lfsr88, SimpleRandomLFSR88_t,
+    simplerandom_lfsr88_seed(&lfsr88_state, 0, 0, 0))
+
+static const TestGenerator_t test_generators[] =
+{
+    { "cong",       "Cong",     cong_seed,      cong_fill },
+    { "shr3",       "SHR3",     shr3_seed,      shr3_fill },
+    { "mwc1",       "MWC1",     mwc1_seed,      mwc1_fill },
+    { "mwc2",       "MWC2",     mwc2_seed,      mwc2_fill },
+#ifdef UINT64_C
+    { "mwc64",      "MWC64",    mwc64_seed,     mwc64_fill },
+#endif
+    { "kiss",       "KISS",     kiss_seed,      kiss_fill },
+#ifdef UINT64_C
+    { "kiss2",      "KISS2",    kiss2_seed,     kiss2_fill },
+#endif
+    { "lfsr113",    "LFSR113",  lfsr113_seed,   lfsr113_fill },
+    { "lfsr88",     "LFSR88",   lfsr88_seed,    lfsr88_fill },
+};
+
+#define NUM_TEST_GENERATORS     (sizeof(test_generators) / sizeof(test_generators[0]))
+
+/* Find a generator by name. Returns NULL if there is none. */
+static const TestGenerator_t * test_generator_find(const char * p_name)
+{
+    size_t      i;
+
+    for (i = 0; i < NUM_TEST_GENERATORS; i++)
+    {
+        if (strcmp(p_name, test_generators[i].p_name) == 0)
+            return &test_generators[i];
+    }
+    return NULL;
+}
+
+#endif /* !defined(_TEST_GENERATORS_H) */
@@ -0,0 +1,89 @@
+/*
+ * test_inline.c
+ *
+ * Test the SIMPLERANDOM_INLINE build mode. The inline sanitize and next
+ * functions must give the same results as the library's out-of-line
+ * functions. simplerandom_zzz_seed() and simplerandom_zzz_fill() are not
+ * inline, so they give the library's results to compare against.
+ */
+
+#define SIMPLERANDOM_INLINE
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "simplerandom.h"
+
+#define NUM_VALUES      10000u
+
+/* Seed 'rng' from 'seeds'. The inline sanitize function must leave the
+ * seeded state unchanged. Then compare NUM_VALUES values from the inline next
+ * function with those from the library's fill function. */
+#define TEST_INLINE(NAME, TYPE)                                                 \
+static int test_inline_##NAME(const uint32_t * p_seeds)                     \
+{                                                                           \
+    TYPE        rng;                                                        \
+    TYPE        fill_rng;                                                   \
+    uint32_t    values[NUM_VALUES];                                         \
+    size_t      i;                                                          \
+                                                                            \
+    simplerandom_##NAME##_seed_array(&rng, p_seeds, 4u, false);             \
+    fill_rng = rng;                                                         \
+    simplerandom_##NAME##_sanitize(&rng);                                   \
+    if (memcmp(&rng, &fill_rng, sizeof(rng)) != 0)                          \
+    {                                                                       \
+        printf("    " #NAME " sanitize changed a seeded state\n");          \
+        return 1;                                                           \
+    }                                                                       \
+    simplerandom_##NAME##_fill(&fill_rng, values, NUM_VALUES);              \
+    for (i = 0; i < NUM_VALUES; i++)                                        \
+    {                                                                       \
+        if (simplerandom_##NAME##_next(&rng) != values[i])                  \
+        {                                                                   \
+            printf("    " #NAME " next mismatch at %u\n", (unsigned)i);     \
+            return 1;                                                       \
+        }                                                                   \
+    }                                                                       \
+    if (memcmp(&rng, &fill_rng, sizeof(rng)) != 0)                          \
+    {                                                                       \
+        printf("    " #NAME " state mismatch\n");                           \
+        return 1;                                                           \
+    }                                                                       \
+    return 0;                                                               \
+}
+
+TEST_INLINE(cong, SimpleRandomCong_t)
+TEST_INLINE(shr3, SimpleRandomSHR3_t)
+TEST_INLINE(mwc1, SimpleRandomMWC1_t)
+TEST_INLINE(mwc2, SimpleRandomMWC2_t)
+TEST_INLINE(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+TEST_INLINE(mwc64, SimpleRandomMWC64_t)
+TEST_INLINE(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+TEST_INLINE(lfsr113, SimpleRandomLFSR113_t)
+TEST_INLINE(lfsr88, SimpleRandomLFSR88_t)
+
+int main(void)
+{
+    static const uint32_t   seeds[4] = {
+        UINT32_C(2051391225), UINT32_C(3360276411), UINT32_C(2374144069), UINT32_C(1046675282),
+    };
+    int                     ret_val = 0;
+
+    printf("Inline next and sanitize tests\n");
+    ret_val |= test_inline_cong(seeds);
+    ret_val |= test_inline_shr3(seeds);
+    ret_val |= test_inline_mwc1(seeds);
+    ret_val |= test_inline_mwc2(seeds);
+    ret_val |= test_inline_kiss(seeds);
+#ifdef UINT64_C
+    ret_val |= test_inline_mwc64(seeds);
+    ret_val |= test_inline_kiss2(seeds);
+#endif
+    ret_val |= test_inline_lfsr113(seeds);
+    ret_val |= test_inline_lfsr88(seeds);
+    printf("    %s\n", ret_val ? "FAILED" : "OK");
+    return ret_val;
+}
@@ -1,13 +1,19 @@
 
 #define __STDC_CONSTANT_MACROS
 #include "simplerandom-c.h"
+#include "simplerandom-cpp.h"
 
 #include <time.h>
 
 #define CXXTEST_HAVE_EH
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <random>
+#include <vector>
 
 class SimpleRandomWrapper
 {
@@ -16,6 +22,22 @@ public:
     virtual size_t num_seeds() = 0;
     virtual void discard(uintmax_t n) = 0;
     virtual void mix(uint32_t * p_mix_array, size_t n) = 0;
+    virtual void fill(uint32_t * p_out, size_t n) = 0;
+    virtual void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) = 0;
+    virtual uint32_t at(uintmax_t i) = 0;
+    virtual uint32_t prev() = 0;
+    // Compare the whole generator state with another wrapper of the same type
+    virtual bool same_state(const SimpleRandomWrapper * p_other) const = 0;
+    virtual void fill_float(float * p_out, size_t n, unsigned bits) = 0;
+    virtual void fill_double(double * p_out, size_t n, unsigned bits) = 0;
+    virtual uint32_t uniform_u32(uint32_t bound) = 0;
+    virtual void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) = 0;
+    virtual double normal() = 0;
+    virtual void fill_normal(double * p_out, size_t n) = 0;
+    virtual double exponential() = 0;
+    virtual void fill_exponential(double * p_out, size_t n) = 0;
+    // Split into streams, and get the first value of each stream
+    virtual void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams) = 0;
 
     // Standard C++ random API
     typedef uint32_t result_type;
@@ -45,6 +67,29 @@ public:
     uint32_t operator()() { return simplerandom_cong_next(&rng); }
     void discard(uintmax_t n) { simplerandom_cong_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_cong_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_cong_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_cong_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_cong_at(&rng, i); }
+    uint32_t prev() { return simplerandom_cong_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperCong *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_cong_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_cong_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_cong_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_cong_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_cong_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_cong_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_cong_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_cong_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomCong_t> streams(n_streams);
+        simplerandom_cong_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_cong_next(&streams[i]);
+    }
 };
 
 typedef SimpleRandomWrapperCong SimpleRandomSeeder;
@@ -64,6 +109,29 @@ public:
     uint32_t operator()() { return simplerandom_shr3_next(&rng); }
     void discard(uintmax_t n) { simplerandom_shr3_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_shr3_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_shr3_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_shr3_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_shr3_at(&rng, i); }
+    uint32_t prev() { return simplerandom_shr3_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperSHR3 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_shr3_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_shr3_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_shr3_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_shr3_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_shr3_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_shr3_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_shr3_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_shr3_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomSHR3_t> streams(n_streams);
+        simplerandom_shr3_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_shr3_next(&streams[i]);
+    }
     uint32_t min() const
     {
         // SHR3 is exceptional in that it doesn't ever return 0.
@@ -86,6 +154,29 @@ public:
     uint32_t operator()() { return simplerandom_mwc1_next(&rng); }
     void discard(uintmax_t n) { simplerandom_mwc1_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_mwc1_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_mwc1_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_mwc1_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_mwc1_at(&rng, i); }
+    uint32_t prev() { return simplerandom_mwc1_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperMWC1 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_mwc1_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_mwc1_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_mwc1_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_mwc1_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_mwc1_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_mwc1_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_mwc1_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_mwc1_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomMWC1_t> streams(n_streams);
+        simplerandom_mwc1_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_mwc1_next(&streams[i]);
+    }
 };
 
 class SimpleRandomWrapperMWC2 : public SimpleRandomWrapper
@@ -103,6 +194,29 @@ public:
     uint32_t operator()() { return simplerandom_mwc2_next(&rng); }
     void discard(uintmax_t n) { simplerandom_mwc2_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_mwc2_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_mwc2_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_mwc2_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_mwc2_at(&rng, i); }
+    uint32_t prev() { return simplerandom_mwc2_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperMWC2 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_mwc2_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_mwc2_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_mwc2_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_mwc2_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_mwc2_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_mwc2_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_mwc2_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_mwc2_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomMWC2_t> streams(n_streams);
+        simplerandom_mwc2_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_mwc2_next(&streams[i]);
+    }
 };
 
 class SimpleRandomWrapperKISS : public SimpleRandomWrapper
@@ -123,6 +237,29 @@ public:
     uint32_t operator()() { return simplerandom_kiss_next(&rng); }
     void discard(uintmax_t n) { simplerandom_kiss_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_kiss_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_kiss_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_kiss_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_kiss_at(&rng, i); }
+    uint32_t prev() { return simplerandom_kiss_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperKISS *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_kiss_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_kiss_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_kiss_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_kiss_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_kiss_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_kiss_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_kiss_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_kiss_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomKISS_t> streams(n_streams);
+        simplerandom_kiss_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_kiss_next(&streams[i]);
+    }
 };
 
 #ifdef UINT64_C
@@ -142,6 +279,29 @@ public:
     uint32_t operator()() { return simplerandom_mwc64_next(&rng); }
     void discard(uintmax_t n) { simplerandom_mwc64_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_mwc64_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_mwc64_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_mwc64_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_mwc64_at(&rng, i); }
+    uint32_t prev() { return simplerandom_mwc64_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperMWC64 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_mwc64_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_mwc64_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_mwc64_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_mwc64_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_mwc64_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_mwc64_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_mwc64_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_mwc64_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomMWC64_t> streams(n_streams);
+        simplerandom_mwc64_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_mwc64_next(&streams[i]);
+    }
 };
 
 class SimpleRandomWrapperKISS2 : public SimpleRandomWrapper
@@ -162,6 +322,29 @@ public:
     uint32_t operator()() { return simplerandom_kiss2_next(&rng); }
     void discard(uintmax_t n) { simplerandom_kiss2_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_kiss2_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_kiss2_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_kiss2_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_kiss2_at(&rng, i); }
+    uint32_t prev() { return simplerandom_kiss2_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperKISS2 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_kiss2_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_kiss2_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_kiss2_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_kiss2_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_kiss2_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_kiss2_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_kiss2_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_kiss2_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomKISS2_t> streams(n_streams);
+        simplerandom_kiss2_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_kiss2_next(&streams[i]);
+    }
 };
 
 #endif
@@ -184,6 +367,29 @@ public:
     uint32_t operator()() { return simplerandom_lfsr113_next(&rng); }
     void discard(uintmax_t n) { simplerandom_lfsr113_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_lfsr113_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_lfsr113_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_lfsr113_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_lfsr113_at(&rng, i); }
+    uint32_t prev() { return simplerandom_lfsr113_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperLFSR113 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_lfsr113_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_lfsr113_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_lfsr113_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_lfsr113_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_lfsr113_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_lfsr113_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_lfsr113_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_lfsr113_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomLFSR113_t> streams(n_streams);
+        simplerandom_lfsr113_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_lfsr113_next(&streams[i]);
+    }
 };
 
 class SimpleRandomWrapperLFSR88 : public SimpleRandomWrapper
@@ -204,6 +410,29 @@ public:
     uint32_t operator()() { return simplerandom_lfsr88_next(&rng); }
     void discard(uintmax_t n) { simplerandom_lfsr88_discard(&rng, n); }
     void mix(uint32_t * p_mix_array, size_t n) { simplerandom_lfsr88_mix(&rng, p_mix_array, n); }
+    void fill(uint32_t * p_out, size_t n) { simplerandom_lfsr88_fill(&rng, p_out, n); }
+    void parallel_fill(uint32_t * p_out, size_t n, unsigned num_threads) { simplerandom_lfsr88_parallel_fill(&rng, p_out, n, num_threads); }
+    uint32_t at(uintmax_t i) { return simplerandom_lfsr88_at(&rng, i); }
+    uint32_t prev() { return simplerandom_lfsr88_prev(&rng); }
+    bool same_state(const SimpleRandomWrapper * p_other) const
+    {
+        return memcmp(&rng, &static_cast<const SimpleRandomWrapperLFSR88 *>(p_other)->rng, sizeof(rng)) == 0;
+    }
+    void fill_float(float * p_out, size_t n, unsigned bits) { simplerandom_lfsr88_fill_float(&rng, p_out, n, bits); }
+    void fill_double(double * p_out, size_t n, unsigned bits) { simplerandom_lfsr88_fill_double(&rng, p_out, n, bits); }
+    uint32_t uniform_u32(uint32_t bound) { return simplerandom_lfsr88_uniform_u32(&rng, bound); }
+    void fill_uniform_u32(uint32_t * p_out, size_t n, uint32_t bound) { simplerandom_lfsr88_fill_uniform_u32(&rng, p_out, n, bound); }
+    double normal() { return simplerandom_lfsr88_normal(&rng); }
+    void fill_normal(double * p_out, size_t n) { simplerandom_lfsr88_fill_normal(&rng, p_out, n); }
+    double exponential() { return simplerandom_lfsr88_exponential(&rng); }
+    void fill_exponential(double * p_out, size_t n) { simplerandom_lfsr88_fill_exponential(&rng, p_out, n); }
+    void split_first(uintmax_t stride, uint32_t * p_out, size_t n_streams)
+    {
+        std::vector<SimpleRandomLFSR88_t> streams(n_streams);
+        simplerandom_lfsr88_split(&rng, streams.data(), n_streams, stride);
+        for (size_t i = 0; i < n_streams; i++)
+            p_out[i] = simplerandom_lfsr88_next(&streams[i]);
+    }
 };
 
 
@@ -227,6 +456,9 @@ public:
     }
     virtual uint32_t get_million_result() { return 2416584377u; }
     virtual uint32_t get_mix_million_result() { return 2377132217u; }
+    // Whether prev() back to a seeded state gives exactly the seeded state,
+    // rather than only an equivalent one. See simplerandom_zzz_prev().
+    virtual bool prev_restores_seeded_state() { return true; }
     void setUp()
     {
         rng = factory((uint32_t)time(NULL));
@@ -276,6 +508,351 @@ public:
         TS_ASSERT_EQUALS(result_discard, get_million_result());
         delete discard_rng;
     }
+    void testDiscardLarge()
+    {
+        SimpleRandomWrapper * two_step_rng;
+        SimpleRandomWrapper * one_step_rng;
+
+        /* Large discards use the high bits of the jump tables. Discarding in
+         * two steps must match discarding the sum in one step. */
+        two_step_rng = factory();
+        two_step_rng->discard(UINTMAX_C(0x0123456789ABCDEF));
+        two_step_rng->discard(UINTMAX_C(0x0FEDCBA987654321));
+        one_step_rng = factory();
+        one_step_rng->discard(UINTMAX_C(0x1111111111111110));
+        for (size_t i = 0; i < 10u; i++)
+        {
+            TS_ASSERT_EQUALS((*two_step_rng)(), (*one_step_rng)());
+        }
+        delete two_step_rng;
+        delete one_step_rng;
+    }
+    void checkFillFloat(unsigned bits)
+    {
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   ref_rng;
+        std::vector<float>      values(1003u);
+        float                   expected;
+
+        rng = factory();
+        ref_rng = factory();
+        rng->fill_float(values.data(), values.size(), bits);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (bits <= 24u)
+                expected = (float)((*ref_rng)() >> 8) / 16777216.0f;
+            else
+                expected = std::min((float)((double)(*ref_rng)() / 4294967296.0), 1.0f - 1.0f / 16777216.0f);
+            TS_ASSERT_EQUALS(values[i], expected);
+            TS_ASSERT(values[i] >= 0.0f && values[i] < 1.0f);
+        }
+        delete rng;
+        delete ref_rng;
+    }
+    void testFillFloat()
+    {
+        checkFillFloat(24u);
+        checkFillFloat(32u);
+        /* Float is limited to 32 bits per value. */
+        checkFillFloat(53u);
+    }
+    void checkFillDouble(unsigned bits)
+    {
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   ref_rng;
+        std::vector<double>     values(1003u);
+        double                  expected;
+        uint32_t                low;
+        uint32_t                high;
+
+        rng = factory();
+        ref_rng = factory();
+        rng->fill_double(values.data(), values.size(), bits);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (bits <= 24u)
+            {
+                expected = ((*ref_rng)() >> 8) / 16777216.0;
+            }
+            else if (bits <= 32u)
+            {
+                expected = (*ref_rng)() / 4294967296.0;
+            }
+            else
+            {
+                low = (*ref_rng)();
+                high = (*ref_rng)();
+                expected = ((high >> 5) * 67108864.0 + (low >> 6)) / 9007199254740992.0;
+            }
+            TS_ASSERT_EQUALS(values[i], expected);
+            TS_ASSERT(values[i] >= 0.0 && values[i] < 1.0);
+        }
+        delete rng;
+        delete ref_rng;
+    }
+    void testFillDouble()
+    {
+        checkFillDouble(24u);
+        checkFillDouble(32u);
+        checkFillDouble(53u);
+    }
+    void testUniformU32()
+    {
+        static const uint32_t   bounds[] = { 0, 1u, 2u, 3u, 7u, 1000u, UINT32_C(0x80000001), UINT32_C(0xFFFFFFFF) };
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   fill_rng;
+        SimpleRandomWrapper *   ref_rng;
+        std::vector<uint32_t>   values(1000u);
+        uint64_t                product;
+        uint32_t                threshold;
+        uint32_t                expected;
+
+        for (size_t k = 0; k < sizeof(bounds) / sizeof(bounds[0]); k++)
+        {
+            /* Reference: reject products whose lower 32 bits are below
+             * (2^32 - bound) mod bound. */
+            rng = factory();
+            fill_rng = factory();
+            ref_rng = factory();
+            fill_rng->fill_uniform_u32(values.data(), values.size(), bounds[k]);
+            threshold = bounds[k] ? (0u - bounds[k]) % bounds[k] : 0;
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                if (bounds[k] == 0)
+                {
+                    expected = (*ref_rng)();
+                }
+                else
+                {
+                    do
+                    {
+                        product = (uint64_t)(*ref_rng)() * bounds[k];
+                    } while ((uint32_t)product < threshold);
+                    expected = (uint32_t)(product >> 32);
+                    TS_ASSERT(expected < bounds[k]);
+                }
+                TS_ASSERT_EQUALS(rng->uniform_u32(bounds[k]), expected);
+                TS_ASSERT_EQUALS(values[i], expected);
+            }
+            /* All three must have used the same number of random values. */
+            expected = (*ref_rng)();
+            TS_ASSERT_EQUALS((*rng)(), expected);
+            TS_ASSERT_EQUALS((*fill_rng)(), expected);
+            delete rng;
+            delete fill_rng;
+            delete ref_rng;
+        }
+    }
+    void checkFillZiggurat(bool exponential)
+    {
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   fill_rng;
+        std::vector<double>     values(1003u);
+        size_t                  i;
+        size_t                  chunk;
+        double                  expected;
+
+        rng = factory();
+        fill_rng = factory();
+        /* Fill in chunks of varying length, including zero length. */
+        for (i = 0, chunk = 0; i < values.size(); i += chunk, ++chunk)
+        {
+            if (chunk > values.size() - i)
+                chunk = values.size() - i;
+            if (exponential)
+                fill_rng->fill_exponential(&values[i], chunk);
+            else
+                fill_rng->fill_normal(&values[i], chunk);
+        }
+        for (i = 0; i < values.size(); i++)
+        {
+            expected = exponential ? rng->exponential() : rng->normal();
+            TS_ASSERT_EQUALS(values[i], expected);
+        }
+        /* Both must have used the same number of random values. */
+        TS_ASSERT_EQUALS((*fill_rng)(), (*rng)());
+        delete rng;
+        delete fill_rng;
+    }
+    void testFillNormal()
+    {
+        checkFillZiggurat(false);
+    }
+    void testFillExponential()
+    {
+        checkFillZiggurat(true);
+    }
+    void testParallelFill()
+    {
+        /* Sizes for one thread, and for several threads with parts of
+         * unequal length. 0 threads means one per processor. */
+        static const size_t     sizes[] = { 1000u, (size_t(1) << 20) + 5u };
+        static const unsigned   threads[] = { 0, 1u, 3u, 4u };
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   parallel_rng;
+
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+        {
+            for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+            {
+                std::vector<uint32_t>   expected(sizes[k]);
+                std::vector<uint32_t>   values(sizes[k]);
+
+                rng = factory();
+                parallel_rng = factory();
+                rng->fill(expected.data(), expected.size());
+                parallel_rng->parallel_fill(values.data(), values.size(), threads[t]);
+                TS_ASSERT(values == expected);
+                /* The state must have moved on by the same amount. */
+                TS_ASSERT_EQUALS((*parallel_rng)(), (*rng)());
+                delete rng;
+                delete parallel_rng;
+            }
+        }
+    }
+    void testAt()
+    {
+        /* In increasing order with small and large gaps, then a repeat, an
+         * earlier index, and the largest. */
+        static const uintmax_t  indices[] = {
+            0, 1u, 2u, 5u, 37u, 38u, 1000u, 1001u, UINTMAX_C(0x123456789), UINTMAX_C(0x12345678A),
+            UINTMAX_C(0x12345678A), 3u, UINTMAX_MAX,
+        };
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   other_rng;
+        SimpleRandomWrapper *   expected_rng;
+
+        rng = factory();
+        other_rng = factory();
+        other_rng->discard(1u);
+        for (size_t k = 0; k < sizeof(indices) / sizeof(indices[0]); k++)
+        {
+            expected_rng = factory();
+            expected_rng->discard(indices[k]);
+            TS_ASSERT_EQUALS(rng->at(indices[k]), (*expected_rng)());
+            delete expected_rng;
+        }
+        /* A look-up from a different state must not use the cache of the
+         * previous one. */
+        for (size_t k = 0; k < sizeof(indices) / sizeof(indices[0]); k++)
+        {
+            rng->at(indices[k]);
+            expected_rng = factory();
+            expected_rng->discard(indices[k]);
+            expected_rng->discard(1u);
+            TS_ASSERT_EQUALS(other_rng->at(indices[k]), (*expected_rng)());
+            delete expected_rng;
+        }
+        /* The state must not have changed. */
+        expected_rng = factory();
+        TS_ASSERT_EQUALS((*rng)(), (*expected_rng)());
+        delete expected_rng;
+        delete rng;
+        delete other_rng;
+    }
+    void testPrev()
+    {
+        const size_t            n = 1000u;
+        uint32_t                values[n];
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   expected_rng;
+
+        /* Forwards, then back over the same values in reverse order, then
+         * forwards again. */
+        rng = factory();
+        for (size_t i = 0; i < n; i++)
+        {
+            values[i] = (*rng)();
+        }
+        for (size_t i = n; i-- > 0; )
+        {
+            TS_ASSERT_EQUALS(rng->prev(), values[i]);
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            TS_ASSERT_EQUALS((*rng)(), values[i]);
+        }
+        delete rng;
+
+        /* Back part of the way. The state must be the same as a fresh
+         * generator stepped forward to the same place. */
+        rng = factory();
+        for (size_t i = 0; i < n; i++)
+        {
+            (*rng)();
+        }
+        for (size_t i = 0; i < n / 2u; i++)
+        {
+            rng->prev();
+        }
+        expected_rng = factory();
+        for (size_t i = 0; i < n - n / 2u; i++)
+        {
+            (*expected_rng)();
+        }
+        TS_ASSERT(rng->same_state(expected_rng));
+        delete expected_rng;
+
+        /* Back all the way to the seeded state. For generators where prev()
+         * restores a seeded state exactly, the state must equal the seed;
+         * otherwise it need only give the same sequence. */
+        for (size_t i = 0; i < n - n / 2u; i++)
+        {
+            rng->prev();
+        }
+        expected_rng = factory();
+        if (prev_restores_seeded_state())
+        {
+            TS_ASSERT(rng->same_state(expected_rng));
+        }
+        for (size_t i = 0; i < 10u; i++)
+        {
+            TS_ASSERT_EQUALS((*rng)(), (*expected_rng)());
+        }
+        delete expected_rng;
+        delete rng;
+
+        /* Back past the seeded state, then forwards to it again. */
+        rng = factory();
+        for (size_t i = 0; i < n; i++)
+        {
+            rng->prev();
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            values[i] = (*rng)();
+        }
+        TS_ASSERT_EQUALS(rng->prev(), values[n - 1u]);
+        (*rng)();
+        expected_rng = factory();
+        for (size_t i = 0; i < 10u; i++)
+        {
+            TS_ASSERT_EQUALS((*rng)(), (*expected_rng)());
+        }
+        delete expected_rng;
+        delete rng;
+    }
+    void testSplit()
+    {
+        const uintmax_t         stride = UINTMAX_C(0x123456789);
+        const size_t            n_streams = 20u;
+        uint32_t                first[n_streams];
+        SimpleRandomWrapper *   rng;
+        SimpleRandomWrapper *   stream_rng;
+
+        /* Each split stream must match a fresh generator discarded by
+         * i * stride. */
+        rng = factory();
+        rng->split_first(stride, first, n_streams);
+        for (size_t i = 0; i < n_streams; i++)
+        {
+            stream_rng = factory();
+            stream_rng->discard(i * stride);
+            TS_ASSERT_EQUALS(first[i], (*stream_rng)());
+            delete stream_rng;
+        }
+        delete rng;
+    }
     void testMixMillion()
     {
         uint32_t zero_seeds[32] = { 0 };
@@ -288,6 +865,32 @@ public:
         }
         TS_ASSERT_EQUALS((*rng)(), get_mix_million_result());
     }
+    void testFill()
+    {
+        SimpleRandomWrapper * fill_rng;
+        SimpleRandomWrapper * next_rng;
+        uint32_t fill_values[1000];
+        size_t i;
+        size_t chunk;
+
+        fill_rng = factory();
+        next_rng = factory();
+        /* Fill in chunks of varying length, including zero length. */
+        for (i = 0, chunk = 0; i < 1000u; i += chunk, ++chunk)
+        {
+            if (chunk > 1000u - i)
+                chunk = 1000u - i;
+            fill_rng->fill(fill_values + i, chunk);
+        }
+        for (i = 0; i < 1000u; i++)
+        {
+            TS_ASSERT_EQUALS(fill_values[i], (*next_rng)());
+        }
+        /* State must have advanced identically. */
+        TS_ASSERT_EQUALS((*fill_rng)(), (*next_rng)());
+        delete fill_rng;
+        delete next_rng;
+    }
     void testDiscard()
     {
         SimpleRandomWrapper * discard_rng;
@@ -459,6 +1062,7 @@ public:
     }
     uint32_t get_million_result() { return 300959510u; }
     uint32_t get_mix_million_result() { return 1565144389u; }
+    bool prev_restores_seeded_state() { return false; }
 };
 
 class SimplerandomLFSR88Test : public SimplerandomCongTest
@@ -479,4 +1083,435 @@ public:
     }
     uint32_t get_million_result() { return 3774296834u; }
     uint32_t get_mix_million_result() { return 284026550u; }
+    bool prev_restores_seeded_state() { return false; }
+};
+
+class SimplerandomLFSR113x8Test : public CxxTest::TestSuite
+{
+public:
+    void checkLanes(uintmax_t stride)
+    {
+        SimpleRandomLFSR113_t   base;
+        SimpleRandomLFSR113_t   lane_rng[SIMPLERANDOM_LFSR113X8_LANES];
+        SimpleRandomLFSR113x8_t rng;
+        uint32_t                values[SIMPLERANDOM_LFSR113X8_LANES * 1000u];
+        size_t                  lane;
+        size_t                  i;
+
+        simplerandom_lfsr113_seed(&base, 12345u, 67890u, 13579u, 24680u);
+        for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; lane++)
+        {
+            lane_rng[lane] = base;
+            for (i = 0; i < lane; i++)
+            {
+                simplerandom_lfsr113_discard(&lane_rng[lane], stride);
+            }
+        }
+        simplerandom_lfsr113x8_seed_streams(&rng, &base, stride);
+
+        /* One next() call, then a fill that ends in a partial set. */
+        simplerandom_lfsr113x8_next(&rng, values);
+        simplerandom_lfsr113x8_fill(&rng, values + SIMPLERANDOM_LFSR113X8_LANES, SIMPLERANDOM_LFSR113X8_LANES * 998u + 3u);
+        for (i = 0; i < SIMPLERANDOM_LFSR113X8_LANES * 999u + 3u; i++)
+        {
+            TS_ASSERT_EQUALS(values[i], simplerandom_lfsr113_next(&lane_rng[i % SIMPLERANDOM_LFSR113X8_LANES]));
+        }
+        /* The partial set still steps all lanes. */
+        for (lane = 3; lane < SIMPLERANDOM_LFSR113X8_LANES; lane++)
+        {
+            simplerandom_lfsr113_next(&lane_rng[lane]);
+        }
+        for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; lane++)
+        {
+            SimpleRandomLFSR113_t lane_state;
+
+            simplerandom_lfsr113x8_get_lane(&rng, lane, &lane_state);
+            TS_ASSERT_EQUALS(lane_state.z1, lane_rng[lane].z1);
+            TS_ASSERT_EQUALS(lane_state.z2, lane_rng[lane].z2);
+            TS_ASSERT_EQUALS(lane_state.z3, lane_rng[lane].z3);
+            TS_ASSERT_EQUALS(lane_state.z4, lane_rng[lane].z4);
+        }
+    }
+    void testLanesMatchScalar()
+    {
+        checkLanes(1000u);
+    }
+    void testLanesPowerOfTwoStride()
+    {
+        checkLanes(UINTMAX_C(1) << 40);
+    }
+};
+
+#ifdef UINT64_C
+
+class SimplerandomKISS2xNTest : public CxxTest::TestSuite
+{
+public:
+    template <typename T, size_t LANES>
+    void checkLanes(void (*seed_streams)(T *, const SimpleRandomKISS2_t *, uintmax_t),
+                    void (*next)(T *, uint32_t *),
+                    void (*fill)(T *, uint32_t *, size_t),
+                    void (*get_lane)(const T *, size_t, SimpleRandomKISS2_t *),
+                    uintmax_t stride)
+    {
+        SimpleRandomKISS2_t     base;
+        SimpleRandomKISS2_t     lane_rng[LANES];
+        T                       rng;
+        std::vector<uint32_t>   values(LANES * 1000u);
+        size_t                  lane;
+        size_t                  i;
+
+        simplerandom_kiss2_seed(&base, 12345u, 67890u, 13579u, 24680u);
+        for (lane = 0; lane < LANES; lane++)
+        {
+            lane_rng[lane] = base;
+            simplerandom_kiss2_discard(&lane_rng[lane], lane * stride);
+        }
+        seed_streams(&rng, &base, stride);
+
+        /* One next() call, then a fill that ends in a partial set. */
+        next(&rng, values.data());
+        fill(&rng, values.data() + LANES, LANES * 998u + 3u);
+        for (i = 0; i < LANES * 999u + 3u; i++)
+        {
+            TS_ASSERT_EQUALS(values[i], simplerandom_kiss2_next(&lane_rng[i % LANES]));
+        }
+        /* The partial set still steps all lanes. */
+        for (lane = 3; lane < LANES; lane++)
+        {
+            simplerandom_kiss2_next(&lane_rng[lane]);
+        }
+        for (lane = 0; lane < LANES; lane++)
+        {
+            SimpleRandomKISS2_t lane_state;
+
+            get_lane(&rng, lane, &lane_state);
+            TS_ASSERT_EQUALS(lane_state.mwc_upper, lane_rng[lane].mwc_upper);
+            TS_ASSERT_EQUALS(lane_state.mwc_lower, lane_rng[lane].mwc_lower);
+            TS_ASSERT_EQUALS(lane_state.cong, lane_rng[lane].cong);
+            TS_ASSERT_EQUALS(lane_state.shr3, lane_rng[lane].shr3);
+        }
+    }
+    void testKISS2x4()
+    {
+        checkLanes<SimpleRandomKISS2x4_t, SIMPLERANDOM_KISS2X4_LANES>(simplerandom_kiss2x4_seed_streams,
+            simplerandom_kiss2x4_next, simplerandom_kiss2x4_fill, simplerandom_kiss2x4_get_lane, 1000u);
+        checkLanes<SimpleRandomKISS2x4_t, SIMPLERANDOM_KISS2X4_LANES>(simplerandom_kiss2x4_seed_streams,
+            simplerandom_kiss2x4_next, simplerandom_kiss2x4_fill, simplerandom_kiss2x4_get_lane, UINTMAX_C(1) << 40);
+    }
+    void testKISS2x8()
+    {
+        checkLanes<SimpleRandomKISS2x8_t, SIMPLERANDOM_KISS2X8_LANES>(simplerandom_kiss2x8_seed_streams,
+            simplerandom_kiss2x8_next, simplerandom_kiss2x8_fill, simplerandom_kiss2x8_get_lane, 1000u);
+        checkLanes<SimpleRandomKISS2x8_t, SIMPLERANDOM_KISS2X8_LANES>(simplerandom_kiss2x8_seed_streams,
+            simplerandom_kiss2x8_next, simplerandom_kiss2x8_fill, simplerandom_kiss2x8_get_lane, UINTMAX_C(1) << 40);
+    }
+};
+
+class SimplerandomTLSTest : public CxxTest::TestSuite
+{
+public:
+    void testSameGenerator()
+    {
+        TS_ASSERT_EQUALS(simplerandom_tls_kiss2(), simplerandom_tls_kiss2());
+    }
+    void testNextAndFill()
+    {
+        SimpleRandomKISS2_t     expected;
+        std::vector<uint32_t>   values(1000u);
+        size_t                  i;
+
+        expected = *simplerandom_tls_kiss2();
+        values[0] = simplerandom_tls_next();
+        simplerandom_tls_fill(values.data() + 1u, values.size() - 1u);
+        for (i = 0; i < values.size(); i++)
+        {
+            TS_ASSERT_EQUALS(values[i], simplerandom_kiss2_next(&expected));
+        }
+        TS_ASSERT_EQUALS(simplerandom_tls_next(), simplerandom_kiss2_next(&expected));
+    }
+};
+
+#endif
+
+class SimplerandomFloatTest : public CxxTest::TestSuite
+{
+public:
+    /* A 32-bit value of 0xFFFFFFFF rounds up to 1.0f, so it must be replaced
+     * by the largest float below 1. */
+    void testFloatBelowOne()
+    {
+        SimpleRandomCong_t  rng;
+        uint32_t            inverse;
+        float               value;
+        double              value_double;
+
+        /* Seed Cong so its next value is 0xFFFFFFFF, using the inverse of
+         * 69069 mod 2^32 (by Newton's method). */
+        inverse = 69069u;
+        for (int i = 0; i < 4; i++)
+            inverse *= 2u - 69069u * inverse;
+        rng.cong = (UINT32_C(0xFFFFFFFF) - 12345u) * inverse;
+        simplerandom_cong_fill_float(&rng, &value, 1u, 32u);
+        TS_ASSERT_EQUALS(value, 1.0f - 1.0f / 16777216.0f);
+
+        rng.cong = (UINT32_C(0xFFFFFFFF) - 12345u) * inverse;
+        simplerandom_cong_fill_double(&rng, &value_double, 1u, 32u);
+        TS_ASSERT_EQUALS(value_double, 4294967295.0 / 4294967296.0);
+    }
+};
+
+/* Check the distribution of the ziggurat normal and exponential values, with
+ * a chi-squared test of a histogram against the expected cumulative
+ * distribution. The tests are deterministic, given the fixed seeds. */
+class SimplerandomZigguratTest : public CxxTest::TestSuite
+{
+private:
+    static const size_t NUM_VALUES = 1000000u;
+
+    static double normal_cdf(double x)
+    {
+        return 0.5 * std::erfc(-x / std::sqrt(2.0));
+    }
+    static double exponential_cdf(double x)
+    {
+        return (x > 0.0) ? -std::expm1(-x) : 0.0;
+    }
+    /* Chi-squared statistic for bins of width 'step' from 'low' to 'high',
+     * plus one bin below and one above. Empty bins that are expected to be
+     * empty (such as below 0 for exponential) are left out. */
+    static double chi_squared(const std::vector<double> & values, double (*cdf)(double), double low, double high, double step)
+    {
+        size_t              num_bins = (size_t)((high - low) / step + 0.5) + 2u;
+        std::vector<size_t> counts(num_bins);
+        double              chi2;
+        double              expected;
+        double              p_low;
+        double              p_high;
+        size_t              bin;
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (values[i] < low)
+                bin = 0;
+            else if (values[i] >= high)
+                bin = num_bins - 1u;
+            else
+                bin = (size_t)((values[i] - low) / step) + 1u;
+            counts[bin]++;
+        }
+        chi2 = 0;
+        for (bin = 0; bin < num_bins; bin++)
+        {
+            p_low = (bin == 0) ? 0.0 : cdf(low + (bin - 1u) * step);
+            p_high = (bin == num_bins - 1u) ? 1.0 : cdf(low + bin * step);
+            expected = (p_high - p_low) * values.size();
+            if (expected == 0 && counts[bin] == 0)
+                continue;
+            chi2 += (counts[bin] - expected) * (counts[bin] - expected) / expected;
+        }
+        return chi2;
+    }
+    static void moments(const std::vector<double> & values, double * p_mean, double * p_variance)
+    {
+        double              sum = 0;
+        double              sum_squares = 0;
+
+        for (size_t i = 0; i < values.size(); i++)
+            sum += values[i];
+        *p_mean = sum / values.size();
+        for (size_t i = 0; i < values.size(); i++)
+            sum_squares += (values[i] - *p_mean) * (values[i] - *p_mean);
+        *p_variance = sum_squares / (values.size() - 1u);
+    }
+    static size_t count_above(const std::vector<double> & values, double limit)
+    {
+        size_t              count = 0;
+
+        for (size_t i = 0; i < values.size(); i++)
+            count += (std::fabs(values[i]) > limit);
+        return count;
+    }
+public:
+    void testNormalKISS2()
+    {
+        SimpleRandomKISS2_t rng;
+        std::vector<double> values(NUM_VALUES);
+        double              mean;
+        double              variance;
+
+        simplerandom_kiss2_seed(&rng, 1u, 2u, 3u, 4u);
+        simplerandom_kiss2_fill_normal(&rng, values.data(), values.size());
+        moments(values, &mean, &variance);
+        TS_ASSERT_DELTA(mean, 0.0, 0.005);
+        TS_ASSERT_DELTA(variance, 1.0, 0.005);
+        /* 64 bins, so ~63 degrees of freedom. 120 is p < 0.0001. */
+        TS_ASSERT_LESS_THAN(chi_squared(values, normal_cdf, -4.0, 4.0, 0.125), 120.0);
+        /* The tail beyond r = 3.654 has probability ~2.6e-4. */
+        TS_ASSERT_DELTA(count_above(values, 3.6541528853610088), 258.0, 60.0);
+    }
+    void testNormalLFSR113()
+    {
+        SimpleRandomLFSR113_t   rng;
+        std::vector<double>     values(NUM_VALUES);
+        double                  mean;
+        double                  variance;
+
+        simplerandom_lfsr113_seed(&rng, 1u, 2u, 3u, 4u);
+        simplerandom_lfsr113_fill_normal(&rng, values.data(), values.size());
+        moments(values, &mean, &variance);
+        TS_ASSERT_DELTA(mean, 0.0, 0.005);
+        TS_ASSERT_DELTA(variance, 1.0, 0.005);
+        TS_ASSERT_LESS_THAN(chi_squared(values, normal_cdf, -4.0, 4.0, 0.125), 120.0);
+    }
+    void testExponentialKISS2()
+    {
+        SimpleRandomKISS2_t rng;
+        std::vector<double> values(NUM_VALUES);
+        double              mean;
+        double              variance;
+
+        simplerandom_kiss2_seed(&rng, 1u, 2u, 3u, 4u);
+        simplerandom_kiss2_fill_exponential(&rng, values.data(), values.size());
+        TS_ASSERT_LESS_THAN_EQUALS(0.0, *std::min_element(values.begin(), values.end()));
+        moments(values, &mean, &variance);
+        TS_ASSERT_DELTA(mean, 1.0, 0.005);
+        TS_ASSERT_DELTA(variance, 1.0, 0.01);
+        /* 64 bins, so ~63 degrees of freedom. 120 is p < 0.0001. */
+        TS_ASSERT_LESS_THAN(chi_squared(values, exponential_cdf, 0.0, 8.0, 0.125), 120.0);
+        /* The tail beyond r = 7.697 has probability ~4.5e-4. */
+        TS_ASSERT_DELTA(count_above(values, 7.6971174701310497), 453.0, 80.0);
+    }
+    void testExponentialLFSR113()
+    {
+        SimpleRandomLFSR113_t   rng;
+        std::vector<double>     values(NUM_VALUES);
+        double                  mean;
+        double                  variance;
+
+        simplerandom_lfsr113_seed(&rng, 1u, 2u, 3u, 4u);
+        simplerandom_lfsr113_fill_exponential(&rng, values.data(), values.size());
+        TS_ASSERT_LESS_THAN_EQUALS(0.0, *std::min_element(values.begin(), values.end()));
+        moments(values, &mean, &variance);
+        TS_ASSERT_DELTA(mean, 1.0, 0.005);
+        TS_ASSERT_DELTA(variance, 1.0, 0.01);
+        TS_ASSERT_LESS_THAN(chi_squared(values, exponential_cdf, 0.0, 8.0, 0.125), 120.0);
+    }
+};
+
+/* The C++ engines in simplerandom-cpp.h must give identical output to the
+ * C API, and work with the standard <random> distributions. */
+class SimplerandomCppEngineTest : public CxxTest::TestSuite
+{
+public:
+    template <typename Engine, typename Wrapper>
+    void checkEngine(Engine engine, Wrapper wrapper)
+    {
+        uint32_t fill_values[100];
+        size_t i;
+
+        for (i = 0; i < 10000u; i++)
+        {
+            TS_ASSERT_EQUALS(engine(), wrapper());
+        }
+        engine.discard(12345u);
+        wrapper.discard(12345u);
+        engine.fill(fill_values, 100u);
+        for (i = 0; i < 100u; i++)
+        {
+            TS_ASSERT_EQUALS(fill_values[i], wrapper());
+        }
+        TS_ASSERT_EQUALS(engine(), wrapper());
+
+        std::uniform_real_distribution<double> real_dist;
+        std::uniform_int_distribution<int> int_dist(1, 6);
+        for (i = 0; i < 1000u; i++)
+        {
+            double real_value = real_dist(engine);
+            int int_value = int_dist(engine);
+            TS_ASSERT(real_value >= 0.0 && real_value < 1.0);
+            TS_ASSERT(int_value >= 1 && int_value <= 6);
+        }
+    }
+    void testEnginesMatchC()
+    {
+        const uint32_t seeds[4] = { 2247183469u, 99545079u, 3269400377u, 3950144837u };
+
+        checkEngine(simplerandom::Cong(seeds[0]), SimpleRandomWrapperCong(seeds[0]));
+        checkEngine(simplerandom::SHR3(seeds[0]), SimpleRandomWrapperSHR3(seeds[0]));
+        checkEngine(simplerandom::MWC1(seeds[0], seeds[1]), SimpleRandomWrapperMWC1(seeds[0], seeds[1]));
+        checkEngine(simplerandom::MWC2(seeds[0], seeds[1]), SimpleRandomWrapperMWC2(seeds[0], seeds[1]));
+        checkEngine(simplerandom::KISS(seeds[0], seeds[1], seeds[2], seeds[3]), SimpleRandomWrapperKISS(seeds, 4));
+#ifdef UINT64_C
+        checkEngine(simplerandom::MWC64(seeds[0], seeds[1]), SimpleRandomWrapperMWC64(seeds[0], seeds[1]));
+        checkEngine(simplerandom::KISS2(seeds[0], seeds[1], seeds[2], seeds[3]), SimpleRandomWrapperKISS2(seeds, 4));
+#endif
+        checkEngine(simplerandom::LFSR113(seeds[0], seeds[1], seeds[2], seeds[3]), SimpleRandomWrapperLFSR113(seeds, 4));
+        checkEngine(simplerandom::LFSR88(seeds[0], seeds[1], seeds[2]), SimpleRandomWrapperLFSR88(seeds, 3));
+    }
+#if __cplusplus >= 201402L
+    /* Seed with the given seeds, discard 'n', then return the 'count'th
+     * value. */
+    template <typename Engine>
+    static constexpr uint32_t constexprValue(Engine engine, uintmax_t n, size_t count)
+    {
+        uint32_t    value = 0;
+
+        engine.discard(n);
+        for (size_t i = 0; i < count; i++)
+        {
+            value = engine();
+        }
+        return value;
+    }
+    template <typename Wrapper>
+    static uint32_t wrapperValue(Wrapper wrapper, uintmax_t n, size_t count)
+    {
+        uint32_t    value = 0;
+
+        wrapper.discard(n);
+        for (size_t i = 0; i < count; i++)
+        {
+            value = wrapper();
+        }
+        return value;
+    }
+    void testConstexpr()
+    {
+        /* Seeds that include bad values, to check the sanitizing. */
+        const uint32_t  seeds[4] = { 0, UINT32_C(0x9068FFFF), 3269400377u, 0 };
+        const uintmax_t n = (UINTMAX_C(1) << 50) + 12345u;
+
+        constexpr uint32_t cong = constexprValue(simplerandom::Cong(2247183469u), n, 3u);
+        constexpr uint32_t shr3 = constexprValue(simplerandom::SHR3(0), n, 3u);
+        constexpr uint32_t mwc1 = constexprValue(simplerandom::MWC1(0, UINT32_C(0x9068FFFF)), n, 3u);
+        constexpr uint32_t mwc2 = constexprValue(simplerandom::MWC2(0, UINT32_C(0x9068FFFF)), n, 3u);
+        constexpr uint32_t kiss = constexprValue(simplerandom::KISS(0, UINT32_C(0x9068FFFF), 3269400377u, 0), n, 3u);
+        constexpr uint32_t lfsr113 = constexprValue(simplerandom::LFSR113(0, UINT32_C(0x9068FFFF), 3269400377u, 0), n, 3u);
+        constexpr uint32_t lfsr88 = constexprValue(simplerandom::LFSR88(0, UINT32_C(0x9068FFFF), 3269400377u), n, 3u);
+
+        TS_ASSERT_EQUALS(cong, wrapperValue(SimpleRandomWrapperCong(2247183469u), n, 3u));
+        TS_ASSERT_EQUALS(shr3, wrapperValue(SimpleRandomWrapperSHR3(0), n, 3u));
+        TS_ASSERT_EQUALS(mwc1, wrapperValue(SimpleRandomWrapperMWC1(seeds[0], seeds[1]), n, 3u));
+        TS_ASSERT_EQUALS(mwc2, wrapperValue(SimpleRandomWrapperMWC2(seeds[0], seeds[1]), n, 3u));
+        TS_ASSERT_EQUALS(kiss, wrapperValue(SimpleRandomWrapperKISS(seeds, 4), n, 3u));
+        TS_ASSERT_EQUALS(lfsr113, wrapperValue(SimpleRandomWrapperLFSR113(seeds, 4), n, 3u));
+        TS_ASSERT_EQUALS(lfsr88, wrapperValue(SimpleRandomWrapperLFSR88(seeds, 3), n, 3u));
+#ifdef UINT64_C
+        constexpr uint32_t mwc64 = constexprValue(simplerandom::MWC64(0u, 0u), n, 3u);
+        constexpr uint32_t kiss2 = constexprValue(simplerandom::KISS2(0, 0, 3269400377u, 0), n, 3u);
+        const uint32_t     kiss2_seeds[4] = { 0, 0, 3269400377u, 0 };
+
+        TS_ASSERT_EQUALS(mwc64, wrapperValue(SimpleRandomWrapperMWC64(0u, 0u), n, 3u));
+        TS_ASSERT_EQUALS(kiss2, wrapperValue(SimpleRandomWrapperKISS2(kiss2_seeds, 4), n, 3u));
+#endif
+    }
+#endif
+    void testMinMax()
+    {
+        static_assert(simplerandom::KISS2::min() == 0, "min() must be constexpr");
+        static_assert(simplerandom::KISS2::max() == UINT32_C(0xFFFFFFFF), "max() must be constexpr");
+        static_assert(simplerandom::SHR3::min() == 1, "SHR3 never outputs 0");
+        TS_ASSERT_EQUALS(simplerandom::LFSR113::num_seeds(), 4u);
+    }
 };
@@ -5,6 +5,9 @@
 
 #include "simplerandom.h"
 #include "bitcolumnmatrix.h"
+#include "jumptables.h"
+#include "maths.h"
+#include "multikernels.h"
 
 static int test_multi(void)
 {
@@ -102,107 +105,492 @@ static int test_multi(void)
     return 0;
 }
 
-static void print_matrix(const char * p_title, const BitColumnMatrix32_t * p_matrix)
+/* Check the maths functions used for Cong discard, and that the table-driven
+ * Cong discard agrees with the closed-form calculation:
+ *     r^n * x + c * (1 + r + r^2 + ... + r^(n-1))
+ */
+static int test_cong_discard(void)
 {
-    size_t      i;
+    static const uint32_t   r_values[] = { 0, 1u, 2u, 3u, 69069u, UINT32_C(0xFFFFFFFF) };
+    SimpleRandomCong_t      cong;
+    SimpleRandomKISS_t      kiss;
+    uintmax_t               n;
+    uint32_t                series;
+    uint32_t                power;
+    uint32_t                expected;
+    unsigned                i;
+    unsigned                j;
+    int                     errors;
+
+    errors = 0;
+    for (i = 0; i < sizeof(r_values) / sizeof(r_values[0]); i++)
+    {
+        series = 0;
+        power = 1u;
+        for (n = 0; n < 100u; n++)
+        {
+            if (geom_series_uint32(r_values[i], n) != series)
+                errors++;
+            series += power;
+            power *= r_values[i];
+        }
+    }
+    for (i = 1u; i < 1000u; i += 2u)
+    {
+        if (i * inverse_uint32(i) != 1u)
+            errors++;
+    }
 
-    printf("%s\n", p_title);
-    for (i = 0; i < 32u; ++i)
+    simplerandom_kiss_seed(&kiss, 5u, 6u, 7u, 8u);
+    for (i = 0; i < 1000u; i++)
     {
-        if (i && !(i % 8))
-            printf("\n");
-        if (!(i % 8))
-            printf("    ");
-        printf("%08"PRIX32" ", p_matrix->matrix[i]);
+        n = simplerandom_kiss_next(&kiss);
+        for (j = 0; j < i % 3u; j++)
+        {
+            n = (n << 32u) | simplerandom_kiss_next(&kiss);
+        }
+        simplerandom_cong_seed(&cong, simplerandom_kiss_next(&kiss));
+        expected = pow_uint32(69069u, n) * cong.cong + geom_series_uint32(69069u, n) * 12345u;
+        simplerandom_cong_discard(&cong, n);
+        if (cong.cong != expected)
+            errors++;
     }
-    printf("\n");
+
+    printf("Cong discard: %d errors\n\n", errors);
+    return errors ? 1 : 0;
 }
 
-static void calc_shr3_matrix(void)
+#ifdef UINT64_C
+
+/* Reference modulo multiplication, one bit at a time, as the 64-bit-only
+ * mul_mod_uint64(). */
+static uint64_t reference_mul_mod_uint64(uint64_t a, uint64_t b, uint64_t mod)
 {
-    BitColumnMatrix32_t     temp_matrix, matrix_a, matrix_b, matrix_c, shr3_matrix;
+    uint64_t    result;
+    unsigned    i;
 
-    bitcolumnmatrix32_unity(&matrix_a);
-    bitcolumnmatrix32_shift(&temp_matrix, 13);
-    bitcolumnmatrix32_iadd(&matrix_a, &temp_matrix);
+    result = 0;
+    b %= mod;
+    for (i = 64u; i-- > 0; )
+    {
+        result = (result >= mod - result) ? result - (mod - result) : result + result;
+        if ((a >> i) & 1u)
+            result = (result >= mod - b) ? result - (mod - b) : result + b;
+    }
+    return result;
+}
 
-    bitcolumnmatrix32_unity(&matrix_b);
-    bitcolumnmatrix32_shift(&temp_matrix, -17);
-    bitcolumnmatrix32_iadd(&matrix_b, &temp_matrix);
+static uint64_t reference_pow_mod_uint64(uint64_t base, uintmax_t n, uint64_t mod)
+{
+    uint64_t    result;
 
-    bitcolumnmatrix32_unity(&matrix_c);
-    bitcolumnmatrix32_shift(&temp_matrix, 5);
-    bitcolumnmatrix32_iadd(&matrix_c, &temp_matrix);
+    result = 1u % mod;
+    for (; n != 0; n >>= 1u)
+    {
+        if (n & 1u)
+            result = reference_mul_mod_uint64(result, base, mod);
+        base = reference_mul_mod_uint64(base, base, mod);
+    }
+    return result;
+}
 
-    bitcolumnmatrix32_unity(&shr3_matrix);
-    bitcolumnmatrix32_imul(&shr3_matrix, &matrix_c);
-    bitcolumnmatrix32_imul(&shr3_matrix, &matrix_b);
-    bitcolumnmatrix32_imul(&shr3_matrix, &matrix_a);
+/* Check the Montgomery modulo power against a reference, for the MWC moduli
+ * and some other odd moduli, and check the MWC Montgomery constants that are
+ * generated by genjumptables. */
+static int test_montgomery(void)
+{
+    static const uint32_t   mods_32[] = {
+        3u, UINT32_C(0x9068FFFF), UINT32_C(0x464FFFFF), UINT32_C(0x80000001), UINT32_C(0xFFFFFFFF),
+    };
+    static const uint64_t   mods_64[] = {
+        3u, UINT64_C(0x29A65EACFFFFFFFF), UINT64_C(0x8000000000000001), UINT64_C(0xFFFFFFFFFFFFFFFF),
+    };
+    MontgomeryUint32_t      mont_32;
+    MontgomeryUint64_t      mont_64;
+    SimpleRandomKISS2_t     kiss2;
+    uint64_t                base;
+    uint64_t                x;
+    uintmax_t               n;
+    unsigned                i;
+    unsigned                j;
+    int                     errors;
+
+    errors = 0;
+    simplerandom_kiss2_seed(&kiss2, 1u, 2u, 3u, 4u);
+    for (i = 0; i < sizeof(mods_32) / sizeof(mods_32[0]); i++)
+    {
+        montgomery_uint32_init(&mont_32, mods_32[i]);
+        for (j = 0; j < 1000u; j++)
+        {
+            base = simplerandom_kiss2_next(&kiss2);
+            x = simplerandom_kiss2_next(&kiss2);
+            n = ((uintmax_t)simplerandom_kiss2_next(&kiss2) << 32u) | simplerandom_kiss2_next(&kiss2);
+            n >>= j % 64u;
+            if (pow_mod_uint32((uint32_t)base, n, mods_32[i]) != reference_pow_mod_uint64(base, n, mods_32[i]))
+                errors++;
+            if (montgomery_uint32_mul(&mont_32, montgomery_uint32_pow_mult(&mont_32, (uint32_t)base, n), (uint32_t)x) !=
+                    reference_mul_mod_uint64(reference_pow_mod_uint64(base, n, mods_32[i]), x, mods_32[i]))
+                errors++;
+        }
+    }
+    for (i = 0; i < sizeof(mods_64) / sizeof(mods_64[0]); i++)
+    {
+        montgomery_uint64_init(&mont_64, mods_64[i]);
+        for (j = 0; j < 1000u; j++)
+        {
+            base = ((uint64_t)simplerandom_kiss2_next(&kiss2) << 32u) | simplerandom_kiss2_next(&kiss2);
+            x = ((uint64_t)simplerandom_kiss2_next(&kiss2) << 32u) | simplerandom_kiss2_next(&kiss2);
+            n = ((uintmax_t)simplerandom_kiss2_next(&kiss2) << 32u) | simplerandom_kiss2_next(&kiss2);
+            n >>= j % 64u;
+            if (pow_mod_uint64(base, n, mods_64[i]) != reference_pow_mod_uint64(base, n, mods_64[i]))
+                errors++;
+            if (mul_mod_uint64(base, x, mods_64[i]) != reference_mul_mod_uint64(base, x, mods_64[i]))
+                errors++;
+            if (montgomery_uint64_mul(&mont_64, montgomery_uint64_pow_mult(&mont_64, base, n), x) !=
+                    reference_mul_mod_uint64(reference_pow_mod_uint64(base, n, mods_64[i]), x, mods_64[i]))
+                errors++;
+        }
+    }
 
-    print_matrix("SHR3 BitColumnMatrix32_t matrix", &shr3_matrix);
+    montgomery_uint32_init(&mont_32, UINT32_C(0x9068FFFF));
+    if (memcmp(&mont_32, &mwc_upper_montgomery, sizeof(mont_32)) != 0)
+        errors++;
+    montgomery_uint32_init(&mont_32, UINT32_C(0x464FFFFF));
+    if (memcmp(&mont_32, &mwc_lower_montgomery, sizeof(mont_32)) != 0)
+        errors++;
+    montgomery_uint64_init(&mont_64, UINT64_C(0x29A65EACFFFFFFFF));
+    if (memcmp(&mont_64, &mwc64_montgomery, sizeof(mont_64)) != 0)
+        errors++;
+
+    printf("Montgomery: %d errors\n\n", errors);
+    return errors ? 1 : 0;
 }
 
-static void calc_lfsr_matrix(const char * p_title, signed shift_1, signed shift_2, unsigned low_mask, signed shift_3)
+#endif /* defined(UINT64_C) */
+
+/* Reference matrix-vector multiplication, one bit at a time. */
+static uint32_t reference_mul_uint32(const BitColumnMatrix32_t * p_left, uint32_t right)
 {
-    BitColumnMatrix32_t     temp_matrix, matrix_a, matrix_b, matrix_c, matrix_d, lfsr_matrix;
+    uint32_t    result;
+    unsigned    row;
+    unsigned    column;
 
-    bitcolumnmatrix32_unity(&matrix_a);
-    bitcolumnmatrix32_shift(&temp_matrix, shift_1);
-    bitcolumnmatrix32_iadd(&matrix_a, &temp_matrix);
+    result = 0;
+    for (row = 0; row < 32u; row++)
+    {
+        for (column = 0; column < 32u; column++)
+        {
+            if (((p_left->matrix[column] >> row) & (right >> column) & 1u) != 0)
+                result ^= UINT32_C(1) << row;
+        }
+    }
+    return result;
+}
 
-    bitcolumnmatrix32_shift(&matrix_b, shift_2);
+/* Check that all the matrix multiplication kernels agree with the reference
+ * multiplication, for some pseudo-random matrices and vectors. Also check
+ * bitcolumnmatrix32_rank(). */
+static int test_bitcolumnmatrix(void)
+{
+    SimpleRandomKISS_t  kiss;
+    BitColumnMatrix32_t left;
+    BitColumnMatrix32_t right;
+    BitColumnMatrix32_t expected;
+    BitColumnMatrix32_t result;
+    uint32_t            vector;
+    unsigned            trial;
+    unsigned            i;
+    int                 errors;
+
+    errors = 0;
+    simplerandom_kiss_seed(&kiss, 1u, 2u, 3u, 4u);
+    for (trial = 0; trial < 1000u; trial++)
+    {
+        simplerandom_kiss_fill(&kiss, left.matrix, 32u);
+        simplerandom_kiss_fill(&kiss, right.matrix, 32u);
+        vector = simplerandom_kiss_next(&kiss);
+        for (i = 0; i < 32u; i++)
+        {
+            expected.matrix[i] = reference_mul_uint32(&left, right.matrix[i]);
+        }
+
+        if (bitcolumnmatrix32_mul_uint32(&left, vector) != reference_mul_uint32(&left, vector))
+            errors++;
+        if (bitcolumnmatrix32_mul_uint32_generic(&left, vector) != reference_mul_uint32(&left, vector))
+            errors++;
+        result = left;
+        bitcolumnmatrix32_imul(&result, &right);
+        if (memcmp(&result, &expected, sizeof(result)) != 0)
+            errors++;
+        result = left;
+        bitcolumnmatrix32_imul_four_russians(&result, &right);
+        if (memcmp(&result, &expected, sizeof(result)) != 0)
+            errors++;
+#ifdef SIMPLERANDOM_X86_KERNELS
+        if (cpu_has_avx2())
+        {
+            if (bitcolumnmatrix32_mul_uint32_avx2(&left, vector) != reference_mul_uint32(&left, vector))
+                errors++;
+            result = left;
+            bitcolumnmatrix32_imul_avx2(&result, &right);
+            if (memcmp(&result, &expected, sizeof(result)) != 0)
+                errors++;
+        }
+#endif
+#ifdef SIMPLERANDOM_X86_GFNI
+        if (cpu_has_gfni())
+        {
+            result = left;
+            bitcolumnmatrix32_imul_gfni(&result, &right);
+            if (memcmp(&result, &expected, sizeof(result)) != 0)
+                errors++;
+        }
+#endif
+    }
 
-    bitcolumnmatrix32_mask(&matrix_c, low_mask, 32);
+    /* Rank of some matrices with known rank. */
+    bitcolumnmatrix32_unity(&result);
+    if (bitcolumnmatrix32_rank(&result) != 32u)
+        errors++;
+    bitcolumnmatrix32_shift(&result, 5);
+    if (bitcolumnmatrix32_rank(&result) != 27u)
+        errors++;
+    bitcolumnmatrix32_mask(&result, 8u, 16u);
+    if (bitcolumnmatrix32_rank(&result) != 8u)
+        errors++;
+    /* Column 31 is the sum of columns 0 and 1, so the rank is at most 31. */
+    simplerandom_kiss_fill(&kiss, result.matrix, 32u);
+    result.matrix[31] = result.matrix[0] ^ result.matrix[1];
+    if (bitcolumnmatrix32_rank(&result) > 31u)
+        errors++;
+    bitcolumnmatrix32_imul(&left, &result);
+    if (bitcolumnmatrix32_rank(&left) > 31u)
+        errors++;
+
+    printf("Matrix multiplication kernels: %d errors\n\n", errors);
+    return errors ? 1 : 0;
+}
 
-    bitcolumnmatrix32_shift(&matrix_d, shift_3);
+/* Number of values for the multi-lane kernel tests. It is not a multiple of
+ * the number of lanes, so the final partial set of values is tested too. */
+#define MULTI_TEST_LEN          1003u
 
-    bitcolumnmatrix32_unity(&lfsr_matrix);
-    bitcolumnmatrix32_imul(&lfsr_matrix, &matrix_d);
-    bitcolumnmatrix32_imul(&lfsr_matrix, &matrix_c);
+/* Check each multi-lane "fill" kernel that the CPU supports, against the
+ * single-stream generators of its lanes. Both the output and the final state
+ * must match. */
+static int test_multi_kernels(void)
+{
+    SimpleRandomLFSR113_t   lfsr113;
+    SimpleRandomLFSR113_t   lfsr113_lanes[SIMPLERANDOM_LFSR113X8_LANES];
+    SimpleRandomLFSR113x8_t lfsr113x8_start;
+    SimpleRandomLFSR113x8_t lfsr113x8_expected;
+    SimpleRandomLFSR113x8_t lfsr113x8;
+#ifdef UINT64_C
+    SimpleRandomKISS2_t     kiss2;
+    SimpleRandomKISS2_t     kiss2_lanes[SIMPLERANDOM_KISS2X8_LANES];
+    SimpleRandomKISS2x4_t   kiss2x4_start;
+    SimpleRandomKISS2x4_t   kiss2x4_expected;
+    SimpleRandomKISS2x4_t   kiss2x4;
+    SimpleRandomKISS2x8_t   kiss2x8_start;
+    SimpleRandomKISS2x8_t   kiss2x8_expected;
+    SimpleRandomKISS2x8_t   kiss2x8;
+    uint32_t                expected4[MULTI_TEST_LEN];
+#endif
+    uint32_t                expected[MULTI_TEST_LEN];
+    uint32_t                result[MULTI_TEST_LEN];
+    size_t                  lane;
+    size_t                  i;
+    int                     errors;
+
+    errors = 0;
+
+    /* LFSR113x8 */
+    simplerandom_lfsr113_seed(&lfsr113, 1u, 2u, 3u, 4u);
+    simplerandom_lfsr113x8_seed_streams(&lfsr113x8_start, &lfsr113, 1000u);
+    for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; ++lane)
+    {
+        simplerandom_lfsr113x8_get_lane(&lfsr113x8_start, lane, &lfsr113_lanes[lane]);
+    }
+    for (i = 0; i < MULTI_TEST_LEN; ++i)
+    {
+        expected[i] = simplerandom_lfsr113_next(&lfsr113_lanes[i % SIMPLERANDOM_LFSR113X8_LANES]);
+    }
+    /* Lanes that didn't produce the final value still take a step. */
+    for (i = MULTI_TEST_LEN; i % SIMPLERANDOM_LFSR113X8_LANES; ++i)
+    {
+        simplerandom_lfsr113_next(&lfsr113_lanes[i % SIMPLERANDOM_LFSR113X8_LANES]);
+    }
+    lfsr113x8_expected = lfsr113x8_start;
+    for (lane = 0; lane < SIMPLERANDOM_LFSR113X8_LANES; ++lane)
+    {
+        simplerandom_lfsr113x8_set_lane(&lfsr113x8_expected, lane, &lfsr113_lanes[lane]);
+    }
 
-    bitcolumnmatrix32_unity(&temp_matrix);
-    bitcolumnmatrix32_imul(&temp_matrix, &matrix_b);
-    bitcolumnmatrix32_imul(&temp_matrix, &matrix_a);
+    lfsr113x8 = lfsr113x8_start;
+    lfsr113x8_fill_generic(&lfsr113x8, result, MULTI_TEST_LEN);
+    if (memcmp(result, expected, sizeof(result)) != 0 ||
+        memcmp(&lfsr113x8, &lfsr113x8_expected, sizeof(lfsr113x8)) != 0)
+        errors++;
+#ifdef MULTI_HAVE_AVX2
+    if (multi_use_avx2())
+    {
+        lfsr113x8 = lfsr113x8_start;
+        lfsr113x8_fill_avx2(&lfsr113x8, result, MULTI_TEST_LEN);
+        if (memcmp(result, expected, sizeof(result)) != 0 ||
+            memcmp(&lfsr113x8, &lfsr113x8_expected, sizeof(lfsr113x8)) != 0)
+            errors++;
+    }
+#endif
 
-    bitcolumnmatrix32_iadd(&lfsr_matrix, &temp_matrix);
+#ifdef UINT64_C
+    /* KISS2x4 and KISS2x8 */
+    simplerandom_kiss2_seed(&kiss2, 1u, 2u, 3u, 4u);
+    simplerandom_kiss2x4_seed_streams(&kiss2x4_start, &kiss2, 1000u);
+    simplerandom_kiss2x8_seed_streams(&kiss2x8_start, &kiss2, 1000u);
 
-    print_matrix(p_title, &lfsr_matrix);
-}
+    for (lane = 0; lane < SIMPLERANDOM_KISS2X4_LANES; ++lane)
+    {
+        simplerandom_kiss2x4_get_lane(&kiss2x4_start, lane, &kiss2_lanes[lane]);
+    }
+    for (i = 0; i < MULTI_TEST_LEN; ++i)
+    {
+        expected4[i] = simplerandom_kiss2_next(&kiss2_lanes[i % SIMPLERANDOM_KISS2X4_LANES]);
+    }
+    for (i = MULTI_TEST_LEN; i % SIMPLERANDOM_KISS2X4_LANES; ++i)
+    {
+        simplerandom_kiss2_next(&kiss2_lanes[i % SIMPLERANDOM_KISS2X4_LANES]);
+    }
+    kiss2x4_expected = kiss2x4_start;
+    for (lane = 0; lane < SIMPLERANDOM_KISS2X4_LANES; ++lane)
+    {
+        simplerandom_kiss2x4_set_lane(&kiss2x4_expected, lane, &kiss2_lanes[lane]);
+    }
 
-static void calc_lfsr113_matrices(void)
-{
-    calc_lfsr_matrix("LFSR113-1 BitColumnMatrix32_t matrix", 6, -13, 1, 18);
-    calc_lfsr_matrix("LFSR113-2 BitColumnMatrix32_t matrix", 2, -27, 3, 2);
-    calc_lfsr_matrix("LFSR113-3 BitColumnMatrix32_t matrix", 13, -21, 4, 7);
-    calc_lfsr_matrix("LFSR113-4 BitColumnMatrix32_t matrix", 3, -12, 7, 13);
+    for (lane = 0; lane < SIMPLERANDOM_KISS2X8_LANES; ++lane)
+    {
+        simplerandom_kiss2x8_get_lane(&kiss2x8_start, lane, &kiss2_lanes[lane]);
+    }
+    for (i = 0; i < MULTI_TEST_LEN; ++i)
+    {
+        expected[i] = simplerandom_kiss2_next(&kiss2_lanes[i % SIMPLERANDOM_KISS2X8_LANES]);
+    }
+    for (i = MULTI_TEST_LEN; i % SIMPLERANDOM_KISS2X8_LANES; ++i)
+    {
+        simplerandom_kiss2_next(&kiss2_lanes[i % SIMPLERANDOM_KISS2X8_LANES]);
+    }
+    kiss2x8_expected = kiss2x8_start;
+    for (lane = 0; lane < SIMPLERANDOM_KISS2X8_LANES; ++lane)
+    {
+        simplerandom_kiss2x8_set_lane(&kiss2x8_expected, lane, &kiss2_lanes[lane]);
+    }
+
+    kiss2x4 = kiss2x4_start;
+    kiss2x4_fill_generic(&kiss2x4, result, MULTI_TEST_LEN);
+    if (memcmp(result, expected4, sizeof(result)) != 0 ||
+        memcmp(&kiss2x4, &kiss2x4_expected, sizeof(kiss2x4)) != 0)
+        errors++;
+    kiss2x8 = kiss2x8_start;
+    kiss2x8_fill_generic(&kiss2x8, result, MULTI_TEST_LEN);
+    if (memcmp(result, expected, sizeof(result)) != 0 ||
+        memcmp(&kiss2x8, &kiss2x8_expected, sizeof(kiss2x8)) != 0)
+        errors++;
+#ifdef MULTI_HAVE_AVX2
+    if (multi_use_avx2())
+    {
+        kiss2x4 = kiss2x4_start;
+        kiss2x4_fill_avx2(&kiss2x4, result, MULTI_TEST_LEN);
+        if (memcmp(result, expected4, sizeof(result)) != 0 ||
+            memcmp(&kiss2x4, &kiss2x4_expected, sizeof(kiss2x4)) != 0)
+            errors++;
+        kiss2x8 = kiss2x8_start;
+        kiss2x8_fill_avx2(&kiss2x8, result, MULTI_TEST_LEN);
+        if (memcmp(result, expected, sizeof(result)) != 0 ||
+            memcmp(&kiss2x8, &kiss2x8_expected, sizeof(kiss2x8)) != 0)
+            errors++;
+    }
+#endif
+#ifdef MULTI_HAVE_AVX512
+    if (multi_use_avx512())
+    {
+        kiss2x8 = kiss2x8_start;
+        kiss2x8_fill_avx512(&kiss2x8, result, MULTI_TEST_LEN);
+        if (memcmp(result, expected, sizeof(result)) != 0 ||
+            memcmp(&kiss2x8, &kiss2x8_expected, sizeof(kiss2x8)) != 0)
+            errors++;
+    }
+#endif
+#endif /* defined(UINT64_C) */
+
+    printf("Multi-lane fill kernels: %d errors\n\n", errors);
+    return errors ? 1 : 0;
 }
 
-static void calc_lfsr88_matrices(void)
+#ifdef UINT64_C
+
+/* Check the thread-local generator. This is the first use of it in this
+ * process, so this thread gets stream 0, which starts at the KISS2 seeds.
+ * Stream 1 must start differently. */
+static int test_tls(void)
 {
-    calc_lfsr_matrix("LFSR88-1 BitColumnMatrix32_t matrix", 13, -19, 1, 12);
-    calc_lfsr_matrix("LFSR88-2 BitColumnMatrix32_t matrix", 2, -25, 3, 4);
-    calc_lfsr_matrix("LFSR88-3 BitColumnMatrix32_t matrix", 3, -11, 4, 17);
+    SimpleRandomKISS2_t kiss2;
+    SimpleRandomKISS2_t stream1;
+    uint32_t            values[100];
+    size_t              i;
+    int                 errors;
+
+    errors = 0;
+    simplerandom_kiss2_seed(&kiss2, UINT32_C(7654321), UINT32_C(521288629), UINT32_C(123456789), UINT32_C(362436000));
+    stream1 = kiss2;
+    simplerandom_kiss2_discard(&stream1, SIMPLERANDOM_TLS_STREAM_STRIDE);
+
+    values[0] = simplerandom_tls_next();
+    simplerandom_tls_fill(&values[1], 99u);
+    for (i = 0; i < 100u; i++)
+    {
+        if (values[i] != simplerandom_kiss2_next(&kiss2))
+            errors++;
+    }
+    if (values[0] == simplerandom_kiss2_next(&stream1))
+        errors++;
+
+    printf("Thread-local generator: %d errors\n\n", errors);
+    return errors ? 1 : 0;
 }
 
+#endif /* defined(UINT64_C) */
+
 int main(void)
 {
     int ret_val;
 
-#if 0
-    calc_shr3_matrix();
-#endif
+    ret_val = test_multi();
+    if (ret_val != 0)
+        return ret_val;
 
-#if 0
-    calc_lfsr113_matrices();
-#endif
-#if 0
-    calc_lfsr88_matrices();
+    ret_val = test_cong_discard();
+    if (ret_val != 0)
+        return ret_val;
+
+#ifdef UINT64_C
+    ret_val = test_montgomery();
+    if (ret_val != 0)
+        return ret_val;
 #endif
 
-    ret_val = test_multi();
+    ret_val = test_bitcolumnmatrix();
     if (ret_val != 0)
         return ret_val;
 
+    ret_val = test_multi_kernels();
+    if (ret_val != 0)
+        return ret_val;
+
+#ifdef UINT64_C
+    ret_val = test_tls();
+    if (ret_val != 0)
+        return ret_val;
+#endif
+
     return 0;
 }
 
@@ -0,0 +1,646 @@
+/*
+ * test_smoke.c
+ *
+ * Fast statistical smoke tests of each generator, to catch a loss of quality
+ * from a change to seeding, fill kernels etc, without needing TestU01. These
+ * are much weaker than TestU01's batteries (see test_testu01.c), but quick
+ * enough to run in "make check".
+ *
+ * Each generator's first 2^29 outputs (by default) are generated by
+ * simplerandom_zzz_fill(). The stream is split into SMOKE_NUM_PARTS parts by
+ * simplerandom_zzz_split(), and the parts are tested by parallel threads, one
+ * per CPU, each taking the next untested part. The split doesn't depend on
+ * the number of CPUs, so the results are the same on any host.
+ * Tests:
+ *     monobit     Number of one bits, over all bits.
+ *     runs        Number of bit changes (0 to 1 or 1 to 0) between adjacent
+ *                 bits, over all bits.
+ *     birthday    Birthday spacings [1], of 512 birthdays in a year of 2^24
+ *                 days. Each birthday is the top 12 bits of two consecutive
+ *                 outputs, so it also tests pairs of outputs.
+ *     rank        Rank of 32x32 binary matrices, each made from 32
+ *                 consecutive outputs, by bitcolumnmatrix32_rank().
+ *     gap         Gap test [1]: lengths of the gaps between outputs in the
+ *                 range [0, 2^28).
+ * The birthday and rank tests are done on a sample of the stream, since they
+ * cost more per output than the others.
+ *
+ * Each test gives a p-value, the probability of a test statistic at least as
+ * large as the one seen, as in TestU01. It fails if it's within SMOKE_P_FAIL
+ * of 0 or 1, so results that are too regular also fail. Some generators are
+ * known to fail some tests, which are listed in expected_failures[]. Only an
+ * unexpected result is an error.
+ *
+ * Usage:
+ *     test_smoke [log2-count]
+ *
+ * References:
+ *
+ * [1]: Knuth, D. E. "The Art of Computer Programming", Volume 2, section 3.3.2.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "simplerandom.h"
+#include "bitcolumnmatrix.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* The default count keeps a run of "make check" on one CPU to about half a
+ * minute. It's the same on any host, so the results are too. */
+#define SMOKE_LOG2_COUNT        29u
+#define SMOKE_BLOCK_LEN         (64u * 1024u)
+#define SMOKE_NUM_PARTS         64u
+#define SMOKE_MAX_THREADS       64u
+
+/* A p-value below this, or above 1 minus this, is a failure. */
+#define SMOKE_P_FAIL            1e-6
+
+/* Birthday spacings: samples in each block, birthdays in each sample, and
+ * the number of days in a year (2^BIRTHDAY_DAY_BITS). */
+#define BIRTHDAY_SAMPLES        4u
+#define BIRTHDAY_M              512u
+#define BIRTHDAY_DAY_BITS       24u
+
+/* Mean number of duplicate spacings in a sample, for m birthdays in a year of
+ * n days. The usual Poisson mean m^3/(4n) is the number of equal pairs, which
+ * is 0.5% too high here: the exact pair count is m^2(m-1)/(4n), and each set
+ * of three equal spacings gives three pairs but only two duplicates, which
+ * takes off m^2(m-1)^2(m-2)/(18n^2). This gives 1.9892, against 1.9890 from
+ * 10^6 samples of KISS2. */
+#define BIRTHDAY_DAYS           ((double)(UINT32_C(1) << BIRTHDAY_DAY_BITS))
+#define BIRTHDAY_MEAN           ((double)BIRTHDAY_M * BIRTHDAY_M * (BIRTHDAY_M - 1u) / (4.0 * BIRTHDAY_DAYS) - \
+                                 (double)BIRTHDAY_M * BIRTHDAY_M * (BIRTHDAY_M - 1u) * (BIRTHDAY_M - 1u) * \
+                                 (BIRTHDAY_M - 2u) / (18.0 * BIRTHDAY_DAYS * BIRTHDAY_DAYS))
+
+/* Matrix rank: one 32x32 matrix from every RANK_STRIDE outputs. */
+#define RANK_STRIDE             1024u
+
+/* Gap test: outputs below GAP_LIMIT are hits, with probability 1/16. Gap
+ * lengths 0 .. GAP_CATEGORIES-1 are counted separately; longer gaps together. */
+#define GAP_LIMIT               (UINT32_C(1) << 28u)
+#define GAP_PROBABILITY         (1.0 / 16.0)
+#define GAP_CATEGORIES          64u
+
+#define SQRT_2_OVER_PI          0.79788456080286535588
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+typedef enum
+{
+    TEST_MONOBIT,
+    TEST_RUNS,
+    TEST_BIRTHDAY,
+    TEST_RANK,
+    TEST_GAP,
+    NUM_TESTS
+} SmokeTest_t;
+
+/* Counts from all the tests, for one part of the stream. */
+typedef struct
+{
+    uint64_t    ones;
+    uint64_t    bits;
+    uint64_t    changes;
+    uint64_t    bit_pairs;
+    uint64_t    birthday_samples;
+    uint64_t    birthday_duplicates;
+    uint64_t    ranks[4];               /* <= 29, 30, 31, 32 */
+    uint64_t    gaps[GAP_CATEGORIES + 1u];
+} SmokeCounts_t;
+
+/* One part of the stream. */
+typedef struct
+{
+    void      (*p_fill)(void * p_rng, uint32_t * p_out, size_t num_out);
+    void *      p_rng;
+    size_t      num_blocks;
+    SmokeCounts_t counts;
+} SmokePart_t;
+
+/* The parts being tested, and the next one for a thread to take. */
+typedef struct
+{
+    SmokePart_t   * p_parts;
+    unsigned        num_parts;
+    unsigned        next_part;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+} SmokeRun_t;
+
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static const char * const test_names[NUM_TESTS] =
+{
+    "monobit", "runs", "birthday", "rank", "gap",
+};
+
+/* Tests that a generator is known to fail. */
+static const struct
+{
+    const char *    p_name;
+    SmokeTest_t     test;
+} expected_failures[] =
+{
+    { "shr3",       TEST_RANK },
+    { "mwc1",       TEST_MONOBIT },
+};
+
+#define NUM_EXPECTED_FAILURES   (sizeof(expected_failures) / sizeof(expected_failures[0]))
+
+/* Probabilities of the rank of a random 32x32 binary matrix being <= 29, 30,
+ * 31 and 32. */
+static const double rank_probabilities[4] =
+{
+    0.0052854502573, 0.1283502644829, 0.5775761901732, 0.2887880950866,
+};
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* Number of one bits. This has no multiply, so that the compiler can
+ * vectorise loops of it with SSE2. */
+static uint64_t popcount64(uint64_t x)
+{
+    x = x - ((x >> 1u) & UINT64_C(0x5555555555555555));
+    x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2u) & UINT64_C(0x3333333333333333));
+    x = (x + (x >> 4u)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    x += x >> 8u;
+    x += x >> 16u;
+    x += x >> 32u;
+    return x & 0x7Fu;
+}
+
+/* Position of the single set bit of 'x', for x = 1 << n, from the top 5
+ * bits of x * 0x077CB531 (a de Bruijn sequence). */
+static const uint8_t debruijn_bit_position[32] =
+{
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9,
+};
+
+/* Sort 'num' values less than 2^24, by a two-pass radix sort. */
+static void radix_sort24(uint32_t * p_values, uint32_t * p_temp, size_t num)
+{
+    size_t      counts[4096u];
+    size_t      i;
+    size_t      total;
+    size_t      count;
+    unsigned    shift;
+    uint32_t  * p_in = p_values;
+    uint32_t  * p_out = p_temp;
+    uint32_t  * p_swap;
+
+    for (shift = 0; shift < 24u; shift += 12u)
+    {
+        memset(counts, 0, sizeof(counts));
+        for (i = 0; i < num; i++)
+            counts[(p_in[i] >> shift) & 0xFFFu]++;
+        total = 0;
+        for (i = 0; i < 4096u; i++)
+        {
+            count = counts[i];
+            counts[i] = total;
+            total += count;
+        }
+        for (i = 0; i < num; i++)
+            p_out[counts[(p_in[i] >> shift) & 0xFFFu]++] = p_in[i];
+        p_swap = p_in;
+        p_in = p_out;
+        p_out = p_swap;
+    }
+    /* After an even number of passes, the result is back in p_values. */
+}
+
+/* Birthday spacings test of one sample, taken from 2 * BIRTHDAY_M outputs.
+ * Returns the number of duplicate spacings. */
+static unsigned birthday_sample(const uint32_t * p_values)
+{
+    uint32_t    days[BIRTHDAY_M];
+    uint32_t    temp[BIRTHDAY_M];
+    unsigned    i;
+    unsigned    duplicates;
+
+    for (i = 0; i < BIRTHDAY_M; i++)
+        days[i] = ((p_values[2u * i] >> 20u) << 12u) | (p_values[2u * i + 1u] >> 20u);
+    radix_sort24(days, temp, BIRTHDAY_M);
+    /* Spacings between sorted birthdays. The first is from day 0. */
+    for (i = BIRTHDAY_M - 1u; i > 0; i--)
+        days[i] -= days[i - 1u];
+    radix_sort24(days, temp, BIRTHDAY_M);
+    duplicates = 0;
+    for (i = 1; i < BIRTHDAY_M; i++)
+    {
+        if (days[i] == days[i - 1u])
+            duplicates++;
+    }
+    return duplicates;
+}
+
+/* Run all the tests on one block of outputs. 'p_gap' is the length of the
+ * gap so far, or -1 before the first hit of the part. */
+static void smoke_block(SmokeCounts_t * p_counts, const uint32_t * p_values, long * p_gap)
+{
+    BitColumnMatrix32_t matrix;
+    size_t              i;
+    uint64_t            pair;
+    uint64_t            ones;
+    uint64_t            changes;
+    unsigned            rank;
+    uint32_t            hits;
+    size_t              j;
+    long                hit;
+    long                last_hit;
+    long                gap;
+
+    /* Monobit and runs, on pairs of outputs as 64-bit words, to halve the
+     * number of popcount64() calls. Bit 31 of each output is followed by bit
+     * 0 of the next. These loops have no dependency between iterations, so
+     * they can be vectorised. */
+    ones = 0;
+    changes = 0;
+    for (i = 0; i < SMOKE_BLOCK_LEN; i += 2u)
+    {
+        pair = p_values[i] | ((uint64_t)p_values[i + 1u] << 32u);
+        ones += popcount64(pair);
+        changes += popcount64((pair ^ (pair << 1u)) & ~UINT64_C(1));
+    }
+    for (i = 2; i < SMOKE_BLOCK_LEN; i += 2u)
+    {
+        changes += ((p_values[i - 1u] >> 31u) ^ p_values[i]) & 1u;
+    }
+    p_counts->ones += ones;
+    p_counts->bits += SMOKE_BLOCK_LEN * 32u;
+    p_counts->changes += changes;
+    p_counts->bit_pairs += SMOKE_BLOCK_LEN * 32u - 1u;
+
+    /* Birthday spacings */
+    for (i = 0; i < BIRTHDAY_SAMPLES; i++)
+    {
+        p_counts->birthday_duplicates += birthday_sample(&p_values[i * (SMOKE_BLOCK_LEN / BIRTHDAY_SAMPLES)]);
+        p_counts->birthday_samples++;
+    }
+
+    /* Matrix rank */
+    for (i = 0; i < SMOKE_BLOCK_LEN; i += RANK_STRIDE)
+    {
+        memcpy(matrix.matrix, &p_values[i], sizeof(matrix.matrix));
+        rank = bitcolumnmatrix32_rank(&matrix);
+        p_counts->ranks[(rank <= 29u) ? 0 : rank - 29u]++;
+    }
+
+    /* Gap test. Hits are rare, so rather than a branch for each output,
+     * make a mask of the hits in each 32 outputs, then go through its set
+     * bits. 'last_hit' is the index of the last hit, relative to the start of
+     * this block. */
+    last_hit = -*p_gap - 1;
+    for (i = 0; i < SMOKE_BLOCK_LEN; i += 32u)
+    {
+        hits = 0;
+        for (j = 0; j < 32u; j++)
+            hits |= (uint32_t)(p_values[i + j] < GAP_LIMIT) << j;
+        while (hits != 0)
+        {
+            hit = (long)i + debruijn_bit_position[((hits & (~hits + 1u)) * UINT32_C(0x077CB531)) >> 27u];
+            if (*p_gap >= 0)
+            {
+                gap = hit - last_hit - 1;
+                p_counts->gaps[(gap < (long)GAP_CATEGORIES) ? (size_t)gap : GAP_CATEGORIES]++;
+            }
+            *p_gap = 0;
+            last_hit = hit;
+            hits &= hits - 1u;
+        }
+    }
+    if (*p_gap >= 0)
+        *p_gap = (long)SMOKE_BLOCK_LEN - 1 - last_hit;
+}
+
+static void smoke_part(SmokePart_t * p_part, uint32_t * p_values)
+{
+    size_t          i;
+    long            gap = -1;
+
+    for (i = 0; i < p_part->num_blocks; i++)
+    {
+        p_part->p_fill(p_part->p_rng, p_values, SMOKE_BLOCK_LEN);
+        smoke_block(&p_part->counts, p_values, &gap);
+    }
+}
+
+#ifdef HAVE_PTHREAD
+static unsigned smoke_num_threads(void)
+{
+    long        num_cpus;
+
+    num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus > (long)SMOKE_MAX_THREADS)
+        return SMOKE_MAX_THREADS;
+    if (num_cpus > 0)
+        return (unsigned)num_cpus;
+    return 1u;
+}
+#endif
+
+/* Take the next untested part, or NULL if there are none left. */
+static SmokePart_t * smoke_next_part(SmokeRun_t * p_run)
+{
+    SmokePart_t   * p_part = NULL;
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&p_run->mutex);
+#endif
+    if (p_run->next_part < p_run->num_parts)
+        p_part = &p_run->p_parts[p_run->next_part++];
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock(&p_run->mutex);
+#endif
+    return p_part;
+}
+
+/* Test parts until there are none left. */
+static void * smoke_worker(void * p_arg)
+{
+    SmokeRun_t    * p_run = (SmokeRun_t *)p_arg;
+    SmokePart_t   * p_part;
+    uint32_t      * p_values;
+
+    p_values = malloc(SMOKE_BLOCK_LEN * sizeof(uint32_t));
+    if (p_values != NULL)
+    {
+        while ((p_part = smoke_next_part(p_run)) != NULL)
+        {
+            smoke_part(p_part, p_values);
+        }
+        free(p_values);
+    }
+    return NULL;
+}
+
+/* Test all the parts, on one thread per CPU. */
+static void smoke_run(SmokePart_t * p_parts, unsigned num_parts)
+{
+    SmokeRun_t  run;
+#ifdef HAVE_PTHREAD
+    pthread_t   threads[SMOKE_MAX_THREADS];
+    bool        started[SMOKE_MAX_THREADS];
+    unsigned    num_threads;
+    unsigned    i;
+#endif
+
+    run.p_parts = p_parts;
+    run.num_parts = num_parts;
+    run.next_part = 0;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_init(&run.mutex, NULL);
+    num_threads = smoke_num_threads();
+    if (num_threads > num_parts)
+        num_threads = num_parts;
+    for (i = 1; i < num_threads; ++i)
+    {
+        started[i] = (pthread_create(&threads[i], NULL, smoke_worker, &run) == 0);
+    }
+    /* The calling thread works too, so all the parts are tested even if no
+     * thread could be started. */
+    smoke_worker(&run);
+    for (i = 1; i < num_threads; ++i)
+    {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&run.mutex);
+#else
+    smoke_worker(&run);
+#endif
+}
+
+/* p-value of a standard normal value 'z': the probability of a value >= z. */
+static double normal_p(double z)
+{
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+/* p-value of a chi-square value 'x' with 'k' degrees of freedom: the
+ * probability of a value >= x. This is exact for 3 degrees of freedom, and
+ * otherwise uses the Wilson-Hilferty approximation, which is good for large
+ * 'k'. */
+static double chi_square_p(double x, unsigned k)
+{
+    double      v = 2.0 / (9.0 * k);
+
+    if (k == 3u)
+        return erfc(sqrt(x / 2.0)) + SQRT_2_OVER_PI * sqrt(x) * exp(-x / 2.0);
+    return normal_p((cbrt(x / k) - (1.0 - v)) / sqrt(v));
+}
+
+/* p-values of all the tests, from the total counts. */
+static void smoke_p_values(const SmokeCounts_t * p_counts, double * p_values)
+{
+    double      expected;
+    double      chi_square;
+    double      total;
+    double      probability;
+    unsigned    i;
+
+    p_values[TEST_MONOBIT] = normal_p((p_counts->ones - p_counts->bits / 2.0) / sqrt(p_counts->bits / 4.0));
+    p_values[TEST_RUNS] = normal_p((p_counts->changes - p_counts->bit_pairs / 2.0) / sqrt(p_counts->bit_pairs / 4.0));
+
+    /* The number of duplicate spacings is approximately Poisson. */
+    expected = p_counts->birthday_samples * BIRTHDAY_MEAN;
+    p_values[TEST_BIRTHDAY] = normal_p((p_counts->birthday_duplicates - expected) / sqrt(expected));
+
+    total = 0;
+    for (i = 0; i < 4u; i++)
+        total += p_counts->ranks[i];
+    chi_square = 0;
+    for (i = 0; i < 4u; i++)
+    {
+        expected = total * rank_probabilities[i];
+        chi_square += (p_counts->ranks[i] - expected) * (p_counts->ranks[i] - expected) / expected;
+    }
+    p_values[TEST_RANK] = chi_square_p(chi_square, 3u);
+
+    total = 0;
+    for (i = 0; i <= GAP_CATEGORIES; i++)
+        total += p_counts->gaps[i];
+    chi_square = 0;
+    probability = GAP_PROBABILITY;
+    for (i = 0; i <= GAP_CATEGORIES; i++)
+    {
+        /* The last category is all the longer gaps. */
+        expected = total * ((i < GAP_CATEGORIES) ? probability : probability / GAP_PROBABILITY);
+        chi_square += (p_counts->gaps[i] - expected) * (p_counts->gaps[i] - expected) / expected;
+        probability *= 1.0 - GAP_PROBABILITY;
+    }
+    p_values[TEST_GAP] = chi_square_p(chi_square, GAP_CATEGORIES);
+}
+
+static bool smoke_expected_failure(const char * p_name, SmokeTest_t test)
+{
+    size_t      i;
+
+    for (i = 0; i < NUM_EXPECTED_FAILURES; i++)
+    {
+        if (strcmp(p_name, expected_failures[i].p_name) == 0 && test == expected_failures[i].test)
+            return true;
+    }
+    return false;
+}
+
+/* Add up the counts of all the parts, then check the results of all the
+ * tests. Returns the number of unexpected results. */
+static int smoke_check(const char * p_name, const SmokePart_t * p_parts, unsigned num_parts)
+{
+    SmokeCounts_t   total;
+    double          p_values[NUM_TESTS];
+    const uint64_t * p_in;
+    uint64_t      * p_total;
+    unsigned        i;
+    size_t          j;
+    bool            failed;
+    bool            expected;
+    int             errors;
+
+    memset(&total, 0, sizeof(total));
+    for (i = 0; i < num_parts; i++)
+    {
+        p_in = (const uint64_t *)&p_parts[i].counts;
+        p_total = (uint64_t *)&total;
+        for (j = 0; j < sizeof(total) / sizeof(uint64_t); j++)
+            p_total[j] += p_in[j];
+    }
+    smoke_p_values(&total, p_values);
+
+    errors = 0;
+    printf("    %-10s", p_name);
+    for (i = 0; i < NUM_TESTS; i++)
+    {
+        failed = (p_values[i] < SMOKE_P_FAIL || p_values[i] > 1.0 - SMOKE_P_FAIL);
+        expected = smoke_expected_failure(p_name, (SmokeTest_t)i);
+        printf(" %s %-9.3g", test_names[i], p_values[i]);
+        if (failed && !expected)
+        {
+            printf("(FAILED) ");
+            errors++;
+        }
+        else if (failed && expected)
+        {
+            printf("(known)  ");
+        }
+        else if (!failed && expected)
+        {
+            /* Not an error, but the list of expected failures should be
+             * checked. */
+            printf("(passed) ");
+        }
+    }
+    printf("\n");
+    return errors;
+}
+
+/* Define a function smoke_zzz() that tests 'num_blocks' blocks of output
+ * from generator 'zzz', and returns the number of unexpected results. */
+#define SMOKE_GENERATOR(NAME, TYPE)                                             \
+static void NAME##_smoke_fill(void * p_rng, uint32_t * p_out, size_t num_out) \
+{                                                                           \
+    simplerandom_##NAME##_fill((TYPE *)p_rng, p_out, num_out);              \
+}                                                                           \
+                                                                            \
+static int smoke_##NAME(const uint32_t * p_seeds, size_t num_blocks)        \
+{                                                                           \
+    TYPE            rng;                                                    \
+    TYPE            rngs[SMOKE_NUM_PARTS];                                  \
+    SmokePart_t     parts[SMOKE_NUM_PARTS];                                 \
+    unsigned        num_parts;                                              \
+    size_t          part_blocks;                                            \
+    unsigned        i;                                                      \
+                                                                            \
+    num_parts = SMOKE_NUM_PARTS;                                            \
+    if (num_parts > num_blocks)                                             \
+        num_parts = (unsigned)num_blocks;                                   \
+    part_blocks = num_blocks / num_parts;                                   \
+    simplerandom_##NAME##_seed_array(&rng, p_seeds, 4u, false);             \
+    simplerandom_##NAME##_split(&rng, rngs, num_parts,                      \
+                                (uintmax_t)part_blocks * SMOKE_BLOCK_LEN);  \
+    memset(parts, 0, sizeof(parts));                                        \
+    for (i = 0; i < num_parts; i++)                                         \
+    {                                                                       \
+        parts[i].p_fill = NAME##_smoke_fill;                                \
+        parts[i].p_rng = &rngs[i];                                          \
+        parts[i].num_blocks = part_blocks;                                  \
+    }                                                                       \
+    /* The last part runs on to the end, to test every block. */           \
+    parts[num_parts - 1u].num_blocks = num_blocks - (num_parts - 1u) * part_blocks; \
+    smoke_run(parts, num_parts);                                            \
+    return smoke_check(#NAME, parts, num_parts);                            \
+}
+
+SMOKE_GENERATOR(cong, SimpleRandomCong_t)
+SMOKE_GENERATOR(shr3, SimpleRandomSHR3_t)
+SMOKE_GENERATOR(mwc1, SimpleRandomMWC1_t)
+SMOKE_GENERATOR(mwc2, SimpleRandomMWC2_t)
+SMOKE_GENERATOR(kiss, SimpleRandomKISS_t)
+#ifdef UINT64_C
+SMOKE_GENERATOR(mwc64, SimpleRandomMWC64_t)
+SMOKE_GENERATOR(kiss2, SimpleRandomKISS2_t)
+#endif /* defined(UINT64_C) */
+SMOKE_GENERATOR(lfsr113, SimpleRandomLFSR113_t)
+SMOKE_GENERATOR(lfsr88, SimpleRandomLFSR88_t)
+
+int main(int argc, char ** argv)
+{
+    static const uint32_t   seeds[4] = {
+        UINT32_C(2051391225), UINT32_C(3360276411), UINT32_C(2374144069), UINT32_C(1046675282),
+    };
+    unsigned                log2_count = SMOKE_LOG2_COUNT;
+    size_t                  num_blocks;
+    int                     errors = 0;
+
+    if (argc > 1)
+        log2_count = (unsigned)atoi(argv[1]);
+    if (log2_count < 16u || log2_count > 40u)
+    {
+        fprintf(stderr, "Usage: test_smoke [log2-count], log2-count from 16 to 40\n");
+        return 2;
+    }
+    num_blocks = (size_t)1u << (log2_count - 16u);
+
+    printf("Statistical smoke tests, 2^%u outputs, p-values:\n", log2_count);
+    errors += smoke_cong(seeds, num_blocks);
+    errors += smoke_shr3(seeds, num_blocks);
+    errors += smoke_mwc1(seeds, num_blocks);
+    errors += smoke_mwc2(seeds, num_blocks);
+    errors += smoke_kiss(seeds, num_blocks);
+#ifdef UINT64_C
+    errors += smoke_mwc64(seeds, num_blocks);
+    errors += smoke_kiss2(seeds, num_blocks);
+#endif
+    errors += smoke_lfsr113(seeds, num_blocks);
+    errors += smoke_lfsr88(seeds, num_blocks);
+    printf("Statistical smoke tests: %d errors\n", errors);
+    return (errors != 0) ? 1 : 0;
+}
@@ -2,104 +2,91 @@
 This tests the generators in this collection using L'Ecuyer's
 TestU01 RNG test suite.
 
+Usage:
+    test_testu01 [smallcrush | crush | bigcrush] generator
+
+The default battery is Crush. Each run tests one generator, so to test
+several generators at once, run several processes. The script run_testu01
+does that for all generators, and collects the results in the same form as
+tests/results/.
+
 References:
 
 [1]: http://www.iro.umontreal.ca/~simardr/testu01/tu01.html
 */
 
-#include "simplerandom.h"
+#include <stdio.h>
+
+#include "test_generators.h"
 
 #include "unif01.h"
 #include "bbattery.h"
 
 
-SimpleRandomCong_t      cong_state;
-SimpleRandomSHR3_t      shr3_state;
-SimpleRandomMWC1_t      mwc1_state;
-SimpleRandomMWC2_t      mwc2_state;
-SimpleRandomMWC64_t     mwc64_state;
-SimpleRandomKISS_t      kiss_state;
-SimpleRandomKISS2_t     kiss2_state;
-SimpleRandomLFSR113_t   lfsr113_state;
-SimpleRandomLFSR88_t    lfsr88_state;
+#define GEN_BUFFER_LEN          4096u
 
 
-unsigned int cong_function(void)
-{
-    return simplerandom_cong_next(&cong_state);
-}
-
-unsigned int shr3_function(void)
-{
-    return simplerandom_shr3_next(&shr3_state);
-}
+static const TestGenerator_t *  p_test_gen;
+static uint32_t                 gen_buffer[GEN_BUFFER_LEN];
+static size_t                   gen_buffer_index = GEN_BUFFER_LEN;
 
-unsigned int mwc1_function(void)
-{
-    return simplerandom_mwc1_next(&mwc1_state);
-}
 
-unsigned int mwc2_function(void)
+/* TestU01 takes one value per call, so take values from a buffer that is
+ * refilled by the generator's fill function. */
+unsigned int gen_function(void)
 {
-    return simplerandom_mwc2_next(&mwc2_state);
+    if (gen_buffer_index >= GEN_BUFFER_LEN)
+    {
+        p_test_gen->p_fill(gen_buffer, GEN_BUFFER_LEN);
+        gen_buffer_index = 0;
+    }
+    return gen_buffer[gen_buffer_index++];
 }
 
-unsigned int mwc64_function(void)
+static void usage(void)
 {
-    return simplerandom_mwc64_next(&mwc64_state);
-}
+    size_t      i;
 
-unsigned int kiss_function(void)
-{
-    return simplerandom_kiss_next(&kiss_state);
+    fprintf(stderr, "Usage: test_testu01 [smallcrush | crush | bigcrush] generator\n");
+    fprintf(stderr, "Generators:");
+    for (i = 0; i < NUM_TEST_GENERATORS; i++)
+        fprintf(stderr, " %s", test_generators[i].p_name);
+    fprintf(stderr, "\n");
 }
 
-unsigned int kiss2_function(void)
-{
-    return simplerandom_kiss2_next(&kiss2_state);
-}
-
-unsigned int lfsr113_function(void)
-{
-    return simplerandom_lfsr113_next(&lfsr113_state);
-}
-
-unsigned int lfsr88_function(void)
-{
-    return simplerandom_lfsr88_next(&lfsr88_state);
-}
-
-int main (void)
+int main (int argc, char ** argv)
 {
     unif01_Gen *gen;
-
-    /* Initialise all generators */
-    simplerandom_cong_seed(&cong_state, UINT32_C(2051391225));
-    simplerandom_shr3_seed(&shr3_state, UINT32_C(3360276411));
-    simplerandom_mwc1_seed(&mwc1_state, UINT32_C(12345), UINT32_C(65437));
-    simplerandom_mwc2_seed(&mwc2_state, UINT32_C(12345), UINT32_C(65437));
-    simplerandom_mwc64_seed(&mwc64_state, UINT32_C(7654321), UINT32_C(521288629));
-    simplerandom_kiss_seed(&kiss_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
-    simplerandom_kiss2_seed(&kiss2_state, UINT32_C(2247183469), UINT32_C(99545079), UINT32_C(3269400377), UINT32_C(3950144837));
-    simplerandom_lfsr113_seed(&lfsr113_state, 0, 0, 0, 0);
-    simplerandom_lfsr88_seed(&lfsr88_state, 0, 0, 0);
-
-    //gen = unif01_CreateExternGenBits ("cong", cong_function);
-    //gen = unif01_CreateExternGenBits ("shr3", shr3_function);
-    //gen = unif01_CreateExternGenBits ("mwc1", mwc1_function);
-    gen = unif01_CreateExternGenBits ("mwc2", mwc2_function);
-    //gen = unif01_CreateExternGenBits ("mwc64", mwc64_function);
-    //gen = unif01_CreateExternGenBits ("kiss", kiss_function);
-    //gen = unif01_CreateExternGenBits ("kiss2", kiss2_function);
-    //gen = unif01_CreateExternGenBits ("lfsr113", lfsr113_function);
-    //gen = unif01_CreateExternGenBits ("lfsr88", lfsr88_function);
-
-    //bbattery_SmallCrush (gen);
-    bbattery_Crush (gen);
-    //bbattery_BigCrush (gen);
+    const char *battery = "crush";
+
+    if (argc == 3)
+    {
+        battery = argv[1];
+    }
+    else if (argc != 2)
+    {
+        usage();
+        return 2;
+    }
+    p_test_gen = test_generator_find(argv[argc - 1]);
+    if (p_test_gen == NULL ||
+        (strcmp(battery, "smallcrush") != 0 && strcmp(battery, "crush") != 0 && strcmp(battery, "bigcrush") != 0))
+    {
+        usage();
+        return 2;
+    }
+
+    p_test_gen->p_seed(NULL, 0);
+    gen = unif01_CreateExternGenBits ((char *)p_test_gen->p_name, gen_function);
+
+    if (strcmp(battery, "smallcrush") == 0)
+        bbattery_SmallCrush (gen);
+    else if (strcmp(battery, "bigcrush") == 0)
+        bbattery_BigCrush (gen);
+    else
+        bbattery_Crush (gen);
 
     unif01_DeleteExternGenBits (gen);
 
     return 0;
 }
-
@@ -0,0 +1,25 @@
+/*
+ * threadlocal.h
+ *
+ * SIMPLERANDOM_THREAD_LOCAL is the storage class for thread-local variables,
+ * for the compilers that support them. It is not defined if the compiler has
+ * no known thread-local storage.
+ */
+#ifndef _SIMPLERANDOM_THREADLOCAL_H
+#define _SIMPLERANDOM_THREADLOCAL_H
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define SIMPLERANDOM_THREAD_LOCAL       _Thread_local
+#elif defined(__GNUC__)
+#define SIMPLERANDOM_THREAD_LOCAL       __thread
+#elif defined(_MSC_VER)
+#define SIMPLERANDOM_THREAD_LOCAL       __declspec(thread)
+#endif
+
+
+#endif /* !defined(_SIMPLERANDOM_THREADLOCAL_H) */
@@ -0,0 +1,550 @@
+/*
+ * ziggurattables.c
+ *
+ * Pre-calculated tables for the ziggurat method of generating normal and
+ * exponential random values. See ziggurattables.h.
+ *
+ * This file is generated by genziggurattables. Do not edit. Run
+ * "make update-ziggurattables" to regenerate it.
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "ziggurattables.h"
+
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+/* Each entry is { k, w, f }. The normal table is for f(x) = exp(-x^2 / 2)
+ * with 52-bit x values, and the exponential table is for f(x) = exp(-x) with
+ * 53-bit x values.
+ */
+
+const ZigguratLayer_t ziggurat_normal_table[ZIGGURAT_TABLE_LEN] =
+{
+    { UINT64_C(0x000EF33D8025EF65), 8.683627060801315e-16, 1 },
+    { UINT64_C(0x0000000000000000), 4.7793301757278182e-17, 0.97710170126767082 },
+    { UINT64_C(0x000C08BE98FBC6C6), 6.3543524174053128e-17, 0.959879091800106 },
+    { UINT64_C(0x000DA354FABD814B), 7.454870481247737e-17, 0.94519895344229909 },
+    { UINT64_C(0x000E51F67EC1EEEF), 8.3293668157931342e-17, 0.93206007595922991 },
+    { UINT64_C(0x000EB255E9D3F780), 9.0680604050595156e-17, 0.91999150503934646 },
+    { UINT64_C(0x000EEF4B817ECABA), 9.7148600765677939e-17, 0.90872644005213032 },
+    { UINT64_C(0x000F19470AFA44AC), 1.0294750314241046e-16, 0.89809592189834286 },
+    { UINT64_C(0x000F37ED61FFCB17), 1.0823430288447711e-16, 0.88798466075583282 },
+    { UINT64_C(0x000F4F469561255B), 1.1311470196109058e-16, 0.87830965580891684 },
+    { UINT64_C(0x000F61A5E41BA396), 1.1766359457022946e-16, 0.86900868803685649 },
+    { UINT64_C(0x000F707A755396A4), 1.2193617278714386e-16, 0.86003362119633109 },
+    { UINT64_C(0x000F7CB2EC28449B), 1.2597439914637113e-16, 0.85134625845867751 },
+    { UINT64_C(0x000F86F10C6357D3), 1.2981099886264051e-16, 0.84291565311220373 },
+    { UINT64_C(0x000F8FA6578325DD), 1.3347203736824142e-16, 0.83471629298688299 },
+    { UINT64_C(0x000F9724C74DD0DA), 1.3697864842571223e-16, 0.82672683394622093 },
+    { UINT64_C(0x000F9DA907DBF508), 1.4034823001242402e-16, 0.81892919160370192 },
+    { UINT64_C(0x000FA360F581FA72), 1.4359529452056965e-16, 0.81130787431265572 },
+    { UINT64_C(0x000FA86FDE5B4BF8), 1.4673208742364442e-16, 0.80384948317096383 },
+    { UINT64_C(0x000FACF160D354DC), 1.4976904668391059e-16, 0.79654233042295841 },
+    { UINT64_C(0x000FB0FB6718B90E), 1.527151500359622e-16, 0.78937614356602404 },
+    { UINT64_C(0x000FB49F8D5374C5), 1.5557818169460786e-16, 0.78234183265480195 },
+    { UINT64_C(0x000FB7EC2366FE77), 1.5836494009290908e-16, 0.77543130498118662 },
+    { UINT64_C(0x000FBAECE9A1E50C), 1.6108140175274953e-16, 0.76863731579848571 },
+    { UINT64_C(0x000FBDAB9D040BED), 1.6373285203969875e-16, 0.76195334683679483 },
+    { UINT64_C(0x000FC03060FF6C57), 1.6632399058420855e-16, 0.75537350650709567 },
+    { UINT64_C(0x000FC2821037A248), 1.6885901708676616e-16, 0.74889244721915638 },
+    { UINT64_C(0x000FC4A67AE25BD1), 1.7134170176559678e-16, 0.74250529634015061 },
+    { UINT64_C(0x000FC6A2977AEE30), 1.7377544365864879e-16, 0.7362075981268621 },
+    { UINT64_C(0x000FC87AA92896A4), 1.7616331923001016e-16, 0.72999526456147568 },
+    { UINT64_C(0x000FCA325E4BDE85), 1.7850812316976747e-16, 0.72386453346862967 },
+    { UINT64_C(0x000FCBCCE902231A), 1.808124028579917e-16, 0.71781193263072152 },
+    { UINT64_C(0x000FCD4D12F839C4), 1.830784876482677e-16, 0.71183424887824798 },
+    { UINT64_C(0x000FCEB54D8FEC99), 1.8530851388618039e-16, 0.70592850133275376 },
+    { UINT64_C(0x000FD007BF1DC930), 1.8750444639373899e-16, 0.70009191813651117 },
+    { UINT64_C(0x000FD1464DD6C4E5), 1.8966809700774777e-16, 0.69432191612611627 },
+    { UINT64_C(0x000FD272A8E2F450), 1.918011406483864e-16, 0.68861608300467125 },
+    { UINT64_C(0x000FD38E4FF0C91E), 1.9390512930625123e-16, 0.6829721616449943 },
+    { UINT64_C(0x000FD49A9990B479), 1.9598150426628839e-16, 0.67738803621877308 },
+    { UINT64_C(0x000FD598B8920F52), 1.9803160683128191e-16, 0.67186171989708166 },
+    { UINT64_C(0x000FD689C08E99EC), 2.0005668776273345e-16, 0.66639134390874977 },
+    { UINT64_C(0x000FD76EA9C8E832), 2.0205791562071666e-16, 0.66097514777666277 },
+    { UINT64_C(0x000FD848547B08E8), 2.0403638415480224e-16, 0.65561147057969693 },
+    { UINT64_C(0x000FD9178BAD2C8B), 2.0599311887403721e-16, 0.65029874311081637 },
+    { UINT64_C(0x000FD9DD07A7ADD2), 2.0792908290414032e-16, 0.64503548082082196 },
+    { UINT64_C(0x000FDA9970105E8B), 2.0984518222370366e-16, 0.63982027745305614 },
+    { UINT64_C(0x000FDB4D5DC02E1F), 2.1174227035760357e-16, 0.63465179928762316 },
+    { UINT64_C(0x000FDBF95C5BFCD0), 2.1362115259449883e-16, 0.62952877992483625 },
+    { UINT64_C(0x000FDC9DEBB99A7D), 2.154825897858147e-16, 0.62445001554702606 },
+    { UINT64_C(0x000FDD3B8118729D), 2.173273017756438e-16, 0.61941436060583399 },
+    { UINT64_C(0x000FDDD288342F8F), 2.1915597050427286e-16, 0.61442072388891344 },
+    { UINT64_C(0x000FDE6364369F63), 2.2096924282235332e-16, 0.6094680649257731 },
+    { UINT64_C(0x000FDEEE708D514E), 2.2276773304789568e-16, 0.60455539069746733 },
+    { UINT64_C(0x000FDF7401A6B42E), 2.2455202529414375e-16, 0.59968175261912482 },
+    { UINT64_C(0x000FDFF46599ED3E), 2.2632267559285698e-16, 0.59484624376798689 },
+    { UINT64_C(0x000FE06FE4BC24F1), 2.280802138345019e-16, 0.59004799633282545 },
+    { UINT64_C(0x000FE0E6C225A258), 2.2982514554424704e-16, 0.5852861792633709 },
+    { UINT64_C(0x000FE1593C28B84B), 2.3155795351040823e-16, 0.58055999610079034 },
+    { UINT64_C(0x000FE1C78CBC3F98), 2.3327909928004376e-16, 0.57586868297235316 },
+    { UINT64_C(0x000FE231E9DB1CA9), 2.3498902453470975e-16, 0.57121150673525267 },
+    { UINT64_C(0x000FE29885DA1B91), 2.3668815235791623e-16, 0.56658776325616389 },
+    { UINT64_C(0x000FE2FB8FB54186), 2.3837688840454263e-16, 0.5619967758145239 },
+    { UINT64_C(0x000FE35B33558D4A), 2.4005562198135078e-16, 0.5574378936187655 },
+    { UINT64_C(0x000FE3B799D0002A), 2.417247270467504e-16, 0.55291049042583185 },
+    { UINT64_C(0x000FE410E99EAD7E), 2.4338456313711043e-16, 0.54841396325526537 },
+    { UINT64_C(0x000FE46746D47734), 2.4503547622614969e-16, 0.54394773119002582 },
+    { UINT64_C(0x000FE4BAD34C095B), 2.466777995232707e-16, 0.53951123425695158 },
+    { UINT64_C(0x000FE50BAED29524), 2.4831185421610892e-16, 0.53510393238045717 },
+    { UINT64_C(0x000FE559F74EBC77), 2.4993795016204544e-16, 0.5307253044036615 },
+    { UINT64_C(0x000FE5A5C8E41212), 2.5155638653296593e-16, 0.52637484717168403 },
+    { UINT64_C(0x000FE5EF3E138689), 2.5316745241713597e-16, 0.5220520746723214 },
+    { UINT64_C(0x000FE6366FD91077), 2.5477142738169461e-16, 0.51775651722975591 },
+    { UINT64_C(0x000FE67B75C6D578), 2.5636858199893983e-16, 0.51348772074732651 },
+    { UINT64_C(0x000FE6BE661E11AA), 2.5795917833928682e-16, 0.50924524599574761 },
+    { UINT64_C(0x000FE6FF55E5F4F2), 2.5954347043351717e-16, 0.5050286679434679 },
+    { UINT64_C(0x000FE73E5900A701), 2.6112170470670209e-16, 0.50083757512614835 },
+    { UINT64_C(0x000FE77B823E9E39), 2.6269412038597271e-16, 0.49667156905248933 },
+    { UINT64_C(0x000FE7B6E37070A1), 2.642609498841191e-16, 0.49253026364386815 },
+    { UINT64_C(0x000FE7F08D774242), 2.6582241916083088e-16, 0.48841328470545758 },
+    { UINT64_C(0x000FE8289053F08C), 2.6737874806323648e-16, 0.48432026942668288 },
+    { UINT64_C(0x000FE85EFB35173B), 2.6893015064726174e-16, 0.48025086590904642 },
+    { UINT64_C(0x000FE893DC840864), 2.7047683548119967e-16, 0.47620473271950547 },
+    { UINT64_C(0x000FE8C741F0CEBC), 2.7201900593277335e-16, 0.47218153846772976 },
+    { UINT64_C(0x000FE8F9387D4EF6), 2.7355686044086806e-16, 0.46818096140569321 },
+    { UINT64_C(0x000FE929CC879B1C), 2.7509059277301681e-16, 0.46420268904817391 },
+    { UINT64_C(0x000FE95909D388EA), 2.7662039226963918e-16, 0.46024641781284248 },
+    { UINT64_C(0x000FE986FB939AA1), 2.7814644407595451e-16, 0.4563118526787161 },
+    { UINT64_C(0x000FE9B3AC714865), 2.796689293624231e-16, 0.45239870686184824 },
+    { UINT64_C(0x000FE9DF2694B6D5), 2.8118802553450217e-16, 0.44850670150720273 },
+    { UINT64_C(0x000FEA0973ABE67B), 2.8270390643244802e-16, 0.44463556539573912 },
+    { UINT64_C(0x000FEA329CF166A4), 2.8421674252184071e-16, 0.44078503466580377 },
+    { UINT64_C(0x000FEA5AAB32952C), 2.857267010754602e-16, 0.43695485254798533 },
+    { UINT64_C(0x000FEA81A6D57419), 2.8723394634709804e-16, 0.43314476911265209 },
+    { UINT64_C(0x000FEAA797DE1CEF), 2.8873863973784824e-16, 0.42935454102944126 },
+    { UINT64_C(0x000FEACC85F3D91F), 2.9024093995538428e-16, 0.4255839313380218 },
+    { UINT64_C(0x000FEAF07865E63C), 2.917410031666946e-16, 0.42183270922949573 },
+    { UINT64_C(0x000FEB13762FEC12), 2.9323898314471826e-16, 0.41810064983784795 },
+    { UINT64_C(0x000FEB3585FE2A4A), 2.9473503140929359e-16, 0.4143875340408909 },
+    { UINT64_C(0x000FEB56AE3162B4), 2.962292973628067e-16, 0.41069314827018799 },
+    { UINT64_C(0x000FEB76F4E284F9), 2.9772192842090299e-16, 0.40701728432947315 },
+    { UINT64_C(0x000FEB965FE62013), 2.9921307013860141e-16, 0.40335973922111429 },
+    { UINT64_C(0x000FEBB4F4CF9D7C), 3.007028663321332e-16, 0.399720314980197 },
+    { UINT64_C(0x000FEBD2B8F449CF), 3.0219145919680625e-16, 0.39609881851583217 },
+    { UINT64_C(0x000FEBEFB16E2E3D), 3.0367898942118028e-16, 0.3924950614593154 },
+    { UINT64_C(0x000FEC0BE31EBDE8), 3.0516559629782197e-16, 0.38890886001878855 },
+    { UINT64_C(0x000FEC2752B15A14), 3.0665141783089555e-16, 0.38534003484007706 },
+    { UINT64_C(0x000FEC42049DAFD3), 3.0813659084082982e-16, 0.38178841087339344 },
+    { UINT64_C(0x000FEC5BFD29F196), 3.0962125106629235e-16, 0.37825381724561896 },
+    { UINT64_C(0x000FEC75406CEEF4), 3.111055332636894e-16, 0.37473608713789086 },
+    { UINT64_C(0x000FEC8DD2500CB4), 3.1258957130439999e-16, 0.37123505766823922 },
+    { UINT64_C(0x000FECA5B6911F10), 3.1407349826994477e-16, 0.36775056977903225 },
+    { UINT64_C(0x000FECBCF0C427FE), 3.1555744654528021e-16, 0.36428246812900372 },
+    { UINT64_C(0x000FECD38454FB15), 3.17041547910403e-16, 0.36083060098964775 },
+    { UINT64_C(0x000FECE97488C8B3), 3.1852593363044075e-16, 0.35739482014578022 },
+    { UINT64_C(0x000FECFEC47F91B7), 3.2001073454440124e-16, 0.35397498080007656 },
+    { UINT64_C(0x000FED1377358528), 3.214960811527448e-16, 0.35057094148140588 },
+    { UINT64_C(0x000FED278F844903), 3.2298210370394161e-16, 0.34718256395679348 },
+    { UINT64_C(0x000FED3B10242F4C), 3.2446893228016983e-16, 0.34380971314685055 },
+    { UINT64_C(0x000FED4DFBAD586D), 3.2595669688230794e-16, 0.34045225704452164 },
+    { UINT64_C(0x000FED605498C3DC), 3.2744552751437077e-16, 0.33711006663700588 },
+    { UINT64_C(0x000FED721D414FE8), 3.2893555426753707e-16, 0.33378301583071823 },
+    { UINT64_C(0x000FED8357E4A981), 3.3042690740391294e-16, 0.33047098137916342 },
+    { UINT64_C(0x000FED9406A42CC8), 3.3191971744017528e-16, 0.32717384281360129 },
+    { UINT64_C(0x000FEDA42B85B704), 3.334141152312373e-16, 0.32389148237639104 },
+    { UINT64_C(0x000FEDB3C8746AB3), 3.3491023205407789e-16, 0.3206237849569053 },
+    { UINT64_C(0x000FEDC2DF416652), 3.3640819969187656e-16, 0.3173706380299135 },
+    { UINT64_C(0x000FEDD171A46E52), 3.3790815051859503e-16, 0.31413193159633707 },
+    { UINT64_C(0x000FEDDF813C8AD2), 3.3941021758414901e-16, 0.31090755812628634 },
+    { UINT64_C(0x000FEDED0F90997F), 3.409145347003127e-16, 0.30769741250429189 },
+    { UINT64_C(0x000FEDFA1E0FD413), 3.4242123652750191e-16, 0.30450139197664983 },
+    { UINT64_C(0x000FEE06AE124BC4), 3.4393045866258318e-16, 0.30131939610080288 },
+    { UINT64_C(0x000FEE12C0D95A06), 3.4544233772785845e-16, 0.29815132669668531 },
+    { UINT64_C(0x000FEE1E579006DF), 3.4695701146137845e-16, 0.29499708779996164 },
+    { UINT64_C(0x000FEE29734B6524), 3.4847461880874147e-16, 0.29185658561709499 },
+    { UINT64_C(0x000FEE34150AE4BB), 3.499953000165382e-16, 0.2887297284821827 },
+    { UINT64_C(0x000FEE3E3DB89B3C), 3.5151919672760754e-16, 0.28561642681550159 },
+    { UINT64_C(0x000FEE47EE2982F3), 3.5304645207827411e-16, 0.28251659308370741 },
+    { UINT64_C(0x000FEE51271DB086), 3.5457721079774367e-16, 0.27943014176163772 },
+    { UINT64_C(0x000FEE59E9407F41), 3.5611161930983894e-16, 0.2763569892956681 },
+    { UINT64_C(0x000FEE623528B42D), 3.5764982583726515e-16, 0.27329705406857691 },
+    { UINT64_C(0x000FEE6A0B5897F0), 3.5919198050860314e-16, 0.27025025636587519 },
+    { UINT64_C(0x000FEE716C3E077A), 3.6073823546823534e-16, 0.26721651834356114 },
+    { UINT64_C(0x000FEE7858327B81), 3.6228874498941935e-16, 0.2641957639972608 },
+    { UINT64_C(0x000FEE7ECF7B06B9), 3.6384366559073464e-16, 0.26118791913272082 },
+    { UINT64_C(0x000FEE84D2484AB2), 3.6540315615613714e-16, 0.2581929113376189 },
+    { UINT64_C(0x000FEE8A60B66342), 3.6696737805887024e-16, 0.25521066995466168 },
+    { UINT64_C(0x000FEE8F7ACCC851), 3.6853649528949155e-16, 0.2522411260559419 },
+    { UINT64_C(0x000FEE94207E25DA), 3.7011067458828998e-16, 0.24928421241852824 },
+    { UINT64_C(0x000FEE9851A829EB), 3.716900855823824e-16, 0.24633986350126363 },
+    { UINT64_C(0x000FEE9C0E13485B), 3.7327490092779445e-16, 0.24340801542275012 },
+    { UINT64_C(0x000FEE9F557273F3), 3.7486529645684897e-16, 0.24048860594050039 },
+    { UINT64_C(0x000FEEA22762CCAE), 3.7646145133120292e-16, 0.23758157443123795 },
+    { UINT64_C(0x000FEEA4836B42AB), 3.7806354820089609e-16, 0.2346868618723299 },
+    { UINT64_C(0x000FEEA668FC2D71), 3.7967177336979448e-16, 0.23180441082433859 },
+    { UINT64_C(0x000FEEA7D76ED6F9), 3.8128631696783779e-16, 0.22893416541468023 },
+    { UINT64_C(0x000FEEA8CE04FA0A), 3.8290737313052437e-16, 0.2260760713223802 },
+    { UINT64_C(0x000FEEA94BE8333B), 3.8453514018609596e-16, 0.22323007576391746 },
+    { UINT64_C(0x000FEEA95029640F), 3.8616982085091493e-16, 0.22039612748015194 },
+    { UINT64_C(0x000FEEA8D9C0075D), 3.8781162243355872e-16, 0.21757417672433113 },
+    { UINT64_C(0x000FEEA7E7897653), 3.8946075704819262e-16, 0.21476417525117358 },
+    { UINT64_C(0x000FEEA678481D24), 3.9111744183782054e-16, 0.21196607630703015 },
+    { UINT64_C(0x000FEEA48AA29E82), 3.927818992080542e-16, 0.20917983462112499 },
+    { UINT64_C(0x000FEEA21D22E4D9), 3.9445435707208776e-16, 0.20640540639788071 },
+    { UINT64_C(0x000FEE9F2E352024), 3.9613504910761354e-16, 0.20364274931033485 },
+    { UINT64_C(0x000FEE9BBC26AF2E), 3.9782421502646831e-16, 0.20089182249465656 },
+    { UINT64_C(0x000FEE97C524F2E3), 3.995221008578565e-16, 0.19815258654577511 },
+    { UINT64_C(0x000FEE93473C0A39), 4.0122895924606296e-16, 0.19542500351413428 },
+    { UINT64_C(0x000FEE8E40557515), 4.0294504976363284e-16, 0.19270903690358912 },
+    { UINT64_C(0x000FEE88AE369C79), 4.0467063924107504e-16, 0.19000465167046496 },
+    { UINT64_C(0x000FEE828E7F3DFC), 4.0640600211422504e-16, 0.18731181422380025 },
+    { UINT64_C(0x000FEE7BDEA7B887), 4.0815142079049387e-16, 0.18463049242679927 },
+    { UINT64_C(0x000FEE749BFF37FF), 4.0990718603532664e-16, 0.18196065559952254 },
+    { UINT64_C(0x000FEE6CC3A9BD5E), 4.1167359738030252e-16, 0.17930227452284767 },
+    { UINT64_C(0x000FEE64529E007F), 4.134509635544235e-16, 0.176655321443735 },
+    { UINT64_C(0x000FEE5B45A32888), 4.1523960294026869e-16, 0.17401977008183875 },
+    { UINT64_C(0x000FEE51994E57B5), 4.1703984405683144e-16, 0.17139559563750595 },
+    { UINT64_C(0x000FEE474A0006CE), 4.1885202607101108e-16, 0.16878277480121151 },
+    { UINT64_C(0x000FEE3C53E12C4F), 4.2067649933990141e-16, 0.16618128576448205 },
+    { UINT64_C(0x000FEE30B2E02AD7), 4.2251362598620484e-16, 0.1635911082323657 },
+    { UINT64_C(0x000FEE2462AD8204), 4.2436378050930775e-16, 0.16101222343751107 },
+    { UINT64_C(0x000FEE175EB83C59), 4.2622735043477981e-16, 0.15844461415592431 },
+    { UINT64_C(0x000FEE09A22A1447), 4.2810473700531167e-16, 0.1558882647244792 },
+    { UINT64_C(0x000FEDFB27E349CB), 4.2999635591638323e-16, 0.15334316106026283 },
+    { UINT64_C(0x000FEDEBEA76216C), 4.3190263810026294e-16, 0.15080929068184568 },
+    { UINT64_C(0x000FEDDBE422047D), 4.3382403056227908e-16, 0.14828664273257453 },
+    { UINT64_C(0x000FEDCB0ECE39D3), 4.357609972736849e-16, 0.14577520800599403 },
+    { UINT64_C(0x000FEDB964042CF3), 4.3771402012585875e-16, 0.14327497897351341 },
+    { UINT64_C(0x000FEDA6DCE938C9), 4.3968359995105214e-16, 0.1407859498144447 },
+    { UINT64_C(0x000FED937237E98C), 4.416702576154204e-16, 0.13830811644855071 },
+    { UINT64_C(0x000FED7F1C38A836), 4.4367453519065673e-16, 0.13584147657125373 },
+    { UINT64_C(0x000FED69D2B9C02A), 4.4569699721120431e-16, 0.13338602969166913 },
+    { UINT64_C(0x000FED538D06ADFF), 4.4773823202475339e-16, 0.1309417771736443 },
+    { UINT64_C(0x000FED3C41DEA422), 4.4979885324455497e-16, 0.12850872227999952 },
+    { UINT64_C(0x000FED23E76A2FD7), 4.5187950131300588e-16, 0.12608687022018586 },
+    { UINT64_C(0x000FED0A732FE643), 4.539808451870034e-16, 0.12367622820159654 },
+    { UINT64_C(0x000FECEFDA07FE33), 4.561035841567423e-16, 0.12127680548479021 },
+    { UINT64_C(0x000FECD4100EB7B8), 4.5824844981095677e-16, 0.11888861344290998 },
+    { UINT64_C(0x000FECB708956EB4), 4.6041620816311538e-16, 0.1165116656256108 },
+    { UINT64_C(0x000FEC98B61230C0), 4.6260766195478467e-16, 0.11414597782783835 },
+    { UINT64_C(0x000FEC790A0DA978), 4.6482365315432084e-16, 0.11179156816383801 },
+    { UINT64_C(0x000FEC57F50F31FD), 4.6706506567126326e-16, 0.10944845714681163 },
+    { UINT64_C(0x000FEC356686C961), 4.6933282830933299e-16, 0.10711666777468364 },
+    { UINT64_C(0x000FEC114CB4B334), 4.7162791798383533e-16, 0.1047962256224869 },
+    { UINT64_C(0x000FEBEB948E6FD0), 4.7395136323258691e-16, 0.10248715894193508 },
+    { UINT64_C(0x000FEBC429A0B691), 4.7630424805331393e-16, 0.10018949876880981 },
+    { UINT64_C(0x000FEB9AF5EE0CDC), 4.7868771610487248e-16, 0.097903279038862284 },
+    { UINT64_C(0x000FEB6FE1C98542), 4.8110297531474192e-16, 0.095628536713008819 },
+    { UINT64_C(0x000FEB42D3AD1F9E), 4.8355130294115271e-16, 0.09336531191269086 },
+    { UINT64_C(0x000FEB13B00B2D4B), 4.8603405114508129e-16, 0.091113648066373634 },
+    { UINT64_C(0x000FEAE2591A02E8), 4.8855265313536044e-16, 0.088873592068275789 },
+    { UINT64_C(0x000FEAAEAE992256), 4.9110862995952705e-16, 0.086645194450557961 },
+    { UINT64_C(0x000FEA788D8EE326), 4.9370359802403355e-16, 0.084428509570353374 },
+    { UINT64_C(0x000FEA3FCFFD73E5), 4.9633927744039882e-16, 0.082223595813202863 },
+    { UINT64_C(0x000FEA044C8DD9F6), 4.9901750130918225e-16, 0.080030515814663056 },
+    { UINT64_C(0x000FE9C5D62F563A), 5.0174022607180904e-16, 0.077849336702096039 },
+    { UINT64_C(0x000FE9843BA947A3), 5.0450954308187285e-16, 0.075680130358927067 },
+    { UINT64_C(0x000FE93F471D4728), 5.0732769157335431e-16, 0.073522973713981268 },
+    { UINT64_C(0x000FE8F6BD76C5D6), 5.1019707323415618e-16, 0.071377949058890375 },
+    { UINT64_C(0x000FE8AA5DC4E8E6), 5.1312026863067837e-16, 0.069245144397006769 },
+    { UINT64_C(0x000FE859E07AB1EA), 5.1610005577432282e-16, 0.067124653827788497 },
+    { UINT64_C(0x000FE804F690A93F), 5.1913943117576996e-16, 0.065016577971242842 },
+    { UINT64_C(0x000FE7AB488233BF), 5.2224163380002353e-16, 0.062921024437758113 },
+    { UINT64_C(0x000FE74C751F6AA5), 5.2541017241775973e-16, 0.060838108349539864 },
+    { UINT64_C(0x000FE6E8102AA201), 5.2864885695049451e-16, 0.058767952920933758 },
+    { UINT64_C(0x000FE67DA0B6ABD8), 5.3196183453384004e-16, 0.056710690106202895 },
+    { UINT64_C(0x000FE60C9F38307D), 5.3535363118164969e-16, 0.054666461324888914 },
+    { UINT64_C(0x000FE5947338F742), 5.3882920013340532e-16, 0.052635418276792176 },
+    { UINT64_C(0x000FE51470977280), 5.4239397822017123e-16, 0.050617723860947761 },
+    { UINT64_C(0x000FE48BD436F457), 5.4605395190747814e-16, 0.048613553215868521 },
+    { UINT64_C(0x000FE3F9BFFD1E37), 5.4981573508928141e-16, 0.046623094901930368 },
+    { UINT64_C(0x000FE35D35EEB19B), 5.536866612467876e-16, 0.044646552251294443 },
+    { UINT64_C(0x000FE2B5122FE4FD), 5.5767489329265775e-16, 0.042684144916474431 },
+    { UINT64_C(0x000FE20003995557), 5.6178955535554167e-16, 0.040736110655940933 },
+    { UINT64_C(0x000FE13C82788314), 5.6604089200824232e-16, 0.038802707404526113 },
+    { UINT64_C(0x000FE068C4EE67AF), 5.7044046212913901e-16, 0.036884215688567284 },
+    { UINT64_C(0x000FDF82B02B71AA), 5.7500137689198962e-16, 0.034980941461716084 },
+    { UINT64_C(0x000FDE87C57EFEAA), 5.7973859457245946e-16, 0.033093219458578522 },
+    { UINT64_C(0x000FDD7509C63BFD), 5.84669289345548e-16, 0.031221417191920245 },
+    { UINT64_C(0x000FDC46E529BF12), 5.8981331764779004e-16, 0.029365939758133314 },
+    { UINT64_C(0x000FDAF8F82E0282), 5.9519381496414451e-16, 0.027527235669603082 },
+    { UINT64_C(0x000FD985E1B2BA75), 6.0083796962719093e-16, 0.025705804008548896 },
+    { UINT64_C(0x000FD7E6EF48CF04), 6.0677804093334485e-16, 0.023902203305795882 },
+    { UINT64_C(0x000FD613ADBD650B), 6.1305272087252806e-16, 0.022117062707308864 },
+    { UINT64_C(0x000FD40149E2F011), 6.1970898945816256e-16, 0.020351096230044517 },
+    { UINT64_C(0x000FD1A1A7B4C7AC), 6.2680469633012834e-16, 0.018605121275724643 },
+    { UINT64_C(0x000FCEE204761F9E), 6.344122407127505e-16, 0.016880083152543166 },
+    { UINT64_C(0x000FCBA8D85E11B1), 6.4262396595480544e-16, 0.015177088307935325 },
+    { UINT64_C(0x000FC7D26ECD2D22), 6.5156033173449926e-16, 0.01349745060173988 },
+    { UINT64_C(0x000FC32B2F1E22EC), 6.6138278850976632e-16, 0.011842757857907888 },
+    { UINT64_C(0x000FBD6581C0B839), 6.7231504625055856e-16, 0.010214971439701471 },
+    { UINT64_C(0x000FB606C4005433), 6.8468034175642588e-16, 0.0086165827693987316 },
+    { UINT64_C(0x000FAC40582A2873), 6.98971833638762e-16, 0.0070508754713732268 },
+    { UINT64_C(0x000F9E971E014597), 7.1599949348306642e-16, 0.0055224032992509968 },
+    { UINT64_C(0x000F89FA48A41DFB), 7.3724243017987979e-16, 0.0040379725933630305 },
+    { UINT64_C(0x000F66C5F7F0302C), 7.6589363708055718e-16, 0.0026090727461021627 },
+    { UINT64_C(0x000F1A5A4B331C49), 8.1138493376564842e-16, 0.0012602859304985975 },
+};
+
+const ZigguratLayer_t ziggurat_exp_table[ZIGGURAT_TABLE_LEN] =
+{
+    { UINT64_C(0x001C5214272497C7), 9.655740063209183e-16, 1 },
+    { UINT64_C(0x0000000000000000), 7.0890142439554112e-18, 0.9381436808621747 },
+    { UINT64_C(0x00137D5BD79C317E), 1.1639412496691221e-17, 0.90046992992574648 },
+    { UINT64_C(0x00186EF58E3F3C0F), 1.5243915123532157e-17, 0.87170433238120371 },
+    { UINT64_C(0x001A9BB7320EB0AD), 1.8332848857237439e-17, 0.84778550062398961 },
+    { UINT64_C(0x001BD127F719447C), 2.1089651094644863e-17, 0.82699329664305032 },
+    { UINT64_C(0x001C951D0F88651B), 2.3611280778431382e-17, 0.80842165152300838 },
+    { UINT64_C(0x001D1BFE2D5C3973), 2.595595772310894e-17, 0.79152763697249562 },
+    { UINT64_C(0x001D7E5BD56B18B3), 2.8161735541977523e-17, 0.77595685204011555 },
+    { UINT64_C(0x001DC934DD172C71), 3.0255041303213823e-17, 0.76146338884989628 },
+    { UINT64_C(0x001E0409DFAC9DC9), 3.2255082548363747e-17, 0.7478686219851951 },
+    { UINT64_C(0x001E337B71D47837), 3.417632340185027e-17, 0.73503809243142348 },
+    { UINT64_C(0x001E5A8B177CB7A3), 3.6029969787344525e-17, 0.72286765959357202 },
+    { UINT64_C(0x001E7B42096F046C), 3.782490776869649e-17, 0.71127476080507601 },
+    { UINT64_C(0x001E970DAF08AE3E), 3.9568321980975532e-17, 0.70019265508278816 },
+    { UINT64_C(0x001EAEF5B14EF09E), 4.1266117781759464e-17, 0.68956649611707799 },
+    { UINT64_C(0x001EC3BD07B46557), 4.292321808442525e-17, 0.67935057226476536 },
+    { UINT64_C(0x001ED5F6F08799CE), 4.4543777432823714e-17, 0.66950631673192473 },
+    { UINT64_C(0x001EE614AE6E5688), 4.6131339814831859e-17, 0.6600008410789997 },
+    { UINT64_C(0x001EF46ECA361CD0), 4.7688957252646359e-17, 0.6508058334145711 },
+    { UINT64_C(0x001F014B76DDD4A4), 4.9219280437279628e-17, 0.64189671642726609 },
+    { UINT64_C(0x001F0CE313A796B7), 5.0724629045031464e-17, 0.63325199421436607 },
+    { UINT64_C(0x001F176369F1F77A), 5.2207047027926717e-17, 0.62485273870366598 },
+    { UINT64_C(0x001F20F20C452571), 5.3668346617181922e-17, 0.61668218091520766 },
+    { UINT64_C(0x001F29AE1951A874), 5.5110143728350947e-17, 0.60872538207962212 },
+    { UINT64_C(0x001F31B18FB95532), 5.6533886732396671e-17, 0.60096896636523223 },
+    { UINT64_C(0x001F39125157C106), 5.7940880048527666e-17, 0.59340090169173343 },
+    { UINT64_C(0x001F3FE2EB6E694C), 5.9332303652089431e-17, 0.58601031847726803 },
+    { UINT64_C(0x001F463332D788FB), 6.0709229328471796e-17, 0.57878735860284503 },
+    { UINT64_C(0x001F4C10BF1D3A0F), 6.2072634311631935e-17, 0.57172304866482582 },
+    { UINT64_C(0x001F51874C5C3322), 6.3423412803030765e-17, 0.56480919291240028 },
+    { UINT64_C(0x001F56A109C3ECC0), 6.4762385759561421e-17, 0.55803828226258745 },
+    { UINT64_C(0x001F5B66D9099996), 6.6090309257694052e-17, 0.55140341654064129 },
+    { UINT64_C(0x001F5FE08210D08C), 6.7407881678727222e-17, 0.54489823767243961 },
+    { UINT64_C(0x001F6414DD445772), 6.8715749911838124e-17, 0.53851687200286191 },
+    { UINT64_C(0x001F6809F6859679), 7.0014514734039296e-17, 0.53225388026304332 },
+    { UINT64_C(0x001F6BC52A2B02E7), 7.1304735496606434e-17, 0.52610421398361973 },
+    { UINT64_C(0x001F6F4B3D32E4F4), 7.2586934224146484e-17, 0.5200631773682336 },
+    { UINT64_C(0x001F72A07190F13A), 7.3861599213817908e-17, 0.51412639381474856 },
+    { UINT64_C(0x001F75C8974D09D7), 7.5129188207237281e-17, 0.50828977641064288 },
+    { UINT64_C(0x001F78C71B045CC0), 7.6390131195508258e-17, 0.50254950184134772 },
+    { UINT64_C(0x001F7B9F12413FF5), 7.7644832907978481e-17, 0.49690198724154955 },
+    { UINT64_C(0x001F7E5346079F8A), 7.8893675027297905e-17, 0.49134386959403253 },
+    { UINT64_C(0x001F80E63BE21139), 8.0137018166754544e-17, 0.48587198734188491 },
+    { UINT64_C(0x001F835A3DAD9162), 8.1375203640417622e-17, 0.48048336393045421 },
+    { UINT64_C(0x001F85B16056B913), 8.2608555052100382e-17, 0.47517519303737737 },
+    { UINT64_C(0x001F87ED89B24262), 8.3837379725391394e-17, 0.46994482528395998 },
+    { UINT64_C(0x001F8A10759374FA), 8.5061969993853231e-17, 0.46478975625042618 },
+    { UINT64_C(0x001F8C1BBA3D39AD), 8.628260436784113e-17, 0.45970761564213769 },
+    { UINT64_C(0x001F8E10CC45D04A), 8.7499548592161825e-17, 0.4546961574746155 },
+    { UINT64_C(0x001F8FF102013E17), 8.8713056606902523e-17, 0.449753251162755 },
+    { UINT64_C(0x001F91BD968358E1), 8.9923371422153571e-17, 0.44487687341454851 },
+    { UINT64_C(0x001F9377AC47AFD8), 9.1130725915979092e-17, 0.4400651008423539 },
+    { UINT64_C(0x001F95204F8B64DB), 9.2335343563817881e-17, 0.43531610321563657 },
+    { UINT64_C(0x001F96B878633892), 9.3537439106491289e-17, 0.43062813728845883 },
+    { UINT64_C(0x001F98410C968892), 9.4737219163129496e-17, 0.42599954114303434 },
+    { UINT64_C(0x001F99BAE146BA81), 9.5934882794579973e-17, 0.42142872899761658 },
+    { UINT64_C(0x001F9B26BC697F00), 9.7130622022215212e-17, 0.41691418643300288 },
+    { UINT64_C(0x001F9C85561B717A), 9.8324622306495114e-17, 0.41245446599716118 },
+    { UINT64_C(0x001F9DD759CFD803), 9.9517062989150719e-17, 0.4080481831520324 },
+    { UINT64_C(0x001F9F1D6761A1CE), 1.0070811770242949e-16, 0.40369401253053028 },
+    { UINT64_C(0x001FA058140936C0), 1.0189795474846941e-16, 0.39939068447523107 },
+    { UINT64_C(0x001FA187EB3A3339), 1.030867374515422e-16, 0.39513698183329016 },
+    { UINT64_C(0x001FA2AD6F6BC4FC), 1.0427462448561886e-16, 0.39093173698479711 },
+    { UINT64_C(0x001FA3C91ACE0683), 1.0546177017945764e-16, 0.38677382908413771 },
+    { UINT64_C(0x001FA4DB5FEE6AA3), 1.0664832480119147e-16, 0.38266218149600983 },
+    { UINT64_C(0x001FA5E4AA4D097D), 1.0783443482419485e-16, 0.37859575940958079 },
+    { UINT64_C(0x001FA6E55EE46783), 1.0902024317583505e-16, 0.37457356761590216 },
+    { UINT64_C(0x001FA7DDDCA51EC4), 1.1020588947055781e-16, 0.370594648435146 },
+    { UINT64_C(0x001FA8CE7CE6A875), 1.1139151022861975e-16, 0.36665807978151416 },
+    { UINT64_C(0x001FA9B793CE5FEF), 1.1257723908165675e-16, 0.36276297335481777 },
+    { UINT64_C(0x001FAA9970ADB858), 1.1376320696616847e-16, 0.35890847294874978 },
+    { UINT64_C(0x001FAB745E588232), 1.1494954230590093e-16, 0.35509375286678746 },
+    { UINT64_C(0x001FAC48A3740585), 1.1613637118402183e-16, 0.35131801643748334 },
+    { UINT64_C(0x001FAD1682BF9FE9), 1.1732381750590458e-16, 0.34758049462163698 },
+    { UINT64_C(0x001FADDE3B5782C1), 1.1851200315326694e-16, 0.34388044470450241 },
+    { UINT64_C(0x001FAEA008F21D6D), 1.1970104813034652e-16, 0.34021714906678002 },
+    { UINT64_C(0x001FAF5C2418B07E), 1.2089107070273855e-16, 0.33658991402867761 },
+    { UINT64_C(0x001FB012C25B7A13), 1.2208218752947062e-16, 0.33299806876180899 },
+    { UINT64_C(0x001FB0C41681DFF4), 1.2327451378884152e-16, 0.32944096426413633 },
+    { UINT64_C(0x001FB17050B6F1FB), 1.2446816329851125e-16, 0.32591797239355619 },
+    { UINT64_C(0x001FB2179EB2963A), 1.2566324863028985e-16, 0.32242848495608917 },
+    { UINT64_C(0x001FB2BA2BDFA84B), 1.2685988122003975e-16, 0.31897191284495724 },
+    { UINT64_C(0x001FB358217F4E18), 1.2805817147307494e-16, 0.31554768522712895 },
+    { UINT64_C(0x001FB3F1A6C9BE0C), 1.2925822886541196e-16, 0.31215524877417955 },
+    { UINT64_C(0x001FB486E10CACD7), 1.3046016204120288e-16, 0.30879406693456019 },
+    { UINT64_C(0x001FB517F3C793FD), 1.3166407890665726e-16, 0.30546361924459026 },
+    { UINT64_C(0x001FB5A500C5FDAA), 1.3287008672073809e-16, 0.30216340067569353 },
+    { UINT64_C(0x001FB62E2837FE59), 1.3407829218289994e-16, 0.29889292101558179 },
+    { UINT64_C(0x001FB6B388C9010A), 1.3528880151811755e-16, 0.2956517042812612 },
+    { UINT64_C(0x001FB7353FB50799), 1.3650172055943978e-16, 0.29243928816189257 },
+    { UINT64_C(0x001FB7B368DC7DA8), 1.377171548282881e-16, 0.28925522348967775 },
+    { UINT64_C(0x001FB82E1ED6BA09), 1.3893520961270639e-16, 0.28609907373707683 },
+    { UINT64_C(0x001FB8A57B0347F6), 1.4015599004375715e-16, 0.28297041453878075 },
+    { UINT64_C(0x001FB919959A0F74), 1.4137960117024852e-16, 0.27986883323697292 },
+    { UINT64_C(0x001FB98A85BA7204), 1.4260614803196654e-16, 0.27679392844851736 },
+    { UINT64_C(0x001FB9F861796F27), 1.4383573573157902e-16, 0.27374530965280297 },
+    { UINT64_C(0x001FBA633DEEE286), 1.4506846950536877e-16, 0.27072259679906002 },
+    { UINT64_C(0x001FBACB2F41EC17), 1.4630445479294757e-16, 0.26772541993204479 },
+    { UINT64_C(0x001FBB3048B49145), 1.4754379730609516e-16, 0.2647534188350622 },
+    { UINT64_C(0x001FBB929CAEA4E2), 1.4878660309686261e-16, 0.26180624268936298 },
+    { UINT64_C(0x001FBBF23CC8029E), 1.5003297862507369e-16, 0.25888354974901623 },
+    { UINT64_C(0x001FBC4F39D22995), 1.5128303082535394e-16, 0.25598500703041538 },
+    { UINT64_C(0x001FBCA9A3E140D5), 1.5253686717381255e-16, 0.25311029001562946 },
+    { UINT64_C(0x001FBD018A548F9F), 1.5379459575449969e-16, 0.2502590823688623 },
+    { UINT64_C(0x001FBD56FBDE729C), 1.5505632532575771e-16, 0.24743107566532763 },
+    { UINT64_C(0x001FBDAA068BD66B), 1.5632216538658375e-16, 0.24462596913189211 },
+    { UINT64_C(0x001FBDFAB7CB3F41), 1.5759222624311761e-16, 0.24184346939887724 },
+    { UINT64_C(0x001FBE491C7364DE), 1.5886661907536842e-16, 0.23908329026244918 },
+    { UINT64_C(0x001FBE9540C9695F), 1.6014545600429167e-16, 0.23634515245705964 },
+    { UINT64_C(0x001FBEDF3086B128), 1.6142885015932787e-16, 0.23362878343743335 },
+    { UINT64_C(0x001FBF26F6DE6175), 1.6271691574651305e-16, 0.23093391716962741 },
+    { UINT64_C(0x001FBF6C9E828AE3), 1.6400976811727179e-16, 0.2282602939307167 },
+    { UINT64_C(0x001FBFB031A904C4), 1.6530752383800369e-16, 0.22560766011668407 },
+    { UINT64_C(0x001FBFF1BA0FFDB0), 1.6661030076057421e-16, 0.22297576805812019 },
+    { UINT64_C(0x001FC03141024589), 1.6791821809382289e-16, 0.22036437584335949 },
+    { UINT64_C(0x001FC06ECF5B54B3), 1.6923139647620223e-16, 0.21777324714870053 },
+    { UINT64_C(0x001FC0AA6D8B1427), 1.7054995804966298e-16, 0.21520215107537868 },
+    { UINT64_C(0x001FC0E42399698A), 1.7187402653490317e-16, 0.21265086199297828 },
+    { UINT64_C(0x001FC11BF9298A64), 1.7320372730810084e-16, 0.21011915938898826 },
+    { UINT64_C(0x001FC151F57D1943), 1.745391874792534e-16, 0.20760682772422204 },
+    { UINT64_C(0x001FC1861F770F4B), 1.7588053597224914e-16, 0.20511365629383771 },
+    { UINT64_C(0x001FC1B87D9E74B4), 1.7722790360680065e-16, 0.20263943909370902 },
+    { UINT64_C(0x001FC1E91620EA43), 1.7858142318237326e-16, 0.20018397469191127 },
+    { UINT64_C(0x001FC217EED505DE), 1.7994122956424637e-16, 0.19774706610509887 },
+    { UINT64_C(0x001FC2450D3C83FF), 1.8130745977185016e-16, 0.19532852067956322 },
+    { UINT64_C(0x001FC27076864FC2), 1.8268025306952523e-16, 0.19292814997677135 },
+    { UINT64_C(0x001FC29A2F90630F), 1.8405975105985878e-16, 0.19054576966319539 },
+    { UINT64_C(0x001FC2C23CE98046), 1.8544609777975695e-16, 0.18818119940425432 },
+    { UINT64_C(0x001FC2E8A2D2C6B4), 1.8683943979941927e-16, 0.18583426276219711 },
+    { UINT64_C(0x001FC30D654122ED), 1.8823992632438921e-16, 0.18350478709776746 },
+    { UINT64_C(0x001FC33087DE9C0F), 1.8964770930086167e-16, 0.18119260347549629 },
+    { UINT64_C(0x001FC3520E0B7EC7), 1.9106294352443765e-16, 0.17889754657247831 },
+    { UINT64_C(0x001FC371FADF66F8), 1.9248578675252438e-16, 0.17661945459049488 },
+    { UINT64_C(0x001FC390512A2887), 1.9391639982058994e-16, 0.17435816917135349 },
+    { UINT64_C(0x001FC3AD137497FA), 1.9535494676249091e-16, 0.17211353531532006 },
+    { UINT64_C(0x001FC3C844013349), 1.9680159493510374e-16, 0.16988540130252766 },
+    { UINT64_C(0x001FC3E1E4CCAB40), 1.982565151475019e-16, 0.16767361861725019 },
+    { UINT64_C(0x001FC3F9F78E4DA8), 1.9971988179493421e-16, 0.165478041874936 },
+    { UINT64_C(0x001FC4107DB85061), 2.0119187299787347e-16, 0.16329852875190182 },
+    { UINT64_C(0x001FC4257877FD68), 2.0267267074641983e-16, 0.16113493991759203 },
+    { UINT64_C(0x001FC438E8B5BFC7), 2.0416246105035888e-16, 0.15898713896931421 },
+    { UINT64_C(0x001FC44ACF15112A), 2.0566143409519179e-16, 0.15685499236936523 },
+    { UINT64_C(0x001FC45B2BF447E8), 2.071697844044737e-16, 0.15473836938446808 },
+    { UINT64_C(0x001FC469FF6C4504), 2.0868771100881597e-16, 0.15263714202744286 },
+    { UINT64_C(0x001FC477495001B2), 2.1021541762192928e-16, 0.15055118500103989 },
+    { UINT64_C(0x001FC483092BFBB9), 2.1175311282410759e-16, 0.14848037564386679 },
+    { UINT64_C(0x001FC48D3E457FF6), 2.1330101025357791e-16, 0.14642459387834494 },
+    { UINT64_C(0x001FC495E799D21B), 2.1485932880616633e-16, 0.14438372216063478 },
+    { UINT64_C(0x001FC49D03DD30B1), 2.1642829284376047e-16, 0.1423576454324722 },
+    { UINT64_C(0x001FC4A29179B433), 2.180081324120784e-16, 0.14034625107486245 },
+    { UINT64_C(0x001FC4A68E8E07FC), 2.1959908346828707e-16, 0.1383494288635802 },
+    { UINT64_C(0x001FC4A8F8EBFB8C), 2.2120138811904959e-16, 0.13636707092642886 },
+    { UINT64_C(0x001FC4A9CE16EA9F), 2.2281529486961805e-16, 0.13439907170221363 },
+    { UINT64_C(0x001FC4A90B41FA34), 2.2444105888463086e-16, 0.13244532790138752 },
+    { UINT64_C(0x001FC4A6AD4E28A0), 2.2607894226131737e-16, 0.13050573846833077 },
+    { UINT64_C(0x001FC4A2B0C82E75), 2.277292143158621e-16, 0.12858020454522817 },
+    { UINT64_C(0x001FC49D11E62DE3), 2.2939215188373114e-16, 0.12666862943751067 },
+    { UINT64_C(0x001FC495CC852DF5), 2.3106803963482133e-16, 0.12477091858083096 },
+    { UINT64_C(0x001FC48CDC265EC1), 2.3275717040435346e-16, 0.12288697950954514 },
+    { UINT64_C(0x001FC4823BEC237A), 2.3445984554049579e-16, 0.12101672182667483 },
+    { UINT64_C(0x001FC475E696DEE6), 2.361763752697774e-16, 0.11916005717532768 },
+    { UINT64_C(0x001FC467D6817E83), 2.3790707908142767e-16, 0.11731689921155557 },
+    { UINT64_C(0x001FC458059DC037), 2.3965228613186235e-16, 0.11548716357863353 },
+    { UINT64_C(0x001FC4466D702E21), 2.4141233567062933e-16, 0.11367076788274431 },
+    { UINT64_C(0x001FC433070BCB99), 2.431875774892256e-16, 0.1118676316700563 },
+    { UINT64_C(0x001FC41DCB0D6E0E), 2.4497837239430702e-16, 0.11007767640518538 },
+    { UINT64_C(0x001FC406B196BBF7), 2.4678509270692887e-16, 0.1083008254510338 },
+    { UINT64_C(0x001FC3EDB248CB62), 2.4860812278958517e-16, 0.10653700405000166 },
+    { UINT64_C(0x001FC3D2C43E593C), 2.504478596029557e-16, 0.10478613930657017 },
+    { UINT64_C(0x001FC3B5DE0591B4), 2.523047132944217e-16, 0.10304816017125772 },
+    { UINT64_C(0x001FC396F599614C), 2.5417910782058122e-16, 0.10132299742595363 },
+    { UINT64_C(0x001FC376005A4593), 2.5607148160617708e-16, 0.099610583670637132 },
+    { UINT64_C(0x001FC352F3069371), 2.5798228824205309e-16, 0.097910853311492199 },
+    { UINT64_C(0x001FC32DC1B22819), 2.5991199722497469e-16, 0.096223742550432798 },
+    { UINT64_C(0x001FC3065FBD7888), 2.6186109474239242e-16, 0.094549189376055859 },
+    { UINT64_C(0x001FC2DCBFCBF263), 2.6383008450549423e-16, 0.092887133556043541 },
+    { UINT64_C(0x001FC2B0D3B99F9E), 2.6581948863418451e-16, 0.091237516631040169 },
+    { UINT64_C(0x001FC2828C8FFCF0), 2.6782984859795252e-16, 0.089600281910032858 },
+    { UINT64_C(0x001FC251DA79F164), 2.6986172621694889e-16, 0.087975374467270218 },
+    { UINT64_C(0x001FC21EACB6D39E), 2.7191570472798185e-16, 0.086362741140756913 },
+    { UINT64_C(0x001FC1E8F18C6756), 2.7399238992058148e-16, 0.084762330532368133 },
+    { UINT64_C(0x001FC1B09637BB3C), 2.7609241134876166e-16, 0.083174093009632383 },
+    { UINT64_C(0x001FC17586DCCD10), 2.7821642362464361e-16, 0.081597980709237419 },
+    { UINT64_C(0x001FC137AE74D6B7), 2.8036510780069835e-16, 0.080033947542319905 },
+    { UINT64_C(0x001FC0F6F6BB2415), 2.8253917284802532e-16, 0.078481949201606421 },
+    { UINT64_C(0x001FC0B348184DA4), 2.8473935723881741e-16, 0.076941943170480503 },
+    { UINT64_C(0x001FC06C898BAFF1), 2.8696643064198177e-16, 0.07541388873405841 },
+    { UINT64_C(0x001FC022A092F365), 2.8922119574179956e-16, 0.073897746992364746 },
+    { UINT64_C(0x001FBFD5710F72B9), 2.9150449019052932e-16, 0.072393480875708738 },
+    { UINT64_C(0x001FBF84DD29488F), 2.9381718870700286e-16, 0.070901055162371829 },
+    { UINT64_C(0x001FBF30C52FC60B), 2.9616020533454657e-16, 0.069420436498728755 },
+    { UINT64_C(0x001FBED907770CC6), 2.9853449587300453e-16, 0.067951593421936601 },
+    { UINT64_C(0x001FBE7D80327DDB), 3.0094106050126181e-16, 0.066494496385339774 },
+    { UINT64_C(0x001FBE1E094BA614), 3.0338094660850029e-16, 0.065049117786753749 },
+    { UINT64_C(0x001FBDBA7A354408), 3.0585525185448609e-16, 0.063615431999807334 },
+    { UINT64_C(0x001FBD52A7B9F826), 3.08365127481531e-16, 0.062193415408540995 },
+    { UINT64_C(0x001FBCE663C6201B), 3.1091178190342663e-16, 0.06078304644547964 },
+    { UINT64_C(0x001FBC757D2C4DE5), 3.1349648459966631e-16, 0.059384305633420266 },
+    { UINT64_C(0x001FBBFFBF63B7AA), 3.1612057034671057e-16, 0.057997175631200659 },
+    { UINT64_C(0x001FBB84F23FE6A2), 3.1878544382197131e-16, 0.056621641283742877 },
+    { UINT64_C(0x001FBB04D9A0D18D), 3.2149258462067974e-16, 0.055257689676697037 },
+    { UINT64_C(0x001FBA7F351A70AD), 3.2424355273094516e-16, 0.053905310196046087 },
+    { UINT64_C(0x001FB9F3BF92B619), 3.2703999451822404e-16, 0.052564494593071692 },
+    { UINT64_C(0x001FB9622ED4ABFC), 3.2988364927722831e-16, 0.051235237055126281 },
+    { UINT64_C(0x001FB8CA33174A17), 3.3277635641716714e-16, 0.049917534282706372 },
+    { UINT64_C(0x001FB82B76765B54), 3.3572006335532441e-16, 0.048611385573379497 },
+    { UINT64_C(0x001FB7859C5B895C), 3.3871683420455052e-16, 0.047316792913181548 },
+    { UINT64_C(0x001FB6D840D55594), 3.417688593525637e-16, 0.04603376107617517 },
+    { UINT64_C(0x001FB622F7D96943), 3.4487846604534239e-16, 0.044762297732943282 },
+    { UINT64_C(0x001FB5654C6F37E1), 3.4804813010374423e-16, 0.043502413568888183 },
+    { UINT64_C(0x001FB49EBFBF69D2), 3.5128048892229794e-16, 0.042254122413316234 },
+    { UINT64_C(0x001FB3CEC803E747), 3.5457835592247919e-16, 0.041017441380414819 },
+    { UINT64_C(0x001FB2F4CF539C3F), 3.5794473666042765e-16, 0.039792391023374125 },
+    { UINT64_C(0x001FB21032442853), 3.6138284682190606e-16, 0.038578995503074857 },
+    { UINT64_C(0x001FB1203E5A9604), 3.6489613237645425e-16, 0.037377282772959361 },
+    { UINT64_C(0x001FB0243042E1C2), 3.6848829220956213e-16, 0.036187284781931423 },
+    { UINT64_C(0x001FAF1B31C479A7), 3.7216330360802073e-16, 0.03500903769739741 },
+    { UINT64_C(0x001FAE045767E105), 3.7592545104162565e-16, 0.03384258215087433 },
+    { UINT64_C(0x001FACDE9DBF2D73), 3.7977935876688744e-16, 0.032687963508959535 },
+    { UINT64_C(0x001FABA8E640060B), 3.8373002787892137e-16, 0.031545232172893609 },
+    { UINT64_C(0x001FAA61F399FF28), 3.8778287856078953e-16, 0.030414443910466604 },
+    { UINT64_C(0x001FA908656F66A2), 3.9194379843114289e-16, 0.029295660224637393 },
+    { UINT64_C(0x001FA79AB3508D3D), 3.962191980786775e-16, 0.028188948763978636 },
+    { UINT64_C(0x001FA61726D1F214), 4.0061607510565417e-16, 0.0270943837809558 },
+    { UINT64_C(0x001FA47BD48BEA00), 4.0514208829565732e-16, 0.026012046645134217 },
+    { UINT64_C(0x001FA2C693C5C095), 4.0980564389030625e-16, 0.024942026419731783 },
+    { UINT64_C(0x001FA0F4F47DF315), 4.1461599642909046e-16, 0.023884420511558171 },
+    { UINT64_C(0x001F9F04336BBE0B), 4.1958336720733989e-16, 0.02283933540638524 },
+    { UINT64_C(0x001F9CF12B79F9BD), 4.247190841824385e-16, 0.021806887504283581 },
+    { UINT64_C(0x001F9AB84415ABC5), 4.3003574816674707e-16, 0.020787204072578117 },
+    { UINT64_C(0x001F98555B782FB9), 4.355474314693952e-16, 0.019780424338009743 },
+    { UINT64_C(0x001F95C3ABD03F79), 4.4126991690360699e-16, 0.01878670074469603 },
+    { UINT64_C(0x001F92FDA9CEF1F3), 4.4722098742599323e-16, 0.017806200410911362 },
+    { UINT64_C(0x001F8FFCDA9AE41D), 4.5342077985658345e-16, 0.016839106826039948 },
+    { UINT64_C(0x001F8CB99E7385F8), 4.5989222049059325e-16, 0.015885621839973163 },
+    { UINT64_C(0x001F892AEC479607), 4.6666156647114758e-16, 0.014945968011691148 },
+    { UINT64_C(0x001F8545F904DB8F), 4.737590853262492e-16, 0.014020391403181938 },
+    { UINT64_C(0x001F80FDC336039B), 4.8121991728292379e-16, 0.013109164931254991 },
+    { UINT64_C(0x001F7C427839E926), 4.8908518273922099e-16, 0.012212592426255381 },
+    { UINT64_C(0x001F7700A3582ACC), 4.9740342361919398e-16, 0.011331013597834597 },
+    { UINT64_C(0x001F71200F1A241C), 5.0623250721441597e-16, 0.010464810181029979 },
+    { UINT64_C(0x001F6A8234B7352B), 5.156421828878083e-16, 0.0096144136425022099 },
+    { UINT64_C(0x001F630000A8E267), 5.2571758020222748e-16, 0.0087803149858089753 },
+    { UINT64_C(0x001F5A66904FE3C4), 5.3656409771120216e-16, 0.00796307743801704 },
+    { UINT64_C(0x001F50724ECE1172), 5.4831440342587039e-16, 0.0071633531836349839 },
+    { UINT64_C(0x001F44C7665C6FDB), 5.6113874546751596e-16, 0.0063819059373191791 },
+    { UINT64_C(0x001F36E5A38A59A2), 5.7526064815033317e-16, 0.005619642207205483 },
+    { UINT64_C(0x001F26143450340A), 5.909817641652103e-16, 0.0048776559835423923 },
+    { UINT64_C(0x001F113E047B0414), 6.0872314161809077e-16, 0.0041572951208337953 },
+    { UINT64_C(0x001EF6AEFA57CBE7), 6.290979034877557e-16, 0.003460264777836904 },
+    { UINT64_C(0x001ED38CA188151E), 6.5304920535640408e-16, 0.0027887987935740761 },
+    { UINT64_C(0x001EA2A61E122DB1), 6.8213930790289286e-16, 0.0021459677437189063 },
+    { UINT64_C(0x001E5961C78B267C), 7.1924449660893616e-16, 0.0015362997803015724 },
+    { UINT64_C(0x001DDDF62BAC0BB1), 7.7060953500320968e-16, 0.00096726928232717454 },
+    { UINT64_C(0x001CDB4DD9E4E8C0), 8.5455170385840274e-16, 0.00045413435384149677 },
+};
+
+#endif /* defined(UINT64_C) */
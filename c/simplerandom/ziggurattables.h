@@ -0,0 +1,82 @@
+/*
+ * ziggurattables.h
+ *
+ * Pre-calculated tables for the ziggurat method [1] of generating normal and
+ * exponential random values, as used in simplerandom-ziggurat.c.
+ *
+ * The area under the density function is covered by ZIGGURAT_TABLE_LEN
+ * layers of equal area 'v'. Layer 0 is the base, which includes the tail
+ * beyond 'r'. The other layers are rectangles, which get narrower as 'i'
+ * decreases, with layer 1 at the top. For each layer 'i':
+ *     w   The width of the layer is x[i] = w * 2^B, where B is the number of
+ *         random bits used for the x value: 52 for normal, 53 for exponential.
+ *     k   A B-bit random value 'u' gives x = u * w, which is certainly under
+ *         the density function if u < k, because that is inside the next
+ *         (narrower) layer above. This is the case ~99% of the time.
+ *     f   The density function at x[i].
+ *
+ * The tables are defined in ziggurattables.c, which is generated by
+ * genziggurattables and committed. See genziggurattables.c.
+ *
+ * [1] The Ziggurat Method for Generating Random Variables
+ *     George Marsaglia, Wai Wan Tsang
+ *     Journal of Statistical Software, 5 (8), 2000
+ */
+#ifndef _SIMPLERANDOM_ZIGGURATTABLES_H
+#define _SIMPLERANDOM_ZIGGURATTABLES_H
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <stdint.h>
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define ZIGGURAT_TABLE_LEN      256u
+
+/* Start of the tail 'r', for 256 layers. */
+#define ZIGGURAT_NORMAL_R       3.6541528853610088
+#define ZIGGURAT_EXP_R          7.6971174701310497
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+typedef struct
+{
+    uint64_t    k;
+    double      w;
+    double      f;
+} ZigguratLayer_t;
+
+#endif /* defined(UINT64_C) */
+
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+#ifdef UINT64_C
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const ZigguratLayer_t ziggurat_normal_table[ZIGGURAT_TABLE_LEN];
+extern const ZigguratLayer_t ziggurat_exp_table[ZIGGURAT_TABLE_LEN];
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* defined(UINT64_C) */
+
+#endif /* !defined(_SIMPLERANDOM_ZIGGURATTABLES_H) */
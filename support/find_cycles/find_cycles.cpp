@@ -1,165 +1,457 @@
-
-#include <stdint.h>
-#include <iostream>
-#include <algorithm>
-#include <map>
-#include <set>
-
-using namespace std;
-
-#define RECORD_STATE_INTERVAL 2048
-
-typedef uint32_t (*p_rng_func_t)(uint32_t);
-
-typedef std::map<uint32_t, uint64_t>            cycles_map_t;
-typedef std::map<uint64_t, std::set<uint32_t> > lengths_map_t;
-typedef std::set<uint32_t>                      values_set_t;    
-
-class FindCycles
-{
-private:
-    cycles_map_t                            _cycles;    // Key is cycle's min value; value is length
-    lengths_map_t                           _lengths;   // Key is length; value is set of cycle's min values
-    values_set_t                            _values;
-    p_rng_func_t                            _p_rng_func;
-    uint64_t                                _func_range;
-
-    uint64_t _find_cycle_with_seed(uint32_t start_value);
-
-public:
-    FindCycles(p_rng_func_t p_rng_func, uint64_t func_range);
-    void find_cycles();
-};
-
-FindCycles::FindCycles(p_rng_func_t p_rng_func, uint64_t func_range)
-{
-    _p_rng_func = p_rng_func;
-    _func_range = func_range;
-}
-
-void FindCycles::find_cycles()
-{
-    cycles_map_t::iterator cycles_iter;
-    lengths_map_t::iterator lengths_iter;
-    uint64_t j;
-
-    for (j = 0; j < _func_range; j++)
-    {
-        _find_cycle_with_seed(j);
-    }
-    cout << "\n";
-
-#if 0
-    for (cycles_iter = _cycles.begin(); cycles_iter != _cycles.end(); cycles_iter++)
-    {
-        cout << "Cycle min " << (*cycles_iter).first << ", length " << (*cycles_iter).second;
-        cout << "\n";
-    }
-    cout << "\n";
-#endif
-
-    for (lengths_iter = _lengths.begin(); lengths_iter != _lengths.end(); lengths_iter++)
-    {
-        cout << "Length " << (*lengths_iter).first << ", " << (*lengths_iter).second.size() << " cycles";
-        cout << "\n";
-    }
-    cout << "\n";
-
-}
-
-uint64_t FindCycles::_find_cycle_with_seed(uint32_t start_value)
-{
-    values_set_t local_values;
-    values_set_t::iterator iter;
-    uint32_t value = start_value;
-    uint32_t length = 0;
-    uint64_t return_length = 0;
-    uint32_t record_state_counter = 0;
-    uint32_t min_value = start_value;
-
-    while (1)
-    {
-        value = _p_rng_func(value);
-        if (value == start_value)
-        {
-            return_length = ((uint64_t)length) + 1;
-
-            cout << "Cycle min " << min_value << ", length " << return_length;
-            cout << "\n";
-            _cycles[min_value] = return_length;
-
-            for (iter = local_values.begin(); iter != local_values.end(); iter++)
-            {
-                _values.insert(*iter);
-            }
-
-            _lengths[return_length].insert(min_value);
-
-            break;
-        }
-        if (value < min_value)
-        {
-            break;
-        }
-#if 0
-        if (_values.find(value) != _values.end())
-        {
-            break;
-        }
-        record_state_counter++;
-        if (record_state_counter >= RECORD_STATE_INTERVAL)
-        {
-            local_values.insert(value);
-            record_state_counter = 0;
-        }
-#else
-        if ((value % RECORD_STATE_INTERVAL) == 0)
-        {
-            if (_values.find(value) != _values.end())
-            {
-                break;
-            }
-            else
-            {
-                local_values.insert(value);
-            }
-        }
-#endif
-
-        length++;
-    }
-
-    return return_length;
-}
-
-uint32_t shr3(uint32_t val)
-{
-    val ^= val << 17u;
-    val ^= val >> 13u;
-    val ^= val << 5u;
-    return val;
-}
-
-uint32_t shr3_2(uint32_t val)
-{
-    val ^= val << 13u;
-    val ^= val >> 17u;
-    val ^= val << 5u;
-    return val;
-}
-
-uint32_t mwc_upper(uint32_t val)
-{
-    return 36969*(val&65535)+(val>>16);
-}
-
-uint32_t mwc_lower(uint32_t val)
-{
-    return 18000*(val&65535)+(val>>16);
-}
-
-int main()
-{
-    FindCycles fc(mwc_lower, 1uLL << 32);
-    fc.find_cycles();
-}
+/*
+ * find_cycles.cpp
+ *
+ * Find all the cycles of a function on 32-bit values, such as the 'next'
+ * function of a generator component, and print their lengths.
+ *
+ * Build with:
+ *     g++ -O2 -std=c++11 -pthread find_cycles.cpp -o find_cycles
+ *
+ * Usage:
+ *     find_cycles <function> [checkpoint-file [num-threads]]
+ *
+ * Each cycle is found by walking it from its minimum value. A walk from any
+ * other start value stops as soon as it reaches a value less than the start
+ * value, so the cycle is only recorded once, by the walk from its minimum.
+ * Walks run in parallel threads, each taking chunks of start values in turn.
+ *
+ * A visited bitmap, of 1 bit per value (512 MiB for 2^32 values), marks the
+ * values that are on a recorded cycle, or that lead into one. A start value
+ * that is marked is skipped, and a walk that reaches a marked value stops,
+ * after marking the values it walked. The bitmap is shared by all threads,
+ * and updated with atomic operations. It only saves time: a value is only
+ * marked once it is known not to be the minimum of an unrecorded cycle.
+ *
+ * If the function is not a permutation, a walk from a value that is not on a
+ * cycle may reach a cycle that doesn't contain the start value, but whose
+ * values are all greater than it. Brent's cycle detection stops that walk.
+ *
+ * If a checkpoint file is given, the progress, the cycles found so far and
+ * the visited bitmap are written to it every CHECKPOINT_INTERVAL_S seconds,
+ * and at the end. The threads are paused while it is written, so that it is
+ * consistent. If the file exists at the start, the run resumes from it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Number of start values that a thread takes at a time.
+#define CHUNK_SIZE                  (1u << 16u)
+// A walk checks the visited bitmap once every this many steps, because each
+// check is likely to be a cache miss.
+#define VISITED_CHECK_INTERVAL      64u
+#ifndef CHECKPOINT_INTERVAL_S
+#define CHECKPOINT_INTERVAL_S       300u
+#endif
+#define CHECKPOINT_MAGIC            "SRFINDCYCLES1"
+
+typedef uint32_t (*p_rng_func_t)(uint32_t);
+
+typedef std::map<uint32_t, uint64_t>            cycles_map_t;
+typedef std::map<uint64_t, std::set<uint32_t> > lengths_map_t;
+
+class FindCycles
+{
+private:
+    cycles_map_t                            _cycles;    // Key is cycle's min value; value is length
+    std::mutex                              _cycles_mutex;
+    p_rng_func_t                            _p_rng_func;
+    string                                  _func_name;
+    uint64_t                                _func_range;
+    uint64_t                                _num_chunks;
+    std::atomic<uint64_t>                   _next_chunk;
+    std::atomic<bool>                       _stop;
+    std::unique_ptr<std::atomic<uint64_t>[]> _visited;
+    uint64_t                                _visited_len;
+
+    bool _is_visited(uint32_t value) const;
+    void _set_visited(uint32_t value);
+    uint64_t _find_cycle_with_seed(uint32_t start_value);
+    void _worker();
+    bool _read_checkpoint(const string & filename);
+    bool _write_checkpoint(const string & filename);
+
+public:
+    FindCycles(p_rng_func_t p_rng_func, const string & func_name, uint64_t func_range);
+    void find_cycles(const string & checkpoint_filename, unsigned num_threads);
+};
+
+FindCycles::FindCycles(p_rng_func_t p_rng_func, const string & func_name, uint64_t func_range)
+    : _next_chunk(0), _stop(false)
+{
+    _p_rng_func = p_rng_func;
+    _func_name = func_name;
+    _func_range = func_range;
+    _num_chunks = (func_range + CHUNK_SIZE - 1u) / CHUNK_SIZE;
+    _visited_len = (func_range + 63u) / 64u;
+    _visited.reset(new std::atomic<uint64_t>[_visited_len]());
+}
+
+bool FindCycles::_is_visited(uint32_t value) const
+{
+    return (_visited[value / 64u].load(std::memory_order_relaxed) >> (value % 64u)) & 1u;
+}
+
+void FindCycles::_set_visited(uint32_t value)
+{
+    _visited[value / 64u].fetch_or(UINT64_C(1) << (value % 64u), std::memory_order_relaxed);
+}
+
+void FindCycles::find_cycles(const string & checkpoint_filename, unsigned num_threads)
+{
+    std::vector<std::thread> threads;
+    lengths_map_t lengths;
+    lengths_map_t::iterator lengths_iter;
+    cycles_map_t::iterator cycles_iter;
+    bool done = false;
+
+    if (!checkpoint_filename.empty() && _read_checkpoint(checkpoint_filename))
+    {
+        cout << "Resumed from " << checkpoint_filename << " at " << (100u * _next_chunk / _num_chunks) << "%\n";
+    }
+
+    while (!done)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+
+        _stop = false;
+        for (unsigned i = 0; i < num_threads; i++)
+        {
+            threads.emplace_back(&FindCycles::_worker, this);
+        }
+        while (!done)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            done = (_next_chunk >= _num_chunks);
+            if (!checkpoint_filename.empty() &&
+                std::chrono::steady_clock::now() - start_time >= std::chrono::seconds(CHECKPOINT_INTERVAL_S))
+            {
+                break;
+            }
+        }
+        // Each thread finishes the chunk it has taken, so all chunks before
+        // _next_chunk are complete.
+        _stop = true;
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
+        done = (_next_chunk >= _num_chunks);
+
+        if (!checkpoint_filename.empty())
+        {
+            if (!_write_checkpoint(checkpoint_filename))
+            {
+                cerr << "Failed to write " << checkpoint_filename << "\n";
+            }
+            cout << "Checkpoint at " << (100u * std::min<uint64_t>(_next_chunk, _num_chunks) / _num_chunks) << "%\n";
+        }
+    }
+    cout << "\n";
+
+    for (cycles_iter = _cycles.begin(); cycles_iter != _cycles.end(); cycles_iter++)
+    {
+        cout << "Cycle min " << (*cycles_iter).first << ", length " << (*cycles_iter).second;
+        cout << "\n";
+        lengths[(*cycles_iter).second].insert((*cycles_iter).first);
+    }
+    cout << "\n";
+
+    for (lengths_iter = lengths.begin(); lengths_iter != lengths.end(); lengths_iter++)
+    {
+        cout << "Length " << (*lengths_iter).first << ", " << (*lengths_iter).second.size() << " cycles";
+        cout << "\n";
+    }
+    cout << "\n";
+}
+
+void FindCycles::_worker()
+{
+    cycles_map_t local_cycles;
+    uint64_t chunk;
+    uint64_t start;
+    uint64_t end;
+    uint64_t j;
+    uint64_t length;
+
+    while (!_stop)
+    {
+        chunk = _next_chunk.fetch_add(1u);
+        if (chunk >= _num_chunks)
+        {
+            break;
+        }
+        start = chunk * CHUNK_SIZE;
+        end = std::min<uint64_t>(start + CHUNK_SIZE, _func_range);
+        for (j = start; j < end; j++)
+        {
+            length = _find_cycle_with_seed((uint32_t)j);
+            if (length != 0)
+            {
+                local_cycles[(uint32_t)j] = length;
+            }
+        }
+        if (!local_cycles.empty())
+        {
+            std::lock_guard<std::mutex> lock(_cycles_mutex);
+
+            _cycles.insert(local_cycles.begin(), local_cycles.end());
+            local_cycles.clear();
+        }
+    }
+}
+
+/* Return the length of the cycle whose minimum value is start_value, or 0 if
+ * start_value is not the minimum value of a cycle. */
+uint64_t FindCycles::_find_cycle_with_seed(uint32_t start_value)
+{
+    uint32_t value = start_value;
+    uint64_t length = 0;
+    uint32_t tortoise = start_value;
+    uint64_t power = 1;
+    uint64_t lambda = 0;
+
+    if (_is_visited(start_value))
+    {
+        return 0;
+    }
+    while (1)
+    {
+        value = _p_rng_func(value);
+        length++;
+        if (value == start_value)
+        {
+            do
+            {
+                _set_visited(value);
+                value = _p_rng_func(value);
+            } while (value != start_value);
+            return length;
+        }
+        if (value < start_value)
+        {
+            // Not the minimum value of its cycle, or not on a cycle.
+            break;
+        }
+        if ((length % VISITED_CHECK_INTERVAL) == 0 && _is_visited(value))
+        {
+            // It leads into a recorded cycle, so mark the values walked.
+            for (value = start_value; !_is_visited(value); value = _p_rng_func(value))
+            {
+                _set_visited(value);
+            }
+            break;
+        }
+        // Brent's cycle detection, for a cycle that doesn't contain
+        // start_value.
+        if (value == tortoise)
+        {
+            break;
+        }
+        lambda++;
+        if (lambda == power)
+        {
+            tortoise = value;
+            power *= 2u;
+            lambda = 0;
+        }
+    }
+
+    return 0;
+}
+
+/* Checkpoint file format, in native byte order:
+ *     magic, function name, '\0'
+ *     func_range, next_chunk, number of cycles (uint64_t each)
+ *     for each cycle: min value (uint32_t), length (uint64_t)
+ *     visited bitmap (uint64_t words)
+ */
+bool FindCycles::_read_checkpoint(const string & filename)
+{
+    FILE * p_file;
+    string header;
+    uint64_t values[3];
+    uint32_t min_value;
+    uint64_t length;
+    std::vector<uint64_t> buffer(1u << 16u);
+    uint64_t i;
+    uint64_t k;
+    size_t n;
+    int c;
+
+    p_file = fopen(filename.c_str(), "rb");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    while ((c = fgetc(p_file)) > 0)
+    {
+        header.push_back((char)c);
+    }
+    if (header != string(CHECKPOINT_MAGIC) + _func_name ||
+        fread(values, sizeof(values), 1u, p_file) != 1u ||
+        values[0] != _func_range)
+    {
+        cerr << filename << " is not a checkpoint for " << _func_name << "\n";
+        exit(EXIT_FAILURE);
+    }
+    _next_chunk = values[1];
+    for (i = 0; i < values[2]; i++)
+    {
+        if (fread(&min_value, sizeof(min_value), 1u, p_file) != 1u ||
+            fread(&length, sizeof(length), 1u, p_file) != 1u)
+        {
+            break;
+        }
+        _cycles[min_value] = length;
+    }
+    for (i = 0; i < _visited_len; i += n)
+    {
+        n = (size_t)std::min<uint64_t>(buffer.size(), _visited_len - i);
+        if (fread(buffer.data(), sizeof(uint64_t), n, p_file) != n)
+        {
+            cerr << filename << " is truncated\n";
+            exit(EXIT_FAILURE);
+        }
+        for (k = 0; k < n; k++)
+        {
+            _visited[i + k].store(buffer[k], std::memory_order_relaxed);
+        }
+    }
+    fclose(p_file);
+    return true;
+}
+
+bool FindCycles::_write_checkpoint(const string & filename)
+{
+    string temp_filename = filename + ".tmp";
+    FILE * p_file;
+    uint64_t values[3];
+    cycles_map_t::iterator cycles_iter;
+    std::vector<uint64_t> buffer(1u << 16u);
+    uint64_t i;
+    uint64_t k;
+    size_t n;
+    bool ok;
+
+    p_file = fopen(temp_filename.c_str(), "wb");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+    ok = (fwrite(CHECKPOINT_MAGIC, strlen(CHECKPOINT_MAGIC), 1u, p_file) == 1u);
+    ok = ok && (fwrite(_func_name.c_str(), _func_name.size() + 1u, 1u, p_file) == 1u);
+    values[0] = _func_range;
+    values[1] = std::min<uint64_t>(_next_chunk, _num_chunks);
+    values[2] = _cycles.size();
+    ok = ok && (fwrite(values, sizeof(values), 1u, p_file) == 1u);
+    for (cycles_iter = _cycles.begin(); ok && cycles_iter != _cycles.end(); cycles_iter++)
+    {
+        ok = (fwrite(&(*cycles_iter).first, sizeof(uint32_t), 1u, p_file) == 1u);
+        ok = ok && (fwrite(&(*cycles_iter).second, sizeof(uint64_t), 1u, p_file) == 1u);
+    }
+    for (i = 0; ok && i < _visited_len; i += n)
+    {
+        n = (size_t)std::min<uint64_t>(buffer.size(), _visited_len - i);
+        for (k = 0; k < n; k++)
+        {
+            buffer[k] = _visited[i + k].load(std::memory_order_relaxed);
+        }
+        ok = (fwrite(buffer.data(), sizeof(uint64_t), n, p_file) == n);
+    }
+    ok = (fclose(p_file) == 0) && ok;
+    // Replace the old checkpoint only once the new one is complete.
+    ok = ok && (rename(temp_filename.c_str(), filename.c_str()) == 0);
+    return ok;
+}
+
+uint32_t shr3(uint32_t val)
+{
+    val ^= val << 17u;
+    val ^= val >> 13u;
+    val ^= val << 5u;
+    return val;
+}
+
+uint32_t shr3_2(uint32_t val)
+{
+    val ^= val << 13u;
+    val ^= val >> 17u;
+    val ^= val << 5u;
+    return val;
+}
+
+uint32_t mwc_upper(uint32_t val)
+{
+    return 36969*(val&65535)+(val>>16);
+}
+
+uint32_t mwc_lower(uint32_t val)
+{
+    return 18000*(val&65535)+(val>>16);
+}
+
+static const struct
+{
+    const char *    p_name;
+    p_rng_func_t    p_func;
+} functions[] =
+{
+    { "shr3",       shr3 },
+    { "shr3_2",     shr3_2 },
+    { "mwc_upper",  mwc_upper },
+    { "mwc_lower",  mwc_lower },
+};
+
+int main(int argc, char * argv[])
+{
+    string func_name = "mwc_lower";
+    string checkpoint_filename;
+    unsigned num_threads = std::thread::hardware_concurrency();
+    p_rng_func_t p_func = NULL;
+
+    if (argc > 1)
+        func_name = argv[1];
+    if (argc > 2)
+        checkpoint_filename = argv[2];
+    if (argc > 3)
+        num_threads = (unsigned)strtoul(argv[3], NULL, 0);
+    if (num_threads == 0)
+        num_threads = 1u;
+
+    for (const auto & function : functions)
+    {
+        if (func_name == function.p_name)
+            p_func = function.p_func;
+    }
+    if (p_func == NULL)
+    {
+        cerr << "Usage: " << argv[0] << " <function> [checkpoint-file [num-threads]]\n";
+        cerr << "Functions:";
+        for (const auto & function : functions)
+        {
+            cerr << " " << function.p_name;
+        }
+        cerr << "\n";
+        return EXIT_FAILURE;
+    }
+
+    FindCycles fc(p_func, func_name, 1uLL << 32);
+    fc.find_cycles(checkpoint_filename, num_threads);
+}
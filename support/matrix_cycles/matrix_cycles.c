@@ -0,0 +1,559 @@
+/*
+ * matrix_cycles.c
+ *
+ * Find the cycle structure of a GF(2)-linear generator, x -> M * x for a
+ * 32-by-32 Galois-2 matrix M, algebraically. That is, it reports how many
+ * cycles there are of each length, and how many states are not on any cycle,
+ * without walking the 2^32 states as find_cycles.cpp does. So it takes
+ * milliseconds, which makes it practical to try many candidate shift triples.
+ *
+ * Usage:
+ *     matrix_cycles xorshift <a> <b> <c>
+ *         Three xorshifts, x ^= x << a; x ^= x >> b; x ^= x << c; where a
+ *         negative shift value is a right shift. E.g. SHR3 is 13 -17 5.
+ *     matrix_cycles lfsr <s1> <s2> <s3> <mask_bits>
+ *         An LFSR113 or LFSR88 component:
+ *             b = ((z << s1) ^ z) >> s2;
+ *             z = ((z & mask) << s3) ^ b;
+ *         where 'mask' clears the lower 'mask_bits' bits.
+ *     matrix_cycles matrix <c0> <c1> ... <c31>
+ *         Any matrix, given as its 32 columns in BitColumnMatrix32_t form.
+ *     matrix_cycles <name>
+ *         A generator component by name, e.g. shr3 or lfsr113_1, from
+ *         matrix_specs[] in c/simplerandom/matrixspecs.c. Run with no
+ *         arguments for the list.
+ *
+ * Method:
+ *
+ * The minimal polynomial of M is the least common multiple of the minimal
+ * polynomials of the unit vectors, which are found from their Krylov
+ * sequences v, M v, M^2 v, ... It is factored into irreducible polynomials
+ * p^m by trial division.
+ *
+ * The state space is then the direct sum of the subspaces V_p = ker p(M)^m.
+ * On the subspace for p = x, M is nilpotent, so those states are on the
+ * "tails" that lead into the cycles; only the zero state of it is on a cycle.
+ * The states on cycles are the sums of the states in the other subspaces.
+ *
+ * A state of V_p whose annihilating polynomial is p^e, for e >= 1, has period
+ * ord(p^e) = ord(p) * 2^t, where 2^t is the smallest power of 2 >= e, and
+ * ord(p) is the smallest k with x^k = 1 modulo p. There are
+ * 2^dim(ker p(M)^e) - 2^dim(ker p(M)^(e-1)) such states. A state on a cycle
+ * has a period that is the least common multiple of the periods of its
+ * components. So the number of states of each period, and the number of
+ * cycles, which is that divided by the period, come from combining the
+ * subspaces.
+ *
+ * Build with:
+ *     ./build
+ */
+
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitcolumnmatrix.h"
+#include "matrixspecs.h"
+
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Maximum number of distinct periods that are tracked. Each irreducible
+ * factor multiplies the number of combinations by at most its multiplicity
+ * plus 1, but most combinations give the same period. */
+#define MAX_PERIODS         1024u
+
+#define MAX_FACTORS         32u
+
+
+/*****************************************************************************
+ * Typedefs
+ ****************************************************************************/
+
+/* Polynomial over GF(2). Bit i is the coefficient of x^i. */
+typedef uint64_t Poly_t;
+
+typedef struct
+{
+    Poly_t      poly;
+    unsigned    multiplicity;
+} PolyFactor_t;
+
+typedef struct
+{
+    uint64_t    period;
+    uint64_t    num_states;
+} PeriodCount_t;
+
+
+/*****************************************************************************
+ * Local functions -- integers
+ ****************************************************************************/
+
+static uint64_t gcd_uint64(uint64_t a, uint64_t b)
+{
+    uint64_t    temp;
+
+    while (b != 0)
+    {
+        temp = a % b;
+        a = b;
+        b = temp;
+    }
+    return a;
+}
+
+static uint64_t lcm_uint64(uint64_t a, uint64_t b)
+{
+    return a / gcd_uint64(a, b) * b;
+}
+
+
+/*****************************************************************************
+ * Local functions -- polynomials over GF(2)
+ ****************************************************************************/
+
+static int poly_degree(Poly_t a)
+{
+    int         degree = -1;
+
+    while (a != 0)
+    {
+        a >>= 1u;
+        degree++;
+    }
+    return degree;
+}
+
+/* The sum of the degrees must be less than 64. */
+static Poly_t poly_mul(Poly_t a, Poly_t b)
+{
+    Poly_t      result = 0;
+
+    while (b != 0)
+    {
+        if (b & 1u)
+            result ^= a;
+        a <<= 1u;
+        b >>= 1u;
+    }
+    return result;
+}
+
+static Poly_t poly_divmod(Poly_t a, Poly_t b, Poly_t * p_remainder)
+{
+    Poly_t      quotient = 0;
+    int         degree_b;
+    int         shift;
+
+    degree_b = poly_degree(b);
+    while ((shift = poly_degree(a) - degree_b) >= 0)
+    {
+        quotient ^= (Poly_t)1u << shift;
+        a ^= b << shift;
+    }
+    if (p_remainder != NULL)
+        *p_remainder = a;
+    return quotient;
+}
+
+static Poly_t poly_mod(Poly_t a, Poly_t b)
+{
+    Poly_t      remainder;
+
+    poly_divmod(a, b, &remainder);
+    return remainder;
+}
+
+static Poly_t poly_gcd(Poly_t a, Poly_t b)
+{
+    Poly_t      temp;
+
+    while (b != 0)
+    {
+        temp = poly_mod(a, b);
+        a = b;
+        b = temp;
+    }
+    return a;
+}
+
+/* The degree of the result must be less than 64. */
+static Poly_t poly_lcm(Poly_t a, Poly_t b)
+{
+    return poly_mul(poly_divmod(a, poly_gcd(a, b), NULL), b);
+}
+
+/* x^n modulo 'mod', for 'mod' of degree at most 32. */
+static Poly_t poly_x_pow_mod(uint64_t n, Poly_t mod)
+{
+    Poly_t      result = 1u;
+    Poly_t      x_exp;
+
+    x_exp = poly_mod(2u, mod);
+    while (n != 0)
+    {
+        if (n & 1u)
+            result = poly_mod(poly_mul(result, x_exp), mod);
+        x_exp = poly_mod(poly_mul(x_exp, x_exp), mod);
+        n >>= 1u;
+    }
+    return poly_mod(result, mod);
+}
+
+/* The order of x modulo an irreducible polynomial 'p', other than x itself.
+ * That is the smallest k with x^k = 1 modulo p, which divides 2^degree - 1. */
+static uint64_t poly_order(Poly_t p)
+{
+    uint64_t    group_order;
+    uint64_t    order;
+    uint64_t    n;
+    uint64_t    prime;
+
+    group_order = (UINT64_C(1) << poly_degree(p)) - 1u;
+    order = group_order;
+    n = group_order;
+    for (prime = 2u; n > 1u; prime++)
+    {
+        if (prime * prime > n)
+            prime = n;
+        if (n % prime == 0)
+        {
+            while (n % prime == 0)
+                n /= prime;
+            while (order % prime == 0 && poly_x_pow_mod(order / prime, p) == 1u)
+                order /= prime;
+        }
+    }
+    return order;
+}
+
+/* Factor 'a' into irreducible polynomials, by trial division. */
+static size_t poly_factor(Poly_t a, PolyFactor_t * p_factors)
+{
+    size_t      num_factors = 0;
+    Poly_t      divisor;
+    Poly_t      quotient;
+    Poly_t      remainder;
+
+    for (divisor = 2u; poly_degree(divisor) * 2 <= poly_degree(a); divisor++)
+    {
+        quotient = poly_divmod(a, divisor, &remainder);
+        if (remainder == 0)
+        {
+            /* 'divisor' is irreducible, since any smaller factors have already
+             * been divided out. */
+            p_factors[num_factors].poly = divisor;
+            p_factors[num_factors].multiplicity = 0;
+            do
+            {
+                a = quotient;
+                p_factors[num_factors].multiplicity++;
+                quotient = poly_divmod(a, divisor, &remainder);
+            } while (remainder == 0);
+            num_factors++;
+        }
+    }
+    if (poly_degree(a) > 0)
+    {
+        p_factors[num_factors].poly = a;
+        p_factors[num_factors].multiplicity = 1u;
+        num_factors++;
+    }
+    return num_factors;
+}
+
+static void poly_print(Poly_t a)
+{
+    int         i;
+    bool        first = true;
+
+    for (i = poly_degree(a); i >= 0; i--)
+    {
+        if ((a >> i) & 1u)
+        {
+            printf("%s", first ? "" : " + ");
+            if (i == 0)
+                printf("1");
+            else if (i == 1)
+                printf("x");
+            else
+                printf("x^%d", i);
+            first = false;
+        }
+    }
+}
+
+
+/*****************************************************************************
+ * Local functions -- matrices
+ ****************************************************************************/
+
+/* p(M), by Horner's method. */
+static void matrix_poly_eval(BitColumnMatrix32_t * p_result, Poly_t p, const BitColumnMatrix32_t * p_matrix)
+{
+    BitColumnMatrix32_t     unity;
+    int                     i;
+
+    bitcolumnmatrix32_unity(&unity);
+    memset(p_result, 0, sizeof(*p_result));
+    for (i = poly_degree(p); i >= 0; i--)
+    {
+        bitcolumnmatrix32_imul(p_result, p_matrix);
+        if ((p >> i) & 1u)
+            bitcolumnmatrix32_iadd(p_result, &unity);
+    }
+}
+
+/* The minimal polynomial of vector 'v' under M: the lowest-degree monic
+ * polynomial p with p(M) v = 0. The Krylov vectors M^k v are reduced against
+ * the earlier ones, keeping track of the polynomial that each reduced vector
+ * is of M applied to v, until one reduces to zero. */
+static Poly_t vector_min_poly(const BitColumnMatrix32_t * p_matrix, uint32_t v)
+{
+    uint32_t    basis[32u];
+    Poly_t      basis_poly[32u];
+    bool        basis_used[32u] = { false };
+    uint32_t    krylov = v;
+    uint32_t    w;
+    Poly_t      w_poly;
+    int         pivot;
+    unsigned    k;
+
+    for (k = 0; k <= 32u; k++)
+    {
+        w = krylov;
+        w_poly = (Poly_t)1u << k;
+        while (w != 0)
+        {
+            pivot = 31 - __builtin_clz(w);
+            if (!basis_used[pivot])
+                break;
+            w ^= basis[pivot];
+            w_poly ^= basis_poly[pivot];
+        }
+        if (w == 0)
+            return w_poly;
+        basis[pivot] = w;
+        basis_poly[pivot] = w_poly;
+        basis_used[pivot] = true;
+        krylov = bitcolumnmatrix32_mul_uint32(p_matrix, krylov);
+    }
+    /* Not reached: 33 vectors in a 32-dimensional space are dependent. */
+    return 0;
+}
+
+static Poly_t matrix_min_poly(const BitColumnMatrix32_t * p_matrix)
+{
+    Poly_t      min_poly = 1u;
+    unsigned    i;
+
+    for (i = 0; i < 32u; i++)
+    {
+        min_poly = poly_lcm(min_poly, vector_min_poly(p_matrix, UINT32_C(1) << i));
+    }
+    return min_poly;
+}
+
+
+/*****************************************************************************
+ * Local functions -- analysis
+ ****************************************************************************/
+
+static void analyse_matrix(const BitColumnMatrix32_t * p_matrix)
+{
+    BitColumnMatrix32_t     p_of_m;
+    BitColumnMatrix32_t     p_of_m_exp;
+    PolyFactor_t            factors[MAX_FACTORS];
+    PeriodCount_t           counts[MAX_PERIODS];
+    PeriodCount_t           new_counts[MAX_PERIODS];
+    size_t                  num_counts;
+    size_t                  num_new_counts;
+    size_t                  num_factors;
+    Poly_t                  min_poly;
+    uint64_t                order;
+    uint64_t                period;
+    uint64_t                num_states;
+    uint64_t                num_tail_states = 0;
+    uint64_t                matrix_period = 1u;
+    unsigned                kernel_dim;
+    unsigned                prev_kernel_dim;
+    unsigned                e;
+    size_t                  i;
+    size_t                  j;
+    size_t                  k;
+
+    printf("Matrix:\n    ");
+    for (i = 0; i < 32u; i++)
+    {
+        printf("0x%08" PRIX32 "%s", p_matrix->matrix[i], (i % 8u == 7u) ? (i == 31u ? "\n" : "\n    ") : " ");
+    }
+
+    min_poly = matrix_min_poly(p_matrix);
+    printf("Minimal polynomial:\n    ");
+    poly_print(min_poly);
+    printf("\n");
+
+    num_factors = poly_factor(min_poly, factors);
+    counts[0].period = 1u;
+    counts[0].num_states = 1u;
+    num_counts = 1u;
+    printf("Factors:\n");
+    for (i = 0; i < num_factors; i++)
+    {
+        printf("    (");
+        poly_print(factors[i].poly);
+        printf(")^%u", factors[i].multiplicity);
+
+        if (factors[i].poly == 2u)
+        {
+            /* p = x. Apart from zero, these states are on the tails. */
+            bitcolumnmatrix32_pow(&p_of_m_exp, p_matrix, factors[i].multiplicity);
+            kernel_dim = 32u - bitcolumnmatrix32_rank(&p_of_m_exp);
+            num_tail_states = (UINT64_C(1) << 32u) - (UINT64_C(1) << (32u - kernel_dim));
+            printf(", nilpotent, dimension %u\n", kernel_dim);
+            continue;
+        }
+        order = poly_order(factors[i].poly);
+        printf(", order %" PRIu64 "\n", order);
+
+        /* Kernel dimensions of p(M)^e, for e = 1 .. multiplicity. */
+        matrix_poly_eval(&p_of_m, factors[i].poly, p_matrix);
+        p_of_m_exp = p_of_m;
+        prev_kernel_dim = 0;
+
+        num_new_counts = 0;
+        for (e = 0; e <= factors[i].multiplicity; e++)
+        {
+            if (e == 0)
+            {
+                period = 1u;
+                num_states = 1u;
+            }
+            else
+            {
+                if (e > 1u)
+                    bitcolumnmatrix32_imul(&p_of_m_exp, &p_of_m);
+                kernel_dim = 32u - bitcolumnmatrix32_rank(&p_of_m_exp);
+                num_states = (UINT64_C(1) << kernel_dim) - (UINT64_C(1) << prev_kernel_dim);
+                prev_kernel_dim = kernel_dim;
+                for (period = order; (period / order) < e; period *= 2u)
+                    ;
+                printf("        annihilator ^%u: %" PRIu64 " states, period %" PRIu64 "\n", e, num_states, period);
+            }
+            /* Combine with the states of the factors so far. */
+            for (j = 0; j < num_counts; j++)
+            {
+                uint64_t    combined_period = lcm_uint64(counts[j].period, period);
+
+                for (k = 0; k < num_new_counts; k++)
+                {
+                    if (new_counts[k].period == combined_period)
+                        break;
+                }
+                if (k == num_new_counts)
+                {
+                    if (num_new_counts >= MAX_PERIODS)
+                    {
+                        fprintf(stderr, "Too many distinct periods\n");
+                        exit(EXIT_FAILURE);
+                    }
+                    new_counts[k].period = combined_period;
+                    new_counts[k].num_states = 0;
+                    num_new_counts++;
+                }
+                new_counts[k].num_states += counts[j].num_states * num_states;
+            }
+        }
+        memcpy(counts, new_counts, num_new_counts * sizeof(counts[0]));
+        num_counts = num_new_counts;
+    }
+
+    printf("Cycles:\n");
+    for (i = 0; i < num_counts; i++)
+    {
+        /* Sort by period. There are few, so a selection sort will do. */
+        for (j = i + 1u; j < num_counts; j++)
+        {
+            if (counts[j].period < counts[i].period)
+            {
+                PeriodCount_t   temp = counts[i];
+
+                counts[i] = counts[j];
+                counts[j] = temp;
+            }
+        }
+        printf("    Length %" PRIu64 ", %" PRIu64 " cycles\n", counts[i].period, counts[i].num_states / counts[i].period);
+        matrix_period = lcm_uint64(matrix_period, counts[i].period);
+    }
+    printf("Period of the matrix: %" PRIu64 "\n", matrix_period);
+    printf("States not on a cycle: %" PRIu64 "\n", num_tail_states);
+}
+
+static void print_usage(const char * p_program)
+{
+    size_t      i;
+
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "    %s xorshift <a> <b> <c>\n", p_program);
+    fprintf(stderr, "    %s lfsr <s1> <s2> <s3> <mask_bits>\n", p_program);
+    fprintf(stderr, "    %s matrix <c0> <c1> ... <c31>\n", p_program);
+    fprintf(stderr, "    %s <name>\n", p_program);
+    fprintf(stderr, "Names:");
+    for (i = 0; i < num_matrix_specs; i++)
+    {
+        fprintf(stderr, " %s", matrix_specs[i].p_name);
+    }
+    fprintf(stderr, "\n");
+}
+
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    BitColumnMatrix32_t     matrix;
+    const MatrixSpec_t *    p_spec;
+    int_fast8_t             shifts[3];
+    size_t                  i;
+
+    if (argc == 5 && strcmp(argv[1], "xorshift") == 0)
+    {
+        for (i = 0; i < 3u; i++)
+            shifts[i] = (int_fast8_t)atoi(argv[2 + i]);
+        make_xorshift_matrix(&matrix, shifts);
+    }
+    else if (argc == 6 && strcmp(argv[1], "lfsr") == 0)
+    {
+        for (i = 0; i < 3u; i++)
+            shifts[i] = (int_fast8_t)atoi(argv[2 + i]);
+        make_lfsr_matrix(&matrix, shifts, (uint_fast8_t)atoi(argv[5]));
+    }
+    else if (argc == 34 && strcmp(argv[1], "matrix") == 0)
+    {
+        for (i = 0; i < 32u; i++)
+            matrix.matrix[i] = (uint32_t)strtoul(argv[2 + i], NULL, 0);
+    }
+    else if (argc == 2 && (p_spec = find_matrix_spec(argv[1])) != NULL)
+    {
+        make_spec_matrix(&matrix, p_spec);
+    }
+    else
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    analyse_matrix(&matrix);
+    return EXIT_SUCCESS;
+}